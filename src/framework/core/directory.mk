@@ -8,6 +8,7 @@ FW_SOURCES += \
 	core/op_event_loop_utils.c \
 	core/op_init.c \
 	core/op_log.c \
+	core/op_log_record.c \
 	core/op_modules.c \
 	core/op_options.c \
 	core/op_plugins.cpp \
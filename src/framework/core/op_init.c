@@ -36,6 +36,8 @@ void op_init(void* context, int argc, char* argv[])
      */
     enum op_log_level log_level = op_log_level_find(argc, argv);
     op_log_level_set(log_level == OP_LOG_NONE ? OP_LOG_INFO : log_level);
+    bool log_binary = op_log_binary_find(argc, argv);
+    op_log_binary_set(log_binary);
     if (op_log_init(context, NULL) != 0) {
         op_exit("Logging initialization failed!");
     }
@@ -65,6 +67,15 @@ void op_init(void* context, int argc, char* argv[])
         }
     }
 
+    if (!log_binary) {
+        char arg_string[8];
+        if (op_config_file_get_value_str(
+                "core.log.binary", arg_string, sizeof(arg_string))) {
+            op_log_binary_set(strncmp(arg_string, "true", sizeof(arg_string))
+                              == 0);
+        }
+    }
+
     /* Parse system options */
     if (op_options_init() != 0 || op_options_parse(argc, argv) != 0) {
         op_exit("Option parsing failed!");
@@ -2,6 +2,7 @@
 #include <ctype.h>
 #include <getopt.h>
 #include <pthread.h>
+#include <stdalign.h>
 #include <stdarg.h>
 #include <stdatomic.h>
 #include <stdlib.h>
@@ -16,6 +17,7 @@
 #include "core/op_event_loop.h"
 #include "core/op_list.h"
 #include "core/op_log.h"
+#include "core/op_log_record.h"
 #include "core/op_options.h"
 #include "core/op_socket.h"
 #include "core/op_thread.h"
@@ -24,6 +26,7 @@ static const char* op_log_endpoint = "inproc://op_logging";
 
 static void* op_log_context;
 static enum op_log_level op_log_level;
+static bool op_log_binary;
 
 static struct op_list* _thread_log_sockets = NULL;
 static __thread void* _log_socket = NULL;
@@ -44,6 +47,52 @@ struct op_log_message
     uint32_t length;            /**< Length of the message (bytes) */
 };
 
+/*
+ * In binary mode, threads write log records to a private, single producer,
+ * single consumer ring instead of formatting messages and sending them to
+ * the logging thread.  The logging thread periodically drains all rings
+ * and does the formatting.  If a ring is full, the record is dropped and
+ * counted; logging never blocks the caller.
+ */
+#define OP_LOG_RING_SIZE (64 * 1024)
+#define OP_LOG_RING_POLL_NS (10 * 1000 * 1000) /* 10 ms */
+#define OP_LOG_RECORD_ALIGN 8
+#define OP_LOG_MESSAGE_MAX_LENGTH 1024
+#define CACHE_LINE_SIZE 64
+
+/**
+ * Binary log record header; the encoded arguments immediately follow
+ */
+struct op_log_record
+{
+    uint32_t length;         /**< Record length, including args; 0 == wrap */
+    uint32_t args_length;    /**< Length of the encoded args */
+    enum op_log_level level; /**< The record's log level */
+    time_t time;             /**< Time sender logged record */
+    const char* signature;   /**< Sender's function signature */
+    const char* format;      /**< Sender's format string */
+    uint8_t args[];
+};
+
+struct op_log_ring
+{
+    struct op_log_ring* next;   /**< Next ring in the global ring list */
+    atomic_bool in_use;         /**< Set when a thread owns the ring */
+    char thread[THREAD_LENGTH]; /**< Owner's thread name */
+    size_t dropped_reported;    /**< Drop count last reported; reader only */
+    alignas(CACHE_LINE_SIZE) atomic_size_t write_count; /**< writer only */
+    atomic_size_t dropped;                              /**< writer only */
+    alignas(CACHE_LINE_SIZE) atomic_size_t read_count;  /**< reader only */
+    alignas(CACHE_LINE_SIZE) uint8_t data[OP_LOG_RING_SIZE];
+};
+
+/*
+ * Rings are never removed from this list; threads release their ring
+ * on exit so that new threads can reuse it.
+ */
+static _Atomic(struct op_log_ring*) _log_rings = NULL;
+static __thread struct op_log_ring* _log_ring = NULL;
+
 /**
  * Simple function to free strings that get logged via ZeroMQ;
  */
@@ -94,6 +143,19 @@ void op_log_level_set(enum op_log_level level)
     if ((OP_LOG_NONE <= level) && (level <= OP_LOG_MAX)) op_log_level = level;
 }
 
+bool op_log_binary_get(void) { return (op_log_binary); }
+
+void op_log_binary_set(bool enable) { op_log_binary = enable; }
+
+bool op_log_binary_find(int argc, char* const argv[])
+{
+    for (int idx = 0; idx < argc; idx++) {
+        if (strcmp(argv[idx], "--core.log.binary") == 0) { return (true); }
+    }
+
+    return (false);
+}
+
 enum op_log_level parse_log_optarg(const char* arg)
 {
     /* Check for a number */
@@ -252,11 +314,151 @@ static void* get_thread_log_socket(void)
  */
 void op_log_close(void)
 {
+    if (_log_ring) {
+        atomic_store_explicit(&_log_ring->in_use, false, memory_order_release);
+        _log_ring = NULL;
+    }
+
     if (_log_socket == NULL) return;
 
     if (op_list_clear(_thread_log_sockets, _log_socket)) { _log_socket = NULL; }
 }
 
+/**
+ * Retrieve the logging ring for the calling thread.
+ * If we don't have one, then claim an unused ring or create a new one.
+ */
+static struct op_log_ring* get_thread_log_ring(void)
+{
+    if (_log_ring) { return (_log_ring); }
+
+    struct op_log_ring* ring = atomic_load(&_log_rings);
+    while (ring) {
+        bool expected = false;
+        if (atomic_compare_exchange_strong(&ring->in_use, &expected, true)) {
+            /*
+             * The ring's thread name labels every record in it, so don't
+             * take it over until the previous owner's records are gone.
+             */
+            if (atomic_load_explicit(&ring->read_count, memory_order_acquire)
+                == atomic_load_explicit(&ring->write_count,
+                                        memory_order_relaxed)) {
+                break;
+            }
+            atomic_store_explicit(&ring->in_use, false, memory_order_release);
+        }
+        ring = ring->next;
+    }
+
+    if (!ring) {
+        ring = aligned_alloc(CACHE_LINE_SIZE, sizeof(*ring));
+        if (!ring) { return (NULL); }
+        memset(ring, 0, sizeof(*ring));
+        atomic_init(&ring->in_use, true);
+        atomic_init(&ring->write_count, 0);
+        atomic_init(&ring->dropped, 0);
+        atomic_init(&ring->read_count, 0);
+
+        ring->next = atomic_load(&_log_rings);
+        while (!atomic_compare_exchange_weak(&_log_rings, &ring->next, ring))
+            ;
+    }
+
+    /* Thread names are generally set at startup, so just look it up once */
+    if (op_thread_getname(pthread_self(), ring->thread) != 0) {
+        strncpy(ring->thread, "unknown", THREAD_LENGTH);
+    }
+
+    _log_ring = ring;
+    return (ring);
+}
+
+/**
+ * Find space for a record of the specified length in the ring.
+ * Returns a pointer to the space and the write count that should be
+ * published once the record has been written, or NULL if the ring is full.
+ */
+static struct op_log_record*
+log_ring_reserve(struct op_log_ring* ring, size_t length, size_t* write_count)
+{
+    size_t write =
+        atomic_load_explicit(&ring->write_count, memory_order_relaxed);
+    size_t read = atomic_load_explicit(&ring->read_count, memory_order_acquire);
+    size_t offset = write % OP_LOG_RING_SIZE;
+    size_t contiguous = OP_LOG_RING_SIZE - offset;
+
+    /* Records never wrap; skip the tail of the ring if necessary */
+    size_t needed = (contiguous < length ? contiguous + length : length);
+    if (OP_LOG_RING_SIZE - (write - read) < needed) { return (NULL); }
+
+    if (contiguous < length) {
+        /* Mark the end of the ring so the reader knows to skip it */
+        ((struct op_log_record*)(ring->data + offset))->length = 0;
+        write += contiguous;
+        offset = 0;
+    }
+
+    *write_count = write + length;
+    return ((struct op_log_record*)(ring->data + offset));
+}
+
+int op_log_record(enum op_log_level level,
+                  const char* signature,
+                  const char* format,
+                  ...)
+{
+    if (!atomic_load_explicit(&_log_thread_ready, memory_order_relaxed))
+        return (0);
+
+    if (level > op_log_level) /* Nothing to do */
+        return (0);
+
+    uint8_t args[OP_LOG_RECORD_MAX_ARGS_LENGTH];
+    struct op_log_ring* ring = get_thread_log_ring();
+
+    va_list argp, encode_argp;
+    va_start(argp, format);
+    va_copy(encode_argp, argp);
+    int args_length =
+        (ring ? op_log_record_encode(args, sizeof(args), format, encode_argp)
+              : -1);
+    va_end(encode_argp);
+
+    if (args_length < 0) {
+        /* Can't defer formatting for this one; do it the slow way */
+        char function[strlen(signature) + 1];
+        op_log_function_name(signature, function);
+        int error = op_vlog(level, function, format, argp);
+        va_end(argp);
+        return (error);
+    }
+    va_end(argp);
+
+    size_t length = (sizeof(struct op_log_record) + args_length
+                     + OP_LOG_RECORD_ALIGN - 1)
+                    & ~(size_t)(OP_LOG_RECORD_ALIGN - 1);
+    size_t write_count = 0;
+    struct op_log_record* record =
+        log_ring_reserve(ring, length, &write_count);
+    if (!record) {
+        atomic_fetch_add_explicit(&ring->dropped, 1, memory_order_relaxed);
+        return (-1);
+    }
+
+    record->length = length;
+    record->args_length = args_length;
+    record->level = level;
+    record->signature = signature;
+    record->format = format;
+    time(&record->time);
+    memcpy(record->args, args, args_length);
+
+    atomic_store_explicit(
+        &ring->write_count, write_count, memory_order_release);
+
+    return (0);
+}
+
 /**
  * Take a message from an arbitrary context and send it to the logging
  * thread.  Not sure what to do about errors in this function, as the
@@ -411,6 +613,93 @@ static int handle_message(const struct op_event_data* data, void* socket)
     return ((recv_or_err < 0 && errno == ETERM) ? -1 : 0);
 }
 
+static void log_ring_write_record(const struct op_log_ring* ring,
+                                  const struct op_log_record* record,
+                                  void* socket)
+{
+    char message[OP_LOG_MESSAGE_MAX_LENGTH];
+    int length = op_log_record_decode(message,
+                                      sizeof(message),
+                                      record->format,
+                                      record->args,
+                                      record->args_length);
+    if (length < 0) {
+        op_safe_log("Logging message lost!  Could not decode log record\n");
+        return;
+    }
+
+    char tag[strlen(record->signature) + 1];
+    op_log_function_name(record->signature, tag);
+
+    struct op_log_message log = {
+        .time = record->time,
+        .tag = tag,
+        .message = message,
+        .level = record->level,
+        .length = length,
+    };
+    strncpy(log.thread, ring->thread, THREAD_LENGTH);
+
+    op_log_write(&log, stdout, socket);
+}
+
+static void log_ring_drain(struct op_log_ring* ring, void* socket)
+{
+    size_t read = atomic_load_explicit(&ring->read_count, memory_order_relaxed);
+    size_t write =
+        atomic_load_explicit(&ring->write_count, memory_order_acquire);
+
+    while (read != write) {
+        size_t offset = read % OP_LOG_RING_SIZE;
+        const struct op_log_record* record =
+            (const struct op_log_record*)(ring->data + offset);
+        if (record->length == 0) {
+            read += OP_LOG_RING_SIZE - offset;
+        } else {
+            log_ring_write_record(ring, record, socket);
+            read += record->length;
+        }
+        atomic_store_explicit(&ring->read_count, read, memory_order_release);
+    }
+
+    size_t dropped = atomic_load_explicit(&ring->dropped, memory_order_relaxed);
+    if (dropped != ring->dropped_reported) {
+        char message[64];
+        struct op_log_message log = {
+            .tag = "op_log",
+            .message = message,
+            .level = OP_LOG_WARNING,
+            .length = snprintf(message,
+                               sizeof(message),
+                               "%zu log messages dropped",
+                               dropped - ring->dropped_reported),
+        };
+        strncpy(log.thread, ring->thread, THREAD_LENGTH);
+        time(&log.time);
+        op_log_write(&log, stdout, socket);
+        ring->dropped_reported = dropped;
+    }
+}
+
+static void log_rings_drain(void* socket)
+{
+    for (struct op_log_ring* ring = atomic_load(&_log_rings); ring != NULL;
+         ring = ring->next) {
+        log_ring_drain(ring, socket);
+    }
+}
+
+/**
+ * Periodic callback for draining all logging rings
+ */
+static int handle_rings(const struct op_event_data* data
+                        __attribute__((unused)),
+                        void* socket)
+{
+    log_rings_drain(socket);
+    return (0);
+}
+
 /**
  * Structure for sending initial arguments to the logging thread
  */
@@ -459,6 +748,18 @@ void* op_log_task(void* void_args)
     int error = op_event_loop_add(loop, messages, &callbacks, external);
     if (error) op_exit("Could not add callack to event loop\n");
 
+    /*
+     * Binary mode might be enabled after we start, so always poll the
+     * rings; this is cheap when there aren't any.
+     */
+    struct op_event_callbacks ring_callbacks = {
+        .on_timeout = handle_rings,
+    };
+    uint64_t ring_poll_ns = OP_LOG_RING_POLL_NS;
+
+    error = op_event_loop_add(loop, ring_poll_ns, &ring_callbacks, external);
+    if (error) op_exit("Could not add ring timer to event loop\n");
+
     /*
      * Create a list for storing thread local log sockets.  We will need to
      * close them all when we exit.
@@ -482,6 +783,9 @@ void* op_log_task(void* void_args)
 
     atomic_store(&_log_thread_ready, false);
 
+    /* Write out anything left in the rings */
+    log_rings_drain(external);
+
     zmq_close(messages);
     if (external) zmq_close(external);
 
@@ -562,6 +866,10 @@ static struct op_options_data log_level_option = {
          "core.log.level",
          'l',
          OP_OPTION_TYPE_STRING},
+        {"Defer formatting of log messages to the logging thread",
+         "core.log.binary",
+         0,
+         OP_OPTION_TYPE_NONE},
         {0, 0, 0, 0},
     }};
 
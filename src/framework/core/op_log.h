@@ -7,6 +7,7 @@ extern "C" {
 #endif
 
 #include <stdarg.h>
+#include <stdbool.h>
 #include <stdint.h>
 #include <string.h>
 
@@ -50,6 +51,39 @@ void op_log_level_set(enum op_log_level level);
  */
 enum op_log_level op_log_level_find(int argc, char* const argv[]);
 
+/**
+ * Check whether binary logging is enabled
+ *
+ * @return
+ *   true if log formatting is deferred to the logging thread
+ */
+bool op_log_binary_get(void) __attribute__((pure));
+
+/**
+ * Enable or disable binary logging
+ *
+ * In binary mode, threads write a copy of the format string pointer and
+ * arguments to a per-thread ring and the logging thread formats them.
+ * Messages are dropped, rather than blocking, if a ring is full.
+ *
+ * @param enable
+ *   true to enable binary logging, false to disable
+ */
+void op_log_binary_set(bool enable);
+
+/**
+ * Retrieve the binary logging flag from the command line
+ *
+ * @param[in] argc
+ *   The number of cli arguments
+ * @param[in] argv
+ *   Array of cli strings
+ *
+ * @return
+ *   true if binary logging was requested, false otherwise
+ */
+bool op_log_binary_find(int argc, char* const argv[]);
+
 /**
  * Maximum length (in chars) of an OP log level value.
  */
@@ -92,9 +126,14 @@ void op_log_function_name(const char* signature, char* function);
 #define OP_LOG(level, format, ...)                                             \
     do {                                                                       \
         if (level <= op_log_level_get()) {                                     \
-            char function_[strlen(__PRETTY_FUNCTION__)];                       \
-            op_log_function_name(__PRETTY_FUNCTION__, function_);              \
-            op_log(level, function_, format, ##__VA_ARGS__);                   \
+            if (op_log_binary_get() && __builtin_constant_p(format)) {         \
+                op_log_record(                                                 \
+                    level, __PRETTY_FUNCTION__, format, ##__VA_ARGS__);        \
+            } else {                                                           \
+                char function_[strlen(__PRETTY_FUNCTION__)];                   \
+                op_log_function_name(__PRETTY_FUNCTION__, function_);          \
+                op_log(level, function_, format, ##__VA_ARGS__);               \
+            }                                                                  \
         }                                                                      \
     } while (0)
 
@@ -119,6 +158,28 @@ int op_vlog(enum op_log_level level,
             const char* format,
             va_list argp);
 
+/**
+ * Write a binary record to the calling thread's log ring
+ *
+ * The logging thread formats the record later, so format and signature
+ * must remain valid for the life of the program, e.g. string literals.
+ * Formats that can't be deferred are logged via op_vlog instead.
+ *
+ * @param level
+ *   The level of the message
+ * @param signature
+ *   The caller's full function signature
+ * @param format
+ *   The printf format string, followed by variable arguments
+ * @return
+ *   -  0: Success
+ *   - !0: Error; the message was dropped
+ */
+int op_log_record(enum op_log_level level,
+                  const char* signature,
+                  const char* format,
+                  ...) __attribute__((format(printf, 3, 4)));
+
 /**
  * Explicit close the logging socket of the calling thread.
  */
@@ -0,0 +1,490 @@
+#include <assert.h>
+#include <ctype.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "core/op_common.h"
+#include "core/op_log_record.h"
+
+/*
+ * Encoded arguments are stored in 8 byte slots in the same order as they
+ * appear in the format string.  Strings are stored as a length slot followed
+ * by the null terminated string data.
+ */
+#define SLOT_SIZE 8
+
+/* Long enough for any sane conversion specification */
+#define MAX_SPEC_LENGTH 64
+
+enum op_log_arg_type {
+    OP_LOG_ARG_NONE = 0, /**< literal '%' */
+    OP_LOG_ARG_INT,
+    OP_LOG_ARG_LONG,
+    OP_LOG_ARG_LLONG,
+    OP_LOG_ARG_INTMAX,
+    OP_LOG_ARG_SIZE,
+    OP_LOG_ARG_PTRDIFF,
+    OP_LOG_ARG_DOUBLE,
+    OP_LOG_ARG_LDOUBLE,
+    OP_LOG_ARG_STRING,
+    OP_LOG_ARG_POINTER,
+    OP_LOG_ARG_UNSUPPORTED,
+};
+
+enum op_log_arg_length {
+    OP_LOG_LENGTH_NONE = 0,
+    OP_LOG_LENGTH_CHAR,
+    OP_LOG_LENGTH_SHORT,
+    OP_LOG_LENGTH_LONG,
+    OP_LOG_LENGTH_LLONG,
+    OP_LOG_LENGTH_INTMAX,
+    OP_LOG_LENGTH_SIZE,
+    OP_LOG_LENGTH_PTRDIFF,
+    OP_LOG_LENGTH_LDOUBLE,
+};
+
+/**
+ * Structure describing a single conversion specification
+ */
+struct op_log_spec
+{
+    const char* begin;         /**< points to the '%' */
+    const char* end;           /**< points past the conversion character */
+    unsigned stars;            /**< number of '*' width/precision args */
+    bool star_precision;       /**< precision is the last '*' arg */
+    int precision;             /**< literal precision; -1 if none */
+    enum op_log_arg_type type; /**< type of the converted argument */
+};
+
+static enum op_log_arg_type
+integer_type(enum op_log_arg_length length, char conversion)
+{
+    switch (length) {
+    case OP_LOG_LENGTH_NONE:
+    case OP_LOG_LENGTH_CHAR:
+    case OP_LOG_LENGTH_SHORT:
+        return (OP_LOG_ARG_INT);
+    case OP_LOG_LENGTH_LONG:
+        /* %lc is a wide character */
+        return (conversion == 'c' ? OP_LOG_ARG_UNSUPPORTED : OP_LOG_ARG_LONG);
+    case OP_LOG_LENGTH_LLONG:
+        return (OP_LOG_ARG_LLONG);
+    case OP_LOG_LENGTH_INTMAX:
+        return (OP_LOG_ARG_INTMAX);
+    case OP_LOG_LENGTH_SIZE:
+        return (OP_LOG_ARG_SIZE);
+    case OP_LOG_LENGTH_PTRDIFF:
+        return (OP_LOG_ARG_PTRDIFF);
+    default:
+        return (OP_LOG_ARG_UNSUPPORTED);
+    }
+}
+
+/**
+ * Parse the conversion specification starting at cursor
+ */
+static void parse_spec(const char* cursor, struct op_log_spec* spec)
+{
+    assert(*cursor == '%');
+
+    spec->begin = cursor++;
+    spec->stars = 0;
+    spec->star_precision = false;
+    spec->precision = -1;
+
+    /* Flags */
+    while (*cursor && strchr("-+ #0'", *cursor)) cursor++;
+
+    /* Width */
+    if (*cursor == '*') {
+        spec->stars++;
+        cursor++;
+    } else {
+        while (isdigit(*cursor)) cursor++;
+    }
+
+    /* Precision */
+    if (*cursor == '.') {
+        cursor++;
+        if (*cursor == '*') {
+            spec->stars++;
+            spec->star_precision = true;
+            cursor++;
+        } else {
+            /* A lone '.' means a precision of zero */
+            spec->precision = 0;
+            while (isdigit(*cursor)) {
+                spec->precision = spec->precision * 10 + (*cursor - '0');
+                cursor++;
+            }
+        }
+    }
+
+    /* Length modifier */
+    enum op_log_arg_length length = OP_LOG_LENGTH_NONE;
+    switch (*cursor) {
+    case 'h':
+        length = (cursor[1] == 'h' ? OP_LOG_LENGTH_CHAR : OP_LOG_LENGTH_SHORT);
+        cursor += (length == OP_LOG_LENGTH_CHAR ? 2 : 1);
+        break;
+    case 'l':
+        length = (cursor[1] == 'l' ? OP_LOG_LENGTH_LLONG : OP_LOG_LENGTH_LONG);
+        cursor += (length == OP_LOG_LENGTH_LLONG ? 2 : 1);
+        break;
+    case 'q':
+        length = OP_LOG_LENGTH_LLONG;
+        cursor++;
+        break;
+    case 'j':
+        length = OP_LOG_LENGTH_INTMAX;
+        cursor++;
+        break;
+    case 'z':
+        length = OP_LOG_LENGTH_SIZE;
+        cursor++;
+        break;
+    case 't':
+        length = OP_LOG_LENGTH_PTRDIFF;
+        cursor++;
+        break;
+    case 'L':
+        length = OP_LOG_LENGTH_LDOUBLE;
+        cursor++;
+        break;
+    default:
+        break;
+    }
+
+    /* Conversion */
+    char conversion = *cursor;
+    spec->end = (conversion ? cursor + 1 : cursor);
+
+    switch (conversion) {
+    case '%':
+        spec->type = OP_LOG_ARG_NONE;
+        break;
+    case 'd':
+    case 'i':
+    case 'u':
+    case 'o':
+    case 'x':
+    case 'X':
+    case 'c':
+        spec->type = integer_type(length, conversion);
+        break;
+    case 'f':
+    case 'F':
+    case 'e':
+    case 'E':
+    case 'g':
+    case 'G':
+    case 'a':
+    case 'A':
+        spec->type = (length == OP_LOG_LENGTH_LDOUBLE ? OP_LOG_ARG_LDOUBLE
+                                                      : OP_LOG_ARG_DOUBLE);
+        break;
+    case 's':
+        /* %ls is a wide string */
+        spec->type = (length == OP_LOG_LENGTH_NONE ? OP_LOG_ARG_STRING
+                                                   : OP_LOG_ARG_UNSUPPORTED);
+        break;
+    case 'p':
+        spec->type = OP_LOG_ARG_POINTER;
+        break;
+    default:
+        /* Includes %n, %m, and truncated specifications */
+        spec->type = OP_LOG_ARG_UNSUPPORTED;
+        break;
+    }
+}
+
+static size_t slot_length(size_t length)
+{
+    return ((length + SLOT_SIZE - 1) & ~(size_t)(SLOT_SIZE - 1));
+}
+
+static bool push_arg(uint8_t buffer[],
+                     size_t length,
+                     size_t* offset,
+                     const void* value,
+                     size_t value_length)
+{
+    if (*offset + slot_length(value_length) > length) { return (false); }
+
+    memcpy(buffer + *offset, value, value_length);
+    *offset += slot_length(value_length);
+    return (true);
+}
+
+static bool pop_arg(const uint8_t args[],
+                    size_t length,
+                    size_t* offset,
+                    void* value,
+                    size_t value_length)
+{
+    if (*offset + slot_length(value_length) > length) { return (false); }
+
+    memcpy(value, args + *offset, value_length);
+    *offset += slot_length(value_length);
+    return (true);
+}
+
+/*
+ * Strings with a precision need not be null terminated, so never read
+ * more than precision characters of them.  A negative precision means
+ * there isn't one.
+ */
+static bool push_string(uint8_t buffer[],
+                        size_t length,
+                        size_t* offset,
+                        const char* value,
+                        int precision)
+{
+    if (!value) { value = "(null)"; }
+
+    size_t string_length =
+        (precision < 0 ? strlen(value) : strnlen(value, precision));
+    uint64_t value_length = string_length + 1;
+    if (*offset + SLOT_SIZE + slot_length(value_length) > length) {
+        return (false);
+    }
+
+    push_arg(buffer, length, offset, &value_length, sizeof(value_length));
+    memcpy(buffer + *offset, value, string_length);
+    buffer[*offset + string_length] = '\0';
+    *offset += slot_length(value_length);
+    return (true);
+}
+
+static const char*
+pop_string(const uint8_t args[], size_t length, size_t* offset)
+{
+    uint64_t value_length = 0;
+    if (!pop_arg(args, length, offset, &value_length, sizeof(value_length))
+        || value_length == 0
+        || *offset + slot_length(value_length) > length) {
+        return (NULL);
+    }
+
+    const char* value = (const char*)(args + *offset);
+    if (value[value_length - 1] != '\0') { return (NULL); }
+
+    *offset += slot_length(value_length);
+    return (value);
+}
+
+#define PUSH_VA_ARG(type)                                                      \
+    do {                                                                       \
+        type value_ = va_arg(argp, type);                                      \
+        if (!push_arg(buffer, length, &offset, &value_, sizeof(value_))) {     \
+            return (-1);                                                       \
+        }                                                                      \
+    } while (0)
+
+int op_log_record_encode(uint8_t buffer[],
+                         size_t length,
+                         const char* format,
+                         va_list argp)
+{
+    struct op_log_spec spec;
+    size_t offset = 0;
+
+    for (const char* cursor = strchr(format, '%'); cursor != NULL;
+         cursor = strchr(spec.end, '%')) {
+        parse_spec(cursor, &spec);
+
+        int precision = spec.precision;
+        for (unsigned i = 0; i < spec.stars; i++) {
+            int value = va_arg(argp, int);
+            if (!push_arg(buffer, length, &offset, &value, sizeof(value))) {
+                return (-1);
+            }
+            /* Any '*' precision always follows a '*' width */
+            if (spec.star_precision && i == spec.stars - 1) {
+                precision = value;
+            }
+        }
+
+        switch (spec.type) {
+        case OP_LOG_ARG_NONE:
+            break;
+        case OP_LOG_ARG_INT:
+            PUSH_VA_ARG(int);
+            break;
+        case OP_LOG_ARG_LONG:
+            PUSH_VA_ARG(long);
+            break;
+        case OP_LOG_ARG_LLONG:
+            PUSH_VA_ARG(long long);
+            break;
+        case OP_LOG_ARG_INTMAX:
+            PUSH_VA_ARG(intmax_t);
+            break;
+        case OP_LOG_ARG_SIZE:
+            PUSH_VA_ARG(size_t);
+            break;
+        case OP_LOG_ARG_PTRDIFF:
+            PUSH_VA_ARG(ptrdiff_t);
+            break;
+        case OP_LOG_ARG_DOUBLE:
+            PUSH_VA_ARG(double);
+            break;
+        case OP_LOG_ARG_LDOUBLE:
+            PUSH_VA_ARG(long double);
+            break;
+        case OP_LOG_ARG_POINTER:
+            PUSH_VA_ARG(void*);
+            break;
+        case OP_LOG_ARG_STRING:
+            if (!push_string(buffer,
+                             length,
+                             &offset,
+                             va_arg(argp, const char*),
+                             precision)) {
+                return (-1);
+            }
+            break;
+        default:
+            return (-1);
+        }
+    }
+
+    return (offset);
+}
+
+#undef PUSH_VA_ARG
+
+/**
+ * Append up to count characters of src to the message, truncating as needed.
+ */
+static void append(char message[],
+                   size_t length,
+                   size_t* used,
+                   const char* src,
+                   size_t count)
+{
+    size_t to_copy = op_min(count, length - 1 - *used);
+    memcpy(message + *used, src, to_copy);
+    *used += to_copy;
+    message[*used] = '\0';
+}
+
+/**
+ * Copy the conversion specification to spec_format, replacing any '*'
+ * with the width/precision argument.
+ */
+static bool resolve_spec(char spec_format[],
+                         const struct op_log_spec* spec,
+                         const uint8_t args[],
+                         size_t args_length,
+                         size_t* offset)
+{
+    size_t used = 0;
+    for (const char* cursor = spec->begin; cursor < spec->end; cursor++) {
+        if (*cursor == '*') {
+            int value = 0;
+            if (!pop_arg(args, args_length, offset, &value, sizeof(value))) {
+                return (false);
+            }
+            int n = snprintf(
+                spec_format + used, MAX_SPEC_LENGTH - used, "%d", value);
+            if (n < 0 || used + n >= MAX_SPEC_LENGTH) { return (false); }
+            used += n;
+        } else {
+            if (used + 1 >= MAX_SPEC_LENGTH) { return (false); }
+            spec_format[used++] = *cursor;
+        }
+    }
+    spec_format[used] = '\0';
+    return (true);
+}
+
+#define FORMAT_ARG(type)                                                       \
+    do {                                                                       \
+        type value_;                                                           \
+        if (!pop_arg(args, args_length, &offset, &value_, sizeof(value_))) {   \
+            return (-1);                                                       \
+        }                                                                      \
+        n = snprintf(message + used, length - used, spec_format, value_);      \
+    } while (0)
+
+int op_log_record_decode(char message[],
+                         size_t length,
+                         const char* format,
+                         const uint8_t args[],
+                         size_t args_length)
+{
+    assert(length);
+
+    struct op_log_spec spec;
+    char spec_format[MAX_SPEC_LENGTH];
+    size_t offset = 0, used = 0;
+    const char* literal = format;
+
+    message[0] = '\0';
+
+    for (const char* cursor = strchr(format, '%'); cursor != NULL;
+         cursor = strchr(spec.end, '%')) {
+        parse_spec(cursor, &spec);
+        append(message, length, &used, literal, cursor - literal);
+        literal = spec.end;
+
+        if (spec.type == OP_LOG_ARG_NONE) {
+            append(message, length, &used, "%", 1);
+            continue;
+        }
+
+        if (!resolve_spec(spec_format, &spec, args, args_length, &offset)) {
+            return (-1);
+        }
+
+        int n = 0;
+        switch (spec.type) {
+        case OP_LOG_ARG_INT:
+            FORMAT_ARG(int);
+            break;
+        case OP_LOG_ARG_LONG:
+            FORMAT_ARG(long);
+            break;
+        case OP_LOG_ARG_LLONG:
+            FORMAT_ARG(long long);
+            break;
+        case OP_LOG_ARG_INTMAX:
+            FORMAT_ARG(intmax_t);
+            break;
+        case OP_LOG_ARG_SIZE:
+            FORMAT_ARG(size_t);
+            break;
+        case OP_LOG_ARG_PTRDIFF:
+            FORMAT_ARG(ptrdiff_t);
+            break;
+        case OP_LOG_ARG_DOUBLE:
+            FORMAT_ARG(double);
+            break;
+        case OP_LOG_ARG_LDOUBLE:
+            FORMAT_ARG(long double);
+            break;
+        case OP_LOG_ARG_POINTER:
+            FORMAT_ARG(void*);
+            break;
+        case OP_LOG_ARG_STRING: {
+            const char* value = pop_string(args, args_length, &offset);
+            if (!value) { return (-1); }
+            n = snprintf(message + used, length - used, spec_format, value);
+            break;
+        }
+        default:
+            return (-1);
+        }
+
+        if (n < 0) { return (-1); }
+        used = op_min(used + n, length - 1);
+    }
+
+    append(message, length, &used, literal, strlen(literal));
+
+    return (used);
+}
+
+#undef FORMAT_ARG
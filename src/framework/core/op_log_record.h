@@ -0,0 +1,74 @@
+#ifndef _OP_LOG_RECORD_H_
+#define _OP_LOG_RECORD_H_
+
+/*
+ * Binary log records store the printf format string and a raw copy of the
+ * arguments.  Formatting is deferred to the logging thread, so the logging
+ * thread can decode records long after the caller has moved on.  Hence,
+ * format strings must be string literals and strings are copied.
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * Maximum size (in bytes) of the encoded arguments for a single record.
+ */
+#define OP_LOG_RECORD_MAX_ARGS_LENGTH 512
+
+/**
+ * Copy the arguments for format into a buffer
+ *
+ * @param[out] buffer
+ *   Buffer for encoded arguments
+ * @param[in] length
+ *   Length of buffer (bytes)
+ * @param[in] format
+ *   The printf format string describing the arguments
+ * @param[in] argp
+ *   The arguments to encode
+ *
+ * @return
+ *   - >= 0: the length of the encoded arguments
+ *   -   -1: the arguments don't fit in the buffer or format contains
+ *           conversions that can't be deferred, e.g. %n, %m, or wide strings
+ */
+int op_log_record_encode(uint8_t buffer[],
+                         size_t length,
+                         const char* format,
+                         va_list argp);
+
+/**
+ * Generate the message for a format string and encoded arguments
+ *
+ * @param[out] message
+ *   Buffer for the message; always null terminated
+ * @param[in] length
+ *   Length of message buffer (bytes)
+ * @param[in] format
+ *   The printf format string used to encode the arguments
+ * @param[in] args
+ *   The encoded arguments
+ * @param[in] args_length
+ *   Length of the encoded arguments (bytes)
+ *
+ * @return
+ *   - >= 0: the length of the message, excluding the null terminator
+ *   -   -1: the arguments don't match the format string
+ */
+int op_log_record_decode(char message[],
+                         size_t length,
+                         const char* format,
+                         const uint8_t args[],
+                         size_t args_length);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _OP_LOG_RECORD_H_ */
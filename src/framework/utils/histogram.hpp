@@ -0,0 +1,136 @@
+#ifndef _OP_UTILS_HISTOGRAM_HPP_
+#define _OP_UTILS_HISTOGRAM_HPP_
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <numeric>
+
+namespace openperf::utils {
+
+/**
+ * A fixed size, log-linear histogram, a la HDR histogram.
+ *
+ * Values less than 2^SubBucketBits are counted exactly. Larger values are
+ * grouped into power of 2 ranges, each of which is split into
+ * 2^(SubBucketBits - 1) linear sub-buckets, so the relative error of any
+ * recorded value is at most 1 / 2^(SubBucketBits - 1). Values larger than
+ * 2^MaxValueBits - 1 are clamped to the last bucket.
+ *
+ * The histogram has no dynamic storage, so it is trivially copyable and
+ * recording a value is just a bit of arithmetic and an increment. It is
+ * intended to be owned by a single writer, e.g. one histogram per worker,
+ * and merged with other histograms for reporting.
+ */
+template <unsigned SubBucketBits = 7, unsigned MaxValueBits = 40>
+class log_linear_histogram
+{
+    static_assert(SubBucketBits >= 2 && SubBucketBits < MaxValueBits);
+    static_assert(MaxValueBits <= 64);
+
+    static constexpr uint64_t half_count = 1ULL << (SubBucketBits - 1);
+
+public:
+    static constexpr size_t bucket_count =
+        (MaxValueBits - SubBucketBits + 2) * half_count;
+
+    static constexpr uint64_t max_value =
+        MaxValueBits == 64 ? ~0ULL : (1ULL << MaxValueBits) - 1;
+
+    static constexpr size_t to_index(uint64_t value)
+    {
+        value = std::min(value, max_value);
+        if (value < 2 * half_count) { return (value); }
+
+        auto shift = (63 - __builtin_clzll(value)) - (SubBucketBits - 1);
+        return (shift * half_count + (value >> shift));
+    }
+
+    /* Smallest value that maps to the given bucket */
+    static constexpr uint64_t lowest_value(size_t idx)
+    {
+        if (idx < 2 * half_count) { return (idx); }
+
+        auto shift = idx / half_count - 1;
+        return ((idx - shift * half_count) << shift);
+    }
+
+    /* Largest value that maps to the given bucket */
+    static constexpr uint64_t highest_value(size_t idx)
+    {
+        if (idx < 2 * half_count) { return (idx); }
+
+        auto shift = idx / half_count - 1;
+        return (lowest_value(idx) + ((1ULL << shift) - 1));
+    }
+
+    void record(uint64_t value, uint64_t count = 1)
+    {
+        m_counts[to_index(value)] += count;
+        m_total += count;
+    }
+
+    uint64_t total() const { return (m_total); }
+
+    uint64_t count_at(size_t idx) const { return (m_counts[idx]); }
+
+    /**
+     * Retrieve the (highest equivalent) value below which the given
+     * fraction, e.g. [0, 1], of recorded values fall. Returns 0 if the
+     * histogram is empty.
+     */
+    uint64_t value_at_quantile(double quantile) const
+    {
+        if (!m_total) { return (0); }
+
+        auto target = static_cast<uint64_t>(
+            std::ceil(std::clamp(quantile, 0.0, 1.0) * m_total));
+        target = std::max(target, uint64_t{1});
+
+        auto sum = uint64_t{0};
+        for (size_t idx = 0; idx < bucket_count; idx++) {
+            sum += m_counts[idx];
+            if (sum >= target) {
+                return (std::min(highest_value(idx), max_value));
+            }
+        }
+
+        return (max_value);
+    }
+
+    void reset()
+    {
+        m_counts.fill(0);
+        m_total = 0;
+    }
+
+    log_linear_histogram& operator+=(const log_linear_histogram& other)
+    {
+        std::transform(std::begin(m_counts),
+                       std::end(m_counts),
+                       std::begin(other.m_counts),
+                       std::begin(m_counts),
+                       std::plus<>{});
+        m_total += other.m_total;
+
+        return (*this);
+    }
+
+private:
+    std::array<uint64_t, bucket_count> m_counts = {};
+    uint64_t m_total = 0;
+};
+
+template <unsigned SubBucketBits, unsigned MaxValueBits>
+log_linear_histogram<SubBucketBits, MaxValueBits>
+operator+(log_linear_histogram<SubBucketBits, MaxValueBits> lhs,
+          const log_linear_histogram<SubBucketBits, MaxValueBits>& rhs)
+{
+    lhs += rhs;
+    return (lhs);
+}
+
+} // namespace openperf::utils
+
+#endif /* _OP_UTILS_HISTOGRAM_HPP_ */
@@ -0,0 +1,826 @@
+#ifndef _OP_UTILS_IO_URING_HPP_
+#define _OP_UTILS_IO_URING_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <limits>
+#include <optional>
+#include <system_error>
+#include <utility>
+
+#include <linux/io_uring.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+namespace openperf::utils::io_uring {
+
+/**
+ * A minimal wrapper around the raw io_uring system calls.
+ *
+ * The ring supports a single submitting/reaping thread.  Submission
+ * queue entries are handed out in order and are only made visible to
+ * the kernel by a call to submit(), so callers can fill in a batch of
+ * operations with a single system call.  Completions are reaped in
+ * batches via for_each_cqe().
+ **/
+class ring
+{
+public:
+    /*
+     * User data reserved for the timeout requests used by submit_and_wait()
+     * on kernels without IORING_FEAT_EXT_ARG.  for_each_cqe() never reports
+     * completions with this value.
+     */
+    static constexpr uint64_t timeout_user_data =
+        std::numeric_limits<uint64_t>::max() - 1;
+
+    ring(unsigned entries, unsigned flags = 0, unsigned sq_thread_idle = 0);
+    ~ring();
+
+    ring(ring&& other) noexcept;
+    ring& operator=(ring&& other) noexcept;
+
+    ring(const ring&) = delete;
+    ring& operator=(const ring&) = delete;
+
+    int fd() const;
+    unsigned features() const;
+    unsigned sq_entries() const;
+
+    /**
+     * Registration functions; return 0 on success or -errno on failure.
+     **/
+    int register_buffers(const struct iovec* iovecs, unsigned nb_iovecs);
+    int unregister_buffers();
+    int register_files(const int* fds, unsigned nb_fds);
+    int unregister_files();
+    int register_buf_ring(io_uring_buf_ring* bufs,
+                          unsigned nb_bufs,
+                          uint16_t group_id);
+    int unregister_buf_ring(uint16_t group_id);
+
+    /**
+     * Retrieve the next free submission queue entry.  The entry is
+     * zeroed before it is returned.  Returns nullptr if the submission
+     * queue is full.
+     **/
+    io_uring_sqe* get_sqe();
+
+    /**
+     * Number of submission queue entries that can be retrieved before the
+     * queue must be submitted.
+     **/
+    unsigned sq_space_left() const;
+
+    /**
+     * Publish all queued entries to the kernel and optionally wait for
+     * the specified number of completions.  Returns the number of
+     * entries the kernel consumed or -errno on failure.  Entries the
+     * kernel did not consume, e.g. due to EAGAIN or EBUSY, stay queued
+     * and are retried by the next submit.
+     **/
+    int submit(unsigned wait_nr = 0);
+
+    /**
+     * Publish all queued entries to the kernel and wait for at least the
+     * specified number of completions to become available, or until the
+     * timeout expires.  Returns 0 on success or -errno on failure, e.g.
+     * -ETIME if the timeout expired.  Unconsumed entries stay queued, as
+     * with submit().
+     **/
+    int submit_and_wait(unsigned wait_nr, std::chrono::nanoseconds timeout);
+
+    /**
+     * Number of completion queue entries available for reaping
+     **/
+    unsigned cq_ready() const;
+
+    /**
+     * Invoke the function for every available completion queue entry
+     * and then release them back to the kernel.  Returns the number of
+     * entries processed.
+     **/
+    template <typename Function> unsigned for_each_cqe(Function&& fn);
+
+private:
+    struct submission_queue
+    {
+        std::atomic<unsigned>* khead;
+        std::atomic<unsigned>* ktail;
+        std::atomic<unsigned>* kflags;
+        unsigned mask;
+        unsigned entries;
+        unsigned tail; /* local tail; published by submit */
+        io_uring_sqe* sqes;
+    };
+
+    struct completion_queue
+    {
+        std::atomic<unsigned>* khead;
+        std::atomic<unsigned>* ktail;
+        unsigned mask;
+        io_uring_cqe* cqes;
+    };
+
+    int enter(unsigned to_submit,
+              unsigned min_complete,
+              unsigned flags,
+              void* arg = nullptr,
+              size_t arg_size = 0);
+    unsigned flush();
+    bool needs_wakeup() const;
+    int wait_with_timeout_sqe(unsigned to_submit,
+                              unsigned min_complete,
+                              unsigned flags,
+                              std::chrono::nanoseconds timeout);
+    void release();
+
+    int m_fd = -1;
+    unsigned m_flags = 0;
+    unsigned m_features = 0;
+
+    void* m_sq_ring = MAP_FAILED;
+    size_t m_sq_ring_size = 0;
+    void* m_cq_ring = MAP_FAILED;
+    size_t m_cq_ring_size = 0;
+    size_t m_sqes_size = 0;
+
+    submission_queue m_sq = {};
+    completion_queue m_cq = {};
+};
+
+/**
+ * A ring of provided buffers for buffer selecting receives, e.g. multishot
+ * receives.  The kernel picks a buffer from the ring for each completion
+ * and reports its id in the completion flags.  Callers hand buffers back
+ * with recycle() once they are done with them; recycled buffers are only
+ * made visible to the kernel by a call to commit().
+ **/
+class buffer_ring
+{
+public:
+    buffer_ring(ring& ring,
+                uint16_t group_id,
+                unsigned entries,
+                size_t buffer_size);
+    ~buffer_ring();
+
+    buffer_ring(const buffer_ring&) = delete;
+    buffer_ring& operator=(const buffer_ring&) = delete;
+
+    uint16_t group_id() const;
+    size_t buffer_size() const;
+    uint8_t* buffer(uint16_t buffer_id) const;
+
+    void recycle(uint16_t buffer_id);
+    void commit();
+
+    /**
+     * Retrieve the id of the buffer used by the completion, if any.
+     **/
+    static std::optional<uint16_t> buffer_id(const io_uring_cqe& cqe);
+
+private:
+    void release();
+
+    ring& m_ring;
+    io_uring_buf_ring* m_bufs = nullptr;
+    size_t m_bufs_size = 0;
+    uint8_t* m_buffers = nullptr;
+    size_t m_buffers_size = 0;
+    size_t m_buffer_size;
+    uint16_t m_mask;
+    uint16_t m_tail = 0;
+    uint16_t m_group_id;
+};
+
+/**
+ * Submission queue entry helpers
+ **/
+
+inline void prep_rw(io_uring_sqe* sqe,
+                    uint8_t opcode,
+                    int fd,
+                    const void* addr,
+                    unsigned length,
+                    uint64_t offset,
+                    uint64_t user_data)
+{
+    sqe->opcode = opcode;
+    sqe->fd = fd;
+    sqe->addr = reinterpret_cast<uintptr_t>(addr);
+    sqe->len = length;
+    sqe->off = offset;
+    sqe->user_data = user_data;
+}
+
+inline void prep_read_fixed(io_uring_sqe* sqe,
+                            int fd,
+                            void* buf,
+                            unsigned length,
+                            uint64_t offset,
+                            uint16_t buf_index,
+                            uint64_t user_data)
+{
+    prep_rw(sqe, IORING_OP_READ_FIXED, fd, buf, length, offset, user_data);
+    sqe->buf_index = buf_index;
+}
+
+inline void prep_write_fixed(io_uring_sqe* sqe,
+                             int fd,
+                             const void* buf,
+                             unsigned length,
+                             uint64_t offset,
+                             uint16_t buf_index,
+                             uint64_t user_data)
+{
+    prep_rw(sqe, IORING_OP_WRITE_FIXED, fd, buf, length, offset, user_data);
+    sqe->buf_index = buf_index;
+}
+
+inline void prep_cancel(io_uring_sqe* sqe,
+                        uint64_t target_user_data,
+                        uint64_t user_data)
+{
+    prep_rw(sqe, IORING_OP_ASYNC_CANCEL, -1, nullptr, 0, 0, user_data);
+    sqe->addr = target_user_data;
+}
+
+inline void prep_connect(io_uring_sqe* sqe,
+                         int fd,
+                         const struct sockaddr* addr,
+                         socklen_t addr_len,
+                         uint64_t user_data)
+{
+    prep_rw(sqe, IORING_OP_CONNECT, fd, addr, 0, addr_len, user_data);
+}
+
+inline void prep_sendmsg(io_uring_sqe* sqe,
+                         int fd,
+                         const struct msghdr* msg,
+                         unsigned flags,
+                         uint64_t user_data)
+{
+    prep_rw(sqe, IORING_OP_SENDMSG, fd, msg, 1, 0, user_data);
+    sqe->msg_flags = flags;
+}
+
+/*
+ * Keep receiving into buffers from the given group until the request
+ * fails, e.g. because the group ran out of buffers or the peer closed
+ * the connection.  Completions flagged with IORING_CQE_F_MORE indicate
+ * that the request is still active.
+ */
+inline void prep_recv_multishot(io_uring_sqe* sqe,
+                                int fd,
+                                uint16_t group_id,
+                                unsigned flags,
+                                uint64_t user_data)
+{
+    prep_rw(sqe, IORING_OP_RECV, fd, nullptr, 0, 0, user_data);
+    sqe->msg_flags = flags;
+    sqe->ioprio |= IORING_RECV_MULTISHOT;
+    sqe->flags |= IOSQE_BUFFER_SELECT;
+    sqe->buf_group = group_id;
+}
+
+inline void prep_shutdown(io_uring_sqe* sqe,
+                          int fd,
+                          int how,
+                          uint64_t user_data)
+{
+    prep_rw(sqe, IORING_OP_SHUTDOWN, fd, nullptr, how, 0, user_data);
+}
+
+/*
+ * Install the file descriptors into the registered file table, starting
+ * at the given offset.  The fds array must remain valid until the
+ * request completes.
+ */
+inline void prep_files_update(io_uring_sqe* sqe,
+                              int* fds,
+                              unsigned nb_fds,
+                              unsigned offset,
+                              uint64_t user_data)
+{
+    prep_rw(sqe, IORING_OP_FILES_UPDATE, -1, fds, nb_fds, offset, user_data);
+}
+
+inline void prep_close(io_uring_sqe* sqe, int fd, uint64_t user_data)
+{
+    prep_rw(sqe, IORING_OP_CLOSE, fd, nullptr, 0, 0, user_data);
+}
+
+inline void
+prep_close_fixed(io_uring_sqe* sqe, unsigned file_index, uint64_t user_data)
+{
+    prep_close(sqe, 0, user_data);
+    sqe->file_index = file_index + 1;
+}
+
+/**
+ * Implementation
+ **/
+
+namespace detail {
+
+template <typename T> T* offset_ptr(void* base, size_t offset)
+{
+    return (reinterpret_cast<T*>(static_cast<uint8_t*>(base) + offset));
+}
+
+} // namespace detail
+
+inline ring::ring(unsigned entries, unsigned flags, unsigned sq_thread_idle)
+    : m_flags(flags)
+{
+    auto params = io_uring_params{};
+    params.flags = flags;
+    params.sq_thread_idle = sq_thread_idle;
+
+    m_fd = static_cast<int>(syscall(__NR_io_uring_setup, entries, &params));
+    if (m_fd < 0) {
+        throw std::system_error(errno, std::generic_category(), "io_uring");
+    }
+
+    m_features = params.features;
+
+    m_sq_ring_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    m_cq_ring_size =
+        params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+
+    if (m_features & IORING_FEAT_SINGLE_MMAP) {
+        m_sq_ring_size = m_cq_ring_size =
+            std::max(m_sq_ring_size, m_cq_ring_size);
+    }
+
+    m_sq_ring = mmap(nullptr,
+                     m_sq_ring_size,
+                     PROT_READ | PROT_WRITE,
+                     MAP_SHARED | MAP_POPULATE,
+                     m_fd,
+                     IORING_OFF_SQ_RING);
+    if (m_sq_ring == MAP_FAILED) {
+        auto error = errno;
+        release();
+        throw std::system_error(error, std::generic_category(), "io_uring");
+    }
+
+    if (m_features & IORING_FEAT_SINGLE_MMAP) {
+        m_cq_ring = m_sq_ring;
+    } else {
+        m_cq_ring = mmap(nullptr,
+                         m_cq_ring_size,
+                         PROT_READ | PROT_WRITE,
+                         MAP_SHARED | MAP_POPULATE,
+                         m_fd,
+                         IORING_OFF_CQ_RING);
+        if (m_cq_ring == MAP_FAILED) {
+            auto error = errno;
+            release();
+            throw std::system_error(
+                error, std::generic_category(), "io_uring");
+        }
+    }
+
+    m_sqes_size = params.sq_entries * sizeof(io_uring_sqe);
+    auto* sqes = mmap(nullptr,
+                      m_sqes_size,
+                      PROT_READ | PROT_WRITE,
+                      MAP_SHARED | MAP_POPULATE,
+                      m_fd,
+                      IORING_OFF_SQES);
+    if (sqes == MAP_FAILED) {
+        auto error = errno;
+        release();
+        throw std::system_error(error, std::generic_category(), "io_uring");
+    }
+
+    m_sq = submission_queue{
+        .khead = detail::offset_ptr<std::atomic<unsigned>>(
+            m_sq_ring, params.sq_off.head),
+        .ktail = detail::offset_ptr<std::atomic<unsigned>>(
+            m_sq_ring, params.sq_off.tail),
+        .kflags = detail::offset_ptr<std::atomic<unsigned>>(
+            m_sq_ring, params.sq_off.flags),
+        .mask = *detail::offset_ptr<unsigned>(m_sq_ring,
+                                              params.sq_off.ring_mask),
+        .entries = params.sq_entries,
+        .tail = 0,
+        .sqes = static_cast<io_uring_sqe*>(sqes)};
+
+    m_cq = completion_queue{
+        .khead = detail::offset_ptr<std::atomic<unsigned>>(
+            m_cq_ring, params.cq_off.head),
+        .ktail = detail::offset_ptr<std::atomic<unsigned>>(
+            m_cq_ring, params.cq_off.tail),
+        .mask = *detail::offset_ptr<unsigned>(m_cq_ring,
+                                              params.cq_off.ring_mask),
+        .cqes = detail::offset_ptr<io_uring_cqe>(m_cq_ring,
+                                                 params.cq_off.cqes)};
+
+    /*
+     * We always fill submission entries in order, so the index array
+     * is just an identity map.
+     */
+    auto* array = detail::offset_ptr<unsigned>(m_sq_ring, params.sq_off.array);
+    for (unsigned i = 0; i < params.sq_entries; i++) { array[i] = i; }
+}
+
+inline ring::~ring() { release(); }
+
+inline ring::ring(ring&& other) noexcept
+    : m_fd(std::exchange(other.m_fd, -1))
+    , m_flags(other.m_flags)
+    , m_features(other.m_features)
+    , m_sq_ring(std::exchange(other.m_sq_ring, MAP_FAILED))
+    , m_sq_ring_size(other.m_sq_ring_size)
+    , m_cq_ring(std::exchange(other.m_cq_ring, MAP_FAILED))
+    , m_cq_ring_size(other.m_cq_ring_size)
+    , m_sqes_size(other.m_sqes_size)
+    , m_sq(std::exchange(other.m_sq, submission_queue{}))
+    , m_cq(std::exchange(other.m_cq, completion_queue{}))
+{}
+
+inline ring& ring::operator=(ring&& other) noexcept
+{
+    if (this != &other) {
+        release();
+        m_fd = std::exchange(other.m_fd, -1);
+        m_flags = other.m_flags;
+        m_features = other.m_features;
+        m_sq_ring = std::exchange(other.m_sq_ring, MAP_FAILED);
+        m_sq_ring_size = other.m_sq_ring_size;
+        m_cq_ring = std::exchange(other.m_cq_ring, MAP_FAILED);
+        m_cq_ring_size = other.m_cq_ring_size;
+        m_sqes_size = other.m_sqes_size;
+        m_sq = std::exchange(other.m_sq, submission_queue{});
+        m_cq = std::exchange(other.m_cq, completion_queue{});
+    }
+
+    return (*this);
+}
+
+inline void ring::release()
+{
+    if (m_sq.sqes) {
+        munmap(m_sq.sqes, m_sqes_size);
+        m_sq.sqes = nullptr;
+    }
+
+    if (m_cq_ring != MAP_FAILED && m_cq_ring != m_sq_ring) {
+        munmap(m_cq_ring, m_cq_ring_size);
+    }
+    m_cq_ring = MAP_FAILED;
+
+    if (m_sq_ring != MAP_FAILED) {
+        munmap(m_sq_ring, m_sq_ring_size);
+        m_sq_ring = MAP_FAILED;
+    }
+
+    if (m_fd >= 0) {
+        close(m_fd);
+        m_fd = -1;
+    }
+}
+
+inline int ring::fd() const { return (m_fd); }
+
+inline unsigned ring::features() const { return (m_features); }
+
+inline unsigned ring::sq_entries() const { return (m_sq.entries); }
+
+inline int ring::enter(unsigned to_submit,
+                       unsigned min_complete,
+                       unsigned flags,
+                       void* arg,
+                       size_t arg_size)
+{
+    auto result = syscall(__NR_io_uring_enter,
+                          m_fd,
+                          to_submit,
+                          min_complete,
+                          flags,
+                          arg,
+                          arg_size);
+    return (result < 0 ? -errno : static_cast<int>(result));
+}
+
+inline int ring::register_buffers(const struct iovec* iovecs,
+                                  unsigned nb_iovecs)
+{
+    auto result = syscall(__NR_io_uring_register,
+                          m_fd,
+                          IORING_REGISTER_BUFFERS,
+                          iovecs,
+                          nb_iovecs);
+    return (result < 0 ? -errno : 0);
+}
+
+inline int ring::unregister_buffers()
+{
+    auto result = syscall(
+        __NR_io_uring_register, m_fd, IORING_UNREGISTER_BUFFERS, nullptr, 0);
+    return (result < 0 ? -errno : 0);
+}
+
+inline int ring::register_files(const int* fds, unsigned nb_fds)
+{
+    auto result = syscall(
+        __NR_io_uring_register, m_fd, IORING_REGISTER_FILES, fds, nb_fds);
+    return (result < 0 ? -errno : 0);
+}
+
+inline int ring::unregister_files()
+{
+    auto result = syscall(
+        __NR_io_uring_register, m_fd, IORING_UNREGISTER_FILES, nullptr, 0);
+    return (result < 0 ? -errno : 0);
+}
+
+inline int ring::register_buf_ring(io_uring_buf_ring* bufs,
+                                   unsigned nb_bufs,
+                                   uint16_t group_id)
+{
+    auto reg = io_uring_buf_reg{};
+    reg.ring_addr = reinterpret_cast<uintptr_t>(bufs);
+    reg.ring_entries = nb_bufs;
+    reg.bgid = group_id;
+
+    auto result = syscall(
+        __NR_io_uring_register, m_fd, IORING_REGISTER_PBUF_RING, &reg, 1);
+    return (result < 0 ? -errno : 0);
+}
+
+inline int ring::unregister_buf_ring(uint16_t group_id)
+{
+    auto reg = io_uring_buf_reg{};
+    reg.bgid = group_id;
+
+    auto result = syscall(
+        __NR_io_uring_register, m_fd, IORING_UNREGISTER_PBUF_RING, &reg, 1);
+    return (result < 0 ? -errno : 0);
+}
+
+inline io_uring_sqe* ring::get_sqe()
+{
+    auto head = m_sq.khead->load(std::memory_order_acquire);
+    if (m_sq.tail - head >= m_sq.entries) { return (nullptr); }
+
+    auto* sqe = &m_sq.sqes[m_sq.tail++ & m_sq.mask];
+    std::memset(sqe, 0, sizeof(*sqe));
+    return (sqe);
+}
+
+inline unsigned ring::sq_space_left() const
+{
+    return (m_sq.entries
+            - (m_sq.tail - m_sq.khead->load(std::memory_order_acquire)));
+}
+
+inline unsigned ring::cq_ready() const
+{
+    return (m_cq.ktail->load(std::memory_order_acquire)
+            - m_cq.khead->load(std::memory_order_relaxed));
+}
+
+/*
+ * Publish our local tail to the kernel and return the number of entries
+ * the kernel has yet to consume.  The kernel only advances the head for
+ * the entries it actually consumes, so anything left over from a partial
+ * or failed submit is counted again here.
+ */
+inline unsigned ring::flush()
+{
+    m_sq.ktail->store(m_sq.tail, std::memory_order_release);
+    return (m_sq.tail - m_sq.khead->load(std::memory_order_acquire));
+}
+
+inline bool ring::needs_wakeup() const
+{
+    if (!(m_flags & IORING_SETUP_SQPOLL)) { return (false); }
+
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    return (m_sq.kflags->load(std::memory_order_relaxed)
+            & IORING_SQ_NEED_WAKEUP);
+}
+
+inline int ring::submit(unsigned wait_nr)
+{
+    auto to_submit = flush();
+    auto flags = wait_nr ? IORING_ENTER_GETEVENTS : 0U;
+
+    if (m_flags & IORING_SETUP_SQPOLL) {
+        /*
+         * The kernel thread picks up new entries on its own; we only
+         * need to enter the kernel if the thread has gone to sleep or
+         * if we need to wait.
+         */
+        if (needs_wakeup()) { flags |= IORING_ENTER_SQ_WAKEUP; }
+        if (!flags) { return (static_cast<int>(to_submit)); }
+
+        auto error = enter(0, wait_nr, flags);
+        return (error < 0 ? error : static_cast<int>(to_submit));
+    }
+
+    if (!to_submit && !wait_nr) { return (0); }
+
+    return (enter(to_submit, wait_nr, flags));
+}
+
+inline int ring::submit_and_wait(unsigned wait_nr,
+                                 std::chrono::nanoseconds timeout)
+{
+    auto to_submit = flush();
+    auto min_complete = cq_ready() >= wait_nr ? 0U : wait_nr;
+    auto flags = min_complete ? IORING_ENTER_GETEVENTS : 0U;
+
+    if (m_flags & IORING_SETUP_SQPOLL) {
+        to_submit = 0;
+        if (needs_wakeup()) { flags |= IORING_ENTER_SQ_WAKEUP; }
+    }
+
+    if (!to_submit && !flags) { return (0); }
+
+    if (!min_complete) {
+        auto error = enter(to_submit, 0, flags);
+        return (error < 0 ? error : 0);
+    }
+
+    if (!(m_features & IORING_FEAT_EXT_ARG)) {
+        return (wait_with_timeout_sqe(to_submit, min_complete, flags, timeout));
+    }
+
+    auto ts = __kernel_timespec{
+        .tv_sec = std::chrono::duration_cast<std::chrono::seconds>(timeout)
+                      .count(),
+        .tv_nsec = (timeout % std::chrono::seconds(1)).count()};
+    auto arg = io_uring_getevents_arg{
+        .sigmask = 0,
+        .sigmask_sz = _NSIG / 8,
+        .pad = 0,
+        .ts = reinterpret_cast<uintptr_t>(&ts)};
+
+    auto error = enter(to_submit,
+                       min_complete,
+                       flags | IORING_ENTER_EXT_ARG,
+                       &arg,
+                       sizeof(arg));
+    return (error < 0 ? error : 0);
+}
+
+/*
+ * Kernels before 5.11 can't take a timeout argument when waiting, so
+ * queue a timeout request that completes after the timeout instead.
+ * The timeout request outlives the wait if a real completion shows up
+ * first; its eventual completion is dropped by for_each_cqe().
+ */
+inline int ring::wait_with_timeout_sqe(unsigned to_submit,
+                                       unsigned min_complete,
+                                       unsigned flags,
+                                       std::chrono::nanoseconds timeout)
+{
+    auto* sqe = get_sqe();
+    if (!sqe) {
+        /* No room for the timeout; just push the queue along */
+        auto error = enter(to_submit, 0, flags & ~IORING_ENTER_GETEVENTS);
+        return (error < 0 ? error : -EBUSY);
+    }
+
+    /* The kernel copies the timespec when it consumes the request */
+    auto ts = __kernel_timespec{
+        .tv_sec = std::chrono::duration_cast<std::chrono::seconds>(timeout)
+                      .count(),
+        .tv_nsec = (timeout % std::chrono::seconds(1)).count()};
+    prep_rw(sqe, IORING_OP_TIMEOUT, -1, &ts, 1, 0, timeout_user_data);
+
+    auto error = enter(flush(), min_complete, flags);
+    return (error < 0 ? error : 0);
+}
+
+template <typename Function> unsigned ring::for_each_cqe(Function&& fn)
+{
+    auto head = m_cq.khead->load(std::memory_order_relaxed);
+    auto tail = m_cq.ktail->load(std::memory_order_acquire);
+    auto count = 0U;
+
+    for (auto idx = head; idx != tail; idx++) {
+        const auto& cqe = m_cq.cqes[idx & m_cq.mask];
+        if (cqe.user_data == timeout_user_data) { continue; }
+        fn(cqe);
+        count++;
+    }
+
+    m_cq.khead->store(tail, std::memory_order_release);
+    return (count);
+}
+
+inline buffer_ring::buffer_ring(ring& ring,
+                                uint16_t group_id,
+                                unsigned entries,
+                                size_t buffer_size)
+    : m_ring(ring)
+    , m_buffer_size(buffer_size)
+    , m_mask(static_cast<uint16_t>(entries - 1))
+    , m_group_id(group_id)
+{
+    /* The kernel requires a power of two number of entries */
+    if (!entries || entries > 32768 || (entries & (entries - 1))) {
+        throw std::system_error(EINVAL, std::generic_category(), "io_uring");
+    }
+
+    /* The ring must be page aligned, so just map it */
+    m_bufs_size = entries * sizeof(io_uring_buf);
+    auto* bufs = mmap(nullptr,
+                      m_bufs_size,
+                      PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE | MAP_ANONYMOUS,
+                      -1,
+                      0);
+    if (bufs == MAP_FAILED) {
+        throw std::system_error(errno, std::generic_category(), "io_uring");
+    }
+    m_bufs = static_cast<io_uring_buf_ring*>(bufs);
+
+    m_buffers_size = entries * buffer_size;
+    auto* buffers = mmap(nullptr,
+                         m_buffers_size,
+                         PROT_READ | PROT_WRITE,
+                         MAP_PRIVATE | MAP_ANONYMOUS,
+                         -1,
+                         0);
+    if (buffers == MAP_FAILED) {
+        auto error = errno;
+        release();
+        throw std::system_error(error, std::generic_category(), "io_uring");
+    }
+    m_buffers = static_cast<uint8_t*>(buffers);
+
+    if (auto error = m_ring.register_buf_ring(m_bufs, entries, m_group_id)) {
+        release();
+        throw std::system_error(-error, std::generic_category(), "io_uring");
+    }
+
+    for (unsigned i = 0; i < entries; i++) { recycle(i); }
+    commit();
+}
+
+inline buffer_ring::~buffer_ring()
+{
+    m_ring.unregister_buf_ring(m_group_id);
+    release();
+}
+
+inline void buffer_ring::release()
+{
+    if (m_buffers) {
+        munmap(m_buffers, m_buffers_size);
+        m_buffers = nullptr;
+    }
+
+    if (m_bufs) {
+        munmap(m_bufs, m_bufs_size);
+        m_bufs = nullptr;
+    }
+}
+
+inline uint16_t buffer_ring::group_id() const { return (m_group_id); }
+
+inline size_t buffer_ring::buffer_size() const { return (m_buffer_size); }
+
+inline uint8_t* buffer_ring::buffer(uint16_t buffer_id) const
+{
+    return (m_buffers + buffer_id * m_buffer_size);
+}
+
+inline void buffer_ring::recycle(uint16_t buffer_id)
+{
+    auto& buf = m_bufs->bufs[m_tail++ & m_mask];
+    buf.addr = reinterpret_cast<uintptr_t>(buffer(buffer_id));
+    buf.len = static_cast<uint32_t>(m_buffer_size);
+    buf.bid = buffer_id;
+}
+
+inline void buffer_ring::commit()
+{
+    /* The ring tail overlays the reserved field of the first buffer */
+    reinterpret_cast<std::atomic<uint16_t>*>(&m_bufs->tail)
+        ->store(m_tail, std::memory_order_release);
+}
+
+inline std::optional<uint16_t> buffer_ring::buffer_id(const io_uring_cqe& cqe)
+{
+    if (!(cqe.flags & IORING_CQE_F_BUFFER)) { return (std::nullopt); }
+    return (static_cast<uint16_t>(cqe.flags >> IORING_CQE_BUFFER_SHIFT));
+}
+
+} // namespace openperf::utils::io_uring
+
+#endif /* _OP_UTILS_IO_URING_HPP_ */
@@ -0,0 +1,151 @@
+#include <numeric>
+#include <sstream>
+
+#include "pistache/peer.h"
+
+#include "api/api_flow_stream.hpp"
+#include "api/api_pistache_utils.hpp"
+#include "core/op_core.h"
+
+namespace openperf::api {
+
+using namespace openperf::pistache_utils;
+
+flow_stream::flow_stream(std::string name,
+                         std::unique_ptr<producer> producer,
+                         std::chrono::milliseconds interval)
+    : m_name(std::move(name))
+    , m_producer(std::move(producer))
+    , m_interval(interval)
+{}
+
+flow_stream::~flow_stream()
+{
+    stop();
+    if (m_thread.joinable()) { m_thread.join(); }
+}
+
+tl::expected<void, std::string>
+flow_stream::start(Pistache::Http::ResponseWriter& response,
+                   Pistache::Http::Version version)
+{
+    auto& headers = response.headers();
+    headers.add<Pistache::Http::Header::ContentType>(
+        MIME(Application, OctetStream));
+    headers.add<Pistache::Http::Header::TransferEncoding>(
+        Pistache::Http::Header::Encoding::Chunked);
+
+    std::ostringstream os;
+    if (!write_status_line(os, version, Pistache::Http::Code::Ok)
+        || !write_cookies(os, response.cookies())
+        || !write_headers(os, response.headers())
+        || !(os << Pistache::Http::crlf)) {
+        return (tl::make_unexpected("Response exceeded buffer size"));
+    }
+
+    m_peer = response.peer();
+    m_transport = get_transport(response);
+
+    auto str = os.str();
+    if (send_to_peer_timeout(*m_peer, str.c_str(), str.length(), MSG_MORE)
+        != static_cast<ssize_t>(str.length())) {
+        return (tl::make_unexpected("Unable to send HTTP response header"));
+    }
+
+    /*
+     * Keep Pistache away from the peer while we own it; the stream
+     * thread gives it back when it's done.
+     */
+    transport_peer_disable(*m_transport, *m_peer);
+
+    m_thread = std::thread([this]() { run(); });
+
+    return {};
+}
+
+void flow_stream::stop()
+{
+    auto lock = std::lock_guard(m_mutex);
+    m_stop = true;
+    m_cond.notify_one();
+}
+
+bool flow_stream::done() const { return (m_done.load()); }
+
+bool flow_stream::send_frame()
+{
+    m_frame.clear();
+    if (!m_producer->next_frame(m_frame)) { return (false); }
+
+    auto frame_length = std::accumulate(
+        std::begin(m_frame),
+        std::end(m_frame),
+        0UL,
+        [](size_t lhs, const iovec& rhs) { return (lhs + rhs.iov_len); });
+    auto chunk_header = get_chunk_header_str(frame_length);
+    auto chunk_trailer = get_chunk_trailer_str();
+
+    auto send_all = [&](const void* data, size_t length, int flags) {
+        return (send_to_peer_timeout(*m_peer, data, length, flags)
+                == static_cast<ssize_t>(length));
+    };
+
+    if (!send_all(chunk_header.c_str(), chunk_header.length(), MSG_MORE)) {
+        return (false);
+    }
+
+    for (const auto& iov : m_frame) {
+        if (iov.iov_len && !send_all(iov.iov_base, iov.iov_len, MSG_MORE)) {
+            return (false);
+        }
+    }
+
+    return (send_all(chunk_trailer.c_str(), chunk_trailer.length(), 0));
+}
+
+bool flow_stream::send_last_chunk()
+{
+    auto last_chunk = get_last_chunk_str();
+    return (send_to_peer_timeout(
+                *m_peer, last_chunk.c_str(), last_chunk.length(), 0)
+            == static_cast<ssize_t>(last_chunk.length()));
+}
+
+void flow_stream::run()
+{
+    op_thread_setname(m_name.c_str());
+
+    auto lock = std::unique_lock(m_mutex);
+    auto ok = true;
+    while (ok && !m_stop) {
+        auto deadline = std::chrono::steady_clock::now() + m_interval;
+
+        lock.unlock();
+        ok = send_frame();
+        lock.lock();
+
+        m_cond.wait_until(lock, deadline, [&]() { return (m_stop); });
+    }
+    auto stopped = m_stop;
+    lock.unlock();
+
+    m_producer->finish();
+
+    if (ok) { send_last_chunk(); }
+
+    /*
+     * Give the peer back to Pistache.  If we were stopped, then the API
+     * is shutting down and the transport thread might be waiting on us,
+     * so don't bother.
+     */
+    if (!stopped) {
+        transport_exec(*m_transport,
+                       [transport = m_transport, peer = m_peer]() {
+                           transport_peer_enable(*transport, *peer);
+                       });
+    }
+
+    m_done = true;
+}
+
+} // namespace openperf::api
@@ -0,0 +1,87 @@
+#ifndef _OP_API_FLOW_STREAM_HPP_
+#define _OP_API_FLOW_STREAM_HPP_
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <sys/uio.h>
+
+#include <pistache/http.h>
+
+#include "tl/expected.hpp"
+
+namespace openperf::api {
+
+/**
+ * Periodically send frames of flow statistics to a REST client as a
+ * chunked, binary stream.  Each HTTP chunk contains exactly one frame.
+ * Frames are sent even when nothing changed so that clients can tell a
+ * quiet stream from a dead one.
+ *
+ * The stream runs in its own thread and ends when the client goes away or
+ * stop() is called.  The frame contents come from a module specific
+ * producer, which is only used by the stream thread.
+ */
+class flow_stream
+{
+public:
+    struct producer
+    {
+        virtual ~producer() = default;
+
+        /*
+         * Fill in the pieces of the next frame.  The data must stay valid
+         * until the next call.  Returns false if the stream should end.
+         */
+        virtual bool next_frame(std::vector<iovec>& frame) = 0;
+
+        /* Called once, after the last frame */
+        virtual void finish() = 0;
+    };
+
+    flow_stream(std::string name,
+                std::unique_ptr<producer> producer,
+                std::chrono::milliseconds interval);
+    ~flow_stream();
+
+    flow_stream(const flow_stream&) = delete;
+    flow_stream& operator=(const flow_stream&) = delete;
+
+    /* Send the HTTP response header and start streaming frames */
+    tl::expected<void, std::string>
+    start(Pistache::Http::ResponseWriter& response,
+          Pistache::Http::Version version);
+
+    void stop();
+
+    bool done() const;
+
+private:
+    void run();
+    bool send_frame();
+    bool send_last_chunk();
+
+    std::string m_name;
+    std::unique_ptr<producer> m_producer;
+    std::chrono::milliseconds m_interval;
+    std::vector<iovec> m_frame;
+
+    Pistache::Tcp::Transport* m_transport = nullptr;
+    std::shared_ptr<Pistache::Tcp::Peer> m_peer;
+
+    std::thread m_thread;
+    std::mutex m_mutex;
+    std::condition_variable m_cond;
+    bool m_stop = false;
+    std::atomic_bool m_done = false;
+};
+
+} // namespace openperf::api
+
+#endif /* _OP_API_FLOW_STREAM_HPP_ */
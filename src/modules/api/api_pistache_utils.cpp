@@ -6,7 +6,7 @@
 
 #include "pistache/peer.h"
 
-#include "packet/capture/pistache_utils.hpp"
+#include "api/api_pistache_utils.hpp"
 #include "core/op_core.h"
 
 namespace openperf::pistache_utils {
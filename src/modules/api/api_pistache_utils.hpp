@@ -1,5 +1,5 @@
-#ifndef _OP_PISTACHE_UTILS_HPP_
-#define _OP_PISTACHE_UTILS_HPP_
+#ifndef _OP_API_PISTACHE_UTILS_HPP_
+#define _OP_API_PISTACHE_UTILS_HPP_
 
 #include <pistache/http.h>
 
@@ -46,4 +46,4 @@ void transport_exec(Pistache::Tcp::Transport& transport,
 
 } // namespace openperf::pistache_utils
 
-#endif // _OP_PISTACHE_UTILS_HPP_
\ No newline at end of file
+#endif // _OP_API_PISTACHE_UTILS_HPP_
\ No newline at end of file
@@ -6,9 +6,11 @@ API_DEPENDS += config_file expected json pistache swagger_model versions
 
 API_SOURCES += \
 	api_config_file_resources.cpp \
+	api_flow_stream.cpp \
 	api_init.cpp \
 	api_internal_client.cpp \
 	api_module_info.cpp \
+	api_pistache_utils.cpp \
 	api_register.c \
 	api_rest_error.cpp \
 	api_utils.cpp \
@@ -41,6 +41,28 @@ constexpr std::string_view to_string(model::block_generation_pattern pattern)
     };
 }
 
+constexpr model::block_generation_engine
+to_block_generation_engine(std::string_view value)
+{
+    if (value == "aio") return model::block_generation_engine::AIO;
+    if (value == "io_uring") return model::block_generation_engine::IO_URING;
+
+    throw std::runtime_error("Engine \"" + std::string(value)
+                             + "\" is unknown");
+}
+
+constexpr std::string_view to_string(model::block_generation_engine engine)
+{
+    switch (engine) {
+    case model::block_generation_engine::AIO:
+        return "aio";
+    case model::block_generation_engine::IO_URING:
+        return "io_uring";
+    default:
+        return "unknown";
+    };
+}
+
 constexpr std::string_view to_string(model::device::state_t state)
 {
     switch (state) {
@@ -79,6 +101,16 @@ constexpr std::string_view to_string(model::file::state_t state)
     };
 }
 
+/*
+ * The kernel limits io_uring to 16k registered buffers and 32k submission
+ * queue entries; we use one buffer per queue slot and reserve half of the
+ * submission queue for cancellation requests.
+ */
+constexpr int64_t max_uring_queue_depth = 1 << 14;
+
+/* O_DIRECT I/O sizes must be a multiple of the logical block size */
+constexpr int64_t direct_io_block_size = 512;
+
 bool is_valid(const BlockFile& file, std::vector<std::string>& errors)
 {
     auto init_errors = errors.size();
@@ -123,6 +155,20 @@ bool is_valid(const BlockGenerator& generator, std::vector<std::string>& errors)
     if (config->ratioIsSet()
         && (config->getReadsPerSec() < 1 || config->getWritesPerSec() < 1))
         errors.emplace_back("Ratio is specified for empty load generation.");
+    if (config->engineIsSet() && config->getEngine() != "aio"
+        && config->getEngine() != "io_uring")
+        errors.emplace_back("Engine value is not valid.");
+    if (config->getEngine() == "io_uring"
+        && config->getQueueDepth() > max_uring_queue_depth)
+        errors.emplace_back("Queue Depth value is too large for io_uring.");
+    if (config->isSqpoll() && config->getEngine() != "io_uring")
+        errors.emplace_back("SQ polling requires the io_uring engine.");
+    if (config->isDirectIo()
+        && (config->getReadSize() % direct_io_block_size
+            || config->getWriteSize() % direct_io_block_size))
+        errors.emplace_back(
+            "Read and Write Sizes must be a multiple of "
+            + std::to_string(direct_io_block_size) + " for direct I/O.");
 
     assert(config);
 
@@ -168,6 +214,9 @@ std::shared_ptr<BlockGenerator> to_swagger(const model::block_generator& p_gen)
         ratio->setWrites(p_gen.config().ratio.value().writes);
         gen_config->setRatio(ratio);
     }
+    gen_config->setEngine(std::string(to_string(p_gen.config().engine)));
+    gen_config->setSqpoll(p_gen.config().sqpoll);
+    gen_config->setDirectIo(p_gen.config().direct_io);
 
     auto gen = std::make_shared<BlockGenerator>();
     gen->setId(p_gen.id());
@@ -206,6 +255,15 @@ to_swagger(const model::block_generator_result& p_gen_result)
             if (gen_stat.latency_min.has_value())
                 stat->setLatencyMax(gen_stat.latency_max.value().count());
 
+            if (gen_stat.latency_p50.has_value())
+                stat->setLatencyP50(gen_stat.latency_p50.value().count());
+            if (gen_stat.latency_p99.has_value())
+                stat->setLatencyP99(gen_stat.latency_p99.value().count());
+            if (gen_stat.latency_p999.has_value())
+                stat->setLatencyP999(gen_stat.latency_p999.value().count());
+            if (gen_stat.latency_p9999.has_value())
+                stat->setLatencyP9999(gen_stat.latency_p9999.value().count());
+
             return stat;
         };
 
@@ -244,8 +302,15 @@ model::block_generator from_swagger(const BlockGenerator& p_gen)
             static_cast<uint32_t>(p_gen.getConfig()->getWritesPerSec()),
         .write_size = static_cast<uint32_t>(p_gen.getConfig()->getWriteSize()),
         .pattern = to_block_generation_pattern(p_gen.getConfig()->getPattern()),
+        .sqpoll = p_gen.getConfig()->isSqpoll(),
+        .direct_io = p_gen.getConfig()->isDirectIo(),
     };
 
+    if (p_gen.getConfig()->engineIsSet()) {
+        conf.engine =
+            to_block_generation_engine(p_gen.getConfig()->getEngine());
+    }
+
     if (p_gen.getConfig()->ratioIsSet()) {
         conf.ratio = model::block_generator_ratio{
             .reads = static_cast<uint32_t>(
@@ -16,6 +16,14 @@ using block_stat = ::openperf::block::generator::block_generator::block_stat;
 
 static uint16_t serial_counter = 0;
 
+template <typename Histogram>
+std::optional<std::chrono::nanoseconds>
+to_percentile(const Histogram& histogram, double quantile)
+{
+    if (!histogram.total()) return std::nullopt;
+    return std::chrono::nanoseconds(histogram.value_at_quantile(quantile));
+}
+
 auto to_statistics_t(const task_stat_t& task_stat)
 {
     return model::block_generator_result::statistics_t{
@@ -26,7 +34,11 @@ auto to_statistics_t(const task_stat_t& task_stat)
         .io_errors = task_stat.errors,
         .latency = task_stat.latency,
         .latency_min = task_stat.latency_min,
-        .latency_max = task_stat.latency_max};
+        .latency_max = task_stat.latency_max,
+        .latency_p50 = to_percentile(task_stat.latency_histogram, 0.5),
+        .latency_p99 = to_percentile(task_stat.latency_histogram, 0.99),
+        .latency_p999 = to_percentile(task_stat.latency_histogram, 0.999),
+        .latency_p9999 = to_percentile(task_stat.latency_histogram, 0.9999)};
 };
 
 std::optional<double> get_field(const block_stat& stat, std::string_view name)
@@ -43,6 +55,14 @@ std::optional<double> get_field(const block_stat& stat, std::string_view name)
         return read.latency_min.value_or(0ns).count();
     if (name == "read.latency_max")
         return read.latency_max.value_or(0ns).count();
+    if (name == "read.latency_p50")
+        return read.latency_histogram.value_at_quantile(0.5);
+    if (name == "read.latency_p99")
+        return read.latency_histogram.value_at_quantile(0.99);
+    if (name == "read.latency_p999")
+        return read.latency_histogram.value_at_quantile(0.999);
+    if (name == "read.latency_p9999")
+        return read.latency_histogram.value_at_quantile(0.9999);
 
     auto& write = stat.write;
     if (name == "write.ops_target") return write.ops_target;
@@ -56,6 +76,14 @@ std::optional<double> get_field(const block_stat& stat, std::string_view name)
         return write.latency_min.value_or(0ns).count();
     if (name == "write.latency_max")
         return write.latency_max.value_or(0ns).count();
+    if (name == "write.latency_p50")
+        return write.latency_histogram.value_at_quantile(0.5);
+    if (name == "write.latency_p99")
+        return write.latency_histogram.value_at_quantile(0.99);
+    if (name == "write.latency_p999")
+        return write.latency_histogram.value_at_quantile(0.999);
+    if (name == "write.latency_p9999")
+        return write.latency_histogram.value_at_quantile(0.9999);
 
     if (name == "timestamp")
         return std::max(write.updated, read.updated).time_since_epoch().count();
@@ -280,6 +308,7 @@ block_generator::make_task_config(const model::block_generator_config& config,
 
     task_config_t t_config{
         .fd = (op == task_operation::READ) ? fd.value().read : fd.value().write,
+        .path = m_vdev->path(),
         .f_size = m_vdev->size(),
         .header_size = m_vdev->header_size(),
         .queue_depth = config.queue_depth,
@@ -288,6 +317,9 @@ block_generator::make_task_config(const model::block_generator_config& config,
                                                     : config.writes_per_sec,
         .block_size = block_size,
         .pattern = config.pattern,
+        .engine = config.engine,
+        .sqpoll = config.sqpoll,
+        .direct_io = config.direct_io,
     };
 
     if (config.ratio) {
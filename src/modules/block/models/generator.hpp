@@ -9,6 +9,8 @@ namespace openperf::block::model {
 
 enum class block_generation_pattern { RANDOM, SEQUENTIAL, REVERSE };
 
+enum class block_generation_engine { AIO, IO_URING };
+
 struct block_generator_ratio
 {
     uint32_t reads;
@@ -24,6 +26,9 @@ struct block_generator_config
     uint32_t write_size;
     std::optional<block_generator_ratio> ratio;
     block_generation_pattern pattern;
+    block_generation_engine engine = block_generation_engine::AIO;
+    bool sqpoll = false;
+    bool direct_io = false;
 };
 
 class block_generator
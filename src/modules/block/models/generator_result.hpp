@@ -27,6 +27,10 @@ public:
         duration latency;
         optional_time_t latency_min;
         optional_time_t latency_max;
+        optional_time_t latency_p50;
+        optional_time_t latency_p99;
+        optional_time_t latency_p999;
+        optional_time_t latency_p9999;
     };
 
 protected:
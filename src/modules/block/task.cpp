@@ -1,6 +1,12 @@
+#include <algorithm>
+#include <numeric>
 #include <thread>
 #include <limits>
 
+#include <fcntl.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
 #include "task.hpp"
 
 #include "framework/core/op_log.h"
@@ -11,6 +17,27 @@ namespace openperf::block::worker {
 using namespace std::chrono_literals;
 constexpr duration TASK_SPIN_THRESHOLD = 100ms;
 
+/* io_uring user data tag for cancellation requests */
+constexpr uint64_t URING_CANCEL_TAG = std::numeric_limits<uint64_t>::max();
+
+/* Failsafe timeout for io_uring completions; see wait_for_aio_ops */
+constexpr duration URING_WAIT_TIMEOUT = 1s;
+
+/* Time the io_uring kernel polling thread may idle before sleeping */
+constexpr unsigned URING_SQPOLL_IDLE_MS = 100;
+
+static void update_latency(task_stat_t& stat, duration op_ns)
+{
+    stat.latency += op_ns;
+    stat.latency_min = (stat.latency_min.has_value())
+                           ? std::min(stat.latency_min.value(), op_ns)
+                           : op_ns;
+    stat.latency_max = (stat.latency_max.has_value())
+                           ? std::max(stat.latency_max.value(), op_ns)
+                           : op_ns;
+    stat.latency_histogram.record(op_ns.count());
+}
+
 struct block_task::operation_config
 {
     int fd;
@@ -32,6 +59,7 @@ task_stat_t& task_stat_t::operator+=(const task_stat_t& stat)
     bytes_target += stat.bytes_target;
     bytes_actual += stat.bytes_actual;
     latency += stat.latency;
+    latency_histogram += stat.latency_histogram;
 
     latency_min = [&]() -> optional_time_t {
         if (latency_min.has_value() && stat.latency_min.has_value())
@@ -56,6 +84,12 @@ block_task::block_task(const task_config_t& configuration)
     config(configuration);
 }
 
+block_task::~block_task()
+{
+    m_ring.reset();
+    if (m_direct_fd != -1) close(m_direct_fd);
+}
+
 // Methods : public
 void block_task::reset()
 {
@@ -105,7 +139,8 @@ task_stat_t block_task::spin()
                        + 1;
 
         assert(ops_req);
-        auto worker_spin_stat = worker_spin(ops_req, cur_time + 1s);
+        auto worker_spin_stat = m_ring ? uring_spin(ops_req, cur_time + 1s)
+                                       : worker_spin(ops_req, cur_time + 1s);
         stat += worker_spin_stat;
 
         cur_time = ref_clock::now();
@@ -124,11 +159,16 @@ task_stat_t block_task::spin()
 }
 
 // Methods : private
+int block_task::io_fd() const
+{
+    return (m_direct_fd != -1 ? m_direct_fd : m_task_config.fd);
+}
+
 task_stat_t block_task::worker_spin(uint64_t nb_ops,
                                     ref_clock::time_point deadline)
 {
     auto op_conf = operation_config{
-        .fd = m_task_config.fd,
+        .fd = io_fd(),
         .f_size = m_task_config.f_size,
         .block_size = m_task_config.block_size,
         .buffer = m_buf.data(),
@@ -175,7 +215,7 @@ task_stat_t block_task::worker_spin(uint64_t nb_ops,
              * where block IO could take a long time to complete when
              * writing large block sizes.
              */
-            if (aio_cancel(m_task_config.fd, nullptr) == -1) {
+            if (aio_cancel(io_fd(), nullptr) == -1) {
                 OP_LOG(OP_LOG_ERROR,
                        "Could not cancel pending AIO operations: %s\n",
                        strerror(errno));
@@ -192,7 +232,7 @@ task_stat_t block_task::worker_spin(uint64_t nb_ops,
              * 2) aio_cancel not supported
              * We consider either of these conditions to be fatal.
              */
-            if (aio_cancel(m_task_config.fd, nullptr) == -1) {
+            if (aio_cancel(io_fd(), nullptr) == -1) {
                 OP_LOG(OP_LOG_ERROR,
                        "Could not cancel pending AIO operations: %s\n",
                        strerror(errno));
@@ -208,22 +248,11 @@ task_stat_t block_task::worker_spin(uint64_t nb_ops,
             if (complete_aio_op(aio_op) == 0) {
                 /* found it; update stats */
                 switch (aio_op.state) {
-                case COMPLETE: {
+                case COMPLETE:
                     stat.ops_actual++;
                     stat.bytes_actual += aio_op.io_bytes;
-
-                    auto op_ns = aio_op.stop - aio_op.start;
-                    stat.latency += op_ns;
-                    stat.latency_min =
-                        (stat.latency_min.has_value())
-                            ? std::min(stat.latency_min.value(), op_ns)
-                            : op_ns;
-                    stat.latency_max =
-                        (stat.latency_max.has_value())
-                            ? std::max(stat.latency_max.value(), op_ns)
-                            : op_ns;
+                    update_latency(stat, aio_op.stop - aio_op.start);
                     break;
-                }
                 case CANCELLED:
                     if (!m_stopping) {
                         // Don't count cancelled operations as errors when
@@ -263,11 +292,135 @@ task_stat_t block_task::worker_spin(uint64_t nb_ops,
     return stat;
 }
 
+/*
+ * io_uring version of the worker loop. Each queue slot owns a registered
+ * buffer, so operations use the fixed buffer/file variants and avoid the
+ * per-operation page pinning and file reference counting in the kernel.
+ * Submissions and completions are handled in batches, so we only make one
+ * system call per batch (or none at all in SQPOLL mode when completions
+ * are already available).
+ */
+task_stat_t block_task::uring_spin(uint64_t nb_ops,
+                                   ref_clock::time_point deadline)
+{
+    const auto block_size = m_task_config.block_size;
+    const auto header_size =
+        ((m_task_config.header_size - 1) / block_size + 1) * block_size;
+    const auto queue_depth = m_aio_ops.size();
+
+    auto stat = task_stat_t{.operation = m_task_config.operation};
+    uint64_t submitted = 0;
+    size_t pending_ops = 0;
+    bool cancelled = false;
+
+    auto queue_ops = [&](ref_clock::time_point now) {
+        if (m_stopping || now >= deadline) return;
+
+        while (pending_ops < queue_depth && submitted < nb_ops) {
+            auto* sqe = m_ring->get_sqe();
+            if (!sqe) break;
+
+            auto idx = m_idle_ops.back();
+            m_idle_ops.pop_back();
+
+            auto& op = m_aio_ops[idx];
+            op.state = PENDING;
+            op.start = now;
+            op.io_bytes = 0;
+
+            auto* buffer = m_buf.data() + idx * block_size;
+            auto offset = block_size * m_pattern.generate() + header_size;
+            if (m_task_config.operation == task_operation::READ) {
+                utils::io_uring::prep_read_fixed(
+                    sqe, 0, buffer, block_size, offset, idx, idx);
+            } else {
+                utils::io_uring::prep_write_fixed(
+                    sqe, 0, buffer, block_size, offset, idx, idx);
+            }
+            sqe->flags |= IOSQE_FIXED_FILE;
+
+            pending_ops++;
+            submitted++;
+        }
+    };
+
+    auto complete_op = [&](const io_uring_cqe& cqe) {
+        if (cqe.user_data == URING_CANCEL_TAG) return;
+
+        auto idx = static_cast<uint32_t>(cqe.user_data);
+        auto& op = m_aio_ops[idx];
+        op.stop = ref_clock::now();
+
+        if (cqe.res >= 0) {
+            op.io_bytes = cqe.res;
+            stat.ops_actual++;
+            stat.bytes_actual += op.io_bytes;
+            update_latency(stat, op.stop - op.start);
+        } else if (cqe.res == -ECANCELED || cqe.res == -EINTR) {
+            if (!m_stopping) {
+                // Don't count cancelled operations as errors when stopping
+                stat.ops_actual++;
+                stat.errors++;
+            }
+        } else {
+            stat.ops_actual++;
+            stat.errors++;
+        }
+
+        op.state = IDLE;
+        m_idle_ops.push_back(idx);
+        pending_ops--;
+    };
+
+    queue_ops(ref_clock::now());
+
+    while (pending_ops) {
+        if (m_stopping && !cancelled && ref_clock::now() >= deadline) {
+            /* See the AIO loop for why we cancel pending operations here */
+            for (size_t i = 0; i < queue_depth; ++i) {
+                if (m_aio_ops[i].state != PENDING) continue;
+                auto* sqe = m_ring->get_sqe();
+                if (!sqe) break;
+                utils::io_uring::prep_cancel(sqe, i, URING_CANCEL_TAG);
+            }
+            cancelled = true;
+        }
+
+        if (auto error = m_ring->submit_and_wait(1, URING_WAIT_TIMEOUT);
+            error && error != -ETIME && error != -EINTR) {
+            /*
+             * Most likely a full completion queue (EBUSY) or a lack of
+             * kernel resources (EAGAIN). In either case, reaping any
+             * available completions below allows us to make progress.
+             */
+            OP_LOG(OP_LOG_ERROR,
+                   "Could not submit io_uring operations: %s\n",
+                   strerror(-error));
+        }
+
+        m_ring->for_each_cqe(complete_op);
+        queue_ops(ref_clock::now());
+    }
+
+    return stat;
+}
+
 void block_task::config(const task_config_t& p_config)
 {
     m_task_config = p_config;
     m_stat.operation = m_task_config.operation;
 
+    if (m_task_config.direct_io) {
+        auto flags = (m_task_config.operation == task_operation::READ)
+                         ? O_RDONLY | O_DIRECT
+                         : O_WRONLY | O_DSYNC | O_DIRECT;
+        m_direct_fd = open(m_task_config.path.c_str(), flags);
+        if (m_direct_fd == -1) {
+            throw std::runtime_error("Could not open " + m_task_config.path
+                                     + " for direct I/O: " + strerror(errno));
+        }
+    }
+
     auto buf_len = m_task_config.queue_depth * m_task_config.block_size;
     m_buf.resize(buf_len);
     utils::op_prbs23_fill(m_buf.data(), m_buf.size());
@@ -277,6 +430,52 @@ void block_task::config(const task_config_t& p_config)
         static_cast<off_t>((m_task_config.f_size - m_task_config.header_size)
                            / m_task_config.block_size),
         m_task_config.pattern);
+
+    if (m_task_config.engine == model::block_generation_engine::IO_URING) {
+        config_ring();
+    }
+}
+
+void block_task::config_ring()
+{
+    /* Leave room in the submission queue for cancellation requests */
+    auto entries = static_cast<unsigned>(m_task_config.queue_depth * 2);
+    auto flags = m_task_config.sqpoll ? IORING_SETUP_SQPOLL : 0U;
+
+    try {
+        m_ring = std::make_unique<utils::io_uring::ring>(
+            entries, flags, URING_SQPOLL_IDLE_MS);
+    } catch (const std::system_error& e) {
+        throw std::runtime_error(std::string("Could not create io_uring: ")
+                                 + e.what());
+    }
+
+    auto iovecs = std::vector<iovec>(m_task_config.queue_depth);
+    for (size_t i = 0; i < iovecs.size(); ++i) {
+        iovecs[i] = {.iov_base = m_buf.data() + i * m_task_config.block_size,
+                     .iov_len = m_task_config.block_size};
+    }
+
+    if (auto error = m_ring->register_buffers(iovecs.data(), iovecs.size())) {
+        m_ring.reset();
+        throw std::runtime_error(
+            std::string("Could not register io_uring buffers: ")
+            + strerror(-error));
+    }
+
+    auto fd = io_fd();
+    if (auto error = m_ring->register_files(&fd, 1)) {
+        m_ring.reset();
+        throw std::runtime_error(
+            std::string("Could not register io_uring file: ")
+            + strerror(-error));
+    }
+
+    m_idle_ops.resize(m_task_config.queue_depth);
+    std::iota(std::rbegin(m_idle_ops), std::rend(m_idle_ops), 0);
+    std::for_each(std::begin(m_aio_ops), std::end(m_aio_ops), [](auto& op) {
+        op.state = IDLE;
+    });
 }
 
 int32_t block_task::calculate_rate()
@@ -3,12 +3,17 @@
 
 #include <atomic>
 #include <chrono>
+#include <memory>
+#include <string>
 
 #include <aio.h>
 
 #include "pattern_generator.hpp"
 
 #include "framework/generator/task.hpp"
+#include "framework/memory/aligned_allocator.hpp"
+#include "framework/utils/histogram.hpp"
+#include "framework/utils/io_uring.hpp"
 #include "modules/timesync/chrono.hpp"
 
 namespace openperf::block::worker {
@@ -30,6 +35,7 @@ struct task_synchronizer
 struct task_config_t
 {
     int fd;
+    std::string path;
     size_t f_size;
     size_t header_size;
     size_t queue_depth;
@@ -37,6 +43,9 @@ struct task_config_t
     uint32_t ops_per_sec;
     size_t block_size;
     model::block_generation_pattern pattern;
+    model::block_generation_engine engine = model::block_generation_engine::AIO;
+    bool sqpoll = false;
+    bool direct_io = false;
     task_synchronizer* synchronizer = nullptr;
 };
 
@@ -53,6 +62,7 @@ struct task_stat_t
      * latency      - The total amount of time required to perform operations
      * latency_min  - The minimum observed latency value
      * latency_max  - The maximum observed latency value
+     * latency_histogram - The distribution of observed latency values (ns)
      */
 
     task_operation operation;
@@ -65,6 +75,7 @@ struct task_stat_t
     duration latency = duration::zero();
     optional_time_t latency_min;
     optional_time_t latency_max;
+    utils::log_linear_histogram<> latency_histogram;
 
     task_stat_t& operator+=(const task_stat_t&);
 };
@@ -90,17 +101,30 @@ class block_task : public framework::generator::task<task_stat_t>
 
     struct operation_config;
 
+    /* O_DIRECT requires buffers aligned to the device's logical block size */
+    static constexpr size_t buffer_alignment = 4096;
+    using buffer_type =
+        std::vector<uint8_t,
+                    memory::aligned_allocator<uint8_t, buffer_alignment>>;
+
 private:
     task_config_t m_task_config;
     task_stat_t m_stat;
     std::vector<operation_state> m_aio_ops;
-    std::vector<uint8_t> m_buf;
+    std::vector<uint32_t> m_idle_ops;
+    buffer_type m_buf;
     pattern_generator m_pattern;
     ref_clock::time_point m_operation_timestamp;
     std::atomic_bool m_stopping;
+    std::unique_ptr<utils::io_uring::ring> m_ring;
+    int m_direct_fd = -1;
 
 public:
     block_task(const task_config_t&);
+    ~block_task() override;
+
+    block_task(const block_task&) = delete;
+    block_task& operator=(const block_task&) = delete;
 
     task_config_t config() const { return m_task_config; }
 
@@ -113,8 +137,11 @@ public:
 
 private:
     void config(const task_config_t&);
+    void config_ring();
     int32_t calculate_rate();
+    int io_fd() const;
     task_stat_t worker_spin(uint64_t nb_ops, ref_clock::time_point deadline);
+    task_stat_t uring_spin(uint64_t nb_ops, ref_clock::time_point deadline);
 
 private:
     static int complete_aio_op(struct operation_state& aio_op);
@@ -67,6 +67,17 @@ enum class data_type { none = 0, int32, int64, float32, float64 };
 data_type to_data_type(std::string_view name);
 std::string to_string(data_type type);
 
+enum class operation_type {
+    none = 0,
+    matrix,
+    crc,
+    branch,
+    pointer_chase,
+    fma
+};
+operation_type to_operation_type(std::string_view name);
+std::string to_string(operation_type type);
+
 /**
  * CPU server requests
  */
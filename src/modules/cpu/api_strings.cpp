@@ -29,6 +29,14 @@ constexpr auto data_type_names =
         std::pair("float32", data_type::float32),
         std::pair("float64", data_type::float64));
 
+constexpr auto operation_type_names =
+    utils::associative_array<std::string_view, operation_type>(
+        std::pair("matrix", operation_type::matrix),
+        std::pair("crc", operation_type::crc),
+        std::pair("branch", operation_type::branch),
+        std::pair("pointer_chase", operation_type::pointer_chase),
+        std::pair("fma", operation_type::fma));
+
 /*
  * String -> type functions
  */
@@ -61,6 +69,11 @@ data_type to_data_type(std::string_view name)
     return (to_api_type(data_type_names, name));
 }
 
+operation_type to_operation_type(std::string_view name)
+{
+    return (to_api_type(operation_type_names, name));
+}
+
 /*
  * Type -> string functions
  */
@@ -89,4 +102,9 @@ std::string to_string(data_type type)
     return (std::string(to_string(data_type_names, type)));
 }
 
+std::string to_string(operation_type type)
+{
+    return (std::string(to_string(operation_type_names, type)));
+}
+
 } // namespace openperf::cpu::api
@@ -6,6 +6,7 @@
 #include "cpu/arg_parser.hpp"
 #include "cpu/generator/config.hpp"
 #include "cpu/generator/coordinator.hpp"
+#include "cpu/generator/load_traits.hpp"
 
 #include "swagger/v1/model/CpuGenerator.h"
 #include "swagger/v1/model/CpuGeneratorResult.h"
@@ -16,7 +17,8 @@ static generator::config
 from_swagger(const swagger::v1::model::CpuGeneratorSystemConfig& src)
 {
     using system_target_config_type =
-        generator::target_operations_config_impl<instruction_set::scalar,
+        generator::target_operations_config_impl<operation::matrix,
+                                                 instruction_set::scalar,
                                                  int64_t>;
 
     auto cores = config::core_mask();
@@ -36,57 +38,21 @@ from_swagger(const swagger::v1::model::CpuGeneratorSystemConfig& src)
     return (dst);
 }
 
-template <typename InstructionSet>
-generator::target_op_config to_target_op_config(enum data_type data, int weight)
-{
-    switch (data) {
-    case data_type::int32:
-        return (
-            generator::target_operations_config_impl<InstructionSet, int32_t>{
-                weight});
-    case data_type::float32:
-        return (generator::target_operations_config_impl<InstructionSet, float>{
-            weight});
-    case data_type::float64:
-        return (
-            generator::target_operations_config_impl<InstructionSet, double>{
-                weight});
-    default:
-        return (
-            generator::target_operations_config_impl<InstructionSet, int64_t>{
-                weight});
-    }
-}
-
 static generator::target_op_config
 from_swagger(const swagger::v1::model::CpuGeneratorCoreConfig_targets& src)
 {
-    auto instr = to_instruction_type(src.getInstructionSet());
-    auto data = to_data_type(src.getDataType());
-
-    switch (instr) {
-    case instruction_type::sse2:
-        return (
-            to_target_op_config<instruction_set::sse2>(data, src.getWeight()));
-    case instruction_type::sse4:
-        return (
-            to_target_op_config<instruction_set::sse4>(data, src.getWeight()));
-    case instruction_type::avx:
-        return (
-            to_target_op_config<instruction_set::avx>(data, src.getWeight()));
-    case instruction_type::avx2:
-        return (
-            to_target_op_config<instruction_set::avx2>(data, src.getWeight()));
-    case instruction_type::avx512:
-        return (to_target_op_config<instruction_set::avx512>(data,
-                                                             src.getWeight()));
-    case instruction_type::neon:
-        return (
-            to_target_op_config<instruction_set::neon>(data, src.getWeight()));
-    default:
-        return (to_target_op_config<instruction_set::scalar>(data,
-                                                             src.getWeight()));
-    }
+    auto names = generator::load_names{
+        .operation = src.operationIsSet()
+                         ? to_operation_type(src.getOperation())
+                         : operation_type::matrix,
+        .instruction_set = to_instruction_type(src.getInstructionSet()),
+        .data = to_data_type(src.getDataType())};
+
+    auto config = generator::make_load<generator::target_op_config>(
+        names, src.getWeight());
+    if (!config) { throw std::runtime_error("Unrecognized target config"); }
+
+    return (*config);
 }
 
 static generator::core_config
@@ -134,132 +100,15 @@ from_swagger(const swagger::v1::model::CpuGeneratorConfig& src)
     }
 }
 
-template <typename SwaggerObject,
-          template <typename, typename>
-          class Target,
-          typename Variant>
+template <typename SwaggerObject, typename Variant>
 std::shared_ptr<SwaggerObject> to_swagger_load_object(const Variant& src)
 {
     auto dst = std::make_shared<SwaggerObject>();
 
-    auto [instr, data] = std::visit(
-        utils::overloaded_visitor(
-            [](const Target<instruction_set::scalar, int32_t>&) {
-                return (std::make_pair(to_string(instruction_type::scalar),
-                                       to_string(data_type::int32)));
-            },
-            [](const Target<instruction_set::scalar, int64_t>&) {
-                return (std::make_pair(to_string(instruction_type::scalar),
-                                       to_string(data_type::int64)));
-            },
-            [](const Target<instruction_set::scalar, float>&) {
-                return (std::make_pair(to_string(instruction_type::scalar),
-                                       to_string(data_type::float32)));
-            },
-            [](const Target<instruction_set::scalar, double>&) {
-                return (std::make_pair(to_string(instruction_type::scalar),
-                                       to_string(data_type::float64)));
-            },
-            [](const Target<instruction_set::sse2, int32_t>&) {
-                return (std::make_pair(to_string(instruction_type::sse2),
-                                       to_string(data_type::int32)));
-            },
-            [](const Target<instruction_set::sse2, int64_t>&) {
-                return (std::make_pair(to_string(instruction_type::sse2),
-                                       to_string(data_type::int64)));
-            },
-            [](const Target<instruction_set::sse2, float>&) {
-                return (std::make_pair(to_string(instruction_type::sse2),
-                                       to_string(data_type::float32)));
-            },
-            [](const Target<instruction_set::sse2, double>&) {
-                return (std::make_pair(to_string(instruction_type::sse2),
-                                       to_string(data_type::float64)));
-            },
-            [](const Target<instruction_set::sse4, int32_t>&) {
-                return (std::make_pair(to_string(instruction_type::sse4),
-                                       to_string(data_type::int32)));
-            },
-            [](const Target<instruction_set::sse4, int64_t>&) {
-                return (std::make_pair(to_string(instruction_type::sse4),
-                                       to_string(data_type::int64)));
-            },
-            [](const Target<instruction_set::sse4, float>&) {
-                return (std::make_pair(to_string(instruction_type::sse4),
-                                       to_string(data_type::float32)));
-            },
-            [](const Target<instruction_set::sse4, double>&) {
-                return (std::make_pair(to_string(instruction_type::sse4),
-                                       to_string(data_type::float64)));
-            },
-            [](const Target<instruction_set::avx, int32_t>&) {
-                return (std::make_pair(to_string(instruction_type::avx),
-                                       to_string(data_type::int32)));
-            },
-            [](const Target<instruction_set::avx, int64_t>&) {
-                return (std::make_pair(to_string(instruction_type::avx),
-                                       to_string(data_type::int64)));
-            },
-            [](const Target<instruction_set::avx, float>&) {
-                return (std::make_pair(to_string(instruction_type::avx),
-                                       to_string(data_type::float32)));
-            },
-            [](const Target<instruction_set::avx, double>&) {
-                return (std::make_pair(to_string(instruction_type::avx),
-                                       to_string(data_type::float64)));
-            },
-            [](const Target<instruction_set::avx2, int32_t>&) {
-                return (std::make_pair(to_string(instruction_type::avx2),
-                                       to_string(data_type::int32)));
-            },
-            [](const Target<instruction_set::avx2, int64_t>&) {
-                return (std::make_pair(to_string(instruction_type::avx2),
-                                       to_string(data_type::int64)));
-            },
-            [](const Target<instruction_set::avx2, float>&) {
-                return (std::make_pair(to_string(instruction_type::avx2),
-                                       to_string(data_type::float32)));
-            },
-            [](const Target<instruction_set::avx2, double>&) {
-                return (std::make_pair(to_string(instruction_type::avx2),
-                                       to_string(data_type::float64)));
-            },
-            [](const Target<instruction_set::avx512, int32_t>&) {
-                return (std::make_pair(to_string(instruction_type::avx512),
-                                       to_string(data_type::int32)));
-            },
-            [](const Target<instruction_set::avx512, int64_t>&) {
-                return (std::make_pair(to_string(instruction_type::avx512),
-                                       to_string(data_type::int64)));
-            },
-            [](const Target<instruction_set::avx512, float>&) {
-                return (std::make_pair(to_string(instruction_type::avx512),
-                                       to_string(data_type::float32)));
-            },
-            [](const Target<instruction_set::avx512, double>&) {
-                return (std::make_pair(to_string(instruction_type::avx512),
-                                       to_string(data_type::float64)));
-            },
-            [](const Target<instruction_set::neon, int32_t>&) {
-                return (std::make_pair(to_string(instruction_type::neon),
-                                       to_string(data_type::int32)));
-            },
-            [](const Target<instruction_set::neon, int64_t>&) {
-                return (std::make_pair(to_string(instruction_type::neon),
-                                       to_string(data_type::int64)));
-            },
-            [](const Target<instruction_set::neon, float>&) {
-                return (std::make_pair(to_string(instruction_type::neon),
-                                       to_string(data_type::float32)));
-            },
-            [](const Target<instruction_set::neon, double>&) {
-                return (std::make_pair(to_string(instruction_type::neon),
-                                       to_string(data_type::float64)));
-            }),
-        src);
-
-    dst->setInstructionSet(instr);
-    dst->setDataType(data);
+    auto names = generator::to_load_names(src);
+    dst->setOperation(to_string(names.operation));
+    dst->setInstructionSet(to_string(names.instruction_set));
+    dst->setDataType(to_string(names.data));
 
     return (dst);
 }
@@ -277,8 +126,7 @@ to_swagger(const generator::core_config& config)
         std::back_inserter(dst->getTargets()),
         [](const auto& target) {
             auto t = to_swagger_load_object<
-                swagger::v1::model::CpuGeneratorCoreConfig_targets,
-                generator::target_operations_config_impl>(target);
+                swagger::v1::model::CpuGeneratorCoreConfig_targets>(target);
             t->setWeight(std::visit(
                 [](const auto& impl) { return (impl.weight); }, target));
             return (t);
@@ -355,14 +203,25 @@ static std::shared_ptr<swagger::v1::model::CpuGeneratorTargetStats>
 to_swagger(const target_stats& src)
 {
     auto dst =
-        to_swagger_load_object<swagger::v1::model::CpuGeneratorTargetStats,
-                               target_stats_impl>(src);
+        to_swagger_load_object<swagger::v1::model::CpuGeneratorTargetStats>(
+            src);
     dst->setOperations(
         std::visit([](const auto& stat) { return (stat.operations); }, src));
 
     return (dst);
 }
 
+template <typename SwaggerObject>
+void set_counters(SwaggerObject& dst,
+                  const std::optional<generator::counter_values>& counters)
+{
+    if (!counters) { return; }
+
+    dst.setCycles(counters->cycles);
+    dst.setInstructions(counters->instructions);
+    dst.setCacheMisses(counters->cache_misses);
+}
+
 static std::shared_ptr<swagger::v1::model::CpuGeneratorCoreStats>
 to_swagger(const generator::result::core_shard& src)
 {
@@ -374,6 +233,7 @@ to_swagger(const generator::result::core_shard& src)
     dst->setTarget(to_nanoseconds(src.target).count());
     dst->setUser(to_nanoseconds(src.user).count());
     dst->setUtilization(to_nanoseconds(src.utilization()).count());
+    set_counters(*dst, src.counters);
 
     auto& targets = dst->getTargets();
     std::transform(std::begin(src.targets),
@@ -397,6 +257,7 @@ to_swagger(const std::vector<generator::result::core_shard>& shards,
     dst->setTarget(to_nanoseconds(sum.target).count());
     dst->setUser(to_nanoseconds(sum.user).count());
     dst->setUtilization(to_nanoseconds(sum.utilization()).count());
+    set_counters(*dst, sum.counters);
 
     auto& cores = dst->getCores();
     std::transform(std::begin(shards),
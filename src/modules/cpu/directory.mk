@@ -18,7 +18,11 @@ CPU_SOURCES += \
 	cpu_transmogrify.cpp \
 	generator/coordinator.cpp \
 	generator/ispc/matrix.ispc \
+	generator/scalar/branch.cpp \
+	generator/scalar/crc.cpp \
+	generator/scalar/fma.cpp \
 	generator/scalar/matrix.cpp \
+	generator/scalar/pointer_chase.cpp \
 	generator/worker.cpp \
 	generator/worker_client.cpp \
 	generator/worker_transmogrify.cpp \
@@ -29,8 +33,15 @@ CPU_SOURCES += \
 
 ifeq ($(ARCH),x86_64)
 	CPU_SOURCES += \
-		generator/instruction_set_x86.cpp
-	CPU_TEST_SOURCES += generator/instruction_set_x86.cpp
+		generator/instruction_set_x86.cpp \
+		generator/x86/avx2.cpp \
+		generator/x86/avx512.cpp \
+		generator/x86/sse4.cpp
+	CPU_TEST_SOURCES += \
+		generator/instruction_set_x86.cpp \
+		generator/x86/avx2.cpp \
+		generator/x86/avx512.cpp \
+		generator/x86/sse4.cpp
 endif
 
 ifeq ($(ARCH),aarch64)
@@ -40,9 +51,18 @@ ifeq ($(ARCH),aarch64)
 endif
 
 ifeq ($(PLATFORM),linux)
-	CPU_SOURCES += generator/system_stats_linux.cpp
+	CPU_SOURCES += \
+		generator/hardware_counters_linux.cpp \
+		generator/system_stats_linux.cpp
 endif
 
+$(CPU_OBJ_DIR)/generator/x86/sse4.o \
+$(CPU_TEST_OBJ_DIR)/generator/x86/sse4.o: OP_CXXFLAGS += -msse4.2
+$(CPU_OBJ_DIR)/generator/x86/avx2.o \
+$(CPU_TEST_OBJ_DIR)/generator/x86/avx2.o: OP_CXXFLAGS += -mavx2 -mfma
+$(CPU_OBJ_DIR)/generator/x86/avx512.o \
+$(CPU_TEST_OBJ_DIR)/generator/x86/avx512.o: OP_CXXFLAGS += -mavx512f
+
 CPU_VERSIONED_FILES := init.cpp
 CPU_UNVERSIONED_OBJECTS :=\
 	$(call op_generate_objects,$(filter-out $(CPU_VERSIONED_FILES),$(CPU_SOURCES)),$(CPU_OBJ_DIR))
@@ -54,5 +74,9 @@ $(CPU_OBJ_DIR)/init.o: OP_CPPFLAGS += \
 	-DBUILD_TIMESTAMP="\"$(TIMESTAMP)\""
 
 CPU_TEST_SOURCES += \
+	generator/scalar/branch.cpp \
+	generator/scalar/crc.cpp \
+	generator/scalar/fma.cpp \
 	generator/scalar/matrix.cpp \
+	generator/scalar/pointer_chase.cpp \
 	generator/ispc/matrix.ispc
@@ -11,19 +11,22 @@
 
 namespace openperf::cpu::generator {
 
-template <typename InstructionSet, typename DataType>
+template <typename Operation, typename InstructionSet, typename DataType>
 struct target_operations_config_impl
 {
+    using operation_type = Operation;
     using instruction_set_type = InstructionSet;
     using data_type = DataType;
 
     int weight;
 };
 
-template <typename... Pairs>
-std::variant<target_operations_config_impl<typename Pairs::first_type,
-                                           typename Pairs::second_type>...>
-    as_target_operations_config_variant(type_list<Pairs...>);
+template <typename... Loads>
+std::variant<
+    target_operations_config_impl<typename Loads::operation_type,
+                                  typename Loads::instruction_set_type,
+                                  typename Loads::data_type>...>
+    as_target_operations_config_variant(type_list<Loads...>);
 
 using target_op_config =
     decltype(as_target_operations_config_variant(load_types{}));
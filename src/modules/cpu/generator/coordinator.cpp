@@ -4,6 +4,7 @@
 #include "core/op_core.h"
 #include "cpu/api.hpp"
 #include "cpu/generator/coordinator.hpp"
+#include "cpu/generator/load_traits.hpp"
 #include "cpu/generator/worker_api.hpp"
 
 namespace openperf::cpu::generator {
@@ -33,50 +34,6 @@ static constexpr uint64_t to_timeout(const Duration& d)
     return (std::chrono::duration_cast<std::chrono::nanoseconds>(d).count());
 }
 
-/*
- * Convert data type, instruction set pairs into a target array index
- */
-
-template <typename InstructionSet>
-std::optional<target_stats> to_target_stats(api::data_type data)
-{
-    switch (data) {
-    case api::data_type::int32:
-        return (target_stats_impl<InstructionSet, int32_t>{});
-    case api::data_type::int64:
-        return (target_stats_impl<InstructionSet, int64_t>{});
-    case api::data_type::float32:
-        return (target_stats_impl<InstructionSet, float>{});
-    case api::data_type::float64:
-        return (target_stats_impl<InstructionSet, double>{});
-    default:
-        return (std::nullopt);
-    }
-}
-
-static std::optional<target_stats> to_target_stats(api::instruction_type instr,
-                                                   api::data_type data)
-{
-    switch (instr) {
-    case api::instruction_type::scalar:
-        return (to_target_stats<instruction_set::scalar>(data));
-    case api::instruction_type::sse2:
-        return (to_target_stats<instruction_set::sse2>(data));
-    case api::instruction_type::sse4:
-        return (to_target_stats<instruction_set::sse4>(data));
-    case api::instruction_type::avx:
-        return (to_target_stats<instruction_set::avx>(data));
-    case api::instruction_type::avx2:
-        return (to_target_stats<instruction_set::avx2>(data));
-    case api::instruction_type::avx512:
-        return (to_target_stats<instruction_set::avx512>(data));
-    case api::instruction_type::neon:
-        return (to_target_stats<instruction_set::neon>(data));
-    default:
-        return (std::nullopt);
-    }
-}
-
 static std::optional<size_t> get_target_index(std::string_view name)
 {
     static constexpr auto delimiters = ", ";
@@ -88,13 +45,14 @@ static std::optional<size_t> get_target_index(std::string_view name)
         tokens.emplace_back(name.substr(beg, pos - beg));
     }
 
-    if (tokens.size() != 2) { return (std::nullopt); }
-
-    auto stats = to_target_stats(api::to_instruction_type(tokens[0]),
-                                 api::to_data_type(tokens[1]));
-    if (!stats) { return (std::nullopt); }
+    /* The operation is optional and defaults to matrix */
+    if (tokens.size() != 2 && tokens.size() != 3) { return (std::nullopt); }
 
-    return (stats->index());
+    return (to_load_index<target_stats>(
+        {.operation = tokens.size() == 3 ? api::to_operation_type(tokens[2])
+                                         : api::operation_type::matrix,
+         .instruction_set = api::to_instruction_type(tokens[0]),
+         .data = api::to_data_type(tokens[1])}));
 }
 
 static std::optional<double> shard_extractor(const result::core_shard& stat,
@@ -116,6 +74,15 @@ static std::optional<double> shard_extractor(const result::core_shard& stat,
     if (name == "user") { return (to_seconds(stat.user).count()); }
     if (name == "steal") { return (to_seconds(stat.steal()).count()); }
     if (name == "error") { return (to_seconds(stat.error()).count()); }
+    if (name == "cycles") {
+        return (stat.counters ? stat.counters->cycles : 0);
+    }
+    if (name == "instructions") {
+        return (stat.counters ? stat.counters->instructions : 0);
+    }
+    if (name == "cache_misses") {
+        return (stat.counters ? stat.counters->cache_misses : 0);
+    }
 
     /* Parse the targets[N] field name */
     constexpr std::string_view prefix = "targets[";
@@ -144,7 +111,8 @@ result_extractor(const std::vector<result::core_shard>& shards,
 {
     if (name == "timestamp" || name == "available" || name == "utilization"
         || name == "target" || name == "system" || name == "user"
-        || name == "steal" || name == "error") {
+        || name == "steal" || name == "error" || name == "cycles"
+        || name == "instructions" || name == "cache_misses") {
         return (shard_extractor(sum_stats(shards), name));
     }
 
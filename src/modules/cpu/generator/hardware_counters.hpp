@@ -0,0 +1,64 @@
+#ifndef _OP_CPU_GENERATOR_HARDWARE_COUNTERS_HPP_
+#define _OP_CPU_GENERATOR_HARDWARE_COUNTERS_HPP_
+
+#include <array>
+#include <cstdint>
+#include <optional>
+
+namespace openperf::cpu::generator {
+
+struct counter_values
+{
+    uint64_t cycles;
+    uint64_t instructions;
+    uint64_t cache_misses;
+
+    counter_values& operator+=(const counter_values& rhs)
+    {
+        cycles += rhs.cycles;
+        instructions += rhs.instructions;
+        cache_misses += rhs.cache_misses;
+        return (*this);
+    }
+
+    friend counter_values operator+(counter_values lhs,
+                                    const counter_values& rhs)
+    {
+        lhs += rhs;
+        return (lhs);
+    }
+
+    friend counter_values operator-(const counter_values& lhs,
+                                    const counter_values& rhs)
+    {
+        return {lhs.cycles - rhs.cycles,
+                lhs.instructions - rhs.instructions,
+                lhs.cache_misses - rhs.cache_misses};
+    }
+};
+
+/**
+ * User space hardware counters for the calling thread.  The counters
+ * start when the object is constructed and only count while the thread
+ * runs.  If the kernel won't give us counters, e.g. due to
+ * perf_event_paranoid settings or missing PMU support in a VM, then
+ * read() always returns nothing.
+ **/
+class hardware_counters
+{
+public:
+    hardware_counters();
+    ~hardware_counters();
+
+    hardware_counters(const hardware_counters&) = delete;
+    hardware_counters& operator=(const hardware_counters&) = delete;
+
+    std::optional<counter_values> read() const;
+
+private:
+    std::array<int, 3> m_fds;
+};
+
+} // namespace openperf::cpu::generator
+
+#endif /* _OP_CPU_GENERATOR_HARDWARE_COUNTERS_HPP_ */
@@ -0,0 +1,92 @@
+#include <cerrno>
+#include <cstring>
+
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include "core/op_log.h"
+#include "cpu/generator/hardware_counters.hpp"
+
+namespace openperf::cpu::generator {
+
+/* Counter order matches the counter_values fields */
+static constexpr std::array<uint64_t, 3> counter_configs = {
+    PERF_COUNT_HW_CPU_CYCLES,
+    PERF_COUNT_HW_INSTRUCTIONS,
+    PERF_COUNT_HW_CACHE_MISSES};
+
+static int open_counter(uint64_t config, int group_fd)
+{
+    auto attr = perf_event_attr{};
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.config = config;
+    attr.disabled = (group_fd == -1);
+    attr.exclude_kernel = 1; /* allowed by the default paranoid level */
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED
+                       | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+    return (static_cast<int>(syscall(
+        SYS_perf_event_open, &attr, 0, -1, group_fd, PERF_FLAG_FD_CLOEXEC)));
+}
+
+hardware_counters::hardware_counters()
+{
+    m_fds.fill(-1);
+
+    for (auto i = 0U; i < m_fds.size(); i++) {
+        m_fds[i] = open_counter(counter_configs[i], m_fds[0]);
+        if (m_fds[i] == -1) {
+            OP_LOG(OP_LOG_DEBUG,
+                   "Hardware counters are unavailable: %s\n",
+                   strerror(errno));
+            return;
+        }
+    }
+
+    ioctl(m_fds[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(m_fds[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+}
+
+hardware_counters::~hardware_counters()
+{
+    for (auto fd : m_fds) {
+        if (fd != -1) { close(fd); }
+    }
+}
+
+std::optional<counter_values> hardware_counters::read() const
+{
+    if (m_fds.back() == -1) { return (std::nullopt); }
+
+    struct
+    {
+        uint64_t nr;
+        uint64_t time_enabled;
+        uint64_t time_running;
+        uint64_t values[std::tuple_size_v<decltype(m_fds)>];
+    } data;
+
+    if (::read(m_fds[0], &data, sizeof(data)) != sizeof(data)
+        || data.nr != m_fds.size()) {
+        return (std::nullopt);
+    }
+
+    /* Scale the values if the kernel had to multiplex our counters */
+    auto scale = [&](uint64_t value) {
+        return (data.time_running && data.time_running < data.time_enabled
+                    ? static_cast<uint64_t>(static_cast<double>(value)
+                                            * data.time_enabled
+                                            / data.time_running)
+                    : value);
+    };
+
+    return (counter_values{.cycles = scale(data.values[0]),
+                           .instructions = scale(data.values[1]),
+                           .cache_misses = scale(data.values[2])});
+}
+
+} // namespace openperf::cpu::generator
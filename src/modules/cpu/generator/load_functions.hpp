@@ -0,0 +1,52 @@
+#ifndef _OP_CPU_GENERATOR_LOAD_FUNCTIONS_HPP_
+#define _OP_CPU_GENERATOR_LOAD_FUNCTIONS_HPP_
+
+#include <cstddef>
+#include <cstdint>
+
+/*
+ * Functions for the non-matrix load operations.  Scalar functions are
+ * available everywhere; vector functions only exist on x86 and must not
+ * be called unless the CPU supports the associated instruction set.
+ */
+
+namespace scalar {
+
+/* Update a CRC32C (Castagnoli) value with the contents of data */
+uint32_t crc32c_int32(const int32_t data[], size_t length, uint32_t crc);
+uint32_t crc32c_int64(const int64_t data[], size_t length, uint32_t crc);
+
+/* Perform length iterations of unpredictable, data dependent branches */
+int32_t branch_int32(uint64_t* state, size_t length);
+int64_t branch_int64(uint64_t* state, size_t length);
+
+/* Follow length links of chain, starting at index; returns the last index */
+int64_t
+pointer_chase_int64(const int64_t chain[], int64_t index, size_t length);
+
+/* Perform length iterations of independent acc = acc * a + b chains */
+float fma_float(float a, float b, size_t length);
+double fma_double(double a, double b, size_t length);
+
+} // namespace scalar
+
+#if defined(__x86_64__)
+
+namespace sse4 {
+uint32_t crc32c_int32(const int32_t data[], size_t length, uint32_t crc);
+uint32_t crc32c_int64(const int64_t data[], size_t length, uint32_t crc);
+} // namespace sse4
+
+namespace avx2 {
+float fma_float(float a, float b, size_t length);
+double fma_double(double a, double b, size_t length);
+} // namespace avx2
+
+namespace avx512 {
+float fma_float(float a, float b, size_t length);
+double fma_double(double a, double b, size_t length);
+} // namespace avx512
+
+#endif
+
+#endif /* _OP_CPU_GENERATOR_LOAD_FUNCTIONS_HPP_ */
@@ -0,0 +1,166 @@
+#ifndef _OP_CPU_GENERATOR_LOAD_TRAITS_HPP_
+#define _OP_CPU_GENERATOR_LOAD_TRAITS_HPP_
+
+#include <algorithm>
+#include <array>
+#include <optional>
+#include <type_traits>
+#include <variant>
+
+#include "cpu/api.hpp"
+#include "cpu/generator/load_types.hpp"
+
+namespace openperf::cpu::generator {
+
+/**
+ * Map load type tags to their API names and back again.  All of the load
+ * variants, e.g. target configs, ops, and stats, expose the same
+ * operation_type, instruction_set_type, and data_type members, so these
+ * functions work with any of them.
+ **/
+
+template <typename Operation> constexpr api::operation_type to_operation_type()
+{
+    if constexpr (std::is_same_v<Operation, operation::matrix>) {
+        return (api::operation_type::matrix);
+    } else if constexpr (std::is_same_v<Operation, operation::crc>) {
+        return (api::operation_type::crc);
+    } else if constexpr (std::is_same_v<Operation, operation::branch>) {
+        return (api::operation_type::branch);
+    } else if constexpr (std::is_same_v<Operation, operation::pointer_chase>) {
+        return (api::operation_type::pointer_chase);
+    } else if constexpr (std::is_same_v<Operation, operation::fma>) {
+        return (api::operation_type::fma);
+    } else {
+        return (api::operation_type::none);
+    }
+}
+
+template <typename InstructionSet>
+constexpr api::instruction_type to_instruction_type()
+{
+    if constexpr (std::is_same_v<InstructionSet, instruction_set::scalar>) {
+        return (api::instruction_type::scalar);
+    } else if constexpr (std::is_same_v<InstructionSet,
+                                        instruction_set::sse2>) {
+        return (api::instruction_type::sse2);
+    } else if constexpr (std::is_same_v<InstructionSet,
+                                        instruction_set::sse4>) {
+        return (api::instruction_type::sse4);
+    } else if constexpr (std::is_same_v<InstructionSet, instruction_set::avx>) {
+        return (api::instruction_type::avx);
+    } else if constexpr (std::is_same_v<InstructionSet,
+                                        instruction_set::avx2>) {
+        return (api::instruction_type::avx2);
+    } else if constexpr (std::is_same_v<InstructionSet,
+                                        instruction_set::avx512>) {
+        return (api::instruction_type::avx512);
+    } else if constexpr (std::is_same_v<InstructionSet,
+                                        instruction_set::neon>) {
+        return (api::instruction_type::neon);
+    } else {
+        return (api::instruction_type::none);
+    }
+}
+
+template <typename DataType> constexpr api::data_type to_data_type()
+{
+    if constexpr (std::is_same_v<DataType, int32_t>) {
+        return (api::data_type::int32);
+    } else if constexpr (std::is_same_v<DataType, int64_t>) {
+        return (api::data_type::int64);
+    } else if constexpr (std::is_same_v<DataType, float>) {
+        return (api::data_type::float32);
+    } else if constexpr (std::is_same_v<DataType, double>) {
+        return (api::data_type::float64);
+    } else {
+        return (api::data_type::none);
+    }
+}
+
+struct load_names
+{
+    api::operation_type operation;
+    api::instruction_type instruction_set;
+    api::data_type data;
+
+    constexpr bool operator==(const load_names& other) const
+    {
+        return (operation == other.operation
+                && instruction_set == other.instruction_set
+                && data == other.data);
+    }
+};
+
+template <typename Load> constexpr load_names to_load_names()
+{
+    return {to_operation_type<typename Load::operation_type>(),
+            to_instruction_type<typename Load::instruction_set_type>(),
+            to_data_type<typename Load::data_type>()};
+}
+
+/* Retrieve the names of the load type held by a load variant */
+template <typename Variant> load_names to_load_names(const Variant& load)
+{
+    return (std::visit(
+        [](const auto& alternative) {
+            return (to_load_names<std::decay_t<decltype(alternative)>>());
+        },
+        load));
+}
+
+namespace detail {
+
+template <typename Variant, size_t... I>
+constexpr auto make_load_names_table(std::index_sequence<I...>)
+{
+    return (std::array<load_names, sizeof...(I)>{
+        to_load_names<std::variant_alternative_t<I, Variant>>()...});
+}
+
+template <typename Variant, typename... Args, size_t... I>
+Variant make_load(size_t index, std::index_sequence<I...>, Args... args)
+{
+    using factory = Variant (*)(Args...);
+    constexpr factory factories[] = {[](Args... values) {
+        return (Variant{std::variant_alternative_t<I, Variant>{values...}});
+    }...};
+
+    return (factories[index](args...));
+}
+
+} // namespace detail
+
+/* Find the variant index of the load with the specified names, if any */
+template <typename Variant>
+std::optional<size_t> to_load_index(const load_names& names)
+{
+    constexpr auto table = detail::make_load_names_table<Variant>(
+        std::make_index_sequence<std::variant_size_v<Variant>>{});
+
+    auto cursor = std::find(std::begin(table), std::end(table), names);
+    return (cursor == std::end(table)
+                ? std::nullopt
+                : std::optional<size_t>(
+                    std::distance(std::begin(table), cursor)));
+}
+
+/*
+ * Construct the load with the specified names; the remaining arguments
+ * are used to initialize it.
+ */
+template <typename Variant, typename... Args>
+std::optional<Variant> make_load(const load_names& names, Args... args)
+{
+    auto index = to_load_index<Variant>(names);
+    if (!index) { return (std::nullopt); }
+
+    return (detail::make_load<Variant>(
+        *index,
+        std::make_index_sequence<std::variant_size_v<Variant>>{},
+        args...));
+}
+
+} // namespace openperf::cpu::generator
+
+#endif /* _OP_CPU_GENERATOR_LOAD_TRAITS_HPP_ */
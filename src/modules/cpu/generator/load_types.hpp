@@ -1,6 +1,7 @@
 #ifndef _OP_CPU_LOAD_TYPES_HPP_
 #define _OP_CPU_LOAD_TYPES_HPP_
 
+#include <cstdint>
 #include <utility>
 
 namespace openperf::cpu {
@@ -68,6 +69,51 @@ struct neon
 {};
 }; // namespace instruction_set
 
+/**
+ * Load operations; each one stresses a different part of the core.
+ **/
+namespace operation {
+struct matrix /* vector/FP execution units */
+{};
+struct crc /* integer multiply/shift pipelines */
+{};
+struct branch /* branch predictor */
+{};
+struct pointer_chase /* cache hierarchy and memory latency */
+{};
+struct fma /* fused multiply-add units */
+{};
+}; // namespace operation
+
+/**
+ * A single load type, e.g. an operation performed with a specific
+ * instruction set on a specific data type.
+ **/
+template <typename Operation, typename InstructionSet, typename DataType>
+struct load_type
+{
+    using operation_type = Operation;
+    using instruction_set_type = InstructionSet;
+    using data_type = DataType;
+};
+
+namespace detail {
+
+/**
+ * Turn a type list of instruction set, data type pairs into a type list
+ * of load types for the specified operation
+ **/
+template <typename Operation, typename... Types> struct to_load_types;
+template <typename Operation, typename... Pairs>
+struct to_load_types<Operation, type_list<Pairs...>>
+{
+    using type = type_list<load_type<Operation,
+                                     typename Pairs::first_type,
+                                     typename Pairs::second_type>...>;
+};
+
+} // namespace detail
+
 using instruction_sets = type_list<instruction_set::scalar,
                                    instruction_set::sse2,
                                    instruction_set::sse4,
@@ -78,8 +124,32 @@ using instruction_sets = type_list<instruction_set::scalar,
 
 using data_types = type_list<int32_t, int64_t, float, double>;
 
+/* Matrix operations are available for every instruction set and data type */
+using matrix_load_types = typename detail::to_load_types<
+    operation::matrix,
+    typename detail::cartesian_product<instruction_sets,
+                                       data_types>::type>::type;
+
+/* The other operations only make sense for specific combinations */
+using other_load_types =
+    type_list<load_type<operation::crc, instruction_set::scalar, int32_t>,
+              load_type<operation::crc, instruction_set::scalar, int64_t>,
+              load_type<operation::crc, instruction_set::sse4, int32_t>,
+              load_type<operation::crc, instruction_set::sse4, int64_t>,
+              load_type<operation::branch, instruction_set::scalar, int32_t>,
+              load_type<operation::branch, instruction_set::scalar, int64_t>,
+              load_type<operation::pointer_chase,
+                        instruction_set::scalar,
+                        int64_t>,
+              load_type<operation::fma, instruction_set::scalar, float>,
+              load_type<operation::fma, instruction_set::scalar, double>,
+              load_type<operation::fma, instruction_set::avx2, float>,
+              load_type<operation::fma, instruction_set::avx2, double>,
+              load_type<operation::fma, instruction_set::avx512, float>,
+              load_type<operation::fma, instruction_set::avx512, double>>;
+
 using load_types =
-    typename detail::cartesian_product<instruction_sets, data_types>::type;
+    typename detail::concat<matrix_load_types, other_load_types>::type;
 
 } // namespace openperf::cpu
 
@@ -8,13 +8,19 @@
 #include <optional>
 #include <variant>
 
+#include "cpu/generator/hardware_counters.hpp"
 #include "cpu/generator/load_types.hpp"
 #include "cpu/generator/system_stats.hpp"
 
 namespace openperf::cpu {
 
-template <typename InstructionSet, typename DataType> struct target_stats_impl
+template <typename Operation, typename InstructionSet, typename DataType>
+struct target_stats_impl
 {
+    using operation_type = Operation;
+    using instruction_set_type = InstructionSet;
+    using data_type = DataType;
+
     int64_t operations;
 
     target_stats_impl& operator+=(const target_stats_impl& rhs)
@@ -31,10 +37,11 @@ template <typename InstructionSet, typename DataType> struct target_stats_impl
     }
 };
 
-template <typename... Pairs>
-std::variant<target_stats_impl<typename Pairs::first_type,
-                               typename Pairs::second_type>...>
-    as_target_stats_variant(type_list<Pairs...>);
+template <typename... Loads>
+std::variant<target_stats_impl<typename Loads::operation_type,
+                               typename Loads::instruction_set_type,
+                               typename Loads::data_type>...>
+    as_target_stats_variant(type_list<Loads...>);
 
 using target_stats = decltype(as_target_stats_variant(load_types{}));
 
@@ -81,6 +88,7 @@ template <typename Clock> struct core_stats
     duration target;
     duration user;
     std::array<target_stats, std::variant_size_v<target_stats>> targets;
+    std::optional<generator::counter_values> counters; /* if available */
 
     core_stats(timestamp timestamp_first,
                timestamp timestamp_last,
@@ -113,6 +121,7 @@ template <typename Clock> struct core_stats
         , target(other.target)
         , user(other.user)
         , targets(other.targets)
+        , counters(other.counters)
     {}
 
     core_stats operator=(const core_stats& other)
@@ -126,6 +135,7 @@ template <typename Clock> struct core_stats
             std::copy(std::begin(other.targets),
                       std::end(other.targets),
                       std::begin(targets));
+            counters = other.counters;
         }
         return (*this);
     }
@@ -177,6 +187,11 @@ template <typename Clock> struct core_stats
             rhs.targets,
             std::make_index_sequence<std::variant_size_v<target_stats>>{});
 
+        if (rhs.counters) {
+            counters = counters.value_or(generator::counter_values{})
+                       + *rhs.counters;
+        }
+
         assert(first() <= last());
         return (*this);
     }
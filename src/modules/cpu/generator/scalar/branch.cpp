@@ -0,0 +1,67 @@
+#include <type_traits>
+
+#include "cpu/generator/load_functions.hpp"
+
+namespace scalar {
+
+/*
+ * Every iteration takes a jump through an eight way switch chosen by
+ * random bits, so the predictor is wrong most of the time.  Each case
+ * does something different to the accumulator to keep the compiler from
+ * merging cases or turning them into conditional moves.
+ */
+template <typename T> T branch(uint64_t* state, size_t length)
+{
+    using value_type = std::make_unsigned_t<T>;
+
+    auto x = *state;
+    auto acc = value_type{0};
+    for (size_t i = 0; i < length; i++) {
+        /* xorshift64 */
+        x ^= x << 13;
+        x ^= x >> 7;
+        x ^= x << 17;
+
+        auto value = static_cast<value_type>(x >> 3);
+        switch (x & 0x7) {
+        case 0:
+            acc += value;
+            break;
+        case 1:
+            acc -= value >> 1;
+            break;
+        case 2:
+            acc ^= value;
+            break;
+        case 3:
+            acc = acc * 3 + 1;
+            break;
+        case 4:
+            acc |= value & 0xff;
+            break;
+        case 5:
+            acc = (acc << 1) | (acc >> (sizeof(acc) * 8 - 1));
+            break;
+        case 6:
+            acc &= ~(value << 4);
+            break;
+        default:
+            acc += acc >> 2;
+        }
+    }
+
+    *state = x;
+    return (static_cast<T>(acc));
+}
+
+int32_t branch_int32(uint64_t* state, size_t length)
+{
+    return (branch<int32_t>(state, length));
+}
+
+int64_t branch_int64(uint64_t* state, size_t length)
+{
+    return (branch<int64_t>(state, length));
+}
+
+} // namespace scalar
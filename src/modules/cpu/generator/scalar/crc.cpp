@@ -0,0 +1,47 @@
+#include <array>
+#include <type_traits>
+
+#include "cpu/generator/load_functions.hpp"
+
+namespace scalar {
+
+/* Reflected CRC32C polynomial; the same one used by the SSE4.2 instructions */
+static constexpr uint32_t crc32c_polynomial = 0x82f63b78;
+
+static constexpr auto crc32c_table = []() {
+    auto table = std::array<uint32_t, 256>{};
+    for (auto i = 0U; i < table.size(); i++) {
+        auto crc = i;
+        for (auto j = 0; j < 8; j++) {
+            crc = (crc >> 1) ^ (crc & 1 ? crc32c_polynomial : 0);
+        }
+        table[i] = crc;
+    }
+    return (table);
+}();
+
+template <typename T>
+uint32_t crc32c(const T data[], size_t length, uint32_t crc)
+{
+    for (size_t i = 0; i < length; i++) {
+        auto value = static_cast<std::make_unsigned_t<T>>(data[i]);
+        for (size_t j = 0; j < sizeof(T); j++) {
+            crc = crc32c_table[(crc ^ value) & 0xff] ^ (crc >> 8);
+            value >>= 8;
+        }
+    }
+
+    return (crc);
+}
+
+uint32_t crc32c_int32(const int32_t data[], size_t length, uint32_t crc)
+{
+    return (crc32c(data, length, crc));
+}
+
+uint32_t crc32c_int64(const int64_t data[], size_t length, uint32_t crc)
+{
+    return (crc32c(data, length, crc));
+}
+
+} // namespace scalar
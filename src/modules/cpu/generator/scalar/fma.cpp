@@ -0,0 +1,31 @@
+#include <array>
+#include <cmath>
+#include <numeric>
+
+#include "cpu/generator/load_functions.hpp"
+
+namespace scalar {
+
+/* Use enough independent chains to hide the latency of each operation */
+static constexpr size_t nb_chains = 8;
+
+template <typename T> T fma(T a, T b, size_t length)
+{
+    auto acc = std::array<T, nb_chains>{};
+    std::iota(std::begin(acc), std::end(acc), T{0});
+
+    for (size_t i = 0; i < length; i++) {
+        for (auto& x : acc) { x = std::fma(x, a, b); }
+    }
+
+    return (std::accumulate(std::begin(acc), std::end(acc), T{0}));
+}
+
+float fma_float(float a, float b, size_t length) { return (fma(a, b, length)); }
+
+double fma_double(double a, double b, size_t length)
+{
+    return (fma(a, b, length));
+}
+
+} // namespace scalar
@@ -0,0 +1,13 @@
+#include "cpu/generator/load_functions.hpp"
+
+namespace scalar {
+
+/* Each load depends on the previous one, so nothing can be prefetched */
+int64_t pointer_chase_int64(const int64_t chain[], int64_t index, size_t length)
+{
+    for (size_t i = 0; i < length; i++) { index = chain[index]; }
+
+    return (index);
+}
+
+} // namespace scalar
@@ -2,9 +2,11 @@
 #define _OP_CPU_GENERATOR_TARGET_HPP_
 
 #include <numeric>
+#include <random>
 #include <variant>
 #include <vector>
 
+#include "cpu/generator/load_functions.hpp"
 #include "cpu/generator/load_types.hpp"
 #include "cpu/generator/matrix_functions.hpp"
 
@@ -44,7 +46,11 @@ unsigned do_matrix_ops(const Wrapper& wrapper,
     return (1);
 }
 
-template <typename InstructionSet, typename DataType> class target_op_impl
+template <typename Operation, typename InstructionSet, typename DataType>
+class target_op_impl;
+
+template <typename InstructionSet, typename DataType>
+class target_op_impl<operation::matrix, InstructionSet, DataType>
 {
     static constexpr auto size = 32;
 
@@ -96,10 +102,180 @@ public:
     }
 };
 
-template <typename... Pairs>
-std::variant<
-    target_op_impl<typename Pairs::first_type, typename Pairs::second_type>...>
-    as_target_op_variant(type_list<Pairs...>);
+/*
+ * The remaining operations are sized so that a single call takes roughly
+ * as long as a scalar matrix multiplication, e.g. tens of microseconds.
+ */
+
+template <typename InstructionSet, typename DataType>
+class target_op_impl<operation::crc, InstructionSet, DataType>
+{
+    static constexpr auto size = 4096 / sizeof(DataType);
+
+    std::vector<DataType> data;
+    mutable uint32_t crc = 0;
+
+public:
+    target_op_impl()
+        : data(size)
+    {
+        std::iota(std::begin(data), std::end(data), 1);
+    }
+
+    unsigned operator()() const
+    {
+        constexpr auto use_sse4 =
+            std::is_same_v<InstructionSet, instruction_set::sse4>;
+#if defined(__x86_64__)
+        if constexpr (use_sse4 && std::is_same_v<DataType, int32_t>) {
+            crc = sse4::crc32c_int32(data.data(), data.size(), crc);
+            return (1);
+        } else if constexpr (use_sse4 && std::is_same_v<DataType, int64_t>) {
+            crc = sse4::crc32c_int64(data.data(), data.size(), crc);
+            return (1);
+        }
+#endif
+        if constexpr (std::is_same_v<DataType, int32_t>) {
+            crc = scalar::crc32c_int32(data.data(), data.size(), crc);
+        } else if constexpr (std::is_same_v<DataType, int64_t>) {
+            crc = scalar::crc32c_int64(data.data(), data.size(), crc);
+        }
+
+        return (1);
+    }
+};
+
+template <typename InstructionSet, typename DataType>
+class target_op_impl<operation::branch, InstructionSet, DataType>
+{
+    static constexpr auto size = 4096;
+
+    mutable uint64_t state;
+    mutable DataType sink = 0;
+
+public:
+    target_op_impl()
+        : state(std::random_device{}() | 1)
+    {}
+
+    unsigned operator()() const
+    {
+        if constexpr (std::is_same_v<DataType, int32_t>) {
+            sink += scalar::branch_int32(&state, size);
+        } else if constexpr (std::is_same_v<DataType, int64_t>) {
+            sink += scalar::branch_int64(&state, size);
+        }
+
+        return (1);
+    }
+};
+
+/*
+ * Generate a single random cycle through a buffer much larger than any
+ * last level cache.  Links are a cache line apart so that every step
+ * touches a new line.  The chain is read-only, so share it between all
+ * targets instead of allocating one per target.
+ */
+constexpr size_t pointer_chase_stride = 64 / sizeof(int64_t);
+
+inline const std::vector<int64_t>& get_pointer_chase_chain()
+{
+    static const auto chain = []() {
+        constexpr auto chain_size = 64 * 1024 * 1024 / sizeof(int64_t);
+        constexpr auto stride = pointer_chase_stride;
+        constexpr auto nb_links = chain_size / stride;
+
+        auto links = std::vector<int64_t>(nb_links);
+        std::iota(std::begin(links), std::end(links), 0);
+
+        /* Sattolo's algorithm; the result is one cycle of every link */
+        auto generator = std::minstd_rand{std::random_device{}()};
+        for (auto i = nb_links - 1; i > 0; i--) {
+            auto j = std::uniform_int_distribution<size_t>(0, i - 1)(generator);
+            std::swap(links[i], links[j]);
+        }
+
+        auto chain = std::vector<int64_t>(chain_size);
+        for (size_t i = 0; i < nb_links; i++) {
+            chain[i * stride] = links[i] * stride;
+        }
+        return (chain);
+    }();
+
+    return (chain);
+}
+
+template <typename InstructionSet, typename DataType>
+class target_op_impl<operation::pointer_chase, InstructionSet, DataType>
+{
+    static constexpr auto size = 256;
+
+    const int64_t* chain;
+    mutable int64_t index;
+
+public:
+    /* Start each target at a random link so targets don't share lines */
+    target_op_impl()
+        : chain(get_pointer_chase_chain().data())
+        , index(std::random_device{}()
+                % (get_pointer_chase_chain().size() / pointer_chase_stride)
+                * pointer_chase_stride)
+    {}
+
+    unsigned operator()() const
+    {
+        index = scalar::pointer_chase_int64(chain, index, size);
+        return (1);
+    }
+};
+
+template <typename InstructionSet, typename DataType>
+class target_op_impl<operation::fma, InstructionSet, DataType>
+{
+    static constexpr auto size = 4096;
+
+    /* The accumulators converge on b / (1 - a) = 1; no overflow or denormals */
+    static constexpr auto a = DataType{0.5};
+    static constexpr auto b = DataType{0.5};
+
+    mutable DataType sink = 0;
+
+public:
+    unsigned operator()() const
+    {
+#if defined(__x86_64__)
+        if constexpr (std::is_same_v<InstructionSet, instruction_set::avx2>) {
+            if constexpr (std::is_same_v<DataType, float>) {
+                sink += avx2::fma_float(a, b, size);
+            } else {
+                sink += avx2::fma_double(a, b, size);
+            }
+            return (1);
+        } else if constexpr (std::is_same_v<InstructionSet,
+                                            instruction_set::avx512>) {
+            if constexpr (std::is_same_v<DataType, float>) {
+                sink += avx512::fma_float(a, b, size);
+            } else {
+                sink += avx512::fma_double(a, b, size);
+            }
+            return (1);
+        }
+#endif
+        if constexpr (std::is_same_v<DataType, float>) {
+            sink += scalar::fma_float(a, b, size);
+        } else {
+            sink += scalar::fma_double(a, b, size);
+        }
+
+        return (1);
+    }
+};
+
+template <typename... Loads>
+std::variant<target_op_impl<typename Loads::operation_type,
+                            typename Loads::instruction_set_type,
+                            typename Loads::data_type>...>
+    as_target_op_variant(type_list<Loads...>);
 
 using target_op = decltype(as_target_op_variant(load_types{}));
 
@@ -1,6 +1,7 @@
 #include "core/op_core.h"
 #include "cpu/generator/config.hpp"
 #include "cpu/generator/coordinator.hpp"
+#include "cpu/generator/hardware_counters.hpp"
 #include "cpu/generator/matrix_functions.hpp"
 #include "cpu/generator/system_stats.hpp"
 #include "cpu/generator/target.hpp"
@@ -118,6 +119,9 @@ class worker : public finite_state_machine<worker, state, command_msg>
 
     utilization_time<clock> m_ref;
 
+    hardware_counters m_counters;
+    std::optional<counter_values> m_counters_ref;
+
     /*
      * We need these clock based values to be double based.
      * Use a prime quanta value to avoid any sort of potential
@@ -149,6 +153,7 @@ public:
                     [&](const auto& config) {
                         using config_type = remove_cvref_t<decltype(config)>;
                         using op_type = target_op_impl<
+                            typename config_type::operation_type,
                             typename config_type::instruction_set_type,
                             typename config_type::data_type>;
 
@@ -212,6 +217,10 @@ public:
         thread_stats.target = std::chrono::duration_cast<clock::duration>(
             (ut.time_stamp - m_ref.time_stamp) * m_ref_ratio);
 
+        if (auto counters = m_counters.read(); counters && m_counters_ref) {
+            thread_stats.counters = *counters - *m_counters_ref;
+        }
+
         return (0);
     }
 
@@ -235,6 +244,7 @@ public:
 
         /* Initialize result values */
         m_ref = get_thread_utilization_time<clock>();
+        m_counters_ref = m_counters.read();
         init_stats(m_result->shard(m_id), m_ref.time_stamp, get_steal_time());
 
         return (state_started{});
@@ -0,0 +1,46 @@
+#include <immintrin.h>
+
+#include "cpu/generator/load_functions.hpp"
+#include "cpu/generator/x86/fma.tcc"
+
+namespace avx2 {
+
+struct float_traits
+{
+    using value_type = float;
+    using vector = __m256;
+
+    static vector set1(float x) { return (_mm256_set1_ps(x)); }
+    static vector add(vector a, vector b) { return (_mm256_add_ps(a, b)); }
+    static vector fmadd(vector a, vector b, vector c)
+    {
+        return (_mm256_fmadd_ps(a, b, c));
+    }
+    static void store(float* dst, vector x) { _mm256_storeu_ps(dst, x); }
+};
+
+struct double_traits
+{
+    using value_type = double;
+    using vector = __m256d;
+
+    static vector set1(double x) { return (_mm256_set1_pd(x)); }
+    static vector add(vector a, vector b) { return (_mm256_add_pd(a, b)); }
+    static vector fmadd(vector a, vector b, vector c)
+    {
+        return (_mm256_fmadd_pd(a, b, c));
+    }
+    static void store(double* dst, vector x) { _mm256_storeu_pd(dst, x); }
+};
+
+float fma_float(float a, float b, size_t length)
+{
+    return (fma<float_traits>(a, b, length));
+}
+
+double fma_double(double a, double b, size_t length)
+{
+    return (fma<double_traits>(a, b, length));
+}
+
+} // namespace avx2
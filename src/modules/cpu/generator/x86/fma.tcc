@@ -0,0 +1,59 @@
+#ifndef _OP_CPU_GENERATOR_X86_FMA_TCC_
+#define _OP_CPU_GENERATOR_X86_FMA_TCC_
+
+#include <iterator>
+#include <numeric>
+#include <utility>
+
+/*
+ * Shared FMA loop for the vector instruction sets.  This file gets
+ * compiled with different ISA flags in each including translation unit,
+ * so keep everything here out of the global namespace.
+ */
+
+namespace {
+
+/* Enough independent chains to keep two FMA ports busy */
+constexpr size_t nb_chains = 8;
+
+template <typename Traits, size_t... N>
+void fmadd_all(typename Traits::vector acc[],
+               typename Traits::vector a,
+               typename Traits::vector b,
+               std::index_sequence<N...>)
+{
+    ((acc[N] = Traits::fmadd(acc[N], a, b)), ...);
+}
+
+template <typename Traits>
+typename Traits::value_type fma(typename Traits::value_type a,
+                                typename Traits::value_type b,
+                                size_t length)
+{
+    using value_type = typename Traits::value_type;
+    using vector = typename Traits::vector;
+
+    auto va = Traits::set1(a);
+    auto vb = Traits::set1(b);
+
+    vector acc[nb_chains];
+    for (size_t i = 0; i < nb_chains; i++) {
+        acc[i] = Traits::set1(static_cast<value_type>(i));
+    }
+
+    for (size_t i = 0; i < length; i++) {
+        fmadd_all<Traits>(acc, va, vb, std::make_index_sequence<nb_chains>{});
+    }
+
+    for (size_t i = 1; i < nb_chains; i++) {
+        acc[0] = Traits::add(acc[0], acc[i]);
+    }
+
+    value_type lanes[sizeof(vector) / sizeof(value_type)];
+    Traits::store(lanes, acc[0]);
+    return (std::accumulate(std::begin(lanes), std::end(lanes), value_type{0}));
+}
+
+} // namespace
+
+#endif /* _OP_CPU_GENERATOR_X86_FMA_TCC_ */
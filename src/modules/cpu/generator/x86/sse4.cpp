@@ -0,0 +1,26 @@
+#include <nmmintrin.h>
+
+#include "cpu/generator/load_functions.hpp"
+
+namespace sse4 {
+
+uint32_t crc32c_int32(const int32_t data[], size_t length, uint32_t crc)
+{
+    for (size_t i = 0; i < length; i++) {
+        crc = _mm_crc32_u32(crc, static_cast<uint32_t>(data[i]));
+    }
+
+    return (crc);
+}
+
+uint32_t crc32c_int64(const int64_t data[], size_t length, uint32_t crc)
+{
+    auto crc64 = uint64_t{crc};
+    for (size_t i = 0; i < length; i++) {
+        crc64 = _mm_crc32_u64(crc64, static_cast<uint64_t>(data[i]));
+    }
+
+    return (static_cast<uint32_t>(crc64));
+}
+
+} // namespace sse4
@@ -3,6 +3,9 @@
 #include "core/op_core.h"
 #include "cpu/api.hpp"
 #include "cpu/arg_parser.hpp"
+#include "cpu/generator/config.hpp"
+#include "cpu/generator/instruction_set.hpp"
+#include "cpu/generator/load_traits.hpp"
 #include "dynamic/validator.tcc"
 
 #include "swagger/v1/model/CpuGenerator.h"
@@ -20,31 +23,51 @@ static bool is_valid_name_stat(std::string_view name)
 {
     if (name == "timestamp" || name == "available" || name == "utilization"
         || name == "target" || name == "system" || name == "user"
-        || name == "steal" || name == "error") {
+        || name == "steal" || name == "error" || name == "cycles"
+        || name == "instructions" || name == "cache_misses") {
         return (true);
     }
 
     return (false);
 }
 
+/* Target names are "instruction_set,data_type[,operation]" */
+static bool is_valid_target_name(std::string_view name)
+{
+    auto instr = std::string(16, '\0');
+    auto data = std::string(16, '\0');
+    auto op = std::string(16, '\0');
+
+    auto fields = sscanf(std::string(name).c_str(),
+                         "%15[^,],%15[^,],%15s",
+                         instr.data(),
+                         data.data(),
+                         op.data());
+    if (fields < 2) { return (false); }
+
+    return (generator::to_load_index<generator::target_op_config>(
+                {.operation = fields == 3 ? to_operation_type(op.c_str())
+                                          : operation_type::matrix,
+                 .instruction_set = to_instruction_type(instr.c_str()),
+                 .data = to_data_type(data.c_str())})
+                .has_value());
+}
+
 bool cpu_dynamic_validator::is_valid_stat(std::string_view name)
 {
     if (is_valid_name_stat(name)) { return (true); }
 
     auto core_idx = 0U;
-    auto instr = std::string(16, '\0');
-    auto data = std::string(16, '\0');
+    auto target = std::string(48, '\0');
     auto op = std::string(10, '\0'); /* "operations".size() == 10 */
 
     if (sscanf(std::string(name).c_str(),
-               "cores[%d].targets[%15[^,],%15[^]]].%10s",
+               "cores[%d].targets[%47[^]]].%10s",
                &core_idx,
-               instr.data(),
-               data.data(),
+               target.data(),
                op.data())
-            == 4
-        && to_instruction_type(instr.c_str()) != instruction_type::none
-        && to_data_type(data.c_str()) != data_type::none
+            == 3
+        && is_valid_target_name(target.c_str())
         && op == "operations") {
         return (true);
     }
@@ -60,6 +83,28 @@ bool cpu_dynamic_validator::is_valid_stat(std::string_view name)
     return (false);
 }
 
+static instruction_set::type to_instruction_set(instruction_type type)
+{
+    switch (type) {
+    case instruction_type::scalar:
+        return (instruction_set::type::SCALAR);
+    case instruction_type::sse2:
+        return (instruction_set::type::SSE2);
+    case instruction_type::sse4:
+        return (instruction_set::type::SSE4);
+    case instruction_type::avx:
+        return (instruction_set::type::AVX);
+    case instruction_type::avx2:
+        return (instruction_set::type::AVX2);
+    case instruction_type::avx512:
+        return (instruction_set::type::AVX512SKX);
+    case instruction_type::neon:
+        return (instruction_set::type::NEON);
+    default:
+        return (instruction_set::type::NONE);
+    }
+}
+
 static void is_valid(const swagger::v1::model::CpuGeneratorCoreConfig& config,
                      std::vector<std::string>& errors)
 {
@@ -95,6 +140,33 @@ static void is_valid(const swagger::v1::model::CpuGeneratorCoreConfig& config,
             if (to_data_type(data) == data_type::none) {
                 errors.emplace_back("Data type, " + data + ", is not valid.");
             }
+
+            auto op = target->operationIsSet()
+                          ? to_operation_type(target->getOperation())
+                          : operation_type::matrix;
+            if (op == operation_type::none) {
+                errors.emplace_back("Operation, " + target->getOperation()
+                                    + ", is not valid.");
+                return;
+            }
+
+            if (op == operation_type::matrix) { return; }
+
+            /* The other operations only support specific combinations */
+            auto names = generator::load_names{
+                .operation = op,
+                .instruction_set = to_instruction_type(instr),
+                .data = to_data_type(data)};
+            if (!generator::to_load_index<generator::target_op_config>(names)) {
+                errors.emplace_back("Operation, " + to_string(op)
+                                    + ", does not support instruction set, "
+                                    + instr + ", with data type, " + data
+                                    + ".");
+            } else if (!instruction_set::available(
+                           to_instruction_set(names.instruction_set))) {
+                errors.emplace_back("Instruction set, " + instr
+                                    + ", is not available on this CPU.");
+            }
         });
 }
 
@@ -42,10 +42,32 @@ using mem_generator_result_ptr = std::unique_ptr<mem_generator_result_type>;
 using mem_info_type = swagger::v1::model::MemoryInfoResult;
 using mem_info_ptr = std::unique_ptr<mem_info_type>;
 
-enum class pattern_type { none = 0, random, sequential, reverse };
+enum class pattern_type {
+    none = 0,
+    random,
+    sequential,
+    reverse,
+    pointer_chase
+};
 pattern_type to_pattern_type(std::string_view name);
 std::string to_string(pattern_type type);
 
+enum class page_size_type { none = 0, standard, huge_2mb, huge_1gb };
+page_size_type to_page_size_type(std::string_view name);
+std::string to_string(page_size_type type);
+
+enum class access_kernel_type {
+    none = 0,
+    automatic,
+    scalar,
+    sse4,
+    avx2,
+    avx512,
+    rep_movsb
+};
+access_kernel_type to_access_kernel_type(std::string_view name);
+std::string to_string(access_kernel_type type);
+
 /**
  * Memory server requests
  */
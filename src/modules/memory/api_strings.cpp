@@ -7,7 +7,23 @@ constexpr auto pattern_type_names =
     utils::associative_array<std::string_view, pattern_type>(
         std::pair("random", pattern_type::random),
         std::pair("sequential", pattern_type::sequential),
-        std::pair("reverse", pattern_type::reverse));
+        std::pair("reverse", pattern_type::reverse),
+        std::pair("pointer_chase", pattern_type::pointer_chase));
+
+constexpr auto page_size_type_names =
+    utils::associative_array<std::string_view, page_size_type>(
+        std::pair("standard", page_size_type::standard),
+        std::pair("huge_2mb", page_size_type::huge_2mb),
+        std::pair("huge_1gb", page_size_type::huge_1gb));
+
+constexpr auto access_kernel_type_names =
+    utils::associative_array<std::string_view, access_kernel_type>(
+        std::pair("automatic", access_kernel_type::automatic),
+        std::pair("scalar", access_kernel_type::scalar),
+        std::pair("sse4", access_kernel_type::sse4),
+        std::pair("avx2", access_kernel_type::avx2),
+        std::pair("avx512", access_kernel_type::avx512),
+        std::pair("rep_movsb", access_kernel_type::rep_movsb));
 
 pattern_type to_pattern_type(std::string_view name)
 {
@@ -21,4 +37,28 @@ std::string to_string(pattern_type type)
         utils::value_to_key(pattern_type_names, type).value_or("unknown")));
 }
 
+page_size_type to_page_size_type(std::string_view name)
+{
+    return (utils::key_to_value(page_size_type_names, name)
+                .value_or(page_size_type::none));
+}
+
+std::string to_string(page_size_type type)
+{
+    return (std::string(
+        utils::value_to_key(page_size_type_names, type).value_or("unknown")));
+}
+
+access_kernel_type to_access_kernel_type(std::string_view name)
+{
+    return (utils::key_to_value(access_kernel_type_names, name)
+                .value_or(access_kernel_type::none));
+}
+
+std::string to_string(access_kernel_type type)
+{
+    return (std::string(utils::value_to_key(access_kernel_type_names, type)
+                            .value_or("unknown")));
+}
+
 } // namespace openperf::memory::api
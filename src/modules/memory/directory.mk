@@ -17,9 +17,32 @@ MEMORY_SOURCES += \
 	init.cpp \
 	memory_options.c \
 	memory_transmogrify.cpp \
+	numa.cpp \
 	server.cpp \
 	utils.cpp
 
+MEMORY_KERNEL_SOURCES := \
+	generator/kernels.cpp \
+	generator/kernels/scalar.cpp
+
+# Instruction set specific kernels; see generator/kernels.cpp
+ifeq ($(ARCH),x86_64)
+	MEMORY_KERNEL_SOURCES += \
+		generator/kernels/avx2.cpp \
+		generator/kernels/avx512.cpp \
+		generator/kernels/rep_movsb.cpp \
+		generator/kernels/sse4.cpp
+endif
+
+MEMORY_SOURCES += $(MEMORY_KERNEL_SOURCES)
+
+$(MEMORY_OBJ_DIR)/generator/kernels/sse4.o \
+$(MEMORY_TEST_OBJ_DIR)/generator/kernels/sse4.o: OP_CXXFLAGS += -msse4.1
+$(MEMORY_OBJ_DIR)/generator/kernels/avx2.o \
+$(MEMORY_TEST_OBJ_DIR)/generator/kernels/avx2.o: OP_CXXFLAGS += -mavx2
+$(MEMORY_OBJ_DIR)/generator/kernels/avx512.o \
+$(MEMORY_TEST_OBJ_DIR)/generator/kernels/avx512.o: OP_CXXFLAGS += -mavx512f
+
 MEMORY_VERSIONED_FILES := init.cpp
 MEMORY_UNVERSIONED_OBJECTS := \
 	$(call op_generate_objects,$(filter-out $(MEMORY_VERSIONED_FILES),$(MEMORY_SOURCES)),$(MEMORY_OBJ_DIR))
@@ -33,4 +56,7 @@ $(MEMORY_OBJ_DIR)/init.o: OP_CPPFLAGS += \
 MEMORY_TEST_DEPENDS +=
 
 MEMORY_TEST_SOURCES += \
+	api_strings.cpp \
 	generator/buffer.cpp \
+	numa.cpp \
+	$(MEMORY_KERNEL_SOURCES)
@@ -5,29 +5,77 @@
 #include <string>
 
 #include "sys/mman.h"
+#include <linux/mman.h>
+#include <unistd.h>
 
 #include "core/op_log.h"
 #include "memory/generator/buffer.hpp"
+#include "memory/numa.hpp"
 
 namespace openperf::memory::generator {
 
-buffer::buffer(size_t size)
-    : m_data(static_cast<std::byte*>(mmap(nullptr,
-                                          size,
+static size_t to_page_size(api::page_size_type type)
+{
+    switch (type) {
+    case api::page_size_type::huge_2mb:
+        return (1UL << 21);
+    case api::page_size_type::huge_1gb:
+        return (1UL << 30);
+    default:
+        return (sysconf(_SC_PAGESIZE));
+    }
+}
+
+static int to_mmap_flags(api::page_size_type type)
+{
+    switch (type) {
+    case api::page_size_type::huge_2mb:
+        return (MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | MAP_HUGE_2MB);
+    case api::page_size_type::huge_1gb:
+        return (MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | MAP_HUGE_1GB);
+    default:
+        return (MAP_PRIVATE | MAP_ANONYMOUS);
+    }
+}
+
+static size_t align_up(size_t size, size_t alignment)
+{
+    return ((size + alignment - 1) / alignment * alignment);
+}
+
+buffer::buffer(size_t size,
+               api::page_size_type page_size,
+               std::optional<unsigned> numa_node)
+    : m_length(size)
+    , m_map_length(align_up(size, to_page_size(page_size)))
+{
+    m_data = static_cast<std::byte*>(mmap(nullptr,
+                                          m_map_length,
                                           PROT_READ | PROT_WRITE,
-                                          MAP_PRIVATE | MAP_ANONYMOUS,
+                                          to_mmap_flags(page_size),
                                           -1,
-                                          0)))
-    , m_length(size)
-{
+                                          0));
     if (m_data == MAP_FAILED) {
-        fprintf(stderr, "mmap failed! %s\n", strerror(errno));
-        fflush(stderr);
+        OP_LOG(OP_LOG_ERROR,
+               "Could not map %zu byte buffer with %s pages: %s\n",
+               m_map_length,
+               to_string(page_size).c_str(),
+               strerror(errno));
         throw std::bad_alloc();
     }
 
+    /* Bind before locking; locking faults the pages in */
+    if (numa_node) {
+        if (auto error = numa::bind(m_data, m_map_length, *numa_node)) {
+            OP_LOG(OP_LOG_WARNING,
+                   "Could not bind memory buffer to NUMA node %u: %s\n",
+                   *numa_node,
+                   strerror(error));
+        }
+    }
+
     /* Lock the buffer to ensure it stays in memory */
-    if (auto error = mlock(m_data, size)) {
+    if (auto error = mlock(m_data, m_map_length)) {
         OP_LOG(OP_LOG_WARNING,
                "Could not lock memory buffer; do you need to increase your "
                "resource limit?\n");
@@ -39,14 +87,14 @@ buffer::buffer(size_t size)
          * The kernel may be doing memory compression or may not be allocating memory
          * (sparse allocation) because the memory is never written to.
          */
-        if (auto error = madvise(m_data, size, MADV_WILLNEED)) {
+        if (auto error = madvise(m_data, m_map_length, MADV_WILLNEED)) {
             OP_LOG(OP_LOG_ERROR,
                    "madvise failed (%zu bytes @ %p): %s\n",
-                   size,
+                   m_map_length,
                    m_data,
                    strerror(errno));
         }
-        std::memset(m_data, 0, size);
+        std::memset(m_data, 0, m_map_length);
     }
 
     OP_LOG(OP_LOG_DEBUG,
@@ -58,18 +106,18 @@ buffer::buffer(size_t size)
 buffer::~buffer()
 {
     /* Unlocking is probably unnecessary, but I like symmetry. */
-    if (munlock(m_data, m_length) == -1) {
+    if (munlock(m_data, m_map_length) == -1) {
         OP_LOG(OP_LOG_ERROR,
                "Could not unlock memory (%zu bytes @ %p): %s\n",
-               m_length,
+               m_map_length,
                m_data,
                strerror(errno));
     }
 
-    if (munmap(m_data, m_length) == -1) {
+    if (munmap(m_data, m_map_length) == -1) {
         OP_LOG(OP_LOG_ERROR,
                "Could not unmap memory (%zu bytes @ %p): %s\n",
-               m_length,
+               m_map_length,
                m_data,
                strerror(errno));
     }
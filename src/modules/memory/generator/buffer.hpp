@@ -2,6 +2,9 @@
 #define _OP_MEMORY_GENERATOR_BUFFER_HPP_
 
 #include <cstddef>
+#include <optional>
+
+#include "memory/api.hpp"
 
 namespace openperf::memory::generator {
 
@@ -9,9 +12,20 @@ class buffer
 {
     std::byte* m_data;
     size_t m_length;
+    size_t m_map_length; /* m_length rounded up to a page multiple */
 
 public:
-    buffer(size_t size);
+    /**
+     * Allocate a locked, anonymous buffer of the specified size.
+     *
+     * Huge page backed buffers require pre-allocated huge pages of
+     * the requested size; we throw std::bad_alloc if they aren't
+     * available. If a NUMA node is specified, then the buffer's pages
+     * are bound to that node before they are faulted in.
+     */
+    buffer(size_t size,
+           api::page_size_type page_size = api::page_size_type::standard,
+           std::optional<unsigned> numa_node = std::nullopt);
     ~buffer();
 
     std::byte* data();
@@ -1,6 +1,8 @@
 #ifndef _OP_MEMORY_GENERATOR_CONFIG_HPP_
 #define _OP_MEMORY_GENERATOR_CONFIG_HPP_
 
+#include <optional>
+
 #include "memory/api.hpp"
 #include "units/rate.hpp"
 
@@ -14,11 +16,16 @@ struct io_config
     unsigned io_size;
     unsigned io_threads;
     api::pattern_type io_pattern;
+    std::optional<unsigned> numa_node; /* run threads on this node's CPUs */
 };
 
 struct config
 {
     uint64_t buffer_size;
+    api::page_size_type buffer_page_size;
+    std::optional<unsigned> buffer_numa_node;
+    api::access_kernel_type access_kernel;
+    bool non_temporal; /* bypass the cache with streaming loads/stores */
     io_config read;
     io_config write;
 };
@@ -37,6 +37,25 @@ result_extractor(const std::vector<result::thread_shard>& shards,
                       [](const io_stats& s) {
                           return (to_nanoseconds(s.latency).count());
                       }),
+            std::pair("latency_p50",
+                      [](const io_stats& s) {
+                          return (s.latency_histogram.value_at_quantile(0.5));
+                      }),
+            std::pair("latency_p99",
+                      [](const io_stats& s) {
+                          return (
+                              s.latency_histogram.value_at_quantile(0.99));
+                      }),
+            std::pair("latency_p999",
+                      [](const io_stats& s) {
+                          return (
+                              s.latency_histogram.value_at_quantile(0.999));
+                      }),
+            std::pair("latency_p9999",
+                      [](const io_stats& s) {
+                          return (
+                              s.latency_histogram.value_at_quantile(0.9999));
+                      }),
             std::pair("ops_actual",
                       [](const io_stats& s) { return (s.ops_actual); }),
             std::pair("ops_target",
@@ -143,7 +162,8 @@ coordinator::coordinator(void* context, struct config&& conf)
     , m_prev_sum(std::nullopt)
     , m_pids{.read = pid_controller(0.07, 1. / 9, 0),
              .write = pid_controller(0.07, 1. / 9, 0)}
-    , m_buffer(conf.buffer_size)
+    , m_buffer(
+          conf.buffer_size, conf.buffer_page_size, conf.buffer_numa_node)
 {
     const auto endpoint = m_client.endpoint();
     const auto id = coordinator_id();
@@ -164,7 +184,10 @@ coordinator::coordinator(void* context, struct config&& conf)
                 .io_size = m_config.read.io_size,
                 .io_rate = rate_distribute(
                     m_config.read.io_rate, m_config.read.io_threads, idx),
-                .io_pattern = m_config.read.io_pattern};
+                .io_pattern = m_config.read.io_pattern,
+                .io_kernel = m_config.access_kernel,
+                .non_temporal = m_config.non_temporal,
+                .numa_node = m_config.read.numa_node};
 
             offset += nb_blocks;
             auto start_token = std::promise<void>{};
@@ -194,7 +217,10 @@ coordinator::coordinator(void* context, struct config&& conf)
                 .io_size = m_config.write.io_size,
                 .io_rate = rate_distribute(
                     m_config.write.io_rate, m_config.write.io_threads, idx),
-                .io_pattern = m_config.write.io_pattern};
+                .io_pattern = m_config.write.io_pattern,
+                .io_kernel = m_config.access_kernel,
+                .non_temporal = m_config.non_temporal,
+                .numa_node = m_config.write.numa_node};
 
             offset += nb_blocks;
             auto start_token = std::promise<void>{};
@@ -0,0 +1,122 @@
+#ifndef _OP_MEMORY_GENERATOR_INDEX_GENERATOR_HPP_
+#define _OP_MEMORY_GENERATOR_INDEX_GENERATOR_HPP_
+
+#include <array>
+#include <cassert>
+#include <cstdint>
+
+#include "memory/api.hpp"
+
+namespace openperf::memory::generator {
+
+/**
+ * Generate the block index for any position in an access pattern without
+ * storing the pattern. Every pattern visits each index in [min, max)
+ * exactly once per cycle.
+ *
+ * Random patterns use a keyed, invertible scramble of the smallest power
+ * of two domain that covers the range. Values outside of the range are
+ * scrambled again until they land inside of it, which preserves the
+ * permutation and takes less than two rounds on average.
+ */
+class index_generator
+{
+public:
+    index_generator(api::pattern_type pattern,
+                    size_t min,
+                    size_t max,
+                    uint64_t seed = 0)
+        : m_pattern(pattern)
+        , m_min(min)
+        , m_size(max - min)
+        , m_mask(to_mask(m_size))
+        , m_shift(to_shift(m_mask))
+    {
+        assert(min <= max);
+
+        /* splitmix64; we just need well mixed keys and odd multipliers */
+        for (auto& round : m_rounds) {
+            seed += 0x9e3779b97f4a7c15;
+            auto z = seed;
+            z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+            z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+            z ^= (z >> 31);
+            round = {.key = z & m_mask, .multiplier = z | 1};
+        }
+    }
+
+    size_t size() const { return (m_size); }
+
+    size_t operator[](size_t position) const
+    {
+        assert(position < m_size);
+
+        switch (m_pattern) {
+        case api::pattern_type::random:
+        case api::pattern_type::pointer_chase:
+            return (m_min + permute(position));
+        case api::pattern_type::reverse:
+            return (m_min + m_size - 1 - position);
+        default:
+            return (m_min + position);
+        }
+    }
+
+private:
+    static constexpr size_t nb_rounds = 3;
+
+    static uint64_t to_mask(size_t size)
+    {
+        auto mask = uint64_t{0};
+        if (size < 2) { return (mask); }
+        while (mask < size - 1) { mask = (mask << 1) | 1; }
+        return (mask);
+    }
+
+    static unsigned to_shift(uint64_t mask)
+    {
+        auto bits = 0U;
+        while (bits < 64 && (mask >> bits)) { bits++; }
+        return (bits / 2 + 1);
+    }
+
+    /*
+     * Each step is a bijection on [0, m_mask], so the composition is, too:
+     * xor with a key, multiply by an odd number modulo a power of two, and
+     * xor with a right shift of the value.
+     */
+    uint64_t scramble(uint64_t x) const
+    {
+        for (const auto& round : m_rounds) {
+            x ^= round.key;
+            x = (x * round.multiplier) & m_mask;
+            x ^= x >> m_shift;
+        }
+        return (x);
+    }
+
+    uint64_t permute(uint64_t x) const
+    {
+        do {
+            x = scramble(x);
+        } while (x >= m_size);
+        return (x);
+    }
+
+    struct round_key
+    {
+        uint64_t key;
+        uint64_t multiplier;
+    };
+
+    api::pattern_type m_pattern;
+    size_t m_min;
+    size_t m_size;
+    uint64_t m_mask;
+    unsigned m_shift;
+    std::array<round_key, nb_rounds> m_rounds;
+};
+
+} // namespace openperf::memory::generator
+
+#endif /* _OP_MEMORY_GENERATOR_INDEX_GENERATOR_HPP_ */
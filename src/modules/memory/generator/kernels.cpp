@@ -0,0 +1,111 @@
+#include "core/op_log.h"
+#include "memory/generator/kernels.hpp"
+#include "utils/associative_array.hpp"
+
+namespace openperf::memory::generator::kernel {
+
+/*
+ * Each instruction set specific kernel lives in its own translation unit
+ * that is compiled with the flags for that instruction set. Only call
+ * into them after checking that the CPU supports them.
+ */
+namespace scalar {
+functions get_functions(bool non_temporal);
+}
+
+#if defined(__x86_64__)
+namespace sse4 {
+functions get_functions(bool non_temporal);
+}
+namespace avx2 {
+functions get_functions(bool non_temporal);
+}
+namespace avx512 {
+functions get_functions(bool non_temporal);
+}
+namespace rep_movsb {
+functions get_functions(bool non_temporal);
+}
+#endif
+
+using functions_factory = functions (*)(bool);
+
+static constexpr auto kernel_factories =
+    utils::associative_array<api::access_kernel_type, functions_factory>(
+#if defined(__x86_64__)
+        std::pair(api::access_kernel_type::sse4, sse4::get_functions),
+        std::pair(api::access_kernel_type::avx2, avx2::get_functions),
+        std::pair(api::access_kernel_type::avx512, avx512::get_functions),
+        std::pair(api::access_kernel_type::rep_movsb,
+                  rep_movsb::get_functions),
+#endif
+        std::pair(api::access_kernel_type::scalar, scalar::get_functions));
+
+bool available(api::access_kernel_type type)
+{
+#if defined(__x86_64__)
+    __builtin_cpu_init();
+#endif
+
+    switch (type) {
+    case api::access_kernel_type::automatic:
+    case api::access_kernel_type::scalar:
+        return (true);
+#if defined(__x86_64__)
+    case api::access_kernel_type::sse4:
+        return (__builtin_cpu_supports("sse4.1"));
+    case api::access_kernel_type::avx2:
+        return (__builtin_cpu_supports("avx2"));
+    case api::access_kernel_type::avx512:
+        return (__builtin_cpu_supports("avx512f"));
+    case api::access_kernel_type::rep_movsb:
+        return (true);
+#endif
+    default:
+        return (false);
+    }
+}
+
+bool supports_non_temporal(api::access_kernel_type type)
+{
+    switch (type) {
+    case api::access_kernel_type::automatic:
+    case api::access_kernel_type::sse4:
+    case api::access_kernel_type::avx2:
+    case api::access_kernel_type::avx512:
+        return (true);
+    default:
+        return (false);
+    }
+}
+
+api::access_kernel_type resolve(api::access_kernel_type type)
+{
+    if (type != api::access_kernel_type::automatic) { return (type); }
+
+    for (auto candidate : {api::access_kernel_type::avx512,
+                           api::access_kernel_type::avx2,
+                           api::access_kernel_type::sse4}) {
+        if (available(candidate)) { return (candidate); }
+    }
+
+    return (api::access_kernel_type::scalar);
+}
+
+functions get_functions(api::access_kernel_type type, bool non_temporal)
+{
+    type = resolve(type);
+    if (!available(type)) {
+        OP_LOG(OP_LOG_WARNING,
+               "CPU does not support the %s memory access kernel; "
+               "using the scalar kernel instead\n",
+               to_string(type).c_str());
+        type = api::access_kernel_type::scalar;
+    }
+
+    auto factory = utils::key_to_value(kernel_factories, type)
+                       .value_or(scalar::get_functions);
+    return (factory(non_temporal && supports_non_temporal(type)));
+}
+
+} // namespace openperf::memory::generator::kernel
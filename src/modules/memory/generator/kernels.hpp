@@ -0,0 +1,26 @@
+#ifndef _OP_MEMORY_GENERATOR_KERNELS_HPP_
+#define _OP_MEMORY_GENERATOR_KERNELS_HPP_
+
+#include "memory/api.hpp"
+#include "memory/generator/kernels/functions.hpp"
+
+namespace openperf::memory::generator::kernel {
+
+/* Indicates whether the running CPU can use the specified kernel */
+bool available(api::access_kernel_type type);
+
+/* Indicates whether the kernel has non-temporal variants */
+bool supports_non_temporal(api::access_kernel_type type);
+
+/* Resolve automatic to the widest vector kernel the CPU supports */
+api::access_kernel_type resolve(api::access_kernel_type type);
+
+/*
+ * Retrieve the access functions for the specified kernel. Unavailable
+ * kernels fall back to scalar functions.
+ */
+functions get_functions(api::access_kernel_type type, bool non_temporal);
+
+} // namespace openperf::memory::generator::kernel
+
+#endif /* _OP_MEMORY_GENERATOR_KERNELS_HPP_ */
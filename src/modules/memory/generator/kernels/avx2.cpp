@@ -0,0 +1,43 @@
+#include "memory/generator/kernels/vector.tcc"
+
+namespace openperf::memory::generator::kernel::avx2 {
+
+struct traits
+{
+    using vector = __m256i;
+
+    static vector zero() { return (_mm256_setzero_si256()); }
+
+    static vector load(const std::byte* src)
+    {
+        return (_mm256_loadu_si256(reinterpret_cast<const __m256i*>(src)));
+    }
+
+    static vector load_stream(const std::byte* src)
+    {
+        return (
+            _mm256_stream_load_si256(reinterpret_cast<const __m256i*>(src)));
+    }
+
+    static void store(std::byte* dst, vector v)
+    {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), v);
+    }
+
+    static void store_stream(std::byte* dst, vector v)
+    {
+        _mm256_stream_si256(reinterpret_cast<__m256i*>(dst), v);
+    }
+
+    static vector bitwise_xor(vector a, vector b)
+    {
+        return (_mm256_xor_si256(a, b));
+    }
+};
+
+functions get_functions(bool non_temporal)
+{
+    return (get_vector_functions<traits>(non_temporal));
+}
+
+} // namespace openperf::memory::generator::kernel::avx2
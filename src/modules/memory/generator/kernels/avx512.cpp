@@ -0,0 +1,42 @@
+#include "memory/generator/kernels/vector.tcc"
+
+namespace openperf::memory::generator::kernel::avx512 {
+
+struct traits
+{
+    using vector = __m512i;
+
+    static vector zero() { return (_mm512_setzero_si512()); }
+
+    static vector load(const std::byte* src)
+    {
+        return (_mm512_loadu_si512(src));
+    }
+
+    static vector load_stream(const std::byte* src)
+    {
+        return (_mm512_stream_load_si512(const_cast<std::byte*>(src)));
+    }
+
+    static void store(std::byte* dst, vector v)
+    {
+        _mm512_storeu_si512(dst, v);
+    }
+
+    static void store_stream(std::byte* dst, vector v)
+    {
+        _mm512_stream_si512(reinterpret_cast<__m512i*>(dst), v);
+    }
+
+    static vector bitwise_xor(vector a, vector b)
+    {
+        return (_mm512_xor_si512(a, b));
+    }
+};
+
+functions get_functions(bool non_temporal)
+{
+    return (get_vector_functions<traits>(non_temporal));
+}
+
+} // namespace openperf::memory::generator::kernel::avx512
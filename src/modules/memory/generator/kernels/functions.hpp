@@ -0,0 +1,33 @@
+#ifndef _OP_MEMORY_GENERATOR_KERNELS_FUNCTIONS_HPP_
+#define _OP_MEMORY_GENERATOR_KERNELS_FUNCTIONS_HPP_
+
+#include <cstddef>
+
+namespace openperf::memory::generator::kernel {
+
+/*
+ * Memory access kernels. Readers load every byte of the source block and
+ * store the result in the sink, either as a copy or folded into its first
+ * bytes, so that the loads can't be optimized away. Writers copy the
+ * source block to the destination.
+ */
+using read_function = void (*)(const std::byte* src,
+                               size_t length,
+                               std::byte* sink);
+using write_function = void (*)(std::byte* dst,
+                                size_t length,
+                                const std::byte* src);
+
+/* Make previous non-temporal stores globally visible */
+using drain_function = void (*)();
+
+struct functions
+{
+    read_function read;
+    write_function write;
+    drain_function drain;
+};
+
+} // namespace openperf::memory::generator::kernel
+
+#endif /* _OP_MEMORY_GENERATOR_KERNELS_FUNCTIONS_HPP_ */
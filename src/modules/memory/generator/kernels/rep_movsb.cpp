@@ -0,0 +1,35 @@
+#include "memory/generator/kernels/functions.hpp"
+
+namespace openperf::memory::generator::kernel::rep_movsb {
+
+/*
+ * On CPUs with enhanced rep movsb (ERMS), microcode picks the copy strategy,
+ * including avoiding read-for-ownership of the destination for large
+ * copies.
+ */
+static void copy(void* dst, const void* src, size_t length)
+{
+    __asm__ volatile("rep movsb"
+                     : "+D"(dst), "+S"(src), "+c"(length)
+                     :
+                     : "memory");
+}
+
+static void read(const std::byte* src, size_t length, std::byte* sink)
+{
+    copy(sink, src, length);
+}
+
+static void write(std::byte* dst, size_t length, const std::byte* src)
+{
+    copy(dst, src, length);
+}
+
+static void drain() {}
+
+functions get_functions(bool)
+{
+    return (functions{.read = read, .write = write, .drain = drain});
+}
+
+} // namespace openperf::memory::generator::kernel::rep_movsb
@@ -0,0 +1,25 @@
+#include <cstring>
+
+#include "memory/generator/kernels/functions.hpp"
+
+namespace openperf::memory::generator::kernel::scalar {
+
+/* Let the C library pick the best copy routine for the block size */
+static void read(const std::byte* src, size_t length, std::byte* sink)
+{
+    std::memcpy(sink, src, length);
+}
+
+static void write(std::byte* dst, size_t length, const std::byte* src)
+{
+    std::memcpy(dst, src, length);
+}
+
+static void drain() {}
+
+functions get_functions(bool)
+{
+    return (functions{.read = read, .write = write, .drain = drain});
+}
+
+} // namespace openperf::memory::generator::kernel::scalar
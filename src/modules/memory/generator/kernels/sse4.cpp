@@ -0,0 +1,43 @@
+#include "memory/generator/kernels/vector.tcc"
+
+namespace openperf::memory::generator::kernel::sse4 {
+
+struct traits
+{
+    using vector = __m128i;
+
+    static vector zero() { return (_mm_setzero_si128()); }
+
+    static vector load(const std::byte* src)
+    {
+        return (_mm_loadu_si128(reinterpret_cast<const __m128i*>(src)));
+    }
+
+    static vector load_stream(const std::byte* src)
+    {
+        return (_mm_stream_load_si128(
+            reinterpret_cast<__m128i*>(const_cast<std::byte*>(src))));
+    }
+
+    static void store(std::byte* dst, vector v)
+    {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), v);
+    }
+
+    static void store_stream(std::byte* dst, vector v)
+    {
+        _mm_stream_si128(reinterpret_cast<__m128i*>(dst), v);
+    }
+
+    static vector bitwise_xor(vector a, vector b)
+    {
+        return (_mm_xor_si128(a, b));
+    }
+};
+
+functions get_functions(bool non_temporal)
+{
+    return (get_vector_functions<traits>(non_temporal));
+}
+
+} // namespace openperf::memory::generator::kernel::sse4
@@ -0,0 +1,159 @@
+#include <cstdint>
+#include <cstring>
+
+#include <immintrin.h>
+
+#include "memory/generator/kernels/functions.hpp"
+
+/*
+ * Generic vector kernels. Each instruction set translation unit defines a
+ * traits struct and includes this file.
+ *
+ * Note: these translation units are built with instruction set specific
+ * flags, so stick to our own static functions here. Inline functions from
+ * shared headers could be emitted with wider instructions than every CPU
+ * supports and then picked by the linker for everyone.
+ */
+
+namespace openperf::memory::generator::kernel {
+
+namespace {
+
+template <typename Traits> constexpr size_t width()
+{
+    return (sizeof(typename Traits::vector));
+}
+
+/* Bytes until p is aligned to the vector width, clamped to length */
+template <typename Traits>
+size_t to_aligned_length(const std::byte* p, size_t length)
+{
+    auto misalignment = reinterpret_cast<uintptr_t>(p) & (width<Traits>() - 1);
+    auto distance = misalignment ? width<Traits>() - misalignment : 0;
+    return (distance < length ? distance : length);
+}
+
+/* Fold any bytes we don't load as part of a vector */
+uint8_t fold(const std::byte* src, size_t length)
+{
+    auto x = uint8_t{0};
+    for (auto i = 0UL; i < length; i++) { x ^= static_cast<uint8_t>(src[i]); }
+    return (x);
+}
+
+/*
+ * Fold every byte of the vector. If we only used part of the accumulator,
+ * the compiler would be free to narrow the loads, too.
+ */
+template <typename Traits> uint8_t fold(typename Traits::vector v)
+{
+    alignas(typename Traits::vector) uint64_t words[width<Traits>() / 8];
+    Traits::store(reinterpret_cast<std::byte*>(words), v);
+
+    auto x = uint64_t{0};
+    for (auto word : words) { x ^= word; }
+    x ^= x >> 32;
+    x ^= x >> 16;
+    x ^= x >> 8;
+    return (static_cast<uint8_t>(x));
+}
+
+template <typename Traits, bool NonTemporal>
+typename Traits::vector load(const std::byte* src)
+{
+    if constexpr (NonTemporal) {
+        return (Traits::load_stream(src));
+    } else {
+        return (Traits::load(src));
+    }
+}
+
+template <typename Traits, bool NonTemporal>
+void store(std::byte* dst, typename Traits::vector v)
+{
+    if constexpr (NonTemporal) {
+        Traits::store_stream(dst, v);
+    } else {
+        Traits::store(dst, v);
+    }
+}
+
+/*
+ * Non-temporal loads and stores need aligned addresses, so handle the
+ * unaligned head of the block separately. Use four independent
+ * accumulators so that loads aren't serialized on a single register.
+ */
+template <typename Traits, bool NonTemporal>
+void read(const std::byte* src, size_t length, std::byte* sink)
+{
+    constexpr auto w = width<Traits>();
+
+    auto head = NonTemporal ? to_aligned_length<Traits>(src, length) : 0;
+    auto x = fold(src, head);
+    src += head;
+    length -= head;
+
+    auto acc0 = Traits::zero(), acc1 = Traits::zero(), acc2 = Traits::zero(),
+         acc3 = Traits::zero();
+    for (; length >= 4 * w; src += 4 * w, length -= 4 * w) {
+        acc0 = Traits::bitwise_xor(acc0, load<Traits, NonTemporal>(src));
+        acc1 = Traits::bitwise_xor(acc1, load<Traits, NonTemporal>(src + w));
+        acc2 =
+            Traits::bitwise_xor(acc2, load<Traits, NonTemporal>(src + 2 * w));
+        acc3 =
+            Traits::bitwise_xor(acc3, load<Traits, NonTemporal>(src + 3 * w));
+    }
+    for (; length >= w; src += w, length -= w) {
+        acc0 = Traits::bitwise_xor(acc0, load<Traits, NonTemporal>(src));
+    }
+
+    acc0 = Traits::bitwise_xor(Traits::bitwise_xor(acc0, acc1),
+                               Traits::bitwise_xor(acc2, acc3));
+    x ^= fold(src, length) ^ fold<Traits>(acc0);
+
+    *sink = std::byte{x};
+}
+
+template <typename Traits, bool NonTemporal>
+void write(std::byte* dst, size_t length, const std::byte* src)
+{
+    constexpr auto w = width<Traits>();
+
+    auto head = NonTemporal ? to_aligned_length<Traits>(dst, length) : 0;
+    std::memcpy(dst, src, head);
+    dst += head;
+    src += head;
+    length -= head;
+
+    for (; length >= 4 * w; dst += 4 * w, src += 4 * w, length -= 4 * w) {
+        auto v0 = Traits::load(src), v1 = Traits::load(src + w),
+             v2 = Traits::load(src + 2 * w), v3 = Traits::load(src + 3 * w);
+        store<Traits, NonTemporal>(dst, v0);
+        store<Traits, NonTemporal>(dst + w, v1);
+        store<Traits, NonTemporal>(dst + 2 * w, v2);
+        store<Traits, NonTemporal>(dst + 3 * w, v3);
+    }
+    for (; length >= w; dst += w, src += w, length -= w) {
+        store<Traits, NonTemporal>(dst, Traits::load(src));
+    }
+
+    std::memcpy(dst, src, length);
+}
+
+void drain_none() {}
+
+void drain_stores() { _mm_sfence(); }
+
+template <typename Traits> functions get_vector_functions(bool non_temporal)
+{
+    return (non_temporal ? functions{.read = read<Traits, true>,
+                                     .write = write<Traits, true>,
+                                     .drain = drain_stores}
+                         : functions{.read = read<Traits, false>,
+                                     .write = write<Traits, false>,
+                                     .drain = drain_none});
+}
+
+} // namespace
+
+} // namespace openperf::memory::generator::kernel
@@ -6,6 +6,8 @@
 #include <numeric>
 #include <optional>
 
+#include "utils/histogram.hpp"
+
 namespace openperf::memory::generator {
 
 template <typename T> struct range
@@ -36,6 +38,12 @@ template <typename Clock> struct io_stats
     duration latency;
     size_t ops_actual;
     size_t ops_target;
+    /*
+     * Memory operations are too fast to time individually, so this
+     * histogram contains the average operation latency of each batch of
+     * operations, weighted by the number of operations in the batch.
+     */
+    utils::log_linear_histogram<> latency_histogram;
 
     io_stats()
         : bytes_actual(0)
@@ -52,6 +60,7 @@ template <typename Clock> struct io_stats
         latency += other.latency;
         ops_actual += other.ops_actual;
         ops_target += other.ops_target;
+        latency_histogram += other.latency_histogram;
 
         return (*this);
     }
@@ -1,5 +1,6 @@
 #include <chrono>
 #include <cstddef> //nullptr
+#include <cstring>
 #include <optional>
 #include <variant>
 
@@ -8,7 +9,10 @@
 #include "core/op_core.h"
 #include "memory/api.hpp"
 #include "memory/generator/coordinator.hpp"
+#include "memory/generator/index_generator.hpp"
+#include "memory/generator/kernels.hpp"
 #include "memory/generator/worker_api.hpp"
+#include "memory/numa.hpp"
 #include "message/serialized_message.hpp"
 
 namespace openperf::memory::generator::worker {
@@ -94,34 +98,115 @@ struct read_traits
     {
         template <typename Timepoint>
         size_t operator()(const io_config& config,
-                          const std::vector<uint32_t>& indexes,
+                          const kernel::functions& kernel,
+                          const index_generator& indexes,
                           std::byte* scratch,
                           size_t nb_ops,
                           size_t offset,
                           const Timepoint& limit)
         {
             using clock = result::clock;
-            assert(offset < indexes.size());
 
             if (nb_blocks(config) == 0) { return (0); }
+            assert(offset < indexes.size());
+
+            if (config.io_pattern == api::pattern_type::pointer_chase) {
+                return (chase(config, indexes[offset], scratch, nb_ops, limit));
+            }
+
+            auto nb_reads = 0UL;
+            auto position = offset;
+            while (nb_reads < nb_ops) {
+                kernel.read(
+                    config.buffer + (indexes[position] * config.io_size),
+                    config.io_size,
+                    scratch);
+                if (++position == indexes.size()) { position = 0; }
+
+                if ((++nb_reads & io_clock_mask) == 0 && clock::now() > limit) {
+                    break;
+                }
+            }
+
+            return (nb_reads);
+        }
+
+        /*
+         * Each load depends on the previous one, so neither the CPU nor the
+         * prefetchers can get ahead of us and every read pays the full
+         * memory latency. Writers share the buffer and may clobber our
+         * links, so keep the chase within our block range. The extra
+         * compare is noise next to a cache miss.
+         */
+        template <typename Timepoint>
+        size_t chase(const io_config& config,
+                     uint64_t idx,
+                     std::byte* scratch,
+                     size_t nb_ops,
+                     const Timepoint& limit)
+        {
+            using clock = result::clock;
+
+            const auto min = config.index_range.min;
+            const auto range = nb_blocks(config);
 
             auto nb_reads = 0UL;
-            for (auto idx : ranges::views::cycle(indexes)
-                                | ranges::views::drop(offset)
-                                | ranges::views::take(nb_ops)) {
-                std::copy_n(config.buffer + (idx * config.io_size),
-                            config.io_size,
-                            scratch);
+            while (nb_reads < nb_ops) {
+                std::memcpy(
+                    &idx, config.buffer + (idx * config.io_size), sizeof(idx));
+                if (idx - min >= range) { idx = min; }
 
                 if ((++nb_reads & io_clock_mask) == 0 && clock::now() > limit) {
                     break;
                 }
             }
 
+            /* Make sure the loads can't be optimized away */
+            std::memcpy(scratch, &idx, sizeof(idx));
+
             return (nb_reads);
         }
     };
 
+    /*
+     * Pointer chasing readers need the buffer to contain a cycle that
+     * visits their blocks in index order. Each block starts with the
+     * index of the next one.
+     */
+    struct io_initializer
+    {
+        void operator()(const io_config& config,
+                        const index_generator& indexes)
+        {
+            if (config.io_pattern != api::pattern_type::pointer_chase
+                || indexes.size() == 0) {
+                return;
+            }
+
+            assert(config.io_size >= sizeof(uint64_t));
+            for (auto i = 0UL; i < indexes.size(); i++) {
+                auto next = uint64_t{indexes[(i + 1) % indexes.size()]};
+                std::memcpy(config.buffer + (indexes[i] * config.io_size),
+                            &next,
+                            sizeof(next));
+            }
+        }
+    };
+
+    /*
+     * Pointer chasing reads only load the link to the next block, so
+     * count those bytes instead of the whole block.
+     */
+    struct io_op_bytes
+    {
+        size_t operator()(const io_config& config)
+        {
+            return (config.io_pattern == api::pattern_type::pointer_chase
+                        ? sizeof(uint64_t)
+                        : config.io_size);
+        }
+    };
+
     struct io_stats_extractor
     {
         template <typename Clock>
@@ -151,25 +236,26 @@ struct write_traits
     {
         template <typename Timepoint>
         size_t operator()(const io_config& config,
-                          const std::vector<uint32_t>& indexes,
+                          const kernel::functions& kernel,
+                          const index_generator& indexes,
                           const std::byte* scratch,
                           size_t nb_ops,
                           size_t offset,
                           const Timepoint& limit)
         {
             using clock = result::clock;
-            assert(offset < indexes.size());
 
             if (nb_blocks(config) == 0) { return (0); }
+            assert(offset < indexes.size());
 
             auto nb_writes = 0UL;
-
-            for (auto idx : ranges::views::cycle(indexes)
-                                | ranges::views::drop(offset)
-                                | ranges::views::take(nb_ops)) {
-                std::copy_n(scratch,
-                            config.io_size,
-                            config.buffer + (idx * config.io_size));
+            auto position = offset;
+            while (nb_writes < nb_ops) {
+                kernel.write(
+                    config.buffer + (indexes[position] * config.io_size),
+                    config.io_size,
+                    scratch);
+                if (++position == indexes.size()) { position = 0; }
 
                 if ((++nb_writes & io_clock_mask) == 0
                     && clock::now() > limit) {
@@ -177,10 +263,24 @@ struct write_traits
                 }
             }
 
+            /* Account for the cost of finishing any streaming stores */
+            kernel.drain();
+
             return (nb_writes);
         }
     };
 
+    /* Writes don't depend on buffer contents */
+    struct io_initializer
+    {
+        void operator()(const io_config&, const index_generator&) {}
+    };
+
+    struct io_op_bytes
+    {
+        size_t operator()(const io_config& config) { return (config.io_size); }
+    };
+
     struct io_stats_extractor
     {
         template <typename Clock>
@@ -205,8 +305,8 @@ class worker : public finite_state_machine<worker<Traits>, state, command_msg>
 {
     struct io_state
     {
-        std::vector<uint32_t> indexes;
-        uint32_t offset;
+        index_generator indexes;
+        size_t offset;
     };
 
     using clock = result::clock;
@@ -225,6 +325,7 @@ class worker : public finite_state_machine<worker<Traits>, state, command_msg>
     io_config m_config;
     io_state m_state;
     io_stats m_stats;
+    kernel::functions m_kernel;
     std::vector<std::byte> m_scratch;
 
     /* Handy definition to zero out stats */
@@ -249,23 +350,15 @@ public:
         , m_rate(config.io_rate)
         , m_id(id)
         , m_config(config)
+        , m_state{index_generator(config.io_pattern,
+                                  config.index_range.min,
+                                  config.index_range.max,
+                                  config.index_range.min),
+                  0}
+        , m_kernel(kernel::get_functions(config.io_kernel, config.non_temporal))
     {
-        auto iota =
-            ranges::views::iota(config.index_range.min, config.index_range.max);
-        m_state.indexes.reserve(nb_blocks(config));
-
-        switch (config.io_pattern) {
-        case api::pattern_type::random:
-            m_state.indexes |=
-                ranges::actions::push_back(iota)
-                | ranges::actions::shuffle(std::default_random_engine{});
-        case api::pattern_type::reverse:
-            m_state.indexes |=
-                ranges::actions::push_back(iota | ranges::views::reverse);
-        default:
-            m_state.indexes |= ranges::actions::push_back(iota);
-        }
-        m_state.offset = 0;
+        using io_initializer = typename Traits::io_initializer;
+        io_initializer{}(m_config, m_state.indexes);
 
         m_scratch.reserve(config.io_size);
         m_scratch |= ranges::actions::push_back(
@@ -278,6 +371,7 @@ public:
     {
         using io_spinner = typename Traits::io_spinner;
         using io_stats_extractor = typename Traits::io_stats_extractor;
+        using io_op_bytes = typename Traits::io_op_bytes;
 
         assert(m_result);
         assert(m_stats.avg_rate > ops_per_sec::zero());
@@ -324,6 +418,7 @@ public:
         }
 
         auto done_ops = io_spinner{}(m_config,
+                                     m_kernel,
                                      m_state.indexes,
                                      m_scratch.data(),
                                      to_do_ops,
@@ -332,7 +427,10 @@ public:
 
         auto t3 = clock::now();
 
-        m_state.offset = (m_state.offset + done_ops) % m_state.indexes.size();
+        if (m_state.indexes.size()) {
+            m_state.offset =
+                (m_state.offset + done_ops) % m_state.indexes.size();
+        }
 
         auto& thread_stats = m_result->shard(m_id);
         if (!thread_stats.first()) { thread_stats.time_.first = t3; }
@@ -342,10 +440,17 @@ public:
         auto run_time = t3 - t2;
         auto total_time = thread_stats.time_.last - thread_stats.time_.first;
         auto& io_stats = io_stats_extractor{}(thread_stats);
-        io_stats.bytes_actual += done_ops * m_config.io_size;
-        io_stats.bytes_target =
-            m_config.io_rate * total_time * m_config.io_size;
+        const auto op_bytes = io_op_bytes{}(m_config);
+        io_stats.bytes_actual += done_ops * op_bytes;
+        io_stats.bytes_target = m_config.io_rate * total_time * op_bytes;
         io_stats.latency += run_time;
+        if (done_ops) {
+            io_stats.latency_histogram.record(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(run_time)
+                        .count()
+                    / done_ops,
+                done_ops);
+        }
         io_stats.ops_actual += done_ops;
         io_stats.ops_target = m_config.io_rate * total_time;
 
@@ -413,6 +518,34 @@ public:
     }
 };
 
+/*
+ * Restrict the current thread to the node's CPUs. Our affinity is
+ * inherited from the memory module, so honor any core mask, too.
+ */
+static void set_node_affinity(unsigned node)
+{
+    auto cpus = numa::node_cpus(node);
+    if (!cpus) {
+        OP_LOG(OP_LOG_WARNING, "Could not find CPUs for NUMA node %u\n", node);
+        return;
+    }
+
+    auto allowed = *cpus & core::cpuset_get_affinity();
+    if (allowed.none()) {
+        OP_LOG(OP_LOG_WARNING,
+               "No CPUs on NUMA node %u are in our core mask\n",
+               node);
+        return;
+    }
+
+    if (auto error = core::cpuset_set_affinity(allowed)) {
+        OP_LOG(OP_LOG_ERROR,
+               "Could not bind thread to NUMA node %u: %s\n",
+               node,
+               strerror(error));
+    }
+}
+
 template <typename Traits>
 static int do_work(void* context,
                    uint8_t coordinator_id,
@@ -426,6 +559,8 @@ static int do_work(void* context,
                        + std::to_string(thread_id))
                           .c_str());
 
+    if (config.numa_node) { set_node_affinity(*config.numa_node); }
+
     std::unique_ptr<void, op_socket_deleter> control(
         op_socket_get_client_subscription(context, endpoint, ""));
 
@@ -3,6 +3,7 @@
 
 #include <future>
 #include <memory>
+#include <optional>
 #include <string>
 #include <variant>
 #include <vector>
@@ -76,6 +77,9 @@ struct io_config
     size_t io_size;
     ops_per_sec io_rate;
     enum api::pattern_type io_pattern;
+    enum api::access_kernel_type io_kernel;
+    bool non_temporal;
+    std::optional<unsigned> numa_node;
 };
 
 int do_reads(void* context,
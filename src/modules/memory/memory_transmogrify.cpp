@@ -23,6 +23,16 @@ to_swagger(const generator::config& config)
     dst->setWriteSize(config.write.io_size);
     dst->setWriteThreads(config.write.io_threads);
     dst->setPattern(to_string(config.read.io_pattern));
+    dst->setPageSize(to_string(config.buffer_page_size));
+    if (config.buffer_numa_node) {
+        dst->setBufferNumaNode(*config.buffer_numa_node);
+    }
+    if (config.read.numa_node) { dst->setReadNumaNode(*config.read.numa_node); }
+    if (config.write.numa_node) {
+        dst->setWriteNumaNode(*config.write.numa_node);
+    }
+    dst->setAccessKernel(to_string(config.access_kernel));
+    dst->setNonTemporal(config.non_temporal);
 
     return (dst);
 }
@@ -76,6 +86,13 @@ to_swagger(const generator::io_stats<Clock>& stats)
     dst->setBytesActual(stats.bytes_actual);
     dst->setLatencyTotal(to_nanoseconds(stats.latency).count());
 
+    if (const auto& histogram = stats.latency_histogram; histogram.total()) {
+        dst->setLatencyP50(histogram.value_at_quantile(0.5));
+        dst->setLatencyP99(histogram.value_at_quantile(0.99));
+        dst->setLatencyP999(histogram.value_at_quantile(0.999));
+        dst->setLatencyP9999(histogram.value_at_quantile(0.9999));
+    }
+
     return (dst);
 }
 
@@ -103,23 +120,41 @@ to_swagger(std::string_view generator_id,
     return (dst);
 }
 
+static std::optional<unsigned> to_numa_node(bool is_set, int32_t node)
+{
+    return (is_set ? std::optional<unsigned>(node) : std::nullopt);
+}
+
 generator::config
 from_swagger(const swagger::v1::model::MemoryGeneratorConfig& config)
 {
     auto dst = generator::config{
         .buffer_size = static_cast<uint64_t>(config.getBufferSize()),
+        .buffer_page_size = config.pageSizeIsSet()
+                                ? to_page_size_type(config.getPageSize())
+                                : page_size_type::standard,
+        .buffer_numa_node = to_numa_node(config.bufferNumaNodeIsSet(),
+                                          config.getBufferNumaNode()),
+        .access_kernel = config.accessKernelIsSet()
+                             ? to_access_kernel_type(config.getAccessKernel())
+                             : access_kernel_type::scalar,
+        .non_temporal = config.nonTemporalIsSet() && config.isNonTemporal(),
         .read =
             {
                 .io_rate = generator::ops_per_sec{config.getReadsPerSec()},
                 .io_size = static_cast<unsigned>(config.getReadSize()),
                 .io_threads = static_cast<unsigned>(config.getReadThreads()),
                 .io_pattern = to_pattern_type(config.getPattern()),
+                .numa_node = to_numa_node(config.readNumaNodeIsSet(),
+                                          config.getReadNumaNode()),
             },
         .write = {
             .io_rate = generator::ops_per_sec{config.getWritesPerSec()},
             .io_size = static_cast<unsigned>(config.getWriteSize()),
             .io_threads = static_cast<unsigned>(config.getWriteThreads()),
             .io_pattern = to_pattern_type(config.getPattern()),
+            .numa_node = to_numa_node(config.writeNumaNodeIsSet(),
+                                      config.getWriteNumaNode()),
         }};
 
     return (dst);
@@ -0,0 +1,84 @@
+#include <cerrno>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <linux/mempolicy.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include "memory/numa.hpp"
+
+namespace openperf::memory::numa {
+
+static constexpr auto node_path = "/sys/devices/system/node/node";
+
+/*
+ * Parse a kernel cpulist string, e.g. "0-3,8,10-11", into a cpuset.
+ * Note: no validation beyond what we need to avoid setting garbage.
+ */
+static std::optional<core::cpuset> parse_cpulist(const std::string& list)
+{
+    auto cpus = core::cpuset{};
+    auto cursor = list.c_str();
+    while (*cursor != '\0' && *cursor != '\n') {
+        char* end = nullptr;
+        auto first = std::strtoul(cursor, &end, 10);
+        if (end == cursor) { return (std::nullopt); }
+
+        auto last = first;
+        if (*end == '-') {
+            cursor = end + 1;
+            last = std::strtoul(cursor, &end, 10);
+            if (end == cursor || last < first) { return (std::nullopt); }
+        }
+
+        for (auto cpu = first; cpu <= last && cpu < cpus.size(); cpu++) {
+            cpus.set(cpu);
+        }
+
+        cursor = (*end == ',' ? end + 1 : end);
+    }
+
+    return (cpus);
+}
+
+std::optional<core::cpuset> node_cpus(unsigned node)
+{
+    auto input =
+        std::ifstream(node_path + std::to_string(node) + "/cpulist");
+    if (!input) { return (std::nullopt); }
+
+    auto list = std::string{};
+    std::getline(input, list);
+
+    return (parse_cpulist(list));
+}
+
+int bind(void* addr, size_t length, unsigned node)
+{
+    constexpr auto bits_per_mask = sizeof(unsigned long) * 8;
+
+    /*
+     * Call mbind directly so that we don't need libnuma. The kernel
+     * expects maxnode to be one more than the highest node bit.
+     */
+    auto mask = std::vector<unsigned long>(node / bits_per_mask + 1, 0);
+    mask[node / bits_per_mask] = 1UL << (node % bits_per_mask);
+
+    if (syscall(SYS_mbind,
+                addr,
+                length,
+                MPOL_BIND,
+                mask.data(),
+                mask.size() * bits_per_mask + 1,
+                MPOL_MF_STRICT | MPOL_MF_MOVE)
+        == -1) {
+        return (errno);
+    }
+
+    return (0);
+}
+
+} // namespace openperf::memory::numa
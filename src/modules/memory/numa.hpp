@@ -0,0 +1,30 @@
+#ifndef _OP_MEMORY_NUMA_HPP_
+#define _OP_MEMORY_NUMA_HPP_
+
+#include <cstddef>
+#include <optional>
+
+#include "core/op_cpuset.hpp"
+
+namespace openperf::memory::numa {
+
+/**
+ * Retrieve the set of CPUs attached to the specified NUMA node.
+ *
+ * @return
+ *   the node's CPUs or std::nullopt if the node does not exist
+ */
+std::optional<core::cpuset> node_cpus(unsigned node);
+
+/**
+ * Bind the pages of the specified memory region to the specified NUMA
+ * node. Pages that have already been faulted in are migrated.
+ *
+ * @return
+ *   0 on success, errno on failure
+ */
+int bind(void* addr, size_t length, unsigned node);
+
+} // namespace openperf::memory::numa
+
+#endif /* _OP_MEMORY_NUMA_HPP_ */
@@ -1,8 +1,12 @@
+#include <fstream>
+
 #include <unistd.h>
 
 #include "dynamic/validator.tcc"
 #include "memory/api.hpp"
 #include "memory/arg_parser.hpp"
+#include "memory/generator/kernels.hpp"
+#include "memory/numa.hpp"
 
 #include "swagger/v1/model/MemoryGenerator.h"
 #include "swagger/v1/model/MemoryInfoResult.h"
@@ -44,6 +48,31 @@ std::optional<long> get_available_memory()
     return (std::nullopt);
 }
 
+/* Huge pages must be reserved ahead of time, so check what's left */
+static std::optional<int64_t> get_free_huge_page_memory(page_size_type type)
+{
+    auto page_kb = (type == page_size_type::huge_1gb ? 1048576 : 2048);
+    auto input = std::ifstream("/sys/kernel/mm/hugepages/hugepages-"
+                               + std::to_string(page_kb) + "kB/free_hugepages");
+    auto free_pages = int64_t{0};
+    if (!(input >> free_pages)) { return (std::nullopt); }
+
+    return (free_pages * page_kb * 1024);
+}
+
+static void is_valid_numa_node(std::string_view user,
+                               int32_t node,
+                               std::vector<std::string>& errors)
+{
+    if (node < 0) {
+        errors.emplace_back("The " + std::string(user)
+                            + " NUMA node cannot be negative.");
+    } else if (!numa::node_cpus(node)) {
+        errors.emplace_back("The " + std::string(user) + " NUMA node "
+                            + std::to_string(node) + " does not exist.");
+    }
+}
+
 static void is_valid(const swagger::v1::model::MemoryGeneratorConfig& config,
                      std::vector<std::string>& errors)
 {
@@ -65,6 +94,56 @@ static void is_valid(const swagger::v1::model::MemoryGeneratorConfig& config,
                             + "\" is not recognized.");
     }
 
+    if (config.pageSizeIsSet()) {
+        if (auto page_size = to_page_size_type(config.getPageSize());
+            page_size == page_size_type::none) {
+            errors.emplace_back("Page size \"" + config.getPageSize()
+                                + "\" is not recognized.");
+        } else if (page_size != page_size_type::standard) {
+            auto free = get_free_huge_page_memory(page_size).value_or(0);
+            if (free < config.getBufferSize()) {
+                errors.emplace_back(
+                    "Buffer size must be less than free " + config.getPageSize()
+                    + " huge page memory of " + std::to_string(free)
+                    + " bytes.");
+            }
+        }
+    }
+
+    if (config.bufferNumaNodeIsSet()) {
+        is_valid_numa_node("buffer", config.getBufferNumaNode(), errors);
+    }
+
+    if (config.readNumaNodeIsSet()) {
+        is_valid_numa_node("reader", config.getReadNumaNode(), errors);
+    }
+
+    if (config.writeNumaNodeIsSet()) {
+        is_valid_numa_node("writer", config.getWriteNumaNode(), errors);
+    }
+
+    auto kernel = (config.accessKernelIsSet()
+                       ? to_access_kernel_type(config.getAccessKernel())
+                       : access_kernel_type::scalar);
+    if (kernel == access_kernel_type::none) {
+        errors.emplace_back("Access kernel \"" + config.getAccessKernel()
+                            + "\" is not recognized.");
+    } else if (!generator::kernel::available(kernel)) {
+        errors.emplace_back("Access kernel \"" + config.getAccessKernel()
+                            + "\" is not supported by this CPU.");
+    } else if (config.nonTemporalIsSet() && config.isNonTemporal()
+               && !generator::kernel::supports_non_temporal(kernel)) {
+        errors.emplace_back("Access kernel \"" + to_string(kernel)
+                            + "\" does not support non-temporal access.");
+    }
+
+    if (to_pattern_type(config.getPattern()) == pattern_type::pointer_chase
+        && config.getReadsPerSec()
+        && config.getReadSize() < static_cast<int32_t>(sizeof(uint64_t))) {
+        errors.emplace_back("Pointer chasing requires a read size of at least "
+                            + std::to_string(sizeof(uint64_t)) + " bytes.");
+    }
+
     if (config.getReadsPerSec() < 0) {
         errors.emplace_back("Reads per second cannot be negative.");
     }
@@ -136,6 +215,10 @@ struct memory_dynamic_validator
     static constexpr auto valid_mem_io_stats =
         make_array<std::string_view>("bytes_actual",
                                      "bytes_target",
+                                     "latency_p50",
+                                     "latency_p99",
+                                     "latency_p999",
+                                     "latency_p9999",
                                      "latency_total",
                                      "ops_actual",
                                      "ops_target");
@@ -265,6 +265,19 @@ to_swagger(const model::generator_result::load_stat_t& stat)
                 .count());
     }
 
+    if (stat.latency_p50.has_value()) {
+        model.setLatencyP50(stat.latency_p50.value().count());
+    }
+    if (stat.latency_p99.has_value()) {
+        model.setLatencyP99(stat.latency_p99.value().count());
+    }
+    if (stat.latency_p999.has_value()) {
+        model.setLatencyP999(stat.latency_p999.value().count());
+    }
+    if (stat.latency_p9999.has_value()) {
+        model.setLatencyP9999(stat.latency_p9999.value().count());
+    }
+
     return model;
 }
 
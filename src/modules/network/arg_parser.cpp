@@ -49,4 +49,37 @@ std::chrono::microseconds operation_timeout()
                     : default_timeout);
 }
 
+unsigned server_workers()
+{
+    static const auto workers =
+        openperf::config::file::op_config_get_param<OP_OPTION_TYPE_LONG>(
+            op_network_server_workers);
+
+    if (workers && workers.value() > 0) {
+        return (static_cast<unsigned>(workers.value()));
+    }
+
+    if (auto mask = core_mask(); mask && mask->count()) {
+        return (mask->count());
+    }
+
+    return (1);
+}
+
+engine_type engine()
+{
+    static const auto type = []() {
+        auto value =
+            openperf::config::file::op_config_get_param<OP_OPTION_TYPE_STRING>(
+                op_network_engine);
+        if (!value || value.value() == "epoll") { return (engine_type::epoll); }
+        if (value.value() == "io_uring") { return (engine_type::io_uring); }
+
+        throw std::runtime_error("Network engine " + value.value()
+                                 + " is unsupported");
+    }();
+
+    return (type);
+}
+
 } // namespace openperf::network::config
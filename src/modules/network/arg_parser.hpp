@@ -11,6 +11,8 @@
 extern const char op_network_mask[];
 extern const char op_network_driver[];
 extern const char op_network_op_timeout[];
+extern const char op_network_server_workers[];
+extern const char op_network_engine[];
 
 namespace openperf::network::config {
 
@@ -20,6 +22,12 @@ std::shared_ptr<internal::drivers::driver> driver();
 
 std::chrono::microseconds operation_timeout();
 
+unsigned server_workers();
+
+enum class engine_type { epoll, io_uring };
+
+engine_type engine();
+
 } // namespace openperf::network::config
 
 #endif /* _OP_NETWORK_ARG_PARSER_HPP_ */
@@ -62,6 +62,22 @@ public:
                              socklen_t* fromlen) = 0;
     virtual ssize_t recvmsg(int s, struct msghdr* message, int flags) = 0;
 
+    /*
+     * Batched receive; drivers without native support receive one message
+     * at a time.  Returns the number of messages received or -1 on error.
+     */
+    virtual int
+    recvmmsg(int s, struct mmsghdr* messages, unsigned int vlen, int flags)
+    {
+        unsigned int i = 0;
+        for (; i < vlen; i++) {
+            auto len = recvmsg(s, &messages[i].msg_hdr, flags);
+            if (len == -1) { break; }
+            messages[i].msg_len = len;
+        }
+        return (i ? static_cast<int>(i) : -1);
+    }
+
     /* Transmit functions */
     virtual ssize_t send(int s, const void* dataptr, size_t len, int flags) = 0;
     virtual ssize_t sendmsg(int s, const struct msghdr* message, int flags) = 0;
@@ -74,6 +90,22 @@ public:
     virtual ssize_t write(int s, const void* dataptr, size_t len) = 0;
     virtual ssize_t writev(int s, const struct iovec* iov, int iovcnt) = 0;
 
+    /*
+     * Batched transmit; drivers without native support send one message
+     * at a time.  Returns the number of messages sent or -1 on error.
+     */
+    virtual int
+    sendmmsg(int s, struct mmsghdr* messages, unsigned int vlen, int flags)
+    {
+        unsigned int i = 0;
+        for (; i < vlen; i++) {
+            auto len = sendmsg(s, &messages[i].msg_hdr, flags);
+            if (len == -1) { break; }
+            messages[i].msg_len = len;
+        }
+        return (i ? static_cast<int>(i) : -1);
+    }
+
     virtual unsigned int if_nametoindex(const char* ifname) = 0;
 };
 using driver_ptr = std::shared_ptr<driver>;
@@ -97,6 +97,13 @@ ssize_t kernel::recvmsg(int s, struct msghdr* message, int flags)
 {
     return ::recvmsg(s, message, flags);
 };
+int kernel::recvmmsg(int s,
+                     struct mmsghdr* messages,
+                     unsigned int vlen,
+                     int flags)
+{
+    return ::recvmmsg(s, messages, vlen, flags, nullptr);
+};
 
 ssize_t kernel::send(int s, const void* dataptr, size_t len, int flags)
 {
@@ -106,6 +113,13 @@ ssize_t kernel::sendmsg(int s, const struct msghdr* message, int flags)
 {
     return ::sendmsg(s, message, flags);
 };
+int kernel::sendmmsg(int s,
+                     struct mmsghdr* messages,
+                     unsigned int vlen,
+                     int flags)
+{
+    return ::sendmmsg(s, messages, vlen, flags);
+};
 ssize_t kernel::sendto(int s,
                        const void* dataptr,
                        size_t len,
@@ -51,10 +51,18 @@ public:
                      struct sockaddr* from,
                      socklen_t* fromlen) override;
     ssize_t recvmsg(int s, struct msghdr* message, int flags) override;
+    int recvmmsg(int s,
+                 struct mmsghdr* messages,
+                 unsigned int vlen,
+                 int flags) override;
 
     /* Transmit functions */
     ssize_t send(int s, const void* dataptr, size_t len, int flags) override;
     ssize_t sendmsg(int s, const struct msghdr* message, int flags) override;
+    int sendmmsg(int s,
+                 struct mmsghdr* messages,
+                 unsigned int vlen,
+                 int flags) override;
     ssize_t sendto(int s,
                    const void* dataptr,
                    size_t len,
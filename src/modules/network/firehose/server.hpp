@@ -2,9 +2,11 @@
 #define _OP_NETWORK_FIREHOSE_SERVER_COMMON_HPP_
 
 #include <atomic>
+#include <optional>
 #include <tl/expected.hpp>
 #include <arpa/inet.h>
 #include <variant>
+#include "core/op_cpuset.hpp"
 #include "protocol.hpp"
 #include "../drivers/driver.hpp"
 #include "../utils/network_sockaddr.hpp"
@@ -37,27 +39,92 @@ class server
 public:
     struct stat_t
     {
-        std::atomic_uint64_t bytes_sent = 0;
-        std::atomic_uint64_t bytes_received = 0;
-        std::atomic_uint64_t connections = 0;
-        std::atomic_uint64_t closed = 0;
-        std::atomic_uint64_t errors = 0;
+        uint64_t bytes_sent = 0;
+        uint64_t bytes_received = 0;
+        uint64_t connections = 0;
+        uint64_t closed = 0;
+        uint64_t errors = 0;
+    };
+
+    /*
+     * Counters owned by a single worker.  Each set sits on its own cache
+     * line and only its worker writes to it, so updates don't need locked
+     * instructions; readers sum every worker's counters instead.
+     */
+    class worker_counter
+    {
+        std::atomic_uint64_t m_value = 0;
+
+    public:
+        worker_counter& operator+=(uint64_t value)
+        {
+            m_value.store(m_value.load(std::memory_order_relaxed) + value,
+                          std::memory_order_relaxed);
+            return (*this);
+        }
+
+        uint64_t load() const
+        {
+            return (m_value.load(std::memory_order_relaxed));
+        }
+    };
+
+    struct alignas(64) worker_stat_t
+    {
+        worker_counter bytes_sent;
+        worker_counter bytes_received;
+        worker_counter connections;
+        worker_counter closed;
+        worker_counter errors;
     };
 
     server() = default;
     server(const server&) = delete;
 
-    const stat_t& stat() { return m_stat; }
+    virtual stat_t stat() const = 0;
 
     virtual ~server() = default;
 
 protected:
+    static stat_t& accumulate(stat_t& lhs, const worker_stat_t& rhs)
+    {
+        lhs.bytes_sent += rhs.bytes_sent.load();
+        lhs.bytes_received += rhs.bytes_received.load();
+        lhs.connections += rhs.connections.load();
+        lhs.closed += rhs.closed.load();
+        lhs.errors += rhs.errors.load();
+        return (lhs);
+    }
+
     std::atomic_int m_fd;
     in_port_t m_port;
     drivers::driver_ptr m_driver;
-    stat_t m_stat;
 };
 
+/*
+ * Pick a single core for the given worker.  Workers are spread round-robin
+ * over the cores the calling thread may run on, which is the Network CPU
+ * mask when one is configured.
+ */
+inline std::optional<core::cpuset> get_worker_cpuset(unsigned worker_idx)
+{
+    const auto affinity = core::cpuset_get_affinity();
+    const auto count = affinity.count();
+    if (!count) { return (std::nullopt); }
+
+    auto target = worker_idx % count;
+    for (size_t i = 0; i < affinity.size(); i++) {
+        if (!affinity.test(i)) { continue; }
+        if (target-- == 0) {
+            auto worker_set = core::cpuset();
+            worker_set.set(i);
+            return (worker_set);
+        }
+    }
+
+    return (std::nullopt);
+}
+
 inline const char* get_state_string(connection_state_t state)
 {
 #define CASE_MAP(s)                                                            \
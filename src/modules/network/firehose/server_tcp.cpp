@@ -5,8 +5,6 @@
 #include <system_error>
 #include <fcntl.h>
 #include <unistd.h>
-#include <poll.h>
-#include <sys/eventfd.h>
 #include <netinet/tcp.h>
 
 #include "core/op_log.h"
@@ -16,25 +14,14 @@
 #include "utils/random.hpp"
 #include "framework/utils/memcpy.hpp"
 
+#include "network/arg_parser.hpp"
 #include "protocol.hpp"
 
 namespace openperf::network::internal::firehose {
 
 const static size_t tcp_backlog = 128;
-const std::string accept_endpoint = "inproc://firehose_tcp_server_accept";
 const std::string ctrl_endpoint = "inproc://firehose_tcp_server_ctrl";
 
-struct connection_msg_t
-{
-    int fd;
-    union
-    {
-        struct sockaddr client;
-        struct sockaddr_in client4;
-        struct sockaddr_in6 client6;
-    };
-};
-
 static inline bool sock_is_readable(void* sock)
 {
     uint32_t flags = 0;
@@ -144,127 +131,6 @@ create_server_socket(drivers::driver* drv,
     return sock;
 }
 
-tcp_acceptor::tcp_acceptor(const drivers::driver_ptr& driver, void* context)
-    : m_driver(driver)
-    , m_eventfd(-1)
-    , m_acceptfd(-1)
-    , m_running(false)
-{
-    m_accept_pub.reset(
-        op_socket_get_server(context, ZMQ_PUSH, accept_endpoint.data()));
-    if (!m_accept_pub) {
-        throw std::runtime_error("Unable to create ZMQ push socket");
-    }
-
-    m_eventfd = eventfd(0, EFD_NONBLOCK);
-    if (m_eventfd < 0) {
-        throw std::system_error(
-            errno, std::generic_category(), "Unable to create eventfd");
-    }
-}
-
-tcp_acceptor::~tcp_acceptor()
-{
-    if (m_running) {
-        try {
-            stop();
-        } catch (...) {
-            // no exceptions in destructor
-        }
-    }
-
-    close(m_eventfd);
-}
-
-void tcp_acceptor::start(int acceptfd)
-{
-    if (m_running) throw std::runtime_error("tcp_acceptor is already running");
-
-    m_running = true;
-    m_acceptfd = acceptfd;
-    m_thread = std::thread([this] {
-        op_thread_setname("op_net_srv_acc");
-        this->run();
-        op_log_close();
-    });
-}
-
-void tcp_acceptor::stop()
-{
-    if (!m_running) return;
-
-    // signal thread to stop
-    m_running = false;
-
-    // wakeup the accept thread by writing to eventfd
-    if (eventfd_write(m_eventfd, 1) < 0) {
-        OP_LOG(OP_LOG_ERROR, "Failed writing to tcp_acceptor eventfd");
-        throw std::system_error(
-            errno, std::generic_category(), "Could not write to eventfd");
-    }
-
-    // wait for thread to stop
-    m_thread.join();
-    m_driver->shutdown(m_acceptfd, SHUT_RDWR);
-    m_driver->close(m_acceptfd);
-    m_acceptfd = -1;
-}
-
-void tcp_acceptor::run()
-{
-    while (m_running) {
-        // use poll to block waiting for accept or eventfd notification
-        std::array<struct pollfd, 2> pfd;
-        pfd[0] = {.fd = m_eventfd, .events = POLLIN, .revents = 0};
-        pfd[1] = {.fd = m_acceptfd, .events = POLLIN, .revents = 0};
-        int npoll = poll(pfd.data(), pfd.size(), -1);
-        if (npoll < 0 && errno != EINTR) {
-            OP_LOG(OP_LOG_ERROR, "poll failed.  %s", strerror(errno));
-            break;
-        }
-        if (npoll <= 0) { continue; }
-
-        if (pfd[0].revents & POLLIN) {
-            // m_eventfd is used to wake up from poll().  Read it to be nice.
-            // loop will probably be exiting due to m_running change.
-            eventfd_t value = 0;
-            eventfd_read(m_eventfd, &value);
-        }
-        if (pfd[1].revents & POLLIN) {
-            sockaddr_storage addr;
-            socklen_t addr_len = sizeof(addr);
-            auto saddr = reinterpret_cast<sockaddr*>(&addr);
-            int conn_fd;
-
-            while ((conn_fd = m_driver->accept(
-                        m_acceptfd, saddr, &addr_len, SOCK_NONBLOCK))
-                   != -1) {
-                int enable = 1;
-                if (m_driver->setsockopt(conn_fd,
-                                         IPPROTO_TCP,
-                                         TCP_NODELAY,
-                                         &enable,
-                                         sizeof(enable))
-                    != 0) {
-                    OP_LOG(OP_LOG_ERROR,
-                           "Failed to enable TCP_NODELAY option.   %s",
-                           strerror(errno));
-                    m_driver->close(conn_fd);
-                    continue;
-                }
-                auto conn = connection_msg_t{.fd = conn_fd};
-                memcpy(&conn.client, saddr, get_sa_len(saddr));
-                if (zmq_send(m_accept_pub.get(), &conn, sizeof(conn), 0) < 0) {
-                    OP_LOG(OP_LOG_ERROR,
-                           "tcp_acceptor failed to send fd=%d\n",
-                           conn.fd);
-                    m_driver->close(conn.fd);
-                }
-            }
-        }
-    }
-}
-
 class tcp_connection_reading_state
 {
 public:
@@ -307,10 +173,10 @@ public:
 
 tcp_worker::tcp_worker(const drivers::driver_ptr& driver,
                        void* context,
-                       server::stat_t& stat)
+                       int acceptfd)
     : m_driver(driver)
-    , m_stat(stat)
     , m_loop(new core::event_loop())
+    , m_acceptfd(acceptfd)
     , m_running(false)
     , m_read_buffer(recv_buffer_size)
     , m_write_buffer(send_buffer_size)
@@ -326,23 +192,32 @@ tcp_worker::tcp_worker(const drivers::driver_ptr& driver,
         OP_LOG(OP_LOG_ERROR, err_msg);
         throw std::runtime_error(err_msg);
     }
-    m_accept_sub.reset(
-        op_socket_get_client(context, ZMQ_PULL, accept_endpoint.data()));
-    if (!m_accept_sub) {
-        constexpr auto err_msg =
-            "Network load generator tcp worker failed to create accept socket";
-        OP_LOG(OP_LOG_ERROR, err_msg);
-        throw std::runtime_error(err_msg);
-    }
 
     utils::op_prbs23_fill(m_write_buffer.data(), m_write_buffer.size());
 }
 
-void tcp_worker::start()
+tcp_worker::~tcp_worker()
+{
+    join();
+    m_driver->shutdown(m_acceptfd, SHUT_RDWR);
+    m_driver->close(m_acceptfd);
+}
+
+void tcp_worker::start(std::optional<core::cpuset> cpus)
 {
     m_running = true;
-    m_thread = std::thread([this] {
+    m_thread = std::thread([this, cpus = std::move(cpus)] {
         op_thread_setname("op_net_srv_w");
+
+        if (cpus) {
+            if (auto error = core::cpuset_set_affinity(cpus.value())) {
+                OP_LOG(OP_LOG_WARNING,
+                       "Could not pin TCP server worker to core %s: %s\n",
+                       cpus->to_string().c_str(),
+                       strerror(error));
+            }
+        }
+
         this->run();
         op_log_close();
     });
@@ -369,10 +244,10 @@ void tcp_worker::run()
             if (!w) return -1;
             return w->do_accept();
         }};
-    m_loop->add(m_accept_sub.get(), &accept_callbacks, this);
+    m_loop->add(m_acceptfd, &accept_callbacks, this);
 
     if (sock_is_readable(m_ctrl_sub.get())) { do_control(); }
-    if (sock_is_readable(m_accept_sub.get())) { do_accept(); }
+    do_accept();
 
     while (m_running) { m_loop->run(); }
 
@@ -383,27 +258,49 @@ void tcp_worker::run()
 
 int tcp_worker::do_accept()
 {
-    connection_msg_t msg;
+    sockaddr_storage addr;
+    socklen_t addr_len = sizeof(addr);
+    auto saddr = reinterpret_cast<sockaddr*>(&addr);
+    int conn_fd;
+
+    while ((conn_fd =
+                m_driver->accept(m_acceptfd, saddr, &addr_len, SOCK_NONBLOCK))
+           != -1) {
+        int enable = 1;
+        if (m_driver->setsockopt(
+                conn_fd, IPPROTO_TCP, TCP_NODELAY, &enable, sizeof(enable))
+            != 0) {
+            OP_LOG(OP_LOG_ERROR,
+                   "Failed to enable TCP_NODELAY option.   %s",
+                   strerror(errno));
+            m_driver->close(conn_fd);
+            addr_len = sizeof(addr);
+            continue;
+        }
 
-    while (zmq_recv(m_accept_sub.get(), &msg, sizeof(msg), ZMQ_DONTWAIT) >= 0) {
-        auto r = network_sockaddr_assign(&msg.client);
+        auto r = network_sockaddr_assign(saddr);
+        addr_len = sizeof(addr);
         if (!r) {
             OP_LOG(OP_LOG_ERROR, "Error getting TCP connection sockaddr");
-            m_driver->close(msg.fd);
+            m_driver->close(conn_fd);
             continue;
         }
         auto conn = std::make_unique<tcp_connection_t>(
-            tcp_connection_t{.fd = msg.fd,
+            tcp_connection_t{.fd = conn_fd,
                              .state = STATE_WAITING,
                              .client = r.value(),
                              .worker = this});
         m_loop->add(
             conn->fd, &tcp_connection_reading_state::callbacks, conn.get());
-        m_connections[msg.fd] = std::move(conn);
-        m_stat.connections++;
+        m_connections[conn_fd] = std::move(conn);
+        m_stat.connections += 1;
     }
 
-    if (errno != EAGAIN) { return -1; }
+    if (errno != EAGAIN && errno != EWOULDBLOCK) {
+        OP_LOG(OP_LOG_ERROR,
+               "Failed to accept TCP connection: %s\n",
+               strerror(errno));
+    }
     return 0;
 }
 
@@ -422,8 +319,8 @@ int tcp_worker::do_control()
 
 int tcp_worker::do_close(tcp_connection_t& conn)
 {
-    if (conn.state == STATE_ERROR) m_stat.errors++;
-    m_stat.closed++;
+    if (conn.state == STATE_ERROR) m_stat.errors += 1;
+    m_stat.closed += 1;
     m_driver->close(conn.fd);
     m_connections.erase(conn.fd);
 
@@ -633,7 +530,32 @@ server_tcp::server_tcp(in_port_t port,
         throw std::runtime_error(err_msg);
     }
 
+    start_workers(port, interface);
+}
+
+server_tcp::~server_tcp()
+{
+    try {
+        stop_workers();
+    } catch (...) {
+        // no exceptions in destructor
+    }
+
+    m_ctrl_pub.reset();
+}
+
+server::stat_t server_tcp::stat() const
+{
+    auto sum = stat_t{};
+    for (const auto& worker : m_workers) { accumulate(sum, worker->stat()); }
+    return (sum);
+}
+
+void server_tcp::start_workers(in_port_t port,
+                               const std::optional<std::string>& interface)
+{
     /* IPv6 any supports IPv4 and IPv6 */
+    auto domain = AF_INET6;
     tl::expected<int, std::string> res;
     if ((res = create_server_socket(m_driver.get(), AF_INET6, port, interface));
         res) {
@@ -642,48 +564,45 @@ server_tcp::server_tcp(in_port_t port,
                     m_driver.get(), AF_INET, port, interface));
                res) {
         OP_LOG(OP_LOG_DEBUG, "Network TCP load server IPv4.\n");
+        domain = AF_INET;
     } else {
         throw std::runtime_error("Cannot create TCP server: " + res.error());
     }
 
-    int acceptfd = res.value();
-    try {
-        m_acceptor = std::make_unique<tcp_acceptor>(driver, m_context.get());
-        m_acceptor->start(acceptfd);
-    } catch (...) {
-        m_driver->close(acceptfd);
-        throw;
-    }
-
-    start_workers();
-}
+    /*
+     * Every worker listens on its own SO_REUSEPORT socket and accepts its
+     * own connections, so the kernel spreads new connections across
+     * workers without a separate accept thread handing them out.
+     */
+    const auto nb_workers = config::server_workers();
+    while (true) {
+        auto acceptfd = res.value();
+        try {
+            m_workers.push_back(std::make_unique<tcp_worker>(
+                m_driver, m_context.get(), acceptfd));
+        } catch (...) {
+            m_driver->close(acceptfd);
+            m_workers.clear();
+            throw;
+        }
 
-server_tcp::~server_tcp()
-{
-    try {
-        m_acceptor->stop();
-    } catch (...) {
-        // no exceptions in destructor
-    }
-    m_acceptor.reset();
+        if (m_workers.size() == nb_workers) { break; }
 
-    try {
-        stop_workers();
-    } catch (...) {
-        // no exceptions in destructor
+        if (!(res = create_server_socket(
+                  m_driver.get(), domain, port, interface))) {
+            m_workers.clear();
+            throw std::runtime_error("Cannot create TCP server: "
+                                     + res.error());
+        }
     }
 
-    m_ctrl_pub.reset();
-}
+    OP_LOG(OP_LOG_DEBUG,
+           "Starting %zu Network TCP load server workers\n",
+           m_workers.size());
 
-void server_tcp::start_workers()
-{
-    // Accept thread has to be started first to avoid ZMQ fault
-    assert(m_acceptor->running());
-
-    m_workers.push_back(
-        std::make_unique<tcp_worker>(m_driver, m_context.get(), m_stat));
-    m_workers.back()->start();
+    for (unsigned i = 0; i < m_workers.size(); i++) {
+        m_workers[i]->start(get_worker_cpuset(i));
+    }
 }
 
 void server_tcp::stop_workers()
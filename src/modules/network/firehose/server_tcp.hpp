@@ -29,31 +29,6 @@ struct tcp_connection_t
     tcp_worker* worker;
 };
 
-class tcp_acceptor
-{
-private:
-    drivers::driver_ptr m_driver;
-    std::unique_ptr<void, op_socket_deleter> m_accept_pub;
-    std::thread m_thread;
-    int m_eventfd;  /* eventfd used to wakeup from poll */
-    int m_acceptfd; /* socket fd used for accept() */
-    bool m_running; /* acceptor is running */
-
-    void run();
-
-public:
-    tcp_acceptor(const drivers::driver_ptr& driver, void* context);
-    tcp_acceptor(const tcp_acceptor&) = delete;
-    tcp_acceptor(tcp_acceptor&&) = delete;
-    tcp_acceptor& operator=(const tcp_acceptor&) = delete;
-    tcp_acceptor& operator=(tcp_acceptor&&) = delete;
-    ~tcp_acceptor();
-
-    void start(int acceptfd);
-    void stop();
-    bool running() const { return m_running; }
-};
-
 class tcp_worker
 {
 private:
@@ -61,10 +36,10 @@ private:
     friend class tcp_connection_writing_state;
 
     drivers::driver_ptr m_driver;
-    server::stat_t& m_stat;
+    server::worker_stat_t m_stat;
     std::unique_ptr<core::event_loop> m_loop;
     std::unique_ptr<void, op_socket_deleter> m_ctrl_sub;
-    std::unique_ptr<void, op_socket_deleter> m_accept_sub;
+    int m_acceptfd; /* this worker's SO_REUSEPORT listening socket */
     std::thread m_thread;
     bool m_running;
     std::map<int, std::unique_ptr<tcp_connection_t>> m_connections;
@@ -82,16 +57,18 @@ private:
 public:
     tcp_worker(const drivers::driver_ptr& driver,
                void* context,
-               server::stat_t& stat);
+               int acceptfd);
     tcp_worker(const tcp_worker&) = delete;
     tcp_worker(tcp_worker&&) = delete;
     tcp_worker& operator=(const tcp_worker&) = delete;
     tcp_worker& operator=(tcp_worker&&) = delete;
-    ~tcp_worker() = default;
+    ~tcp_worker();
 
-    void start();
+    void start(std::optional<core::cpuset> cpus);
     void join();
     bool running() const { return m_running; }
+
+    const server::worker_stat_t& stat() const { return m_stat; }
 };
 
 class server_tcp final : public server
@@ -108,10 +85,10 @@ private:
 
     std::unique_ptr<void, zmq_ctx_deleter> m_context;
     std::unique_ptr<void, op_socket_deleter> m_ctrl_pub;
-    std::unique_ptr<tcp_acceptor> m_acceptor;
     std::vector<std::unique_ptr<tcp_worker>> m_workers;
 
-    void start_workers();
+    void start_workers(in_port_t port,
+                       const std::optional<std::string>& interface);
     void stop_workers();
 
 public:
@@ -120,6 +97,8 @@ public:
                const drivers::driver_ptr& driver);
     server_tcp(const server_tcp&) = delete;
     ~server_tcp() override;
+
+    stat_t stat() const override;
 };
 
 } // namespace openperf::network::internal::firehose
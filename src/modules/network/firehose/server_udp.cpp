@@ -1,8 +1,10 @@
 #include <cassert>
+#include <cstring>
 #include <stdexcept>
 #include <fcntl.h>
 #include <unistd.h>
 #include <poll.h>
+#include <netinet/udp.h>
 #include <sys/eventfd.h>
 
 #include "config/op_config_file.hpp"
@@ -73,6 +75,15 @@ tl::expected<int, std::string> server_udp::new_server(
         return tl::make_unexpected<std::string>(strerror(err));
     }
 
+    /* Every worker binds its own socket to the port */
+    if (m_driver->setsockopt(
+            sock, SOL_SOCKET, SO_REUSEPORT, &enable, sizeof(enable))
+        != 0) {
+        auto err = errno;
+        m_driver->close(sock);
+        return tl::make_unexpected<std::string>(strerror(err));
+    }
+
     /* Update to non-blocking socket */
     int flags = m_driver->fcntl(sock, F_GETFL);
     if (flags == -1) {
@@ -125,127 +136,389 @@ server_udp::server_udp(in_port_t port,
             errno, std::generic_category(), "Failed to create eventfd");
     }
 
-    /* IPv6 any supports IPv4 and IPv6 */
-    tl::expected<int, std::string> res;
-    if ((res = new_server(AF_INET6, port, interface)); res) {
-        OP_LOG(OP_LOG_DEBUG, "Network UDP load server IPv4/IPv6.\n");
-    } else if ((res = new_server(AF_INET, port, interface)); res) {
-        OP_LOG(OP_LOG_DEBUG, "Network UDP load server IPv4.\n");
-    } else {
-        throw std::runtime_error("Cannot create UDP server: " + res.error());
+    try {
+        /* IPv6 any supports IPv4 and IPv6 */
+        auto domain = AF_INET6;
+        tl::expected<int, std::string> res;
+        if ((res = new_server(AF_INET6, port, interface)); res) {
+            OP_LOG(OP_LOG_DEBUG, "Network UDP load server IPv4/IPv6.\n");
+        } else if ((res = new_server(AF_INET, port, interface)); res) {
+            OP_LOG(OP_LOG_DEBUG, "Network UDP load server IPv4.\n");
+            domain = AF_INET;
+        } else {
+            throw std::runtime_error("Cannot create UDP server: "
+                                     + res.error());
+        }
+
+        /*
+         * Each worker gets its own socket, so the kernel can spread
+         * clients across workers instead of having them all contend
+         * for a single socket.
+         */
+        const auto nb_workers = config::server_workers();
+        m_workers.push_back(std::make_unique<udp_worker>(
+            m_driver, res.value(), m_eventfd, m_stopped));
+        while (m_workers.size() < nb_workers) {
+            if (!(res = new_server(domain, port, interface))) {
+                throw std::runtime_error("Cannot create UDP server: "
+                                         + res.error());
+            }
+            m_workers.push_back(std::make_unique<udp_worker>(
+                m_driver, res.value(), m_eventfd, m_stopped));
+        }
+    } catch (...) {
+        m_workers.clear();
+        close(m_eventfd);
+        throw;
     }
 
-    m_fd = res.value();
+    OP_LOG(OP_LOG_DEBUG,
+           "Starting %zu Network UDP load server workers\n",
+           m_workers.size());
 
-    run_worker_thread();
+    for (unsigned i = 0; i < m_workers.size(); i++) {
+        m_workers[i]->start(get_worker_cpuset(i));
+    }
 }
 
 server_udp::~server_udp()
 {
     m_stopped.store(true, std::memory_order_relaxed);
-    eventfd_write(m_eventfd, 1);
-    if (m_worker_thread.joinable()) m_worker_thread.join();
 
-    if (m_fd.load() >= 0) { m_driver->close(m_fd); }
+    /* Workers never read the eventfd, so a single write wakes them all */
+    eventfd_write(m_eventfd, 1);
+    for (auto& worker : m_workers) { worker->join(); }
+    m_workers.clear();
 
     close(m_eventfd);
 }
 
-// One worker for udp
-void server_udp::run_worker_thread()
+server::stat_t server_udp::stat() const
+{
+    auto sum = stat_t{};
+    for (const auto& worker : m_workers) { accumulate(sum, worker->stat()); }
+    return (sum);
+}
+
+udp_worker::udp_worker(const drivers::driver_ptr& driver,
+                       int fd,
+                       int eventfd,
+                       const std::atomic_bool& stopped)
+    : m_driver(driver)
+    , m_stopped(stopped)
+    , m_fd(fd)
+    , m_eventfd(eventfd)
+    , m_gro(false)
+    , m_gso(false)
+    , m_rx(std::make_unique<message_batch>())
+    , m_tx(std::make_unique<message_batch>())
+{
+    /*
+     * Let the kernel coalesce back to back datagrams from the same flow
+     * and segment our replies for us, if it can.  Drivers that don't
+     * support these options just get a datagram per message.
+     */
+    int enable = 1;
+    m_gro = (m_driver->setsockopt(
+                 m_fd, SOL_UDP, UDP_GRO, &enable, sizeof(enable))
+             == 0);
+
+    int segment_size = 0;
+    socklen_t segment_size_len = sizeof(segment_size);
+    m_gso = (m_driver->getsockopt(
+                 m_fd, SOL_UDP, UDP_SEGMENT, &segment_size, &segment_size_len)
+             == 0);
+
+    OP_LOG(OP_LOG_DEBUG,
+           "Network UDP load server socket %d: GRO %s, GSO %s\n",
+           m_fd,
+           m_gro ? "enabled" : "disabled",
+           m_gso ? "enabled" : "disabled");
+
+    m_recv_buffer.resize(udp_batch_size
+                         * (m_gro ? udp_gro_buffer_size : recv_buffer_size));
+    m_send_buffer.resize(udp_gso_max_segments * send_buffer_size);
+    utils::op_prbs23_fill(m_send_buffer.data(), m_send_buffer.size());
+
+    m_tx->count = 0;
+}
+
+udp_worker::~udp_worker()
+{
+    join();
+    m_driver->close(m_fd);
+}
+
+void udp_worker::start(std::optional<core::cpuset> cpus)
 {
-    m_worker_thread = std::thread([&] {
+    m_thread = std::thread([this, cpus = std::move(cpus)] {
         // Set the thread name
         op_thread_setname("op_net_srv_w");
 
-        ssize_t recv_or_err = 0;
-        connection_t conn = {
-            .fd = m_fd, .state = STATE_WAITING, .bytes_left = 0};
-        sockaddr_storage client_storage;
-        auto* client = reinterpret_cast<sockaddr*>(&client_storage);
-        socklen_t client_length = sizeof(struct sockaddr_in6);
-
-        std::vector<uint8_t> read_buffer(net_request_size);
-        std::vector<uint8_t> send_buffer(send_buffer_size);
-        utils::op_prbs23_fill(send_buffer.data(), send_buffer.size());
-
-        while (!m_stopped.load(std::memory_order_relaxed)) {
-            // Wait for rx data or eventfd notification
-            std::array<struct pollfd, 2> pfd;
-            pfd[0] = {.fd = m_eventfd, .events = POLLIN, .revents = 0};
-            pfd[1] = {.fd = m_fd, .events = POLLIN, .revents = 0};
-            int npoll = poll(pfd.data(), pfd.size(), -1);
-            if (npoll < 0 && errno != EINTR) {
-                OP_LOG(OP_LOG_ERROR, "poll failed.  %s", strerror(errno));
-                break;
+        if (cpus) {
+            if (auto error = core::cpuset_set_affinity(cpus.value())) {
+                OP_LOG(OP_LOG_WARNING,
+                       "Could not pin UDP server worker to core %s: %s\n",
+                       cpus->to_string().c_str(),
+                       strerror(error));
+            }
+        }
+
+        this->run();
+        op_log_close();
+    });
+}
+
+void udp_worker::join()
+{
+    if (m_thread.joinable()) { m_thread.join(); }
+}
+
+void udp_worker::run()
+{
+    while (!m_stopped.load(std::memory_order_relaxed)) {
+        // Wait for rx data or eventfd notification
+        std::array<struct pollfd, 2> pfd;
+        pfd[0] = {.fd = m_eventfd, .events = POLLIN, .revents = 0};
+        pfd[1] = {.fd = m_fd, .events = POLLIN, .revents = 0};
+        int npoll = poll(pfd.data(), pfd.size(), -1);
+        if (npoll < 0 && errno != EINTR) {
+            OP_LOG(OP_LOG_ERROR, "poll failed.  %s", strerror(errno));
+            break;
+        }
+        if (npoll <= 0) { continue; }
+
+        int nb_msgs = 0;
+        do {
+            prepare_receive();
+            nb_msgs = m_driver->recvmmsg(
+                m_fd, m_rx->messages.data(), m_rx->messages.size(), MSG_TRUNC);
+            for (int i = 0; i < nb_msgs; i++) {
+                do_receive(m_rx->messages[i]);
+            }
+            flush_replies();
+        } while (nb_msgs == static_cast<int>(m_rx->messages.size()));
+    }
+}
+
+void udp_worker::prepare_receive()
+{
+    auto& rx = *m_rx;
+    const auto buffer_size = m_recv_buffer.size() / rx.messages.size();
+
+    for (size_t i = 0; i < rx.messages.size(); i++) {
+        rx.iovecs[i].iov_base = m_recv_buffer.data() + i * buffer_size;
+        rx.iovecs[i].iov_len = buffer_size;
+
+        auto& hdr = rx.messages[i].msg_hdr;
+        hdr = msghdr{};
+        hdr.msg_name = &rx.addresses[i];
+        hdr.msg_namelen = sizeof(rx.addresses[i]);
+        hdr.msg_iov = &rx.iovecs[i];
+        hdr.msg_iovlen = 1;
+        hdr.msg_control = rx.controls[i].data;
+        hdr.msg_controllen = sizeof(rx.controls[i].data);
+        rx.messages[i].msg_len = 0;
+    }
+}
+
+void udp_worker::do_receive(struct mmsghdr& msg)
+{
+    auto& hdr = msg.msg_hdr;
+    auto* data = static_cast<uint8_t*>(hdr.msg_iov[0].iov_base);
+    const auto* client = static_cast<const sockaddr*>(hdr.msg_name);
+
+    /* MSG_TRUNC gives us the full length, even if we only read part of it */
+    const size_t length = msg.msg_len;
+    const size_t available = std::min(length, hdr.msg_iov[0].iov_len);
+    m_stat.bytes_received += length;
+
+    /* Coalesced datagrams are all segment_size long, except the last one */
+    size_t segment_size = length;
+    for (auto* cmsg = CMSG_FIRSTHDR(&hdr); cmsg != nullptr;
+         cmsg = CMSG_NXTHDR(&hdr, cmsg)) {
+        if (cmsg->cmsg_level == SOL_UDP && cmsg->cmsg_type == UDP_GRO) {
+            int gso_size = 0;
+            std::memcpy(&gso_size, CMSG_DATA(cmsg), sizeof(gso_size));
+            if (gso_size > 0) { segment_size = gso_size; }
+        }
+    }
+
+    for (size_t offset = 0; offset < length; offset += segment_size) {
+        const auto seg_length = std::min(segment_size, length - offset);
+        const auto seg_available =
+            offset < available ? std::min(seg_length, available - offset) : 0;
+        do_request(data + offset, seg_available, client, hdr.msg_namelen);
+    }
+}
+
+void udp_worker::do_request(uint8_t* data,
+                            size_t length,
+                            const struct sockaddr* client,
+                            socklen_t client_length)
+{
+    m_stat.connections += 1;
+
+    auto bytes_left = length;
+    auto req = firehose::parse_request(data, bytes_left);
+    if (!req) {
+        char ntopbuf[INET6_ADDRSTRLEN];
+        const char* addr = inet_ntop(
+            client->sa_family, get_sa_addr(client), ntopbuf, INET6_ADDRSTRLEN);
+        OP_LOG(OP_LOG_ERROR,
+               "Invalid firehose request received "
+               "from %s:%d\n",
+               addr ? addr : "unknown",
+               ntohs(get_sa_port(client)));
+        OP_LOG(OP_LOG_ERROR,
+               "recv = %zu, bytes_left = %zu\n",
+               length,
+               bytes_left);
+        return;
+    }
+
+    if (req.value().action == action_t::GET) {
+        queue_reply(client, client_length, req.value().length);
+    }
+
+    m_stat.closed += 1;
+}
+
+void udp_worker::queue_reply(const struct sockaddr* client,
+                             socklen_t client_length,
+                             size_t length)
+{
+    auto& tx = *m_tx;
+
+    while (length) {
+        const auto max_chunk = m_gso
+                                   ? udp_gso_max_segments * send_buffer_size
+                                   : send_buffer_size;
+        const auto chunk = std::min(length, max_chunk);
+        const auto idx = tx.count;
+
+        std::memcpy(&tx.addresses[idx], client, client_length);
+        tx.iovecs[idx].iov_base = m_send_buffer.data();
+        tx.iovecs[idx].iov_len = chunk;
+
+        auto& hdr = tx.messages[idx].msg_hdr;
+        hdr = msghdr{};
+        hdr.msg_name = &tx.addresses[idx];
+        hdr.msg_namelen = client_length;
+        hdr.msg_iov = &tx.iovecs[idx];
+        hdr.msg_iovlen = 1;
+
+        /* Have the kernel split large replies into datagrams for us */
+        if (chunk > send_buffer_size) {
+            hdr.msg_control = tx.controls[idx].data;
+            hdr.msg_controllen = CMSG_SPACE(sizeof(uint16_t));
+            auto* cmsg = CMSG_FIRSTHDR(&hdr);
+            cmsg->cmsg_level = SOL_UDP;
+            cmsg->cmsg_type = UDP_SEGMENT;
+            cmsg->cmsg_len = CMSG_LEN(sizeof(uint16_t));
+            const uint16_t segment_size = send_buffer_size;
+            std::memcpy(CMSG_DATA(cmsg), &segment_size, sizeof(segment_size));
+        }
+
+        length -= chunk;
+        if (++tx.count == tx.messages.size()) { flush_replies(); }
+    }
+}
+
+void udp_worker::flush_replies()
+{
+    auto& tx = *m_tx;
+
+    unsigned idx = 0;
+    while (idx < tx.count) {
+        auto sent = m_driver->sendmmsg(
+            m_fd, tx.messages.data() + idx, tx.count - idx, 0);
+        if (sent > 0) {
+            auto bytes_sent = 0UL;
+            for (auto i = idx; i < idx + sent; i++) {
+                bytes_sent += tx.messages[i].msg_len;
             }
-            if (npoll <= 0) { continue; }
+            m_stat.bytes_sent += bytes_sent;
+            idx += sent;
+            continue;
+        }
 
-            if (pfd[0].revents & POLLIN) {
-                eventfd_t value = 0;
-                eventfd_read(m_eventfd, &value);
+        /*
+         * Segmentation fails if the segments don't fit in the path MTU or
+         * the device can't checksum them; stop trying on this socket.
+         */
+        if (m_gso && (errno == EINVAL || errno == EIO)) {
+            OP_LOG(OP_LOG_DEBUG,
+                   "UDP segmentation failed on socket %d: %s; "
+                   "sending datagrams individually\n",
+                   m_fd,
+                   strerror(errno));
+            m_gso = false;
+            for (; idx < tx.count; idx++) {
+                send_unsegmented(tx.messages[idx].msg_hdr);
             }
+            break;
+        }
+
+        /* The socket buffer is full; retry the rest once it drains */
+        if (errno == EAGAIN || errno == EWOULDBLOCK) {
+            if (wait_writable()) { continue; }
+            break;
+        }
 
-            while ((recv_or_err = m_driver->recvfrom(m_fd,
-                                                     read_buffer.data(),
-                                                     read_buffer.size(),
-                                                     0,
-                                                     client,
-                                                     &client_length))
-                   != -1) {
-                uint8_t* recv_cursor = read_buffer.data();
-                size_t bytes_left = recv_or_err;
-                m_stat.bytes_received += recv_or_err;
-                m_stat.connections++;
-
-                auto req = firehose::parse_request(recv_cursor, bytes_left);
-                if (!req) {
-                    char ntopbuf[INET6_ADDRSTRLEN];
-                    const char* addr = inet_ntop(client->sa_family,
-                                                 get_sa_addr(client),
-                                                 ntopbuf,
-                                                 INET6_ADDRSTRLEN);
-                    OP_LOG(OP_LOG_ERROR,
-                           "Invalid firehose request received "
-                           "from %s:%d\n",
-                           addr ? addr : "unknown",
-                           ntohs(get_sa_port(client)));
-                    OP_LOG(OP_LOG_ERROR,
-                           "recv = %zu, bytes_left = %zu\n",
-                           recv_or_err,
-                           bytes_left);
-                    continue;
-                }
-                conn.state = (req.value().action == action_t::GET)
-                                 ? STATE_WRITING
-                                 : STATE_READING;
-                conn.bytes_left = req.value().length;
-                bytes_left -= firehose::net_request_size;
-                recv_cursor += firehose::net_request_size;
-
-                while (conn.state == STATE_WRITING && conn.bytes_left) {
-                    size_t produced =
-                        std::min(send_buffer.size(), conn.bytes_left);
-                    ssize_t send_or_err = m_driver->sendto(m_fd,
-                                                           send_buffer.data(),
-                                                           produced,
-                                                           0,
-                                                           client,
-                                                           client_length);
-                    if (send_or_err == -1) {
-                        conn.state = STATE_ERROR;
-                        conn.bytes_left = 0;
-                        m_stat.errors++;
-                    } else {
-                        conn.bytes_left -= send_or_err;
-                        m_stat.bytes_sent += send_or_err;
-                    }
-                }
-                m_stat.closed++;
+        /* Drop the failed reply and carry on with the rest */
+        m_stat.errors += 1;
+        idx++;
+    }
+
+    tx.count = 0;
+}
+
+void udp_worker::send_unsegmented(const struct msghdr& msg)
+{
+    const auto* data = static_cast<const uint8_t*>(msg.msg_iov[0].iov_base);
+    size_t bytes_left = msg.msg_iov[0].iov_len;
+
+    while (bytes_left) {
+        size_t produced = std::min(send_buffer_size, bytes_left);
+        ssize_t send_or_err =
+            m_driver->sendto(m_fd,
+                             data,
+                             produced,
+                             0,
+                             static_cast<const sockaddr*>(msg.msg_name),
+                             msg.msg_namelen);
+        if (send_or_err == -1) {
+            if ((errno == EAGAIN || errno == EWOULDBLOCK) && wait_writable()) {
+                continue;
             }
+            m_stat.errors += 1;
+            return;
         }
-        op_log_close();
-    });
+        bytes_left -= send_or_err;
+        m_stat.bytes_sent += send_or_err;
+    }
+}
+
+/*
+ * Wait for room in the socket's send buffer.  Returns false if the server
+ * is stopping or the wait fails.
+ */
+bool udp_worker::wait_writable()
+{
+    std::array<struct pollfd, 2> pfd;
+    pfd[0] = {.fd = m_eventfd, .events = POLLIN, .revents = 0};
+    pfd[1] = {.fd = m_fd, .events = POLLOUT, .revents = 0};
+    while (!m_stopped.load(std::memory_order_relaxed)) {
+        int npoll = poll(pfd.data(), pfd.size(), -1);
+        if (npoll < 0 && errno != EINTR) {
+            OP_LOG(OP_LOG_ERROR, "poll failed.  %s", strerror(errno));
+            return (false);
+        }
+        if (pfd[1].revents & (POLLOUT | POLLERR)) { return (true); }
+    }
+
+    return (false);
 }
 
 } // namespace openperf::network::internal::firehose
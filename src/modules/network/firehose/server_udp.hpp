@@ -1,27 +1,104 @@
 #ifndef _OP_NETWORK_FIREHOSE_SERVER_UDP_HPP_
 #define _OP_NETWORK_FIREHOSE_SERVER_UDP_HPP_
 
+#include <array>
 #include <atomic>
+#include <memory>
 #include <thread>
 #include <vector>
+#include <sys/socket.h>
 
 #include "server.hpp"
 
 namespace openperf::network::internal::firehose {
 
+/* Maximum number of datagrams handled per recvmmsg/sendmmsg call */
+const static size_t udp_batch_size = 32;
+
+/*
+ * Maximum number of send_buffer_size datagrams to hand to the kernel in a
+ * single UDP_SEGMENT send; the total must fit in a single UDP payload.
+ */
+const static size_t udp_gso_max_segments = 15;
+
+/* Receive buffer size for a datagram when using UDP_GRO */
+const static size_t udp_gro_buffer_size = 65535;
+
+class udp_worker
+{
+private:
+    struct alignas(struct cmsghdr) control_buffer
+    {
+        uint8_t data[CMSG_SPACE(sizeof(int))];
+    };
+
+    /* Scratch space for a batch of datagrams */
+    struct message_batch
+    {
+        std::array<struct mmsghdr, udp_batch_size> messages;
+        std::array<struct iovec, udp_batch_size> iovecs;
+        std::array<struct sockaddr_storage, udp_batch_size> addresses;
+        std::array<control_buffer, udp_batch_size> controls;
+        unsigned count;
+    };
+
+    drivers::driver_ptr m_driver;
+    server::worker_stat_t m_stat;
+    const std::atomic_bool& m_stopped;
+    int m_fd;      /* this worker's SO_REUSEPORT socket */
+    int m_eventfd; /* eventfd used to wakeup from poll */
+    bool m_gro;    /* socket coalesces received datagrams */
+    bool m_gso;    /* socket accepts UDP_SEGMENT sends */
+    std::thread m_thread;
+
+    std::unique_ptr<message_batch> m_rx;
+    std::unique_ptr<message_batch> m_tx;
+    std::vector<uint8_t> m_recv_buffer;
+    std::vector<uint8_t> m_send_buffer;
+
+    void run();
+
+    void prepare_receive();
+    void do_receive(struct mmsghdr& msg);
+    void do_request(uint8_t* data,
+                    size_t length,
+                    const struct sockaddr* client,
+                    socklen_t client_length);
+    void queue_reply(const struct sockaddr* client,
+                     socklen_t client_length,
+                     size_t length);
+    void flush_replies();
+    void send_unsegmented(const struct msghdr& msg);
+    bool wait_writable();
+
+public:
+    udp_worker(const drivers::driver_ptr& driver,
+               int fd,
+               int eventfd,
+               const std::atomic_bool& stopped);
+    udp_worker(const udp_worker&) = delete;
+    udp_worker(udp_worker&&) = delete;
+    udp_worker& operator=(const udp_worker&) = delete;
+    udp_worker& operator=(udp_worker&&) = delete;
+    ~udp_worker();
+
+    void start(std::optional<core::cpuset> cpus);
+    void join();
+
+    const server::worker_stat_t& stat() const { return m_stat; }
+};
+
 class server_udp final : public server
 {
 private:
     std::atomic_bool m_stopped;
-    std::thread m_worker_thread;
+    std::vector<std::unique_ptr<udp_worker>> m_workers;
     int m_eventfd;
 
-    int udp_write(connection_t&);
     tl::expected<int, std::string>
     new_server(int domain,
                in_port_t port,
                const std::optional<std::string>& interface);
-    void run_worker_thread();
 
 public:
     server_udp(in_port_t port,
@@ -29,6 +106,8 @@ public:
                const drivers::driver_ptr& driver);
     server_udp(const server_udp&) = delete;
     ~server_udp() override;
+
+    stat_t stat() const override;
 };
 
 } // namespace openperf::network::internal::firehose
@@ -13,6 +13,14 @@ using namespace std::chrono_literals;
 static uint16_t serial_counter = 0;
 constexpr auto NAME_PREFIX = "op_network";
 
+template <typename Histogram>
+std::optional<std::chrono::nanoseconds>
+to_percentile(const Histogram& histogram, double quantile)
+{
+    if (!histogram.total()) return std::nullopt;
+    return std::chrono::nanoseconds(histogram.value_at_quantile(quantile));
+}
+
 auto to_load_stat_t(const task::stat_t& task_stat)
 {
     return model::generator_result::load_stat_t{
@@ -23,7 +31,11 @@ auto to_load_stat_t(const task::stat_t& task_stat)
         .io_errors = task_stat.errors,
         .latency = task_stat.latency,
         .latency_min = task_stat.latency_min,
-        .latency_max = task_stat.latency_max};
+        .latency_max = task_stat.latency_max,
+        .latency_p50 = to_percentile(task_stat.latency_histogram, 0.5),
+        .latency_p99 = to_percentile(task_stat.latency_histogram, 0.99),
+        .latency_p999 = to_percentile(task_stat.latency_histogram, 0.999),
+        .latency_p9999 = to_percentile(task_stat.latency_histogram, 0.9999)};
 };
 
 auto to_conn_stat_t(const task::stat_t& write_stat,
@@ -54,6 +66,14 @@ std::optional<double> get_field(const model::generator_result& stat,
         return read.latency_min.value_or(0ns).count();
     if (name == "read.latency_max")
         return read.latency_max.value_or(0ns).count();
+    if (name == "read.latency_p50")
+        return read.latency_p50.value_or(0ns).count();
+    if (name == "read.latency_p99")
+        return read.latency_p99.value_or(0ns).count();
+    if (name == "read.latency_p999")
+        return read.latency_p999.value_or(0ns).count();
+    if (name == "read.latency_p9999")
+        return read.latency_p9999.value_or(0ns).count();
 
     auto write = stat.write_stats();
     if (name == "write.ops_target") return write.ops_target;
@@ -67,6 +87,14 @@ std::optional<double> get_field(const model::generator_result& stat,
         return write.latency_min.value_or(0ns).count();
     if (name == "write.latency_max")
         return write.latency_max.value_or(0ns).count();
+    if (name == "write.latency_p50")
+        return write.latency_p50.value_or(0ns).count();
+    if (name == "write.latency_p99")
+        return write.latency_p99.value_or(0ns).count();
+    if (name == "write.latency_p999")
+        return write.latency_p999.value_or(0ns).count();
+    if (name == "write.latency_p9999")
+        return write.latency_p9999.value_or(0ns).count();
 
     if (name == "timestamp") return stat.timestamp().time_since_epoch().count();
 
@@ -47,7 +47,7 @@ void server::reset() {}
 
 server::stat_t server::stat() const
 {
-    auto& istat = server_ptr->stat();
+    auto istat = server_ptr->stat();
     auto& stat = const_cast<stat_t&>(m_stat);
     stat.connections = istat.connections;
     stat.errors = istat.errors;
@@ -4,6 +4,8 @@
 const char op_network_mask[] = "modules.network.cpu-mask";
 const char op_network_driver[] = "modules.network.driver";
 const char op_network_op_timeout[] = "modules.network.operation-timeout";
+const char op_network_server_workers[] = "modules.network.server-workers";
+const char op_network_engine[] = "modules.network.engine";
 
 MAKE_OPTION_DATA(
     network,
@@ -20,6 +22,16 @@ MAKE_OPTION_DATA(
              "microseconds, default 1000000 (1s)",
              "modules.network.operation-timeout",
              0,
-             OP_OPTION_TYPE_LONG), );
+             OP_OPTION_TYPE_LONG),
+    MAKE_OPT("specifies the number of Network server worker threads, "
+             "default one per core in the Network CPU mask",
+             "modules.network.server-workers",
+             0,
+             OP_OPTION_TYPE_LONG),
+    MAKE_OPT("specifies the connection engine for kernel driver generators: "
+             "epoll (default) or io_uring",
+             "modules.network.engine",
+             0,
+             OP_OPTION_TYPE_STRING), );
 
 REGISTER_CLI_OPTIONS(network)
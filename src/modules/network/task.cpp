@@ -1,5 +1,7 @@
 #include <thread>
 #include <limits>
+#include <numeric>
+#include <system_error>
 #include <cerrno>
 #include <cstdlib>
 #include <cinttypes>
@@ -7,6 +9,8 @@
 #include <netinet/tcp.h>
 #include <tl/expected.hpp>
 #include <fcntl.h>
+#include <sys/socket.h>
+#include <unistd.h>
 
 #include "config/op_config_file.hpp"
 #include "framework/core/op_log.h"
@@ -29,6 +33,36 @@ constexpr duration TASK_SPIN_THRESHOLD = 100ms;
 constexpr duration QUANTA = 10ms;
 const size_t max_buffer_size = 64 * 1024;
 
+/* io_uring queue limits; the kernel requires powers of two */
+constexpr unsigned URING_MIN_ENTRIES = 64;
+constexpr unsigned URING_MAX_ENTRIES = 32768;
+constexpr unsigned URING_MAX_RECV_BUFFERS = 1024;
+constexpr size_t URING_RECV_BUFFER_SIZE = 16 * 1024;
+constexpr uint16_t URING_BUFFER_GROUP = 0;
+
+/* io_uring request types; stored in the low byte of the user data */
+enum class uring_op : uint8_t {
+    files_update = 1,
+    close_raw,
+    connect,
+    send,
+    recv,
+    shutdown,
+    close,
+};
+
+static constexpr uint64_t uring_tag(unsigned slot, uring_op op)
+{
+    return ((static_cast<uint64_t>(slot) << 8) | static_cast<uint8_t>(op));
+}
+
+static unsigned uring_entries(uint64_t count, unsigned max_entries)
+{
+    auto entries = URING_MIN_ENTRIES;
+    while (entries < count && entries < max_entries) { entries <<= 1; }
+    return (entries);
+}
+
 stat_t& stat_t::operator+=(const stat_t& stat)
 {
     assert(operation == stat.operation);
@@ -39,6 +73,7 @@ stat_t& stat_t::operator+=(const stat_t& stat)
     bytes_target += stat.bytes_target;
     bytes_actual += stat.bytes_actual;
     latency += stat.latency;
+    latency_histogram += stat.latency_histogram;
     errors += stat.errors;
 
     latency_min = [&]() -> optional_time_t {
@@ -160,6 +195,14 @@ network_task::network_task(const config_t& configuration,
 network_task::~network_task()
 {
     m_active = false;
+    if (m_ring) {
+        try {
+            uring_teardown();
+        } catch (...) {
+            // no exceptions in destructor
+        }
+    }
+
     auto count = m_loop->count();
     if (count) {
         // Wait a bit for current operations to complete and exit gracefully
@@ -240,9 +283,10 @@ void update_stat_latency(stat_t& stat, duration dur)
     if (!stat.latency_min || dur < stat.latency_min.value()) {
         stat.latency_min = dur;
     }
-    if (!stat.latency_max || dur < stat.latency_max.value()) {
+    if (!stat.latency_max || dur > stat.latency_max.value()) {
         stat.latency_max = dur;
     }
+    stat.latency_histogram.record(dur.count());
 }
 
 stat_t network_task::spin()
@@ -274,7 +318,8 @@ stat_t network_task::spin()
         auto ops_req = dt * ops_per_sec / std::nano::den + 1;
 
         assert(ops_req);
-        auto worker_spin_stat = worker_spin(ops_req);
+        auto worker_spin_stat =
+            m_ring ? uring_spin(ops_req) : worker_spin(ops_req);
         stat += worker_spin_stat;
 
         cur_time = ref_clock::now();
@@ -657,6 +702,600 @@ stat_t network_task::worker_spin(uint64_t nb_ops)
     return m_spin_stat;
 }
 
+/*
+ * The io_uring engine needs registered files that can be used by linked
+ * requests, provided buffer rings, and multishot receives, i.e. Linux 6.0
+ * or later.  Check for all of them once, by receiving on a socket pair.
+ */
+static bool io_uring_supported()
+{
+    static const bool supported = []() {
+        using namespace utils::io_uring;
+
+        try {
+            auto probe_ring = ring(4);
+            if (!(probe_ring.features() & IORING_FEAT_LINKED_FILE)) {
+                return (false);
+            }
+            auto bufs = buffer_ring(probe_ring, URING_BUFFER_GROUP, 1, 64);
+
+            int sv[2];
+            if (socketpair(AF_UNIX, SOCK_STREAM, 0, sv) == -1) {
+                return (false);
+            }
+
+            auto result = false;
+            prep_recv_multishot(
+                probe_ring.get_sqe(), sv[0], bufs.group_id(), 0, 0);
+            const uint8_t probe = 0;
+            if (probe_ring.submit() == 1 && write(sv[1], &probe, 1) == 1
+                && probe_ring.submit_and_wait(1, 100ms) == 0) {
+                probe_ring.for_each_cqe([&](const io_uring_cqe& cqe) {
+                    result = (cqe.res == 1 && (cqe.flags & IORING_CQE_F_MORE));
+                });
+            }
+
+            close(sv[0]);
+            close(sv[1]);
+            return (result);
+        } catch (const std::system_error&) {
+            return (false);
+        }
+    }();
+
+    return (supported);
+}
+
+bool network_task::config_ring()
+{
+    using namespace utils::io_uring;
+
+    if (!dynamic_cast<drivers::kernel*>(m_driver.get())
+        || m_config.target.protocol != IPPROTO_TCP) {
+        OP_LOG(OP_LOG_DEBUG,
+               "The io_uring engine only supports TCP with the kernel "
+               "driver; using the event loop\n");
+        return (false);
+    }
+
+    if (!io_uring_supported()) {
+        OP_LOG(OP_LOG_WARNING,
+               "Kernel does not support the io_uring network engine; "
+               "using the event loop\n");
+        return (false);
+    }
+
+    auto server = populate_sockaddr(m_driver,
+                                    m_config.target.host,
+                                    m_config.target.port,
+                                    m_config.target.interface);
+    if (!server) {
+        OP_LOG(OP_LOG_ERROR,
+               "Invalid network generator target %s: %s\n",
+               m_config.target.host.c_str(),
+               strerror(server.error()));
+        return (false);
+    }
+
+    firehose::request_t to_request = {
+        .action = (m_config.operation == operation_t::READ)
+                      ? firehose::action_t::GET
+                      : firehose::action_t::PUT,
+        .length = static_cast<uint32_t>(m_config.block_size),
+    };
+    m_request.clear();
+    if (auto r = firehose::build_request(to_request, m_request); !r) {
+        OP_LOG(OP_LOG_ERROR,
+               "Cannot build firehose request: %s",
+               strerror(r.error()));
+        return (false);
+    }
+
+    /*
+     * Every connection may have a handful of requests queued between
+     * submissions, e.g. a close followed by the connect of its
+     * replacement, so size the submission queue accordingly.
+     */
+    const auto nb_conns = m_config.connections;
+    try {
+        m_ring = std::make_unique<ring>(
+            uring_entries(nb_conns * 8, URING_MAX_ENTRIES));
+        m_uring_bufs = std::make_unique<buffer_ring>(
+            *m_ring,
+            URING_BUFFER_GROUP,
+            uring_entries(nb_conns * 2, URING_MAX_RECV_BUFFERS),
+            URING_RECV_BUFFER_SIZE);
+    } catch (const std::system_error& e) {
+        OP_LOG(OP_LOG_WARNING,
+               "Could not create io_uring for network generator: %s\n",
+               e.what());
+        m_uring_bufs.reset();
+        m_ring.reset();
+        return (false);
+    }
+
+    /* Start with an empty file table; connections fill it in */
+    auto files = std::vector<int>(nb_conns, -1);
+    if (auto error = m_ring->register_files(files.data(), files.size())) {
+        OP_LOG(OP_LOG_WARNING,
+               "Could not register io_uring files for network generator: "
+               "%s\n",
+               strerror(-error));
+        m_uring_bufs.reset();
+        m_ring.reset();
+        return (false);
+    }
+
+    m_uring_conns.assign(nb_conns, uring_connection_t{});
+    m_uring_free.resize(nb_conns);
+    std::iota(m_uring_free.rbegin(), m_uring_free.rend(), 0U);
+    m_uring_idle.clear();
+    m_uring_closes.clear();
+    m_uring_active = 0;
+    m_uring_ops_to_start = 0;
+    m_uring_inflight = 0;
+    m_uring_server = server.value();
+
+    return (true);
+}
+
+void network_task::uring_teardown()
+{
+    /* Shutting down the sockets aborts any outstanding operations */
+    m_uring_idle.clear();
+    for (unsigned slot = 0; slot < m_uring_conns.size(); slot++) {
+        const auto& conn = m_uring_conns[slot];
+        if (conn.active && !conn.closing) { uring_close(slot, STATE_DONE); }
+    }
+
+    const auto deadline = ref_clock::now() + QUANTA;
+    while (m_uring_active) {
+        auto now = ref_clock::now();
+        if (now >= deadline) { break; }
+        uring_retry_closes();
+        m_ring->submit_and_wait(1, deadline - now);
+        m_ring->for_each_cqe(
+            [this](const io_uring_cqe& cqe) { uring_handle_completion(cqe); });
+        m_uring_bufs->commit();
+    }
+
+    /* Destroying the ring closes anything left in the file table */
+    if (m_uring_active) {
+        OP_LOG(OP_LOG_DEBUG,
+               "Forcefully closing %zu connections",
+               m_uring_active);
+    }
+
+    m_uring_bufs.reset();
+    m_ring.reset();
+    m_uring_conns.clear();
+    m_uring_free.clear();
+    m_uring_closes.clear();
+    m_uring_active = 0;
+    m_uring_ops_to_start = 0;
+    m_uring_inflight = 0;
+}
+
+/*
+ * io_uring version of the worker loop.  Instead of waiting for socket
+ * readiness and then making a system call per operation, we queue every
+ * connect, send, and close as a ring request and submit them all with a
+ * single system call.  Each connection also has a multishot receive
+ * outstanding, so responses show up as completions without any further
+ * requests.  Sockets are installed in the ring's registered file table
+ * as soon as they are created, which avoids the file reference counting
+ * on every request.
+ */
+stat_t network_task::uring_spin(uint64_t nb_ops)
+{
+    m_spin_stat = stat_t{.operation = m_config.operation};
+    m_uring_ops_to_start = nb_ops;
+
+    uring_retry_closes();
+
+    /* Put idle connections back to work */
+    auto idle = std::vector<unsigned>{};
+    std::swap(idle, m_uring_idle);
+    for (auto slot : idle) {
+        const auto& conn = m_uring_conns[slot];
+        if (conn.active && !conn.closing) { uring_start_operation(slot); }
+    }
+
+    uring_open_connections();
+
+    const auto deadline = ref_clock::now() + QUANTA;
+    while (m_uring_ops_to_start || m_uring_inflight) {
+        auto now = ref_clock::now();
+        if (now >= deadline) { break; }
+
+        if (auto error = m_ring->submit_and_wait(1, deadline - now);
+            error && error != -ETIME && error != -EINTR) {
+            OP_LOG(OP_LOG_ERROR,
+                   "Could not submit io_uring operations: %s\n",
+                   strerror(-error));
+        }
+
+        m_ring->for_each_cqe(
+            [this](const io_uring_cqe& cqe) { uring_handle_completion(cqe); });
+        m_uring_bufs->commit();
+
+        /* Replace any connections that finished */
+        uring_retry_closes();
+        uring_open_connections();
+    }
+
+    uring_expire_operations();
+    m_ring->submit();
+
+    return (m_spin_stat);
+}
+
+/*
+ * Retrieve the first of nb_sqes submission queue entries.  Linked requests
+ * must be submitted together, so make room for all of them up front.
+ * Returns nullptr if the kernel won't take any more requests right now.
+ */
+io_uring_sqe* network_task::uring_sqe(unsigned nb_sqes)
+{
+    if (m_ring->sq_space_left() < nb_sqes) { m_ring->submit(); }
+    if (m_ring->sq_space_left() < nb_sqes) { return (nullptr); }
+
+    return (m_ring->get_sqe());
+}
+
+void network_task::uring_open_connections()
+{
+    using namespace utils::io_uring;
+
+    const auto& server = m_uring_server.value();
+    auto* sa = std::visit([](auto&& sa) { return (sockaddr*)&sa; }, server);
+
+    while (m_active && m_uring_active < m_config.connections
+           && !m_uring_free.empty()) {
+        m_spin_stat.conn_stat.attempted++;
+
+        auto sock =
+            m_driver->socket(network_sockaddr_family(server), SOCK_STREAM, 0);
+        if (sock == -1) {
+            OP_LOG(OP_LOG_TRACE,
+                   "Could not open new connection: %s\n",
+                   strerror(errno));
+            m_spin_stat.conn_stat.errors++;
+            break;
+        }
+
+        /* See new_connection for why we disable the Nagle algorithm */
+        int enable = 1;
+        if ((m_config.target.interface
+             && m_driver->setsockopt(sock,
+                                     SOL_SOCKET,
+                                     SO_BINDTODEVICE,
+                                     m_config.target.interface.value().c_str(),
+                                     m_config.target.interface.value().size())
+                    < 0)
+            || m_driver->setsockopt(
+                   sock, IPPROTO_TCP, TCP_NODELAY, &enable, sizeof(enable))
+                   != 0) {
+            OP_LOG(OP_LOG_TRACE,
+                   "Could not open new connection: %s\n",
+                   strerror(errno));
+            m_driver->close(sock);
+            m_spin_stat.conn_stat.errors++;
+            break;
+        }
+
+        auto* sqe = uring_sqe(3);
+        if (!sqe) {
+            OP_LOG(OP_LOG_TRACE,
+                   "Could not open new connection: "
+                   "io_uring submission queue is full\n");
+            m_driver->close(sock);
+            m_spin_stat.conn_stat.errors++;
+            break;
+        }
+
+        auto slot = m_uring_free.back();
+        m_uring_free.pop_back();
+        m_uring_active++;
+
+        auto& conn = m_uring_conns[slot];
+        conn = uring_connection_t{.fd = sock,
+                                  .state = STATE_INIT,
+                                  .active = true,
+                                  .ops_left = m_config.ops_per_connection};
+
+        /*
+         * Install the socket in the file table, close our copy, and
+         * connect.  The close runs even if the install fails, so we
+         * never leak the socket.
+         */
+        prep_files_update(
+            sqe, &conn.fd, 1, slot, uring_tag(slot, uring_op::files_update));
+        sqe->flags |= IOSQE_IO_HARDLINK | IOSQE_CQE_SKIP_SUCCESS;
+
+        sqe = m_ring->get_sqe();
+        prep_close(sqe, conn.fd, uring_tag(slot, uring_op::close_raw));
+        sqe->flags |= IOSQE_IO_LINK | IOSQE_CQE_SKIP_SUCCESS;
+
+        sqe = m_ring->get_sqe();
+        prep_connect(sqe,
+                     slot,
+                     sa,
+                     network_sockaddr_size(server),
+                     uring_tag(slot, uring_op::connect));
+        sqe->flags |= IOSQE_FIXED_FILE;
+        conn.pending++;
+    }
+}
+
+void network_task::uring_start_operation(unsigned slot)
+{
+    auto& conn = m_uring_conns[slot];
+
+    if (!m_active || conn.ops_left == 0) {
+        uring_close(slot, STATE_DONE);
+        return;
+    }
+
+    if (m_uring_ops_to_start == 0) {
+        conn.state = STATE_INIT;
+        m_uring_idle.push_back(slot);
+        return;
+    }
+
+    m_uring_ops_to_start--;
+    m_uring_inflight++;
+    conn.in_operation = true;
+    conn.operation_start_time = ref_clock::now();
+
+    switch (m_config.operation) {
+    case operation_t::READ:
+        conn.state = STATE_READING;
+        conn.send_left = m_request.size();
+        conn.bytes_left = m_config.block_size;
+        break;
+    case operation_t::WRITE:
+        conn.state = STATE_WRITING;
+        conn.send_left = m_request.size() + m_config.block_size;
+        conn.bytes_left = 0;
+        break;
+    }
+
+    uring_send(slot);
+}
+
+void network_task::uring_send(unsigned slot)
+{
+    auto& conn = m_uring_conns[slot];
+
+    /* The request stream is the header followed by any write payload */
+    const auto total = m_request.size()
+                       + (m_config.operation == operation_t::WRITE
+                              ? m_config.block_size
+                              : 0);
+    const auto offset = total - conn.send_left;
+
+    size_t nb_iov = 0;
+    auto payload_left = conn.send_left;
+    if (offset < m_request.size()) {
+        conn.iov[nb_iov++] = {.iov_base = m_request.data() + offset,
+                              .iov_len = m_request.size() - offset};
+        payload_left -= m_request.size() - offset;
+    }
+    if (payload_left) {
+        conn.iov[nb_iov++] = {
+            .iov_base = m_write_buffer.data(),
+            .iov_len = std::min(payload_left, m_write_buffer.size())};
+    }
+
+    conn.msg = msghdr{};
+    conn.msg.msg_iov = conn.iov.data();
+    conn.msg.msg_iovlen = nb_iov;
+
+    auto* sqe = uring_sqe();
+    if (!sqe) {
+        uring_close(slot, STATE_ERROR);
+        return;
+    }
+
+    utils::io_uring::prep_sendmsg(sqe,
+                                  slot,
+                                  &conn.msg,
+                                  MSG_NOSIGNAL | MSG_WAITALL,
+                                  uring_tag(slot, uring_op::send));
+    sqe->flags |= IOSQE_FIXED_FILE;
+    conn.pending++;
+}
+
+void network_task::uring_recv(unsigned slot)
+{
+    auto& conn = m_uring_conns[slot];
+
+    auto* sqe = uring_sqe();
+    if (!sqe) {
+        uring_close(slot, STATE_ERROR);
+        return;
+    }
+
+    utils::io_uring::prep_recv_multishot(sqe,
+                                         slot,
+                                         m_uring_bufs->group_id(),
+                                         0,
+                                         uring_tag(slot, uring_op::recv));
+    sqe->flags |= IOSQE_FIXED_FILE;
+    conn.recv_armed = true;
+    conn.pending++;
+}
+
+void network_task::uring_complete_operation(unsigned slot)
+{
+    auto& conn = m_uring_conns[slot];
+
+    conn.in_operation = false;
+    m_uring_inflight--;
+
+    m_spin_stat.ops_actual++;
+    m_spin_stat.bytes_actual += m_config.block_size;
+    update_stat_latency(m_spin_stat,
+                        ref_clock::now() - conn.operation_start_time);
+
+    conn.ops_left--;
+    conn.state = STATE_INIT;
+    uring_start_operation(slot);
+}
+
+void network_task::uring_close(unsigned slot, connection_state_t state)
+{
+    auto& conn = m_uring_conns[slot];
+    if (conn.closing) { return; }
+
+    if (conn.in_operation) {
+        conn.in_operation = false;
+        m_uring_inflight--;
+    }
+
+    conn.closing = true;
+    conn.state = state;
+    if (state == STATE_ERROR) { m_spin_stat.errors++; }
+
+    /* The slot stays in use until the close completes, whenever we queue it */
+    conn.pending++;
+    if (!uring_queue_close(slot)) { m_uring_closes.push_back(slot); }
+}
+
+bool network_task::uring_queue_close(unsigned slot)
+{
+    using namespace utils::io_uring;
+
+    auto* sqe = uring_sqe(2);
+    if (!sqe) { return (false); }
+
+    /* Shutting the socket down terminates any outstanding receive */
+    prep_shutdown(sqe, slot, SHUT_RDWR, uring_tag(slot, uring_op::shutdown));
+    sqe->flags |=
+        IOSQE_FIXED_FILE | IOSQE_IO_HARDLINK | IOSQE_CQE_SKIP_SUCCESS;
+
+    sqe = m_ring->get_sqe();
+    prep_close_fixed(sqe, slot, uring_tag(slot, uring_op::close));
+    return (true);
+}
+
+/* Queue any closes that didn't fit in the submission queue earlier */
+void network_task::uring_retry_closes()
+{
+    auto closes = std::vector<unsigned>{};
+    std::swap(closes, m_uring_closes);
+    for (auto slot : closes) {
+        if (!uring_queue_close(slot)) { m_uring_closes.push_back(slot); }
+    }
+}
+
+void network_task::uring_release(unsigned slot)
+{
+    auto& conn = m_uring_conns[slot];
+    if (!conn.closing || conn.pending) { return; }
+
+    conn.active = false;
+    conn.closing = false;
+    m_uring_active--;
+    m_uring_free.push_back(slot);
+}
+
+void network_task::uring_handle_completion(const io_uring_cqe& cqe)
+{
+    const auto slot = static_cast<unsigned>(cqe.user_data >> 8);
+    const auto op = static_cast<uring_op>(cqe.user_data & 0xff);
+    auto& conn = m_uring_conns[slot];
+
+    /* We don't look at the response data, so hand buffers right back */
+    if (auto id = utils::io_uring::buffer_ring::buffer_id(cqe)) {
+        m_uring_bufs->recycle(*id);
+    }
+
+    switch (op) {
+    case uring_op::connect:
+        conn.pending--;
+        if (conn.closing) { break; }
+        if (cqe.res < 0) {
+            OP_LOG(OP_LOG_TRACE,
+                   "Could not open new connection: %s\n",
+                   strerror(-cqe.res));
+            m_spin_stat.conn_stat.errors++;
+            uring_close(slot, STATE_DONE);
+            break;
+        }
+        m_spin_stat.conn_stat.successful++;
+        if (m_config.operation == operation_t::READ) { uring_recv(slot); }
+        if (!conn.closing) { uring_start_operation(slot); }
+        break;
+    case uring_op::send:
+        conn.pending--;
+        if (conn.closing) { break; }
+        if (cqe.res < 0) {
+            uring_close(slot, STATE_ERROR);
+            break;
+        }
+        conn.send_left -= std::min(conn.send_left, size_t(cqe.res));
+        if (conn.send_left) {
+            uring_send(slot);
+        } else if (conn.bytes_left == 0) {
+            uring_complete_operation(slot);
+        }
+        break;
+    case uring_op::recv:
+        if (!(cqe.flags & IORING_CQE_F_MORE)) {
+            conn.recv_armed = false;
+            conn.pending--;
+        }
+        if (conn.closing) { break; }
+        if (cqe.res > 0) {
+            if (conn.in_operation && conn.bytes_left) {
+                conn.bytes_left -= std::min(conn.bytes_left, size_t(cqe.res));
+                if (!conn.bytes_left && !conn.send_left) {
+                    uring_complete_operation(slot);
+                }
+            }
+            if (!conn.recv_armed && !conn.closing) { uring_recv(slot); }
+        } else if (cqe.res == 0) {
+            uring_close(slot, STATE_DONE); /* remote side closed connection */
+        } else if (cqe.res == -ENOBUFS) {
+            uring_recv(slot); /* buffers are recycled before the next submit */
+        } else {
+            uring_close(slot, STATE_ERROR);
+        }
+        break;
+    case uring_op::close:
+        conn.pending--;
+        m_spin_stat.conn_stat.closed++;
+        break;
+    default:
+        /* Failures of requests that skip successful completions */
+        break;
+    }
+
+    uring_release(slot);
+}
+
+void network_task::uring_expire_operations()
+{
+    static auto timeout = config::operation_timeout();
+    const auto now = ref_clock::now();
+
+    for (unsigned slot = 0; slot < m_uring_conns.size(); slot++) {
+        const auto& conn = m_uring_conns[slot];
+        if (!conn.active || conn.closing || !conn.in_operation
+            || now - conn.operation_start_time < timeout) {
+            continue;
+        }
+
+        OP_LOG(OP_LOG_DEBUG,
+               "network %s operation timed out slot=%u",
+               conn.state == STATE_WRITING ? "write" : "read",
+               slot);
+        uring_close(slot, STATE_ERROR);
+    }
+}
+
 void network_task::config(const config_t& p_config)
 {
     m_config = p_config;
@@ -664,6 +1303,14 @@ void network_task::config(const config_t& p_config)
 
     m_write_buffer.resize(std::min(m_config.block_size, max_buffer_size));
     utils::op_prbs23_fill(m_write_buffer.data(), m_write_buffer.size());
+
+    /* Reconfiguring drops any io_uring connections */
+    if (m_ring) { uring_teardown(); }
+
+    if (config::engine() == config::engine_type::io_uring && config_ring()) {
+        /* Connections made by the event loop would never be serviced */
+        if (m_loop->count()) { m_loop->purge(); }
+    }
 }
 
 int32_t network_task::calculate_rate()
@@ -1,6 +1,7 @@
 #ifndef _OP_NETWORK_GENERATOR_TASK_HPP_
 #define _OP_NETWORK_GENERATOR_TASK_HPP_
 
+#include <array>
 #include <atomic>
 #include <chrono>
 #include <map>
@@ -10,6 +11,8 @@
 #include <netinet/in.h>
 
 #include "framework/generator/task.hpp"
+#include "framework/utils/histogram.hpp"
+#include "framework/utils/io_uring.hpp"
 #include "modules/timesync/chrono.hpp"
 #include "utils/network_sockaddr.hpp"
 #include "drivers/driver.hpp"
@@ -77,6 +80,28 @@ struct connection_t
 
 using connection_ptr = std::unique_ptr<connection_t>;
 
+/*
+ * Connection state for the io_uring engine.  Connections live in a fixed
+ * table; a connection's index is also its slot in the ring's registered
+ * file table, so sockets are only referenced by index once installed.
+ */
+struct uring_connection_t
+{
+    int fd; /* socket until it is installed in the file table */
+    connection_state_t state;
+    bool active;       /* slot is in use */
+    bool closing;      /* close has been queued */
+    bool in_operation; /* an operation has been started but not finished */
+    bool recv_armed;   /* multishot receive is outstanding */
+    unsigned pending;  /* outstanding requests that will complete */
+    size_t send_left;  /* request bytes left to send */
+    size_t bytes_left; /* response bytes left to receive */
+    ref_clock::time_point operation_start_time;
+    uint_fast64_t ops_left;
+    msghdr msg;
+    std::array<iovec, 2> iov;
+};
+
 struct conn_stat_t
 {
     uint_fast64_t attempted = 0;
@@ -98,6 +123,7 @@ struct stat_t
      * latency      - The total amount of time required to perform operations
      * latency_min  - The minimum observed latency value
      * latency_max  - The maximum observed latency value
+     * latency_histogram - The distribution of observed latency values (ns)
      */
 
     operation_t operation;
@@ -111,6 +137,7 @@ struct stat_t
     duration latency = duration::zero();
     optional_time_t latency_min;
     optional_time_t latency_max;
+    utils::log_linear_histogram<> latency_histogram;
 
     stat_t& operator+=(const stat_t&);
 };
@@ -143,6 +170,23 @@ private:
     stat_t worker_spin(uint64_t nb_ops);
     int32_t calculate_rate();
 
+    /* io_uring engine */
+    bool config_ring();
+    void uring_teardown();
+    stat_t uring_spin(uint64_t nb_ops);
+    io_uring_sqe* uring_sqe(unsigned nb_sqes = 1);
+    void uring_open_connections();
+    void uring_start_operation(unsigned slot);
+    void uring_send(unsigned slot);
+    void uring_recv(unsigned slot);
+    void uring_complete_operation(unsigned slot);
+    void uring_close(unsigned slot, connection_state_t state);
+    bool uring_queue_close(unsigned slot);
+    void uring_retry_closes();
+    void uring_release(unsigned slot);
+    void uring_handle_completion(const io_uring_cqe& cqe);
+    void uring_expire_operations();
+
     bool m_active;
     config_t m_config;
     stat_t m_stat;
@@ -153,6 +197,19 @@ private:
     ref_clock::time_point m_operation_timestamp;
     std::map<int, connection_ptr> m_connections;
     std::vector<uint8_t> m_write_buffer;
+
+    /* io_uring engine state; the ring must outlive its buffers */
+    std::unique_ptr<utils::io_uring::ring> m_ring;
+    std::unique_ptr<utils::io_uring::buffer_ring> m_uring_bufs;
+    std::vector<uring_connection_t> m_uring_conns;
+    std::vector<unsigned> m_uring_free;
+    std::vector<unsigned> m_uring_idle;
+    std::vector<unsigned> m_uring_closes; /* closes waiting for room */
+    size_t m_uring_active = 0;
+    uint_fast64_t m_uring_ops_to_start = 0;
+    uint_fast64_t m_uring_inflight = 0;
+    std::optional<network_sockaddr> m_uring_server;
+    std::vector<uint8_t> m_request;
 };
 
 } // namespace openperf::network::internal::task
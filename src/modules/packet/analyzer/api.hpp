@@ -38,11 +38,14 @@ inline constexpr std::string_view endpoint =
     "inproc://openperf_packet_analyzer";
 
 /*
- * We use an RCU system to handle concurrent reader/writer access
- * for results.  Our only reader is the server thread, so we use
- * the following explicit id instead of hard coding 0 everywhere.
+ * Flow statistics are preallocated when a result is created so that
+ * new flows never require memory allocation on the data path.  These
+ * values bound the number of flows each analyzer may track.  Since every
+ * result (and every reset) pays for the maximum in each worker shard,
+ * the default is kept small; users expecting more flows must ask.
  */
-inline constexpr auto result_reader_id = 0;
+inline constexpr size_t default_max_flows = 4096;
+inline constexpr size_t max_flows_limit = 1U << 24;
 
 /*
  * Provide some sane typedefs for the swagger types we deal with.
@@ -75,6 +78,69 @@ using rx_flow_ptr = std::unique_ptr<rx_flow_type>;
 
 using id_ptr = std::unique_ptr<std::string>;
 
+/*
+ * Compact flow statistics for streaming clients. Records are fixed size
+ * and trivially copyable, so they can be written to the wire as is. The
+ * optional counter groups are only valid when the corresponding flag
+ * is set. All timestamps and durations are in nanoseconds.
+ */
+enum class rx_flow_update_flags : uint32_t {
+    frame_length = (1 << 0),
+    latency = (1 << 1),
+    sequencing = (1 << 2),
+};
+
+struct rx_flow_update
+{
+    core::uuid id; /* same id as the RxFlow object */
+    uint64_t frame_count;
+    int64_t timestamp_first;
+    int64_t timestamp_last;
+    struct
+    {
+        uint32_t fcs;
+        uint32_t ipv4_checksum;
+        uint32_t tcp_checksum;
+        uint32_t udp_checksum;
+    } errors;
+    uint32_t flags;
+    uint16_t frame_length_min;
+    uint16_t frame_length_max;
+    int64_t frame_length_total;
+    int64_t latency_min;
+    int64_t latency_max;
+    int64_t latency_total;
+    uint64_t sequence_in_order;
+    uint32_t sequence_dropped;
+    uint32_t sequence_duplicate;
+    uint32_t sequence_late;
+    uint32_t sequence_reordered;
+};
+
+static_assert(std::is_trivially_copyable_v<rx_flow_update>);
+static_assert(sizeof(rx_flow_update) == 120); /* wire format */
+
+/*
+ * Every frame of an rx flow stream starts with this header and is
+ * followed by `count` rx_flow_update records.  Values use host byte
+ * order.
+ */
+struct rx_flow_update_frame_header
+{
+    static constexpr uint32_t frame_magic = 0x4f505246; /* "OPRF" */
+    static constexpr uint16_t frame_version = 1;
+
+    uint32_t magic;
+    uint16_t version;
+    uint16_t record_length; /* sizeof(rx_flow_update) */
+    uint64_t count;
+    int64_t timestamp;
+};
+
+static_assert(sizeof(rx_flow_update_frame_header) == 24); /* wire format */
+
+using rx_flow_updates_ptr = std::unique_ptr<std::vector<rx_flow_update>>;
+
 enum class filter_key_type { none, analyzer_id, source_id };
 using filter_map_type = std::map<filter_key_type, std::string>;
 using filter_map_ptr = std::unique_ptr<filter_map_type>;
@@ -209,6 +275,22 @@ struct request_get_rx_flow
     std::string id;
 };
 
+/*
+ * Retrieve all flows that have received frames since the previous request
+ * with the same subscription id.  The first request for a subscription id
+ * returns every flow.
+ */
+struct request_get_rx_flow_updates
+{
+    uint64_t subscription;
+    filter_map_ptr filter;
+};
+
+struct request_delete_rx_flow_subscription
+{
+    uint64_t subscription;
+};
+
 struct reply_analyzers
 {
     std::vector<analyzer_ptr> analyzers;
@@ -224,6 +306,11 @@ struct reply_rx_flows
     std::vector<rx_flow_ptr> flows;
 };
 
+struct reply_rx_flow_updates
+{
+    rx_flow_updates_ptr updates;
+};
+
 using request_msg = std::variant<request_list_analyzers,
                                  request_create_analyzer,
                                  request_delete_analyzers,
@@ -241,7 +328,9 @@ using request_msg = std::variant<request_list_analyzers,
                                  request_get_analyzer_result,
                                  request_delete_analyzer_result,
                                  request_list_rx_flows,
-                                 request_get_rx_flow>;
+                                 request_get_rx_flow,
+                                 request_get_rx_flow_updates,
+                                 request_delete_rx_flow_subscription>;
 
 struct reply_ok
 {};
@@ -262,6 +351,7 @@ struct reply_error
 using reply_msg = std::variant<reply_analyzers,
                                reply_analyzer_results,
                                reply_rx_flows,
+                               reply_rx_flow_updates,
                                reply_ok,
                                reply_error>;
 
@@ -278,6 +368,8 @@ analyzer_result_ptr to_swagger(const core::uuid& id, const sink_result& result);
 rx_flow_ptr to_swagger(const core::uuid& id,
                        const core::uuid& result_id,
                        const statistics::generic_flow_counters& counters);
+rx_flow_update to_update(const core::uuid& id,
+                         const statistics::generic_flow_counters& counters);
 
 core::uuid get_analyzer_result_id();
 
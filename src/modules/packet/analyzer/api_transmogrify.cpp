@@ -82,6 +82,14 @@ serialized_msg serialize_request(request_msg&& msg)
                  [&](const request_get_rx_flow& request) {
                      return (message::push(
                          serialized, request.id.data(), request.id.length()));
+                 },
+                 [&](request_get_rx_flow_updates& request) -> int {
+                     return (message::push(serialized, request.subscription)
+                             || message::push(serialized,
+                                              std::move(request.filter)));
+                 },
+                 [&](const request_delete_rx_flow_subscription& request) {
+                     return (message::push(serialized, request.subscription));
                  }),
              msg));
     if (error) { throw std::bad_alloc(); }
@@ -105,6 +113,10 @@ serialized_msg serialize_reply(reply_msg&& msg)
                  [&](reply_rx_flows& reply) {
                      return (message::push(serialized, reply.flows));
                  },
+                 [&](reply_rx_flow_updates& reply) {
+                     return (
+                         message::push(serialized, std::move(reply.updates)));
+                 },
                  [&](const reply_ok&) {
                      return (message::push(serialized, 0));
                  },
@@ -186,6 +198,17 @@ tl::expected<request_msg, int> deserialize_request(serialized_msg&& msg)
     case utils::variant_index<request_msg, request_get_rx_flow>(): {
         return (request_get_rx_flow{message::pop_string(msg)});
     }
+    case utils::variant_index<request_msg, request_get_rx_flow_updates>(): {
+        auto request = request_get_rx_flow_updates{};
+        request.subscription = message::pop<uint64_t>(msg);
+        request.filter.reset(message::pop<filter_map_type*>(msg));
+        return (request);
+    }
+    case utils::variant_index<request_msg,
+                              request_delete_rx_flow_subscription>(): {
+        return (request_delete_rx_flow_subscription{
+            message::pop<uint64_t>(msg)});
+    }
     }
 
     return (tl::make_unexpected(EINVAL));
@@ -207,6 +230,12 @@ tl::expected<reply_msg, int> deserialize_reply(serialized_msg&& msg)
     case utils::variant_index<reply_msg, reply_rx_flows>(): {
         return (reply_rx_flows{message::pop_unique_vector<rx_flow_type>(msg)});
     }
+    case utils::variant_index<reply_msg, reply_rx_flow_updates>(): {
+        auto reply = reply_rx_flow_updates{};
+        reply.updates.reset(
+            message::pop<std::vector<rx_flow_update>*>(msg));
+        return (reply);
+    }
     case utils::variant_index<reply_msg, reply_ok>():
         return (reply_ok{});
     case utils::variant_index<reply_msg, reply_error>():
@@ -3,8 +3,8 @@
 #
 
 PA_DEPENDS += \
+	api \
 	base_n \
-	immer \
 	packet_bpf \
 	packet_protocol \
 	packet_statistics \
@@ -17,7 +17,7 @@ PA_SOURCES += \
 	api_transmogrify.cpp \
 	handler.cpp \
 	init.cpp \
-	recycle_impl.cpp \
+	rx_flow_stream.cpp \
 	server.cpp \
 	sink.cpp \
 	sink_transmogrify.cpp \
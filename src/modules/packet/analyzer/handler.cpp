@@ -6,6 +6,7 @@
 #include "core/op_core.h"
 #include "message/serialized_message.hpp"
 #include "packet/analyzer/api.hpp"
+#include "packet/analyzer/rx_flow_stream.hpp"
 #include "packetio/init.hpp"
 
 #include "swagger/converters/packet_analyzer.hpp"
@@ -63,13 +64,17 @@ public:
     /* Rx flow operations */
     void list_rx_flows(const request_type& request, response_type response);
     void get_rx_flow(const request_type& request, response_type response);
+    void stream_rx_flows(const request_type& request, response_type response);
 
 private:
+    void* m_context;
     std::unique_ptr<void, op_socket_deleter> m_socket;
+    std::vector<std::unique_ptr<openperf::api::flow_stream>> m_streams;
 };
 
 handler::handler(void* context, Pistache::Rest::Router& router)
-    : m_socket(op_socket_get_client(context, ZMQ_REQ, endpoint.data()))
+    : m_context(context)
+    , m_socket(op_socket_get_client(context, ZMQ_REQ, endpoint.data()))
 {
     using namespace Pistache::Rest::Routes;
 
@@ -120,6 +125,9 @@ handler::handler(void* context, Pistache::Rest::Router& router)
 
     Get(router, "/packet/rx-flows", bind(&handler::list_rx_flows, this));
     Get(router, "/packet/rx-flows/:id", bind(&handler::get_rx_flow, this));
+    Get(router,
+        "/packet/rx-flows/x/stream",
+        bind(&handler::stream_rx_flows, this));
 }
 
 using namespace Pistache;
@@ -873,4 +881,60 @@ void handler::get_rx_flow(const request_type& request, response_type response)
     }
 }
 
+static tl::expected<uint64_t, int> to_uint64(const std::string& val_str)
+{
+    char* end_ptr = nullptr;
+    auto v = strtoull(val_str.c_str(), &end_ptr, 10);
+    if (!end_ptr || *end_ptr != '\0') { return tl::make_unexpected(EINVAL); }
+    return v;
+}
+
+void handler::stream_rx_flows(const request_type& request,
+                              response_type response)
+{
+    if (auto server_ok = check_server(); !server_ok) {
+        response.send(Http::Code::Method_Not_Allowed, server_ok.error());
+        return;
+    }
+
+    constexpr auto min_interval = std::chrono::milliseconds{10};
+    auto interval = std::chrono::milliseconds{1000};
+    if (auto query = request.query().get("interval")) {
+        auto v = to_uint64(query.value());
+        if (!v || std::chrono::milliseconds(*v) < min_interval) {
+            response.send(Http::Code::Bad_Request,
+                          json_error(EINVAL,
+                                     "interval value is not valid ("
+                                         + query.value() + ")"));
+            return;
+        }
+        interval = std::chrono::milliseconds{*v};
+    }
+
+    auto filter = filter_map_ptr{};
+    set_optional_filter(request, filter, filter_key_type::analyzer_id);
+    set_optional_filter(request, filter, filter_key_type::source_id);
+
+    /* Clean up after any streams that have finished */
+    m_streams.erase(
+        std::remove_if(std::begin(m_streams),
+                       std::end(m_streams),
+                       [](const auto& stream) { return (stream->done()); }),
+        std::end(m_streams));
+
+    auto stream = std::make_unique<openperf::api::flow_stream>(
+        "op_pa_stream",
+        std::make_unique<rx_flow_stream>(
+            m_context, filter ? std::move(*filter) : filter_map_type{}),
+        interval);
+    if (auto success = stream->start(response, request.version()); !success) {
+        OP_LOG(OP_LOG_ERROR,
+               "Failed to start rx flow stream: %s\n",
+               success.error().c_str());
+        return;
+    }
+
+    m_streams.push_back(std::move(stream));
+}
+
 } // namespace openperf::packet::analyzer::api
@@ -1,4 +0,0 @@
-#include "utils/recycle.tcc"
-
-template class openperf::utils::recycle::depot<1>;
-template class openperf::utils::recycle::guard<1>;
@@ -0,0 +1,79 @@
+#include <zmq.h>
+
+#include "message/serialized_message.hpp"
+#include "packet/analyzer/rx_flow_stream.hpp"
+#include "timesync/chrono.hpp"
+
+namespace openperf::packet::analyzer::api {
+
+static reply_msg submit_request(void* socket, request_msg&& request)
+{
+    if (auto error = message::send(
+            socket, api::serialize_request(std::forward<request_msg>(request)));
+        error != 0) {
+        return (to_error(error_type::ZMQ_ERROR, error));
+    }
+
+    auto reply = message::recv(socket).and_then(api::deserialize_reply);
+    if (!reply) { return (to_error(error_type::ZMQ_ERROR, reply.error())); }
+
+    return (std::move(*reply));
+}
+
+rx_flow_stream::rx_flow_stream(void* context, filter_map_type filter)
+    : m_context(context)
+    , m_filter(std::move(filter))
+{}
+
+/* Our address is unique for as long as the subscription exists */
+uint64_t rx_flow_stream::subscription() const
+{
+    return (reinterpret_cast<uintptr_t>(this));
+}
+
+bool rx_flow_stream::next_frame(std::vector<iovec>& frame)
+{
+    /* Open the socket from the stream thread, since that's its only user */
+    if (!m_socket) {
+        m_socket.reset(
+            op_socket_get_client(m_context, ZMQ_REQ, endpoint.data()));
+    }
+
+    auto api_reply = submit_request(
+        m_socket.get(),
+        request_get_rx_flow_updates{
+            subscription(), std::make_unique<filter_map_type>(m_filter)});
+
+    auto reply = std::get_if<reply_rx_flow_updates>(&api_reply);
+    if (!reply || !reply->updates) {
+        OP_LOG(OP_LOG_ERROR, "Failed to retrieve rx flow updates\n");
+        return (false);
+    }
+
+    m_updates = std::move(reply->updates);
+    m_header = rx_flow_update_frame_header{
+        .magic = rx_flow_update_frame_header::frame_magic,
+        .version = rx_flow_update_frame_header::frame_version,
+        .record_length = sizeof(rx_flow_update),
+        .count = m_updates->size(),
+        .timestamp = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                         timesync::chrono::realtime::now().time_since_epoch())
+                         .count()};
+
+    frame.push_back({&m_header, sizeof(m_header)});
+    frame.push_back(
+        {m_updates->data(), m_updates->size() * sizeof(rx_flow_update)});
+
+    return (true);
+}
+
+void rx_flow_stream::finish()
+{
+    if (!m_socket) { return; }
+
+    submit_request(m_socket.get(),
+                   request_delete_rx_flow_subscription{subscription()});
+    m_socket.reset();
+}
+
+} // namespace openperf::packet::analyzer::api
@@ -0,0 +1,40 @@
+#ifndef _OP_PACKET_ANALYZER_RX_FLOW_STREAM_HPP_
+#define _OP_PACKET_ANALYZER_RX_FLOW_STREAM_HPP_
+
+#include "api/api_flow_stream.hpp"
+#include "core/op_core.h"
+#include "packet/analyzer/api.hpp"
+
+namespace openperf::packet::analyzer::api {
+
+/**
+ * Produces the frames of a binary rx flow stream.  Each frame is a
+ * rx_flow_update_frame_header followed by the records of every flow that
+ * received frames since the previous frame.  The first frame contains every
+ * flow.
+ *
+ * The producer uses its own socket to query the analyzer server, so that
+ * streams don't block the REST handler.
+ */
+class rx_flow_stream final : public openperf::api::flow_stream::producer
+{
+public:
+    rx_flow_stream(void* context, filter_map_type filter);
+
+    bool next_frame(std::vector<iovec>& frame) override;
+    void finish() override;
+
+private:
+    uint64_t subscription() const;
+
+    void* m_context;
+    std::unique_ptr<void, op_socket_deleter> m_socket;
+    filter_map_type m_filter;
+
+    rx_flow_update_frame_header m_header;
+    rx_flow_updates_ptr m_updates;
+};
+
+} // namespace openperf::packet::analyzer::api
+
+#endif /* _OP_PACKET_ANALYZER_RX_FLOW_STREAM_HPP_ */
@@ -142,6 +142,15 @@ static std::string to_string(const request_msg& request)
                            },
                            [](const request_get_rx_flow& request) {
                                return ("get rx flow " + request.id);
+                           },
+                           [](const request_get_rx_flow_updates& request) {
+                               return ("get rx flow updates for subscription "
+                                       + std::to_string(request.subscription));
+                           },
+                           [](const request_delete_rx_flow_subscription&
+                                  request) {
+                               return ("delete rx flow subscription "
+                                       + std::to_string(request.subscription));
                            }),
                        request));
 }
@@ -289,6 +298,9 @@ reply_msg server::handle_request(const request_create_analyzer& request)
     if (user_config->filterIsSet()) {
         config.filter = user_config->getFilter();
     }
+    if (user_config->maxFlowsIsSet()) {
+        config.max_flows = user_config->getMaxFlows();
+    }
 
     /* Check if id already exists in map */
     if (std::binary_search(std::begin(m_sinks),
@@ -652,31 +664,36 @@ reply_msg server::handle_request(const request_delete_analyzer_result& request)
     return (reply_ok{});
 }
 
-reply_msg server::handle_request(const request_list_rx_flows& request)
+using result_filter_fn =
+    std::function<bool(const std::pair<const core::uuid,
+                                       std::unique_ptr<sink_result>>&)>;
+
+static result_filter_fn to_result_filter(const filter_map_ptr& filter)
 {
-    auto compare = std::function<bool(const result_map::value_type& pair)>{};
-    if (!request.filter) {
-        compare = [](const auto&) { return (true); };
-    } else {
-        auto& filter = *request.filter;
-        compare = [&](const auto& item) {
-            if (filter.count(filter_key_type::analyzer_id)
-                && filter[filter_key_type::analyzer_id]
-                       != item.second->parent().id()) {
-                return (false);
-            }
+    if (!filter) {
+        return ([](const auto&) { return (true); });
+    }
 
-            if (filter.count(filter_key_type::source_id)
-                && filter[filter_key_type::source_id]
-                       != item.second->parent().source()) {
-                return (false);
-            }
+    return ([&filter = *filter](const auto& item) {
+        if (filter.count(filter_key_type::analyzer_id)
+            && filter.at(filter_key_type::analyzer_id)
+                   != item.second->parent().id()) {
+            return (false);
+        }
 
-            return (true);
-        };
-    }
+        if (filter.count(filter_key_type::source_id)
+            && filter.at(filter_key_type::source_id)
+                   != item.second->parent().source()) {
+            return (false);
+        }
 
-    assert(compare);
+        return (true);
+    });
+}
+
+reply_msg server::handle_request(const request_list_rx_flows& request)
+{
+    auto compare = to_result_filter(request.filter);
 
     auto reply = reply_rx_flows{};
 
@@ -687,14 +704,12 @@ reply_msg server::handle_request(const request_list_rx_flows& request)
             if (!compare(result_pair)) { return; }
 
             auto& shards = result_pair.second->flows();
+            uint16_t idx = 0;
             std::for_each(
                 std::begin(shards), std::end(shards), [&](const auto& shard) {
-                    uint16_t idx = 0;
-                    auto guard = utils::recycle::guard(shard.first,
-                                                       api::result_reader_id);
                     std::transform(
-                        std::begin(shard.second),
-                        std::end(shard.second),
+                        std::begin(shard),
+                        std::end(shard),
                         std::back_inserter(reply.flows),
                         [&](const auto& pair) {
                             return (to_swagger(rx_flow_id(result_pair.first,
@@ -704,6 +719,7 @@ reply_msg server::handle_request(const request_list_rx_flows& request)
                                                result_pair.first,
                                                pair.second));
                         });
+                    idx++;
                 });
         });
 
@@ -726,8 +742,7 @@ reply_msg server::handle_request(const request_get_rx_flow& request)
     }
 
     const auto& shard = result->flows()[shard_idx];
-    auto guard = utils::recycle::guard(shard.first, api::result_reader_id);
-    auto counters = shard.second.find(hash, stream_id.value_or(0));
+    auto counters = shard.find(hash, stream_id.value_or(0));
     if (!counters) { return (to_error(error_type::NOT_FOUND)); }
 
     auto reply = reply_rx_flows{};
@@ -735,4 +750,72 @@ reply_msg server::handle_request(const request_get_rx_flow& request)
     return (reply);
 }
 
+reply_msg server::handle_request(const request_get_rx_flow_updates& request)
+{
+    using namespace openperf::packet::analyzer::statistics::flow;
+
+    auto compare = to_result_filter(request.filter);
+
+    /*
+     * Build a new state for the subscription so that results which have
+     * since been deleted or filtered out don't linger.
+     */
+    auto& last_state = m_subscriptions[request.subscription];
+    auto next_state = subscription_state{};
+
+    auto reply = reply_rx_flow_updates{
+        std::make_unique<std::vector<rx_flow_update>>()};
+
+    std::for_each(
+        std::begin(m_results),
+        std::end(m_results),
+        [&](const auto& result_pair) {
+            if (!compare(result_pair)) { return; }
+
+            const auto& result_id = result_pair.first;
+            const auto& shards = result_pair.second->flows();
+
+            auto& trackers = next_state[result_id];
+            if (auto found = last_state.find(result_id);
+                found != std::end(last_state)) {
+                trackers = std::move(found->second);
+            }
+            trackers.resize(shards.size());
+
+            for (uint16_t idx = 0; idx < shards.size(); idx++) {
+                const auto& shard = shards[idx];
+                auto& tracker = trackers[idx];
+
+                /*
+                 * The shard may gain flows while we look at it; just
+                 * catch any new ones on the next update.
+                 */
+                tracker.resize(shard.size());
+                auto cursor = std::begin(shard);
+                for (size_t flow_idx = 0; flow_idx < tracker.size();
+                     flow_idx++) {
+                    const auto& [key, counters] = *cursor++;
+                    auto count = counters.template get<counter::frame_counter>()
+                                     .count;
+                    if (!tracker.update(flow_idx, count)) { continue; }
+
+                    reply.updates->emplace_back(to_update(
+                        rx_flow_id(result_id, idx, key.first, key.second),
+                        counters));
+                }
+            }
+        });
+
+    last_state = std::move(next_state);
+
+    return (reply);
+}
+
+reply_msg
+server::handle_request(const request_delete_rx_flow_subscription& request)
+{
+    m_subscriptions.erase(request.subscription);
+    return (reply_ok{});
+}
+
 } // namespace openperf::packet::analyzer::api
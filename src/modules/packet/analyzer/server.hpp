@@ -7,6 +7,7 @@
 #include "core/op_core.h"
 #include "packet/analyzer/api.hpp"
 #include "packet/analyzer/sink.hpp"
+#include "packet/statistics/flow_update_tracker.hpp"
 #include "packetio/internal_client.hpp"
 
 namespace openperf::packet::analyzer::api {
@@ -38,6 +39,19 @@ class server
     /* result id --> result */
     result_map m_results;
 
+    /*
+     * Streaming clients only want flows that changed since their last
+     * update, so we track the last reported frame count of every flow
+     * for each subscription.  Flows are never removed from a shard, so
+     * a flow's position in its shard is a stable index.
+     */
+    using flow_tracker_shards =
+        std::vector<packet::statistics::flow_update_tracker>;
+    using subscription_state = std::map<core::uuid, flow_tracker_shards>;
+
+    /* subscription id --> result id --> flow trackers */
+    std::map<uint64_t, subscription_state> m_subscriptions;
+
 public:
     server(void* context, core::event_loop& loop);
 
@@ -64,6 +78,8 @@ public:
 
     reply_msg handle_request(const request_list_rx_flows&);
     reply_msg handle_request(const request_get_rx_flow&);
+    reply_msg handle_request(const request_get_rx_flow_updates&);
+    reply_msg handle_request(const request_delete_rx_flow_subscription&);
 };
 
 } // namespace openperf::packet::analyzer::api
@@ -1,5 +1,4 @@
-#include <mutex>
-#include <thread>
+#include <numeric>
 
 #include "packetio/internal_client.hpp"
 #include "packetio/internal_worker.hpp"
@@ -19,11 +18,8 @@ constexpr auto counters_prefetch_offset = 8;
 /* Instantiate our templatized data structures */
 template class statistics::flow::map<statistics::generic_flow_counters>;
 
-static std::once_flag flow_counter_factory_init;
-
 sink_result::sink_result(const sink& parent)
     : m_parent(parent)
-    , m_flow_shards(parent.worker_count())
 {
     assert(parent.worker_count());
     std::generate_n(
@@ -32,23 +28,36 @@ sink_result::sink_result(const sink& parent)
                 m_parent.protocol_counters()));
         });
 
-    /* Alert the RCU system that we will have a reader */
-    std::for_each(
-        std::begin(m_flow_shards), std::end(m_flow_shards), [](auto& shard) {
-            shard.first.writer_add_reader(api::result_reader_id);
-        });
-
     /*
-     * The counter factory functions don't perform their initialization until
-     * called.  The protocol counter factory was initialized above, however,
-     * we don't create flow counters until we receive a packet.  Hence, if
-     * we haven't done so already, ask the flow factory for a dummy counter
-     * now so that we can initialize it here instead of on the sink's fast path.
+     * Flow counters are created up front so that the sink never needs
+     * to allocate memory when it encounters a new flow.
      */
-    std::call_once(flow_counter_factory_init, []() {
-        [[maybe_unused]] auto flow_counters = statistics::make_flow_counters(
-            statistics::all_flow_counters, statistics::all_flow_digests);
-    });
+    auto make_counters = [&](uint32_t) {
+        return (statistics::make_flow_counters(m_parent.flow_counters(),
+                                               m_parent.flow_digests()));
+    };
+
+    m_flow_shards.reserve(m_parent.worker_count());
+    for (size_t i = 0; i < m_parent.worker_count(); i++) {
+        /*
+         * If possible, keep the counters for all flows in a shard in one
+         * struct of arrays, so that the data path can update them a burst
+         * at a time.  The map's counters are then just views of it.
+         */
+        auto compact =
+            statistics::make_compact_flow_counters(m_parent.flow_counters(),
+                                                   m_parent.flow_digests(),
+                                                   m_parent.max_flows());
+        if (!compact) {
+            m_flow_shards.emplace_back(m_parent.max_flows(), make_counters);
+            continue;
+        }
+
+        m_flow_shards.emplace_back(
+            m_parent.max_flows(),
+            [&](uint32_t slot) { return (compact->counters(slot)); });
+        m_compact_shards.push_back(std::move(*compact));
+    }
 }
 
 bool sink_result::active() const { return (m_active); }
@@ -75,6 +84,21 @@ const std::vector<sink_result::flow_shard>& sink_result::flows() const
     return (m_flow_shards);
 }
 
+const sink_result::compact_shard* sink_result::compact_flow(size_t idx) const
+{
+    return (idx < m_compact_shards.size() ? &m_compact_shards[idx] : nullptr);
+}
+
+uint64_t sink_result::flow_overflow() const
+{
+    return (std::accumulate(std::begin(m_flow_shards),
+                            std::end(m_flow_shards),
+                            uint64_t{0},
+                            [](uint64_t sum, const auto& shard) {
+                                return (sum + shard.overflow());
+                            }));
+}
+
 void sink_result::start() { m_active = true; }
 
 void sink_result::stop() { m_active = false; }
@@ -145,6 +169,8 @@ api::flow_digest_flags sink::flow_digests() const
     return (m_config.flow_digests);
 }
 
+size_t sink::max_flows() const { return (m_config.max_flows); }
+
 size_t sink::worker_count() const { return (m_indexes.size()); }
 
 sink_result* sink::reset(sink_result* results)
@@ -247,14 +273,19 @@ uint16_t sink::push_all(sink_result& results,
     /* Do some initial setup */
     auto& flows = results.flow(index);
     auto& protocol = results.protocol(index);
+    const auto* compact = results.compact_flow(index);
 
     auto flow_counters =
         std::array<const statistics::generic_flow_counters*, burst_size_max>{};
+    auto flow_slots = std::array<uint32_t, burst_size_max>{};
+    auto flow_packets =
+        std::array<const packetio::packet::packet_buffer*, burst_size_max>{};
     auto packet_types =
         std::array<packetio::packet::packet_type::flags, burst_size_max>{};
 
     auto cursor = packets;
     auto end = packets + packets_length;
+    auto overflows = 0U;
 
     while (cursor != end) {
         /*
@@ -270,20 +301,11 @@ uint16_t sink::push_all(sink_result& results,
 
         auto key = get_packet_key(*cursor);
         while (cursor != stop) {
-            auto* counters = flows.second.find(key);
-            if (!counters) { /* New flow; create counters */
-                auto to_insert = statistics::make_flow_counters(
-                    m_config.flow_counters, m_config.flow_digests);
-                to_insert.set_header(*cursor);
-
-                auto to_delete = flows.second.insert(key, std::move(to_insert));
-
-                flows.first.writer_add_gc_callback([to_delete]() {
-                    delete to_delete;
-                    return (sink_result::recycler::gc_callback_result::ok);
+            auto* counters = flows.find(key);
+            if (!counters) { /* New flow; claim counters */
+                counters = flows.insert(key, [&](const auto& stats) {
+                    stats.set_header(*cursor);
                 });
-
-                counters = std::addressof(flows.second.at(key));
             }
 
             auto pkt_type = packetio::packet::packet_type_flags(*cursor).value;
@@ -293,6 +315,7 @@ uint16_t sink::push_all(sink_result& results,
              * and flags so long as the key matches the next packet.
              */
             for (;;) {
+                overflows += (counters == nullptr);
                 flow_counters[count] = counters;
                 packet_types[count++] = pkt_type;
                 if (++cursor == stop) { break; }
@@ -306,6 +329,21 @@ uint16_t sink::push_all(sink_result& results,
         /* Update protocol counters in bulk */
         protocol.update(packet_types.data(), count);
 
+        if (compact) {
+            /* Flows we have no room for have no counters */
+            auto nb_flow_packets = 0;
+            for (auto i = 0; i < count; i++) {
+                if (!flow_counters[i]) { continue; }
+                flow_slots[nb_flow_packets] = flow_counters[i]->slot();
+                flow_packets[nb_flow_packets++] = start[i];
+            }
+            compact->update(
+                flow_slots.data(), flow_packets.data(), nb_flow_packets);
+
+            cursor = stop;
+            continue;
+        }
+
         /*
          * For any decent size flow count, the stat block we need is unlikely
          * to be in memory, so prefetch it before we need it.
@@ -313,8 +351,12 @@ uint16_t sink::push_all(sink_result& results,
         openperf::utils::prefetch_enumerate_for_each(
             flow_counters.data(),
             flow_counters.data() + count,
-            [](const auto* counters) { counters->write_prefetch(); },
+            [](const auto* counters) {
+                if (counters) { counters->write_prefetch(); }
+            },
             [&](auto offset, const auto* counters) {
+                /* Flows we have no room for have no counters */
+                if (!counters) { return; }
                 auto* pkt = start[offset];
                 counters->update(pkt);
             },
@@ -323,7 +365,7 @@ uint16_t sink::push_all(sink_result& results,
         cursor = stop;
     }
 
-    flows.first.writer_process_gc_callbacks();
+    if (overflows) { flows.add_overflow(overflows); }
 
     return (packets_length);
 }
@@ -6,13 +6,13 @@
 
 #include "core/op_core.h"
 #include "packet/analyzer/api.hpp"
+#include "packet/analyzer/statistics/compact_flow_counters.hpp"
 #include "packet/analyzer/statistics/flow/map.hpp"
 #include "packet/analyzer/statistics/generic_flow_counters.hpp"
 #include "packet/analyzer/statistics/generic_flow_digests.hpp"
 #include "packet/statistics/generic_protocol_counters.hpp"
 #include "packetio/generic_sink.hpp"
 #include "utils/flat_memoize.hpp"
-#include "utils/recycle.hpp"
 #include "utils/soa_container.hpp"
 
 namespace openperf::packet::bpf {
@@ -37,16 +37,16 @@ struct sink_config
     api::flow_counter_flags flow_counters =
         statistics::flow_counter_flags::frame_count;
     api::flow_digest_flags flow_digests = statistics::flow_digest_flags::none;
+    size_t max_flows = api::default_max_flows;
 };
 
 class sink_result
 {
 public:
-    using recycler = utils::recycle::depot<1>;
-
     using flow_counters_container =
         statistics::flow::map<statistics::generic_flow_counters>;
-    using flow_shard = std::pair<recycler, flow_counters_container>;
+    using flow_shard = flow_counters_container;
+    using compact_shard = statistics::compact_flow_counters;
 
     using protocol_shard = packet::statistics::generic_protocol_counters;
 
@@ -61,6 +61,11 @@ public:
     flow_shard& flow(size_t idx);
     const std::vector<flow_shard>& flows() const;
 
+    /* Compact storage for the flow shard, if the sink's counters allow it */
+    const compact_shard* compact_flow(size_t idx) const;
+
+    uint64_t flow_overflow() const;
+
     void start();
     void stop();
 
@@ -68,6 +73,7 @@ private:
     const sink& m_parent;
     std::vector<protocol_shard> m_protocol_shards;
     std::vector<flow_shard> m_flow_shards;
+    std::vector<compact_shard> m_compact_shards;
     bool m_active = false;
 };
 
@@ -89,6 +95,7 @@ public:
     api::protocol_counter_flags protocol_counters() const;
     api::flow_counter_flags flow_counters() const;
     api::flow_digest_flags flow_digests() const;
+    size_t max_flows() const;
 
     sink_result* reset(sink_result* results);
     void start(sink_result* results);
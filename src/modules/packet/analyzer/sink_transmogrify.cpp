@@ -76,6 +76,7 @@ analyzer_ptr to_swagger(const sink& src)
     if (!src_config.filter.empty()) {
         dst_config->setFilter(src_config.filter);
     }
+    dst_config->setMaxFlows(src_config.max_flows);
 
     dst->setConfig(dst_config);
 
@@ -250,13 +251,11 @@ sum_flow_counters(flow_counter_flags counter_flags,
     auto tmp = make_flow_counters(counter_flags, digest_flags);
 
     std::for_each(std::begin(src), std::end(src), [&](const auto& shard) {
-        auto guard = utils::recycle::guard(shard.first, api::result_reader_id);
-        std::for_each(std::begin(shard.second),
-                      std::end(shard.second),
-                      [&](const auto& pair) {
-                          copy_flow_counters(pair.second, tmp);
-                          add_flow_counters(tmp, sum);
-                      });
+        std::for_each(
+            std::begin(shard), std::end(shard), [&](const auto& pair) {
+                copy_flow_counters(pair.second, tmp);
+                add_flow_counters(tmp, sum);
+            });
     });
 
     return (sum);
@@ -268,11 +267,8 @@ static void to_swagger(const core::uuid& result_id,
 {
     uint16_t idx = 0;
     std::for_each(std::begin(src), std::end(src), [&](const auto& shard) {
-        auto guard = utils::recycle::guard(shard.first, api::result_reader_id);
         std::for_each(
-            std::begin(shard.second),
-            std::end(shard.second),
-            [&](const auto& pair) {
+            std::begin(shard), std::end(shard), [&](const auto& pair) {
                 dst.emplace_back(core::to_string(rx_flow_id(
                     result_id, idx, pair.first.first, pair.first.second)));
             });
@@ -618,6 +614,7 @@ analyzer_result_ptr to_swagger(const core::uuid& id, const sink_result& src)
     }
 
     to_swagger(id, src.flows(), dst->getFlows());
+    dst->setFlowOverflow(src.flow_overflow());
 
     return (dst);
 }
@@ -643,6 +640,59 @@ rx_flow_ptr to_swagger(const core::uuid& id,
     return (dst);
 }
 
+template <typename Duration> static int64_t to_nanoseconds(Duration d)
+{
+    return (std::chrono::duration_cast<std::chrono::nanoseconds>(d).count());
+}
+
+rx_flow_update to_update(const core::uuid& id,
+                         const statistics::generic_flow_counters& counters)
+{
+    using namespace openperf::packet::analyzer::statistics::flow;
+
+    auto dst = rx_flow_update{};
+    dst.id = id;
+
+    const auto& frame_count = counters.get<counter::frame_counter>();
+    dst.frame_count = frame_count.count;
+    if (frame_count.count) {
+        dst.timestamp_first =
+            to_nanoseconds(frame_count.first_.time_since_epoch());
+        dst.timestamp_last =
+            to_nanoseconds(frame_count.last_.time_since_epoch());
+    }
+    dst.errors.fcs = frame_count.errors.fcs;
+    dst.errors.ipv4_checksum = frame_count.errors.ipv4_checksum;
+    dst.errors.tcp_checksum = frame_count.errors.tcp_checksum;
+    dst.errors.udp_checksum = frame_count.errors.udp_checksum;
+
+    if (counters.holds<counter::frame_length>() && frame_count.count) {
+        const auto& src = counters.get<counter::frame_length>();
+        dst.flags |= static_cast<uint32_t>(rx_flow_update_flags::frame_length);
+        dst.frame_length_min = src.min;
+        dst.frame_length_max = src.max;
+        dst.frame_length_total = src.total;
+    }
+    if (counters.holds<counter::latency>() && frame_count.count) {
+        const auto& src = counters.get<counter::latency>();
+        dst.flags |= static_cast<uint32_t>(rx_flow_update_flags::latency);
+        dst.latency_min = to_nanoseconds(src.min);
+        dst.latency_max = to_nanoseconds(src.max);
+        dst.latency_total = to_nanoseconds(src.total);
+    }
+    if (counters.holds<counter::sequencing>()) {
+        const auto& src = counters.get<counter::sequencing>();
+        dst.flags |= static_cast<uint32_t>(rx_flow_update_flags::sequencing);
+        dst.sequence_in_order = src.in_order;
+        dst.sequence_dropped = src.dropped;
+        dst.sequence_duplicate = src.duplicate;
+        dst.sequence_late = src.late;
+        dst.sequence_reordered = src.reordered;
+    }
+
+    return (dst);
+}
+
 core::uuid get_analyzer_result_id()
 {
     auto id = core::uuid::random();
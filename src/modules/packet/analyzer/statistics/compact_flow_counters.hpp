@@ -0,0 +1,90 @@
+#ifndef _OP_ANALYZER_STATISTICS_COMPACT_FLOW_COUNTERS_HPP_
+#define _OP_ANALYZER_STATISTICS_COMPACT_FLOW_COUNTERS_HPP_
+
+#include <memory>
+#include <optional>
+
+#include "packet/analyzer/statistics/generic_flow_counters.hpp"
+#include "packet/analyzer/statistics/generic_flow_digests.hpp"
+#include "packetio/packet_buffer.hpp"
+
+namespace openperf::packet::analyzer::statistics {
+
+/**
+ * Type erased store of flow counters for every slot in a flow map.
+ *
+ * Unlike generic_flow_counters, which hides the counter types of a single
+ * flow, this hides the counter types of all flows, so the data path only
+ * pays for one virtual call per burst.  Readers still get a
+ * generic_flow_counters for each slot.
+ */
+class compact_flow_counters
+{
+public:
+    template <typename Store>
+    compact_flow_counters(std::shared_ptr<Store> store)
+        : m_self(std::make_shared<store_model<Store>>(std::move(store)))
+    {}
+
+    generic_flow_counters counters(uint32_t slot) const
+    {
+        return (m_self->counters(slot));
+    }
+
+    void update(const uint32_t slots[],
+                const packetio::packet::packet_buffer* const packets[],
+                uint16_t count) const
+    {
+        m_self->update(slots, packets, count);
+    }
+
+private:
+    struct store_concept
+    {
+        virtual ~store_concept() = default;
+
+        virtual generic_flow_counters counters(uint32_t slot) const = 0;
+
+        virtual void
+        update(const uint32_t slots[],
+               const packetio::packet::packet_buffer* const packets[],
+               uint16_t count) const = 0;
+    };
+
+    template <typename Store> struct store_model final : store_concept
+    {
+        store_model(std::shared_ptr<Store> store)
+            : m_store(std::move(store))
+        {}
+
+        generic_flow_counters counters(uint32_t slot) const override
+        {
+            return (generic_flow_counters(m_store, slot));
+        }
+
+        void update(const uint32_t slots[],
+                    const packetio::packet::packet_buffer* const packets[],
+                    uint16_t count) const override
+        {
+            m_store->update(slots, packets, count);
+        }
+
+        std::shared_ptr<Store> m_store;
+    };
+
+    std::shared_ptr<store_concept> m_self;
+};
+
+/*
+ * Compact storage only supports the counters that can be updated with
+ * simple passes over a burst, and no digests.  Returns std::nullopt for
+ * anything else.
+ */
+std::optional<compact_flow_counters> make_compact_flow_counters(
+    openperf::utils::bit_flags<flow_counter_flags> counter_flags,
+    openperf::utils::bit_flags<flow_digest_flags> digest_flags,
+    size_t max_flows);
+
+} // namespace openperf::packet::analyzer::statistics
+
+#endif /* _OP_ANALYZER_STATISTICS_COMPACT_FLOW_COUNTERS_HPP_ */
@@ -1,10 +1,13 @@
+#include <array>
 #include <functional>
 #include <tuple>
 #include <type_traits>
 #include <vector>
 
+#include "packet/analyzer/statistics/compact_flow_counters.hpp"
 #include "packet/analyzer/statistics/generic_flow_counters.hpp"
 #include "packet/analyzer/statistics/generic_flow_digests.hpp"
+#include "packet/analyzer/statistics/flow/soa_counters.hpp"
 
 namespace openperf::packet::analyzer::statistics {
 
@@ -155,6 +158,56 @@ openperf::utils::bit_flags<flow_counter_flags> get_required_counters(
     return (counter_flags);
 }
 
+/*
+ * Counters that compact storage can handle.  The index of a compact
+ * counter combination is the bitmask of its optional counters.
+ */
+inline constexpr auto compact_optional_counters =
+    std::array{flow_counter_flags::frame_length,
+               flow_counter_flags::sequencing,
+               flow_counter_flags::prbs,
+               flow_counter_flags::header};
+
+constexpr int to_compact_flags(size_t idx)
+{
+    auto flags = openperf::utils::bit_flags<flow_counter_flags>{
+        flow_counter_flags::frame_count};
+    for (size_t i = 0; i < compact_optional_counters.size(); i++) {
+        if (idx & (1 << i)) { flags |= compact_optional_counters[i]; }
+    }
+    return (to_value(flags));
+}
+
+template <typename Tuple> struct soa_counters_type;
+
+template <typename... Counters>
+struct soa_counters_type<std::tuple<Counters...>>
+{
+    using type = flow::soa_counters<Counters...>;
+};
+
+template <size_t I> constexpr auto make_compact_flow_counters_constructor()
+{
+    using tuple_type = decltype(make_flow_counters_tuple<to_compact_flags(I)>(
+        openperf::utils::bit_flags<flow_digest_flags>{}));
+    using store_type = typename soa_counters_type<tuple_type>::type;
+
+    return ([](size_t max_flows) {
+        return (
+            compact_flow_counters(std::make_shared<store_type>(max_flows)));
+    });
+}
+
+template <size_t... I>
+auto make_compact_flow_counters_constructor_index(std::index_sequence<I...>)
+{
+    auto constructors =
+        std::vector<std::function<compact_flow_counters(size_t)>>{};
+    (constructors.emplace_back(make_compact_flow_counters_constructor<I>()),
+     ...);
+    return (constructors);
+}
+
 } // namespace detail
 
 /*
@@ -179,4 +232,36 @@ make_flow_counters(openperf::utils::bit_flags<flow_counter_flags> counter_flags,
     return (constructors[detail::to_value(counter_flags)](digest_flags));
 }
 
+std::optional<compact_flow_counters> make_compact_flow_counters(
+    openperf::utils::bit_flags<flow_counter_flags> counter_flags,
+    openperf::utils::bit_flags<flow_digest_flags> digest_flags,
+    size_t max_flows)
+{
+    const static auto constructors =
+        detail::make_compact_flow_counters_constructor_index(
+            std::make_index_sequence<
+                1 << detail::compact_optional_counters.size()>{});
+
+    if (digest_flags) { return (std::nullopt); }
+
+    /* Frame counts are always present */
+    counter_flags |= flow_counter_flags::frame_count;
+
+    auto idx = 0U;
+    for (size_t i = 0; i < detail::compact_optional_counters.size(); i++) {
+        const auto flag = detail::compact_optional_counters[i];
+        if (counter_flags & flag) {
+            idx |= (1 << i);
+            counter_flags &= ~flag;
+        }
+    }
+
+    /* Anything left over needs the generic counters */
+    if (counter_flags & ~flow_counter_flags::frame_count) {
+        return (std::nullopt);
+    }
+
+    return (constructors[idx](max_flows));
+}
+
 } // namespace openperf::packet::analyzer::statistics
@@ -1,28 +1,61 @@
 #ifndef _OP_ANALYZER_STATISTICS_FLOW_MAP_HPP_
 #define _OP_ANALYZER_STATISTICS_FLOW_MAP_HPP_
 
+#include <array>
 #include <atomic>
 #include <cstddef>
+#include <functional>
 #include <utility>
-
-#include "immer/map.hpp"
+#include <vector>
 
 namespace openperf::packet::analyzer::statistics::flow {
 
+/*
+ * Fixed capacity flow table for analyzer shards.
+ *
+ * All flow statistics are created when the map is constructed, so
+ * inserting a new flow on the data path never allocates memory.
+ * Flows are located via an open addressing table of cache line sized
+ * buckets.  The map supports a single writer and multiple concurrent
+ * readers.  Since flows are never removed, readers don't need any
+ * further synchronization beyond the atomic length values published
+ * by the writer.
+ */
 template <typename FlowStats> class map
 {
 public:
-    map();
-    ~map();
-
     using key_type = std::pair<uint32_t, uint32_t>;
     using value_type = FlowStats;
+    using entry_type = std::pair<key_type, value_type>;
+    using iterator = const entry_type*;
+    using factory_type = std::function<value_type(uint32_t slot)>;
+
+    /*
+     * make_stats is called with the slot of each entry.  Flows claim
+     * slots in insertion order, so the slot can be used to index data
+     * stored alongside the map.
+     */
+    map(size_t max_flows, const factory_type& make_stats);
+    ~map() = default;
+
+    map(map&& other) noexcept;
+    map& operator=(map&& other) noexcept;
 
-    using map_type = immer::map<key_type, value_type>;
+    map(const map&) = delete;
+    map& operator=(const map&) = delete;
 
-    map_type* insert(const key_type& key, const value_type& stats);
+    /*
+     * Claim the statistics for the given key.  Returns nullptr if
+     * the map is full.  Writer only.
+     */
+    const value_type* insert(const key_type& key);
 
-    map_type* insert(const key_type& key, value_type&& stats);
+    /*
+     * As above, but call init with the claimed statistics before they
+     * become visible to readers.
+     */
+    template <typename InitFunction>
+    const value_type* insert(const key_type& key, InitFunction&& init);
 
     const value_type* find(uint32_t rss_hash, uint32_t stream_id) const;
 
@@ -30,11 +63,40 @@ public:
 
     const value_type& at(const key_type& key) const;
 
-    typename map_type::iterator begin() const;
-    typename map_type::iterator end() const;
+    size_t size() const;
+    size_t max_size() const;
+
+    /* Number of packets that could not be assigned to a flow */
+    uint64_t overflow() const;
+
+    /* Writer only */
+    void add_overflow(uint64_t count = 1);
+
+    iterator begin() const;
+    iterator end() const;
 
 private:
-    std::atomic<map_type*> m_map;
+    static constexpr size_t cache_line_size = 64;
+
+    struct alignas(cache_line_size) bucket
+    {
+        static constexpr size_t capacity = 5;
+
+        std::atomic<uint32_t> length = 0;
+        std::array<uint32_t, capacity> slots;
+        std::array<uint64_t, capacity> keys;
+    };
+
+    static_assert(sizeof(bucket) == cache_line_size);
+
+    size_t to_bucket_index(uint64_t key) const;
+
+    std::vector<bucket> m_buckets;
+    std::vector<entry_type> m_entries;
+    unsigned m_shift = 0;
+
+    std::atomic<size_t> m_length = 0;
+    std::atomic<uint64_t> m_overflow = 0;
 };
 
 } // namespace openperf::packet::analyzer::statistics::flow
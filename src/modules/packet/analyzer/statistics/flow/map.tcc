@@ -1,72 +1,192 @@
+#include <algorithm>
+#include <stdexcept>
+
 #include "packet/analyzer/statistics/flow/map.hpp"
-#include "utils/hash_combine.hpp"
 
 namespace openperf::packet::analyzer::statistics::flow {
 
-template <typename FlowStats> map<FlowStats>::map()
+namespace detail {
+
+/* Fibonacci hashing multiplier, e.g. 2^64 / phi */
+inline constexpr uint64_t hash_multiplier = 0x9e3779b97f4a7c15;
+
+/*
+ * We want the average bucket to be no more than 80% full when the
+ * map is at capacity, hence we need one bucket for every 4 flows.
+ */
+inline constexpr size_t flows_per_bucket = 4;
+
+inline constexpr size_t min_bucket_count = 2;
+
+inline uint64_t to_key(uint32_t rss_hash, uint32_t stream_id)
 {
-    m_map.store(new map_type{});
+    return (static_cast<uint64_t>(rss_hash) << 32 | stream_id);
 }
 
-template <typename FlowStats> map<FlowStats>::~map()
+inline unsigned log2_bucket_count(size_t max_flows)
 {
-    delete m_map.exchange(nullptr);
+    auto count = std::max(
+        min_bucket_count, (max_flows + flows_per_bucket - 1) / flows_per_bucket);
+    return (64 - __builtin_clzll(count - 1));
 }
 
+} // namespace detail
+
 template <typename FlowStats>
-typename map<FlowStats>::map_type*
-map<FlowStats>::insert(const key_type& key, const FlowStats& stats)
+map<FlowStats>::map(size_t max_flows, const factory_type& make_stats)
+    : m_buckets(1ULL << detail::log2_bucket_count(max_flows))
+    , m_shift(64 - detail::log2_bucket_count(max_flows))
 {
-    auto* original = m_map.load(std::memory_order_consume);
-    auto* updated = new map_type{
-        std::move(original->insert(std::make_pair(key, std::move(stats))))};
-    return (m_map.exchange(updated, std::memory_order_release));
+    m_entries.reserve(max_flows);
+    for (size_t i = 0; i < max_flows; i++) {
+        m_entries.emplace_back(key_type{0, 0},
+                               make_stats(static_cast<uint32_t>(i)));
+    }
 }
 
 template <typename FlowStats>
-typename map<FlowStats>::map_type* map<FlowStats>::insert(const key_type& key,
-                                                          FlowStats&& stats)
+map<FlowStats>::map(map&& other) noexcept
+    : m_buckets(std::move(other.m_buckets))
+    , m_entries(std::move(other.m_entries))
+    , m_shift(other.m_shift)
+    , m_length(other.m_length.load())
+    , m_overflow(other.m_overflow.load())
+{}
+
+template <typename FlowStats>
+map<FlowStats>& map<FlowStats>::operator=(map&& other) noexcept
 {
-    auto* original = m_map.load(std::memory_order_consume);
-    auto* updated = new map_type{std::move(
-        original->insert(std::make_pair(key, std::forward<FlowStats>(stats))))};
-    return (m_map.exchange(updated, std::memory_order_release));
+    if (this != &other) {
+        m_buckets = std::move(other.m_buckets);
+        m_entries = std::move(other.m_entries);
+        m_shift = other.m_shift;
+        m_length.store(other.m_length.load());
+        m_overflow.store(other.m_overflow.load());
+    }
+
+    return (*this);
+}
+
+template <typename FlowStats>
+size_t map<FlowStats>::to_bucket_index(uint64_t key) const
+{
+    return ((key * detail::hash_multiplier) >> m_shift);
+}
+
+template <typename FlowStats>
+const FlowStats* map<FlowStats>::insert(const key_type& key)
+{
+    return (insert(key, [](value_type&) {}));
+}
+
+template <typename FlowStats>
+template <typename InitFunction>
+const FlowStats* map<FlowStats>::insert(const key_type& key,
+                                        InitFunction&& init)
+{
+    auto length = m_length.load(std::memory_order_relaxed);
+    if (length == m_entries.size()) { return (nullptr); }
+
+    auto packed = detail::to_key(key.first, key.second);
+    auto mask = m_buckets.size() - 1;
+    auto idx = to_bucket_index(packed);
+
+    /*
+     * We always have more bucket slots than entries, so there must
+     * be a bucket with an available slot.
+     */
+    for (;;) {
+        auto& b = m_buckets[idx];
+        auto b_length = b.length.load(std::memory_order_relaxed);
+        if (b_length < bucket::capacity) {
+            /* Initialize the entry before making it visible to readers */
+            auto& entry = m_entries[length];
+            entry.first = key;
+            init(entry.second);
+
+            b.keys[b_length] = packed;
+            b.slots[b_length] = static_cast<uint32_t>(length);
+            b.length.store(b_length + 1, std::memory_order_release);
+            m_length.store(length + 1, std::memory_order_release);
+
+            return (std::addressof(entry.second));
+        }
+        idx = (idx + 1) & mask;
+    }
 }
 
 template <typename FlowStats>
 const FlowStats* map<FlowStats>::find(uint32_t rss_hash,
                                       uint32_t stream_id) const
 {
-    auto* map = m_map.load(std::memory_order_relaxed);
-    return (map->find({rss_hash, stream_id}));
+    auto packed = detail::to_key(rss_hash, stream_id);
+    auto mask = m_buckets.size() - 1;
+    auto idx = to_bucket_index(packed);
+
+    for (size_t probes = 0; probes < m_buckets.size(); probes++) {
+        const auto& b = m_buckets[idx];
+        auto b_length = b.length.load(std::memory_order_acquire);
+        for (uint32_t i = 0; i < b_length; i++) {
+            if (b.keys[i] == packed) {
+                return (std::addressof(m_entries[b.slots[i]].second));
+            }
+        }
+
+        /* A key can only be in the next bucket if this one is full */
+        if (b_length < bucket::capacity) { break; }
+
+        idx = (idx + 1) & mask;
+    }
+
+    return (nullptr);
 }
 
 template <typename FlowStats>
 const FlowStats* map<FlowStats>::find(const map<FlowStats>::key_type& key) const
 {
-    auto* map = m_map.load(std::memory_order_relaxed);
-    return (map->find(key));
+    return (find(key.first, key.second));
 }
 
 template <typename FlowStats>
 const FlowStats& map<FlowStats>::at(const map<FlowStats>::key_type& key) const
 {
-    auto* map = m_map.load(std::memory_order_relaxed);
-    return (map->at(key));
+    auto* stats = find(key);
+    if (!stats) { throw std::out_of_range("flow not found"); }
+    return (*stats);
+}
+
+template <typename FlowStats> size_t map<FlowStats>::size() const
+{
+    return (m_length.load(std::memory_order_acquire));
+}
+
+template <typename FlowStats> size_t map<FlowStats>::max_size() const
+{
+    return (m_entries.size());
+}
+
+template <typename FlowStats> uint64_t map<FlowStats>::overflow() const
+{
+    return (m_overflow.load(std::memory_order_relaxed));
+}
+
+template <typename FlowStats> void map<FlowStats>::add_overflow(uint64_t count)
+{
+    /* Single writer, so we don't need an atomic add here */
+    m_overflow.store(m_overflow.load(std::memory_order_relaxed) + count,
+                     std::memory_order_relaxed);
 }
 
 template <typename FlowStats>
-typename map<FlowStats>::map_type::iterator map<FlowStats>::begin() const
+typename map<FlowStats>::iterator map<FlowStats>::begin() const
 {
-    auto* map = m_map.load(std::memory_order_relaxed);
-    return (map->begin());
+    return (m_entries.data());
 }
 
 template <typename FlowStats>
-typename map<FlowStats>::map_type::iterator map<FlowStats>::end() const
+typename map<FlowStats>::iterator map<FlowStats>::end() const
 {
-    auto* map = m_map.load(std::memory_order_relaxed);
-    return (map->end());
+    return (m_entries.data() + size());
 }
 
 } // namespace openperf::packet::analyzer::statistics::flow
@@ -0,0 +1,271 @@
+#ifndef _OP_ANALYZER_STATISTICS_FLOW_SOA_COUNTERS_HPP_
+#define _OP_ANALYZER_STATISTICS_FLOW_SOA_COUNTERS_HPP_
+
+#include <array>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include "packet/analyzer/statistics/flow/counters.hpp"
+#include "packet/analyzer/statistics/flow/header.hpp"
+#include "packet/statistics/tuple_utils.hpp"
+#include "packetio/packet_buffer.hpp"
+#include "utils/soa_container.hpp"
+
+namespace openperf::packet::analyzer::statistics::flow {
+
+inline constexpr uint16_t soa_burst_size = 64;
+
+/**
+ * The per packet values the compact counters need, pulled out of a burst
+ * of packets before any counters are touched.  Each counter update is then
+ * a simple loop over a few of these arrays.
+ */
+struct soa_burst
+{
+    enum flags : uint8_t {
+        ipv4_checksum_error = (1 << 0),
+        tcp_checksum_error = (1 << 1),
+        udp_checksum_error = (1 << 2),
+        has_sequence = (1 << 3),
+    };
+
+    std::array<uint32_t, soa_burst_size> slots;
+    std::array<counter::frame_counter::timestamp, soa_burst_size> rx;
+    std::array<uint16_t, soa_burst_size> frame_lengths;
+    std::array<uint8_t, soa_burst_size> packet_flags;
+    std::array<uint32_t, soa_burst_size> sequence_numbers;
+    std::array<uint32_t, soa_burst_size> prbs_octets;
+    std::array<uint32_t, soa_burst_size> prbs_bit_errors;
+    uint16_t count = 0;
+};
+
+namespace detail {
+
+template <typename T, typename Tuple> struct tuple_index;
+
+template <typename T, typename... Ts>
+struct tuple_index<T, std::tuple<T, Ts...>>
+    : std::integral_constant<size_t, 0>
+{};
+
+template <typename T, typename U, typename... Ts>
+struct tuple_index<T, std::tuple<U, Ts...>>
+    : std::integral_constant<size_t,
+                             1 + tuple_index<T, std::tuple<Ts...>>::value>
+{};
+
+} // namespace detail
+
+/**
+ * Flow counters stored as a struct of arrays, indexed by flow slot.
+ *
+ * Each counter type gets its own dense array, so a burst update only
+ * touches the cache lines of the counters that are actually enabled, and
+ * each update pass is a tight loop over a single array instead of a
+ * virtual call per packet into a heap allocated tuple.  Only counters
+ * that can be updated independently of each other are supported here;
+ * anything fancier uses the generic tuple based counters.
+ */
+template <typename... Counters> class soa_counters
+{
+public:
+    using counters_tuple = std::tuple<Counters...>;
+
+    static_assert(
+        packet::statistics::has_type_v<counter::frame_counter, counters_tuple>);
+
+    soa_counters(size_t max_flows)
+    {
+        m_data.reserve(max_flows);
+        for (size_t i = 0; i < max_flows; i++) {
+            m_data.push_back(counters_tuple{});
+        }
+    }
+
+    size_t size() const { return (m_data.size()); }
+
+    template <typename StatsType> static constexpr bool holds()
+    {
+        return (packet::statistics::has_type_v<StatsType, counters_tuple>);
+    }
+
+    template <typename StatsType> StatsType& get(uint32_t slot)
+    {
+        if constexpr (holds<StatsType>()) {
+            return (data<StatsType>()[slot]);
+        } else {
+            throw std::invalid_argument("counters are missing requested type");
+        }
+    }
+
+    void set_header(uint32_t slot, const packetio::packet::packet_buffer* pkt)
+    {
+        if constexpr (holds<header>()) {
+            flow::set_header(get<header>(slot),
+                             packetio::packet::packet_type_flags(pkt),
+                             packetio::packet::to_data<const uint8_t>(pkt));
+        }
+    }
+
+    /*
+     * Update the counters for a burst of packets.  Packets from the same
+     * flow are expected to be adjacent, as they usually are.
+     */
+    void update(const uint32_t slots[],
+                const packetio::packet::packet_buffer* const packets[],
+                uint16_t count)
+    {
+        auto burst = soa_burst{};
+        auto* frames = data<counter::frame_counter>();
+
+        for (uint16_t start = 0; start < count; start += soa_burst_size) {
+            burst.count = std::min<uint16_t>(soa_burst_size, count - start);
+            for (uint16_t i = 0; i < burst.count; i++) {
+                const auto slot = slots[start + i];
+                __builtin_prefetch(frames + slot, 1, 0);
+                fill(burst, i, slot, packets[start + i]);
+            }
+            update(burst);
+        }
+    }
+
+    void update(const soa_burst& burst)
+    {
+        using namespace counter;
+
+        /* Frame counts after each packet, for the summary statistics */
+        auto counts = std::array<stat_t, soa_burst_size>{};
+
+        /* Frame counters only need updating once per run of packets */
+        auto* frames = data<frame_counter>();
+        for (uint16_t i = 0; i < burst.count;) {
+            const auto slot = burst.slots[i];
+            auto& stat = frames[slot];
+
+            auto end = i;
+            auto ipv4_errors = 0U, tcp_errors = 0U, udp_errors = 0U;
+            do {
+                const auto flags = burst.packet_flags[end];
+                ipv4_errors += !!(flags & soa_burst::ipv4_checksum_error);
+                tcp_errors += !!(flags & soa_burst::tcp_checksum_error);
+                udp_errors += !!(flags & soa_burst::udp_checksum_error);
+                counts[end] = stat.count + (end - i) + 1;
+            } while (++end < burst.count && burst.slots[end] == slot);
+
+            if (!stat.count) { stat.first_ = burst.rx[i]; }
+            stat.count += end - i;
+            stat.last_ = burst.rx[end - 1];
+            stat.errors.ipv4_checksum += ipv4_errors;
+            stat.errors.tcp_checksum += tcp_errors;
+            stat.errors.udp_checksum += udp_errors;
+
+            i = end;
+        }
+
+        if constexpr (holds<frame_length>()) {
+            auto* lengths = data<frame_length>();
+            for (uint16_t i = 0; i < burst.count; i++) {
+                counter::update(lengths[burst.slots[i]],
+                                burst.frame_lengths[i],
+                                counts[i]);
+            }
+        }
+
+        if constexpr (holds<sequencing>()) {
+            auto* sequences = data<sequencing>();
+            for (uint16_t i = 0; i < burst.count; i++) {
+                if (burst.packet_flags[i] & soa_burst::has_sequence) {
+                    counter::update(sequences[burst.slots[i]],
+                                    burst.sequence_numbers[i],
+                                    sequence_late_threshold);
+                }
+            }
+        }
+
+        if constexpr (holds<prbs>()) {
+            auto* prbs_stats = data<prbs>();
+            for (uint16_t i = 0; i < burst.count; i++) {
+                auto& stat = prbs_stats[burst.slots[i]];
+                stat.octets += burst.prbs_octets[i];
+                stat.bit_errors += burst.prbs_bit_errors[i];
+                stat.frame_errors += !!burst.prbs_bit_errors[i];
+            }
+        }
+    }
+
+    /* Copy of all the counters for the given slot */
+    counters_tuple counters(uint32_t slot) const
+    {
+        return (counters_tuple{get_const<Counters>(slot)...});
+    }
+
+private:
+    /* Same window used by the generic counters */
+    static constexpr uint32_t sequence_late_threshold = 1000;
+
+    using container_type =
+        openperf::utils::soa_container<std::vector, counters_tuple>;
+
+    template <typename StatsType> StatsType* data()
+    {
+        return (m_data.template data<
+                detail::tuple_index<StatsType, counters_tuple>::value>());
+    }
+
+    template <typename StatsType>
+    const StatsType& get_const(uint32_t slot) const
+    {
+        return (m_data.template get<
+                detail::tuple_index<StatsType, counters_tuple>::value>()[slot]);
+    }
+
+    void fill(soa_burst& burst,
+              uint16_t idx,
+              uint32_t slot,
+              const packetio::packet::packet_buffer* pkt)
+    {
+        using namespace openperf::packetio::packet;
+
+        burst.slots[idx] = slot;
+        burst.rx[idx] = rx_timestamp(pkt);
+
+        uint8_t flags = (ipv4_checksum_error(pkt)
+                         ? soa_burst::ipv4_checksum_error
+                         : 0)
+                        | (tcp_checksum_error(pkt)
+                               ? soa_burst::tcp_checksum_error
+                               : 0)
+                        | (udp_checksum_error(pkt)
+                               ? soa_burst::udp_checksum_error
+                               : 0);
+
+        if constexpr (holds<counter::frame_length>()) {
+            burst.frame_lengths[idx] = frame_length(pkt);
+        }
+
+        if constexpr (holds<counter::sequencing>()) {
+            if (auto seq_num = signature_sequence_number(pkt)) {
+                flags |= soa_burst::has_sequence;
+                burst.sequence_numbers[idx] = *seq_num;
+            }
+        }
+
+        if constexpr (holds<counter::prbs>()) {
+            /* Can't have one without the other... */
+            auto octets = prbs_octets(pkt);
+            burst.prbs_octets[idx] = octets.value_or(0);
+            burst.prbs_bit_errors[idx] =
+                octets ? prbs_bit_errors(pkt).value() : 0;
+        }
+
+        burst.packet_flags[idx] = flags;
+    }
+
+    container_type m_data;
+};
+
+} // namespace openperf::packet::analyzer::statistics::flow
+
+#endif /* _OP_ANALYZER_STATISTICS_FLOW_SOA_COUNTERS_HPP_ */
@@ -21,6 +21,16 @@ public:
         : m_self(std::make_shared<stats_model<StatsTuple>>(std::move(tuple)))
     {}
 
+    /*
+     * View of a single flow slot in a store of compact counters, e.g.
+     * flow::soa_counters.
+     */
+    template <typename Store>
+    generic_flow_counters(std::shared_ptr<Store> store, uint32_t slot)
+        : m_self(std::make_shared<slot_model<Store>>(std::move(store), slot))
+        , m_slot(slot)
+    {}
+
     template <typename StatsType> const StatsType& get() const
     {
         return (m_self->get<StatsType>());
@@ -48,6 +58,9 @@ public:
 
     void write_prefetch() const { __builtin_prefetch(m_self.get(), 1, 0); }
 
+    /* Slot in the compact counter store; only meaningful for views */
+    uint32_t slot() const { return (m_slot); }
+
     void dump(std::ostream& os) const { m_self->dump(os); }
 
 private:
@@ -265,7 +278,149 @@ private:
         mutable StatsTuple m_data;
     };
 
+    template <typename Store> struct slot_model final : stats_concept
+    {
+        slot_model(std::shared_ptr<Store> store, uint32_t slot)
+            : m_store(std::move(store))
+            , m_slot(slot)
+        {}
+
+        template <typename StatsType> const StatsType& get_stat() const
+        {
+            return (m_store->template get<StatsType>(m_slot));
+        }
+
+        const generic_flow_digests&
+        get(tag<generic_flow_digests>&&) const override
+        {
+            return (get_stat<generic_flow_digests>());
+        }
+
+        const flow::counter::frame_counter&
+        get(tag<flow::counter::frame_counter>&&) const override
+        {
+            return (get_stat<flow::counter::frame_counter>());
+        }
+
+        const flow::counter::frame_length&
+        get(tag<flow::counter::frame_length>&&) const override
+        {
+            return (get_stat<flow::counter::frame_length>());
+        }
+
+        const flow::header& get(tag<flow::header>&&) const override
+        {
+            return (get_stat<flow::header>());
+        }
+
+        const flow::counter::interarrival&
+        get(tag<flow::counter::interarrival>&&) const override
+        {
+            return (get_stat<flow::counter::interarrival>());
+        }
+
+        const flow::counter::jitter_ipdv&
+        get(tag<flow::counter::jitter_ipdv>&&) const override
+        {
+            return (get_stat<flow::counter::jitter_ipdv>());
+        }
+
+        const flow::counter::jitter_rfc&
+        get(tag<flow::counter::jitter_rfc>&&) const override
+        {
+            return (get_stat<flow::counter::jitter_rfc>());
+        }
+
+        const flow::counter::latency&
+        get(tag<flow::counter::latency>&&) const override
+        {
+            return (get_stat<flow::counter::latency>());
+        }
+
+        const flow::counter::prbs&
+        get(tag<flow::counter::prbs>&&) const override
+        {
+            return (get_stat<flow::counter::prbs>());
+        }
+
+        const flow::counter::sequencing&
+        get(tag<flow::counter::sequencing>&&) const override
+        {
+            return (get_stat<flow::counter::sequencing>());
+        }
+
+        bool holds(tag<generic_flow_digests>&&) const override
+        {
+            return (Store::template holds<generic_flow_digests>());
+        }
+
+        bool holds(tag<flow::counter::frame_counter>&&) const override
+        {
+            return (Store::template holds<flow::counter::frame_counter>());
+        }
+
+        bool holds(tag<flow::counter::frame_length>&&) const override
+        {
+            return (Store::template holds<flow::counter::frame_length>());
+        }
+
+        bool holds(tag<flow::header>&&) const override
+        {
+            return (Store::template holds<flow::header>());
+        }
+
+        bool holds(tag<flow::counter::interarrival>&&) const override
+        {
+            return (Store::template holds<flow::counter::interarrival>());
+        }
+
+        bool holds(tag<flow::counter::jitter_ipdv>&&) const override
+        {
+            return (Store::template holds<flow::counter::jitter_ipdv>());
+        }
+
+        bool holds(tag<flow::counter::jitter_rfc>&&) const override
+        {
+            return (Store::template holds<flow::counter::jitter_rfc>());
+        }
+
+        bool holds(tag<flow::counter::latency>&&) const override
+        {
+            return (Store::template holds<flow::counter::latency>());
+        }
+
+        bool holds(tag<flow::counter::prbs>&&) const override
+        {
+            return (Store::template holds<flow::counter::prbs>());
+        }
+
+        bool holds(tag<flow::counter::sequencing>&&) const override
+        {
+            return (Store::template holds<flow::counter::sequencing>());
+        }
+
+        void
+        set_header(const packetio::packet::packet_buffer* pkt) const override
+        {
+            m_store->set_header(m_slot, pkt);
+        }
+
+        void update(const packetio::packet::packet_buffer* pkt) const override
+        {
+            m_store->update(&m_slot, &pkt, 1);
+        }
+
+        void dump(std::ostream& os) const override
+        {
+            flow::counter::dump(os, m_store->counters(m_slot));
+        }
+
+        std::shared_ptr<Store> m_store;
+        uint32_t m_slot;
+    };
+
     std::shared_ptr<stats_concept> m_self;
+    uint32_t m_slot = 0;
 };
 
 enum class flow_counter_flags {
@@ -48,6 +48,15 @@ bool is_valid(const analyzer_type& analyzer, std::vector<std::string>& errors)
         }
     }
 
+    if (config->maxFlowsIsSet()) {
+        auto max_flows = config->getMaxFlows();
+        if (max_flows < 1 || static_cast<size_t>(max_flows) > max_flows_limit) {
+            errors.emplace_back("Max flows (" + std::to_string(max_flows)
+                                + ") must be between 1 and "
+                                + std::to_string(max_flows_limit) + ".");
+        }
+    }
+
     if (config->filterIsSet()) {
         auto filter = config->getFilter();
         if (!bpf::bpf_validate_filter(filter)) {
@@ -21,7 +21,12 @@ constexpr bpf_memword_init_t bpf_ctx_preinited()
 inline void bpf_arg_init(bpf_args_t& args,
                          const packetio::packet::packet_buffer* packet)
 {
-    args.buflen = args.wirelen = packetio::packet::length(packet);
+    /*
+     * Only the first segment is contiguous, but that's where the headers
+     * are; loads beyond it just fail to match.
+     */
+    args.wirelen = packetio::packet::length(packet);
+    args.buflen = packetio::packet::max_length(packet);
     args.pkt =
         reinterpret_cast<const uint8_t*>(packetio::packet::to_data(packet));
     auto stream_id = packetio::packet::signature_stream_id(packet);
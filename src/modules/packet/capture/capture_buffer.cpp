@@ -1,9 +1,14 @@
+#include <algorithm>
 #include <cinttypes>
 #include <cstdio>
+#include <cstring>
+#include <limits>
+#include <fcntl.h>
 #include <sys/mman.h>
 #include <unistd.h>
 
 #include "core/op_log.h"
+#include "core/op_thread.h"
 #include "packet/capture/capture_buffer.hpp"
 #include "packet/capture/pcap_defs.hpp"
 #include "packetio/packet_buffer.hpp"
@@ -137,9 +142,8 @@ uint16_t capture_buffer_mem::write_packets(
         *reinterpret_cast<capture_packet_hdr*>(m_write_addr) = hdr;
         m_write_addr += sizeof(hdr);
 
-        std::copy_n(openperf::packetio::packet::to_data<const uint8_t>(packet),
-                    hdr.captured_len,
-                    m_write_addr);
+        openperf::packetio::packet::copy_data(
+            packet, m_write_addr, hdr.captured_len);
         m_write_addr += padded_data_len;
         m_stats.packets += 1;
         m_stats.bytes += hdr.captured_len;
@@ -231,7 +235,6 @@ uint16_t capture_buffer_mem_wrap::write_packets(
 
     for (uint16_t i = 0; i < packets_length; ++i) {
         auto& packet = packets[i];
-        auto data = openperf::packetio::packet::to_data(packet);
 
         fill_capture_packet_hdr(hdr, packet, m_max_packet_size);
         auto padded_data_len = pad_capture_data_len(hdr.captured_len);
@@ -254,9 +257,8 @@ uint16_t capture_buffer_mem_wrap::write_packets(
 
         *reinterpret_cast<capture_packet_hdr*>(m_write_addr) = hdr;
         m_write_addr += sizeof(hdr);
-        std::copy_n(reinterpret_cast<const uint8_t*>(data),
-                    hdr.captured_len,
-                    m_write_addr);
+        openperf::packetio::packet::copy_data(
+            packet, m_write_addr, hdr.captured_len);
         m_write_addr += padded_data_len;
         m_stats.packets += 1;
         m_stats.bytes += hdr.captured_len;
@@ -436,6 +438,152 @@ void capture_buffer_mem_wrap_reader::rewind() { init(); }
 
 ///////////////////////////////////////////////////////////////////////////////
 
+/*
+ * Marks the unused space at the end of a live buffer when a packet doesn't
+ * fit.  Readers skip to the start of the buffer when they find it.
+ */
+constexpr uint32_t live_wrap_marker = std::numeric_limits<uint32_t>::max();
+
+capture_buffer_live::capture_buffer_live(uint64_t size,
+                                         uint32_t max_packet_size,
+                                         std::function<bool()>&& done)
+    : capture_buffer_mem(size, max_packet_size)
+    , m_done(std::move(done))
+    , m_write_count(0)
+    , m_read_count(0)
+{}
+
+uint16_t capture_buffer_live::write_packets(
+    const openperf::packetio::packet::packet_buffer* const packets[],
+    uint16_t packets_length)
+{
+    capture_packet_hdr hdr;
+
+    auto write_count = m_write_count.load(std::memory_order_relaxed);
+    auto read_count = m_read_count.load(std::memory_order_acquire);
+
+    uint16_t i = 0;
+    for (; i < packets_length; ++i) {
+        auto& packet = packets[i];
+
+        fill_capture_packet_hdr(hdr, packet, m_max_packet_size);
+        auto padded_data_len = pad_capture_data_len(hdr.captured_len);
+        auto total_packet_len = sizeof(hdr) + padded_data_len;
+
+        // To simplify logic, packet hdr and data are always contiguous
+        auto offset = write_count % m_mem_size;
+        auto skip = (offset + total_packet_len > m_mem_size)
+                        ? m_mem_size - offset
+                        : 0;
+        auto required = write_count + skip + total_packet_len;
+        if (required - read_count > m_mem_size) {
+            read_count = m_read_count.load(std::memory_order_acquire);
+            if (required - read_count > m_mem_size) {
+                // The reader can't keep up, so drop the rest of the burst
+                break;
+            }
+        }
+
+        // Records are only 4 byte aligned, so copy headers in and out
+        if (skip) {
+            if (skip >= sizeof(hdr)) {
+                std::memcpy(m_start_addr + offset
+                                + offsetof(capture_packet_hdr, captured_len),
+                            &live_wrap_marker,
+                            sizeof(live_wrap_marker));
+            }
+            write_count += skip;
+            offset = 0;
+        }
+
+        std::memcpy(m_start_addr + offset, &hdr, sizeof(hdr));
+        openperf::packetio::packet::copy_data(
+            packet, m_start_addr + offset + sizeof(hdr), hdr.captured_len);
+        write_count += total_packet_len;
+        m_stats.packets += 1;
+        m_stats.bytes += hdr.captured_len;
+    }
+
+    m_write_count.store(write_count, std::memory_order_release);
+    m_stats.dropped += packets_length - i;
+
+    return packets_length;
+}
+
+std::unique_ptr<capture_buffer_reader> capture_buffer_live::create_reader()
+{
+    return std::make_unique<capture_buffer_live_reader>(*this);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+capture_buffer_live_reader::capture_buffer_live_reader(
+    capture_buffer_live& buffer)
+    : m_buffer(buffer)
+    , m_read_count(buffer.get_read_count())
+    , m_read_offset(0)
+{}
+
+capture_buffer_live_reader::~capture_buffer_live_reader()
+{
+    // Give the space used by the last packets read back to the writer
+    m_buffer.set_read_count(m_read_count);
+}
+
+bool capture_buffer_live_reader::is_done() const
+{
+    return (m_buffer.is_done() && m_read_count == m_buffer.get_write_count());
+}
+
+uint16_t capture_buffer_live_reader::read_packets(capture_packet* packets[],
+                                                  uint16_t count)
+{
+    // The previously returned packets are no longer needed
+    m_buffer.set_read_count(m_read_count);
+
+    if (count > m_packets.size()) {
+        // Allocate buffer space for all packets
+        m_packets.resize(count);
+    }
+
+    const auto write_count = m_buffer.get_write_count();
+    const auto start_addr = m_buffer.get_start_addr();
+    const size_t size = m_buffer.get_end_addr() - start_addr;
+
+    uint16_t i = 0;
+    while (i < count && m_read_count < write_count) {
+        auto offset = m_read_count % size;
+        auto& packet = m_packets[i];
+        if (size - offset < sizeof(packet.hdr)) {
+            m_read_count += size - offset;
+            continue;
+        }
+
+        std::memcpy(&packet.hdr, start_addr + offset, sizeof(packet.hdr));
+        if (packet.hdr.captured_len == live_wrap_marker) {
+            m_read_count += size - offset;
+            continue;
+        }
+
+        packet.data = start_addr + offset + sizeof(packet.hdr);
+        packets[i] = &packet;
+        ++i;
+
+        auto total_packet_len =
+            sizeof(packet.hdr) + pad_capture_data_len(packet.hdr.captured_len);
+        m_read_count += total_packet_len;
+        m_read_offset += total_packet_len;
+    }
+    return i;
+}
+
+capture_buffer_stats capture_buffer_live_reader::get_stats() const
+{
+    return m_buffer.get_stats();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
 capture_buffer_file::capture_buffer_file(std::string_view filename,
                                          keep_file keep_file,
                                          uint32_t max_packet_size)
@@ -613,7 +761,12 @@ uint16_t capture_buffer_file::write_packets(
             return i;
         }
 
-        auto data = openperf::packetio::packet::to_data(packet);
+        /* Segmented packets need to be gathered before writing */
+        if (m_scratch.size() < block_hdr.captured_len) {
+            m_scratch.resize(block_hdr.captured_len);
+        }
+        auto data = openperf::packetio::packet::read_data(
+            packet, m_scratch.data(), block_hdr.captured_len);
         if (fwrite(data, block_hdr.captured_len, 1, m_fp_write) != 1) {
             OP_LOG(OP_LOG_ERROR,
                    "Failed writing enhanced packet block data %" PRIu32,
@@ -654,6 +807,7 @@ uint16_t capture_buffer_file::write_packets(
 
 std::unique_ptr<capture_buffer_reader> capture_buffer_file::create_reader()
 {
+    flush();
     return std::unique_ptr<capture_buffer_reader>(
         new capture_buffer_file_reader(*this));
 }
@@ -669,23 +823,23 @@ void capture_buffer_file::flush()
 
 capture_buffer_file_reader::capture_buffer_file_reader(
     capture_buffer_file& buffer)
+    : capture_buffer_file_reader(buffer, {buffer.get_filename()})
+{}
+
+capture_buffer_file_reader::capture_buffer_file_reader(
+    const capture_buffer& buffer, std::vector<std::string> filenames)
     : m_buffer(buffer)
+    , m_filenames(std::move(filenames))
+    , m_file_idx(0)
     , m_fp_read(nullptr)
     , m_read_offset(0)
     , m_eof(false)
 {
-    auto filename = buffer.get_filename();
-    buffer.flush();
-
-    m_fp_read = fopen(filename.c_str(), "r");
-    if (!m_fp_read) {
-        throw std::runtime_error(
-            std::string("Failed opening PCAP file for read.  ") + filename);
-    }
-    if (!read_file_header()) {
-        fclose(m_fp_read);
+    assert(!m_filenames.empty());
+    if (!open_file(0)) {
         throw std::runtime_error(
-            std::string("Failed reading PCAP file header.  ") + filename);
+            std::string("Failed reading PCAP file header.  ")
+            + m_filenames.front());
     }
 }
 
@@ -697,10 +851,25 @@ capture_buffer_file_reader::~capture_buffer_file_reader()
     }
 }
 
+bool capture_buffer_file_reader::open_file(size_t idx)
+{
+    if (m_fp_read) { fclose(m_fp_read); }
+
+    m_file_idx = idx;
+    m_fp_read = fopen(m_filenames[idx].c_str(), "r");
+    if (!m_fp_read) {
+        OP_LOG(OP_LOG_ERROR,
+               "Failed opening PCAP file for read.  %s",
+               m_filenames[idx].c_str());
+        return false;
+    }
+
+    return read_file_header();
+}
+
 bool capture_buffer_file_reader::read_file_header()
 {
     ::rewind(m_fp_read);
-    m_read_offset = 0;
     m_eof = false;
 
     // Read the pcap section header
@@ -720,30 +889,10 @@ bool capture_buffer_file_reader::read_file_header()
         return false;
     }
 
-    m_read_offset = ftell(m_fp_read);
-
-    // Read blocks until 1st packet
-    while (true) {
-        pcap::block_header block_header;
-        if (fread(&block_header, sizeof(block_header), 1, m_fp_read) != 1) {
-            // Capture file is valid but does not contain any packets
-            return true;
-        }
-        if (block_header.block_type == pcap::block_type::ENHANCED_PACKET) {
-            if (fseek(m_fp_read, m_read_offset, SEEK_SET)) {
-                OP_LOG(OP_LOG_ERROR, "Failed setting PCAP read offset.");
-                return false;
-            }
-            return true;
-        }
-        remain = block_header.block_length - sizeof(block_header);
-        if (remain && fseek(m_fp_read, remain, SEEK_CUR)) {
-            OP_LOG(OP_LOG_ERROR, "Failed skipping PCAP block data.");
-            return false;
-        }
-        m_read_offset += block_header.block_length;
-    }
-    return false;
+    // Packet blocks may be interleaved with other blocks, so leave
+    // skipping those up to read_packets().
+    m_read_offset += section.block_total_length;
+    return true;
 }
 
 bool capture_buffer_file_reader::is_done() const { return m_eof; }
@@ -763,18 +912,49 @@ uint16_t capture_buffer_file_reader::read_packets(capture_packet* packets[],
 
     uint16_t i = 0;
     while (i < count) {
-        if (fread(&block_hdr, sizeof(block_hdr), 1, m_fp_read) != 1) {
+        pcap::block_header header;
+        if (fread(&header, sizeof(header), 1, m_fp_read) != 1) {
+            // Move on to the next file, if we have one
+            if (m_file_idx + 1 < m_filenames.size()
+                && open_file(m_file_idx + 1)) {
+                continue;
+            }
             m_eof = true;
             break;
         }
-        m_read_offset += sizeof(block_hdr);
-        if (block_hdr.block_type != pcap::block_type::ENHANCED_PACKET) {
+        m_read_offset += sizeof(header);
+        if (header.block_length < sizeof(header) + sizeof(uint32_t)) {
             OP_LOG(OP_LOG_ERROR,
-                   "Unexepcted PCAP block type %" PRIu32,
-                   block_hdr.block_type);
+                   "Invalid PCAP block length %" PRIu32,
+                   header.block_length);
             m_eof = true;
             break;
         }
+        if (header.block_type != pcap::block_type::ENHANCED_PACKET) {
+            // Skip blocks we don't care about, e.g. padding
+            auto remain = header.block_length - sizeof(header);
+            if (fseek(m_fp_read, remain, SEEK_CUR) != 0) {
+                OP_LOG(OP_LOG_ERROR, "Failed skipping PCAP block data.");
+                m_eof = true;
+                break;
+            }
+            m_read_offset += remain;
+            continue;
+        }
+
+        auto hdr_remain = sizeof(block_hdr) - sizeof(header);
+        if (fread(reinterpret_cast<uint8_t*>(&block_hdr) + sizeof(header),
+                  hdr_remain,
+                  1,
+                  m_fp_read)
+            != 1) {
+            OP_LOG(OP_LOG_ERROR, "Failed reading PCAP enhanced packet block");
+            m_eof = true;
+            break;
+        }
+        m_read_offset += hdr_remain;
+        block_hdr.block_type = header.block_type;
+        block_hdr.block_total_length = header.block_length;
 
         auto block_remain = block_hdr.block_total_length - sizeof(block_hdr);
         size_t block_data_len =
@@ -863,7 +1043,535 @@ capture_buffer_stats capture_buffer_file_reader::get_stats() const
     return m_buffer.get_stats();
 }
 
-void capture_buffer_file_reader::rewind() { read_file_header(); }
+void capture_buffer_file_reader::rewind()
+{
+    m_read_offset = 0;
+    open_file(0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+/*
+ * Streaming file capture constants.  Segments are written to disk whole, so
+ * each one has enough spare room past the data area for the pad block that
+ * rounds it up to the direct I/O block size.
+ */
+constexpr size_t stream_block_size = 4096;
+constexpr size_t stream_segment_size = 1024 * 1024;
+constexpr size_t stream_segment_stride =
+    stream_segment_size + 2 * stream_block_size;
+constexpr size_t stream_min_segments = 4;
+constexpr unsigned stream_queue_depth = 8;
+constexpr uint64_t stream_header_id = std::numeric_limits<uint64_t>::max();
+constexpr auto stream_poll_interval = std::chrono::milliseconds(1);
+constexpr auto stream_drain_interval = std::chrono::seconds(1);
+
+/**
+ * Fill the space between length and the next block boundary with a pcapng
+ * custom block.
+ * @return the padded length
+ */
+static uint32_t pad_stream_data(uint8_t* data, uint32_t length)
+{
+    constexpr uint32_t min_pad_length =
+        sizeof(pcap::custom_block) + sizeof(uint32_t);
+
+    uint32_t pad_length =
+        round_up(length, uint32_t{stream_block_size}) - length;
+    if (pad_length == 0) { return (length); }
+    if (pad_length < min_pad_length) { pad_length += stream_block_size; }
+
+    auto* pad = data + length;
+    std::memset(pad, 0, pad_length);
+
+    auto block = pcap::custom_block{.block_type = pcap::block_type::CUSTOM,
+                                    .block_total_length = pad_length,
+                                    .private_enterprise_number = 0};
+    std::memcpy(pad, &block, sizeof(block));
+    std::memcpy(pad + pad_length - sizeof(uint32_t),
+                &block.block_total_length,
+                sizeof(uint32_t));
+
+    return (length + pad_length);
+}
+
+/**
+ * Write the section and interface description blocks for a new file.
+ * @return the unpadded header length
+ */
+static uint32_t write_stream_header(uint8_t* data)
+{
+    auto* cursor = data;
+
+    pcap::section_block section;
+    section.block_type = pcap::block_type::SECTION;
+    section.block_total_length = sizeof(section) + sizeof(uint32_t);
+    section.byte_order_magic = pcap::BYTE_ORDER_MAGIC;
+    section.major_version = 1;
+    section.minor_version = 0;
+    section.section_length = pcap::SECTION_LENGTH_UNSPECIFIED;
+    std::memcpy(cursor, &section, sizeof(section));
+    cursor += sizeof(section);
+    std::memcpy(cursor, &section.block_total_length, sizeof(uint32_t));
+    cursor += sizeof(uint32_t);
+
+    pcap::interface_default_options interface_options{};
+    interface_options.ts_resol.hdr.option_code =
+        pcap::interface_option_type::IF_TSRESOL;
+    interface_options.ts_resol.hdr.option_length = 1;
+    interface_options.ts_resol.resolution = 9; // nano seconds
+    interface_options.opt_end.hdr.option_code =
+        pcap::interface_option_type::OPT_END;
+    interface_options.opt_end.hdr.option_length = 0;
+
+    pcap::interface_description_block interface_description;
+    interface_description.block_type = pcap::block_type::INTERFACE_DESCRIPTION;
+    interface_description.block_total_length = sizeof(interface_description)
+                                               + sizeof(interface_options)
+                                               + sizeof(uint32_t);
+    interface_description.link_type = pcap::link_type::ETHERNET;
+    interface_description.reserved = 0;
+    interface_description.snap_len = MAX_PACKET_SIZE;
+    std::memcpy(
+        cursor, &interface_description, sizeof(interface_description));
+    cursor += sizeof(interface_description);
+    std::memcpy(cursor, &interface_options, sizeof(interface_options));
+    cursor += sizeof(interface_options);
+    std::memcpy(
+        cursor, &interface_description.block_total_length, sizeof(uint32_t));
+    cursor += sizeof(uint32_t);
+
+    return (cursor - data);
+}
+
+/**
+ * Generate the name of the n'th file of a rotated capture, e.g.
+ * "capture.pcapng" -> "capture.1.pcapng".
+ */
+static std::string rotated_filename(const std::string& filename, size_t n)
+{
+    if (n == 0) { return (filename); }
+
+    auto path = std::filesystem::path(filename);
+    auto rotated = path.stem().string() + "." + std::to_string(n)
+                   + path.extension().string();
+    return (path.replace_filename(rotated).string());
+}
+
+capture_buffer_file_stream::capture_buffer_file_stream(
+    std::string_view filename,
+    uint64_t buffer_size,
+    keep_file keep_file,
+    uint32_t max_packet_size,
+    uint64_t rotate_size,
+    std::chrono::milliseconds rotate_interval)
+    : m_filename(filename)
+    , m_keep_file(keep_file)
+    , m_max_packet_size(std::min(max_packet_size, uint32_t{MAX_PACKET_SIZE}))
+    , m_rotate_size(rotate_size)
+    , m_rotate_interval(rotate_interval)
+    , m_mem(nullptr)
+    , m_mem_size(0)
+    , m_segment_count(
+          std::max(stream_min_segments, buffer_size / stream_segment_size))
+    , m_fill_idx(m_segment_count - 1)
+    , m_stats{0, 0}
+    , m_full(false)
+    , m_write_idx(0)
+    , m_inflight(0)
+    , m_fd(-1)
+    , m_file_offset(0)
+    , m_header{}
+    , m_flush_requested(0)
+    , m_flush_completed(0)
+    , m_stop(false)
+{
+    /* The first block holds the file header; segments follow */
+    m_mem_size = stream_block_size + m_segment_count * stream_segment_stride;
+    auto addr = mmap(nullptr,
+                     m_mem_size,
+                     PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS | MAP_POPULATE,
+                     -1,
+                     0);
+    if (addr == MAP_FAILED) {
+        OP_LOG(OP_LOG_ERROR,
+               "Failed to mmap capture stream memory size %zu.  %s",
+               m_mem_size,
+               strerror(errno));
+        throw std::bad_alloc();
+    }
+    m_mem = reinterpret_cast<uint8_t*>(addr);
+
+    m_header.iov_base = m_mem;
+    m_header.iov_len = pad_stream_data(m_mem, write_stream_header(m_mem));
+    assert(m_header.iov_len == stream_block_size);
+
+    m_segments = std::make_unique<segment[]>(m_segment_count);
+    for (size_t i = 0; i < m_segment_count; i++) {
+        auto& seg = m_segments[i];
+        seg.state.store(segment_state::free, std::memory_order_relaxed);
+        seg.length = 0;
+        seg.iov.iov_base =
+            m_mem + stream_block_size + i * stream_segment_stride;
+        seg.iov.iov_len = 0;
+    }
+
+    try {
+        m_ring.emplace(stream_queue_depth);
+    } catch (const std::system_error& e) {
+        OP_LOG(OP_LOG_INFO,
+               "io_uring unavailable for capture file %s; using pwrite: %s",
+               m_filename.c_str(),
+               e.what());
+    }
+
+    if (!open_file()) {
+        munmap(m_mem, m_mem_size);
+        throw std::runtime_error(
+            std::string("Unable to open capture buffer file ") + m_filename);
+    }
+
+    m_writer = std::thread([this]() { run_writer(); });
+}
+
+capture_buffer_file_stream::~capture_buffer_file_stream()
+{
+    {
+        auto lock = std::lock_guard<std::mutex>(m_mutex);
+        m_stop = true;
+    }
+    m_cond.notify_all();
+    if (m_writer.joinable()) { m_writer.join(); }
+
+    close_file();
+    munmap(m_mem, m_mem_size);
+
+    if (m_keep_file == keep_file::disabled) {
+        for (const auto& filename : m_filenames) {
+            if (std::filesystem::exists(filename)) {
+                std::filesystem::remove(filename);
+            }
+        }
+    }
+}
+
+capture_buffer_file_stream::segment* capture_buffer_file_stream::next_segment()
+{
+    auto idx = (m_fill_idx + 1) % m_segment_count;
+    auto& seg = m_segments[idx];
+    if (seg.state.load(std::memory_order_acquire) != segment_state::free) {
+        return (nullptr);
+    }
+
+    seg.length = 0;
+    seg.state.store(segment_state::busy, std::memory_order_relaxed);
+    m_fill_idx = idx;
+    return (&seg);
+}
+
+uint16_t capture_buffer_file_stream::write_packets(
+    const openperf::packetio::packet::packet_buffer* const packets[],
+    uint16_t packets_length)
+{
+    if (is_full()) { return 0; }
+
+    /*
+     * Reclaim the segment we were filling, unless the writer has taken it
+     * from us, in which case we need a fresh one.
+     */
+    auto* seg = &m_segments[m_fill_idx];
+    auto expected = segment_state::open;
+    if (!seg->state.compare_exchange_strong(expected,
+                                            segment_state::busy,
+                                            std::memory_order_acquire,
+                                            std::memory_order_relaxed)) {
+        seg = next_segment();
+    }
+
+    pcap::enhanced_packet_block block_hdr;
+    block_hdr.block_type = pcap::block_type::ENHANCED_PACKET;
+    block_hdr.interface_id = 0;
+
+    pcap::enhanced_packet_block_default_options options;
+    options.flags.hdr.option_code =
+        pcap::enhanced_packet_block_option_type::FLAGS;
+    options.flags.hdr.option_length = 4;
+    options.flags.flags.value = 0;
+    options.opt_end.hdr.option_code =
+        pcap::enhanced_packet_block_option_type::OPT_END;
+    options.opt_end.hdr.option_length = 0;
+
+    uint16_t i = 0;
+    while (seg && i < packets_length) {
+        auto packet = packets[i];
+        auto packet_len = openperf::packetio::packet::length(packet);
+        auto captured_len = std::min(uint32_t(packet_len), m_max_packet_size);
+        auto pad_length = pcap::pad_block_length(captured_len) - captured_len;
+        uint32_t block_length = sizeof(block_hdr) + captured_len + pad_length
+                                + sizeof(options) + sizeof(uint32_t);
+
+        if (seg->length + block_length > stream_segment_size) {
+            // Hand this segment off to the writer and grab the next one
+            seg->state.store(segment_state::full, std::memory_order_release);
+            seg = next_segment();
+            continue;
+        }
+
+        auto ts = std::chrono::time_point_cast<std::chrono::nanoseconds>(
+                      openperf::packetio::packet::rx_timestamp(packet))
+                      .time_since_epoch()
+                      .count();
+
+        block_hdr.block_total_length = block_length;
+        block_hdr.packet_len = packet_len;
+        block_hdr.captured_len = captured_len;
+        block_hdr.timestamp_high = (ts >> 32);
+        block_hdr.timestamp_low = ts;
+
+        if (openperf::packetio::packet::tx_sink(packet))
+            options.flags.flags.set_direction(pcap::packet_direction::OUTBOUND);
+        else
+            options.flags.flags.set_direction(pcap::packet_direction::INBOUND);
+
+        auto* cursor = static_cast<uint8_t*>(seg->iov.iov_base) + seg->length;
+        std::memcpy(cursor, &block_hdr, sizeof(block_hdr));
+        cursor += sizeof(block_hdr);
+        openperf::packetio::packet::copy_data(packet, cursor, captured_len);
+        cursor += captured_len;
+        std::memset(cursor, 0, pad_length);
+        cursor += pad_length;
+        std::memcpy(cursor, &options, sizeof(options));
+        cursor += sizeof(options);
+        std::memcpy(cursor, &block_length, sizeof(block_length));
+
+        seg->length += block_length;
+        ++(m_stats.packets);
+        m_stats.bytes += captured_len;
+        ++i;
+    }
+
+    if (seg) {
+        seg->state.store(segment_state::open, std::memory_order_release);
+    } else {
+        // No free segments; the writer can't keep up.
+        m_stats.dropped += packets_length - i;
+    }
+
+    return packets_length;
+}
+
+std::unique_ptr<capture_buffer_reader>
+capture_buffer_file_stream::create_reader()
+{
+    flush();
+    return std::unique_ptr<capture_buffer_reader>(
+        new capture_buffer_file_reader(*this, get_filenames()));
+}
+
+std::vector<std::string> capture_buffer_file_stream::get_filenames() const
+{
+    auto lock = std::lock_guard<std::mutex>(m_mutex);
+    return (m_filenames);
+}
+
+void capture_buffer_file_stream::flush()
+{
+    auto lock = std::unique_lock<std::mutex>(m_mutex);
+    auto request = ++m_flush_requested;
+    m_cond.notify_all();
+    m_cond.wait(lock, [&]() { return (m_flush_completed >= request); });
+}
+
+void capture_buffer_file_stream::run_writer()
+{
+    op_thread_setname("op_cap_write");
+
+    auto last_drain = std::chrono::steady_clock::now();
+    auto lock = std::unique_lock<std::mutex>(m_mutex);
+    while (true) {
+        auto request = m_flush_requested;
+        auto stop = m_stop;
+        lock.unlock();
+
+        /*
+         * Periodically, or when asked, take any partially filled segment
+         * from the worker so that packets don't linger in memory.
+         */
+        auto now = std::chrono::steady_clock::now();
+        auto drain = stop || request != m_flush_completed
+                     || now - last_drain >= stream_drain_interval;
+        if (drain) { last_drain = now; }
+
+        size_t written = 0;
+        while (written < m_segment_count && write_segment(m_write_idx, drain)) {
+            m_write_idx = (m_write_idx + 1) % m_segment_count;
+            written++;
+        }
+        reap_writes(drain ? m_inflight : 0);
+
+        lock.lock();
+        if (drain) {
+            m_flush_completed = request;
+            m_cond.notify_all();
+        }
+        if (stop) { break; }
+        if (!written) { m_cond.wait_for(lock, stream_poll_interval); }
+    }
+}
+
+bool capture_buffer_file_stream::write_segment(size_t idx, bool steal)
+{
+    auto& seg = m_segments[idx];
+    auto state = seg.state.load(std::memory_order_acquire);
+    if (state == segment_state::free) { return (false); }
+
+    if (state != segment_state::full) {
+        if (!steal) { return (false); }
+
+        // Wait for the worker to finish any write in progress
+        auto expected = segment_state::open;
+        while (!seg.state.compare_exchange_weak(expected,
+                                                segment_state::full,
+                                                std::memory_order_acquire,
+                                                std::memory_order_acquire)) {
+            if (expected == segment_state::full) { break; }
+            expected = segment_state::open;
+            std::this_thread::yield();
+        }
+    }
+
+    if (!seg.length || m_fd < 0 || is_full()) {
+        seg.state.store(segment_state::free, std::memory_order_release);
+        return (true);
+    }
+
+    auto now = std::chrono::steady_clock::now();
+    if ((m_rotate_size && m_file_offset >= m_rotate_size)
+        || (m_rotate_interval.count()
+            && now - m_file_start >= m_rotate_interval)) {
+        close_file();
+        if (!open_file()) {
+            m_full.store(true, std::memory_order_relaxed);
+            seg.state.store(segment_state::free, std::memory_order_release);
+            return (true);
+        }
+    }
+
+    seg.iov.iov_len =
+        pad_stream_data(static_cast<uint8_t*>(seg.iov.iov_base), seg.length);
+    write_data(&seg.iov, idx);
+
+    return (true);
+}
+
+void capture_buffer_file_stream::write_data(const iovec* iov,
+                                            uint64_t user_data)
+{
+    auto offset = m_file_offset;
+    m_file_offset += iov->iov_len;
+
+    if (m_ring) {
+        if (m_inflight == stream_queue_depth) { reap_writes(1); }
+
+        auto* sqe = m_ring->get_sqe();
+        assert(sqe);
+        utils::io_uring::prep_rw(
+            sqe, IORING_OP_WRITEV, m_fd, iov, 1, offset, user_data);
+        m_inflight++;
+
+        /*
+         * A failed submit leaves the write queued in the ring; the next
+         * submit, e.g. while reaping, retries it.
+         */
+        if (auto error = m_ring->submit(); error < 0) {
+            OP_LOG(OP_LOG_DEBUG,
+                   "Deferring capture file write to %s: %s\n",
+                   m_filename.c_str(),
+                   strerror(-error));
+        }
+        return;
+    }
+
+    auto result = pwritev(m_fd, iov, 1, offset);
+    complete_write(user_data, result < 0 ? -errno : static_cast<int>(result));
+}
+
+void capture_buffer_file_stream::reap_writes(unsigned wait_nr)
+{
+    if (!m_ring) { return; }
+
+    unsigned reaped = 0;
+    while (m_inflight) {
+        auto n = m_ring->for_each_cqe([&](const io_uring_cqe& cqe) {
+            complete_write(cqe.user_data, cqe.res);
+        });
+        m_inflight -= n;
+        reaped += n;
+
+        if (reaped >= wait_nr || !m_inflight) { break; }
+        m_ring->submit_and_wait(1, stream_drain_interval);
+    }
+}
+
+void capture_buffer_file_stream::complete_write(uint64_t user_data,
+                                                int result)
+{
+    auto* iov =
+        user_data == stream_header_id ? &m_header : &m_segments[user_data].iov;
+
+    if (result != static_cast<int>(iov->iov_len)) {
+        OP_LOG(OP_LOG_ERROR,
+               "Failed writing capture file %s: %s",
+               m_filename.c_str(),
+               result < 0 ? strerror(-result) : "short write");
+        m_full.store(true, std::memory_order_relaxed);
+    }
+
+    if (user_data != stream_header_id) {
+        m_segments[user_data].state.store(segment_state::free,
+                                          std::memory_order_release);
+    }
+}
+
+bool capture_buffer_file_stream::open_file()
+{
+    auto filename = rotated_filename(m_filename, m_filenames.size());
+
+    constexpr auto flags = O_WRONLY | O_CREAT | O_TRUNC;
+    m_fd = open(filename.c_str(), flags | O_DIRECT, 0644);
+    if (m_fd < 0 && errno == EINVAL) {
+        // Not every file system supports direct I/O
+        m_fd = open(filename.c_str(), flags, 0644);
+    }
+    if (m_fd < 0) {
+        OP_LOG(OP_LOG_ERROR,
+               "Failed opening capture file %s: %s",
+               filename.c_str(),
+               strerror(errno));
+        return (false);
+    }
+
+    {
+        auto lock = std::lock_guard<std::mutex>(m_mutex);
+        m_filenames.push_back(std::move(filename));
+    }
+
+    m_file_offset = 0;
+    m_file_start = std::chrono::steady_clock::now();
+    write_data(&m_header, stream_header_id);
+
+    return (true);
+}
+
+void capture_buffer_file_stream::close_file()
+{
+    if (m_fd < 0) { return; }
+
+    reap_writes(m_inflight);
+    close(m_fd);
+    m_fd = -1;
+}
 
 ///////////////////////////////////////////////////////////////////////////////
 
@@ -931,6 +1639,7 @@ capture_buffer_stats multi_capture_buffer_reader::get_stats() const
         auto s = reader.get_stats();
         total.packets += s.packets;
         total.bytes += s.bytes;
+        total.dropped += s.dropped;
     }
     return total;
 }
@@ -963,4 +1672,57 @@ void multi_capture_buffer_reader::populate_timestamp_priority_list()
     }
 }
 
+///////////////////////////////////////////////////////////////////////////////
+
+multi_capture_buffer_live_reader::multi_capture_buffer_live_reader(
+    std::vector<std::unique_ptr<capture_buffer_reader>>&& readers)
+    : m_readers(std::move(readers))
+    , m_next(0)
+{}
+
+bool multi_capture_buffer_live_reader::is_done() const
+{
+    return std::all_of(m_readers.begin(),
+                       m_readers.end(),
+                       [](const auto& reader) { return reader->is_done(); });
+}
+
+uint16_t
+multi_capture_buffer_live_reader::read_packets(capture_packet* packets[],
+                                               uint16_t count)
+{
+    if (m_readers.empty()) return 0;
+
+    // Each reader is read at most once so previous packets remain valid
+    uint16_t n = 0;
+    for (size_t i = 0; i < m_readers.size() && n < count; ++i) {
+        auto& reader = m_readers[(m_next + i) % m_readers.size()];
+        n += reader->read_packets(packets + n, count - n);
+    }
+    m_next = (m_next + 1) % m_readers.size();
+
+    return n;
+}
+
+capture_buffer_stats multi_capture_buffer_live_reader::get_stats() const
+{
+    capture_buffer_stats total{0, 0};
+    for (auto& reader : m_readers) {
+        auto s = reader->get_stats();
+        total.packets += s.packets;
+        total.bytes += s.bytes;
+        total.dropped += s.dropped;
+    }
+    return total;
+}
+
+size_t multi_capture_buffer_live_reader::get_offset() const
+{
+    size_t offset = 0;
+    std::for_each(m_readers.begin(), m_readers.end(), [&](const auto& reader) {
+        offset += reader->get_offset();
+    });
+    return offset;
+}
+
 } // namespace openperf::packet::capture
@@ -1,14 +1,22 @@
 #ifndef _OP_PACKET_CAPTURE_BUFFER_HPP_
 #define _OP_PACKET_CAPTURE_BUFFER_HPP_
 
+#include <atomic>
+#include <condition_variable>
 #include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <optional>
+#include <thread>
 #include <vector>
 #include <queue>
 #include <assert.h>
+#include <sys/uio.h>
 
 #include "timesync/chrono.hpp"
+#include "utils/io_uring.hpp"
 
 namespace openperf::packetio::packet {
 struct packet_buffer;
@@ -53,6 +61,7 @@ struct capture_buffer_stats
 {
     uint64_t packets;
     uint64_t bytes;
+    uint64_t dropped = 0;
 };
 
 /**
@@ -481,6 +490,89 @@ protected:
     bool m_eof;
 };
 
+/**
+ * Capture buffer implementation which streams packets to a live reader.
+ *
+ * The buffer is a ring shared between a single worker and a single reader.
+ * Workers never block; packets are dropped, and counted, when the reader
+ * falls behind.  Packets are consumed as they are read, so the reader can
+ * not be rewound.  The done function tells the reader when no more packets
+ * will be written.
+ */
+class capture_buffer_live : public capture_buffer_mem
+{
+public:
+    capture_buffer_live(uint64_t size,
+                        uint32_t max_packet_size,
+                        std::function<bool()>&& done);
+    capture_buffer_live(const capture_buffer_live&) = delete;
+    virtual ~capture_buffer_live() = default;
+
+    uint16_t write_packets(
+        const openperf::packetio::packet::packet_buffer* const packets[],
+        uint16_t packets_length) override;
+
+    bool is_full() const override { return false; }
+
+    std::unique_ptr<capture_buffer_reader> create_reader() override;
+
+    capture_buffer_stats get_stats() const override { return m_stats; }
+
+    bool is_done() const { return m_done(); }
+
+    /*
+     * Byte counts are free running, so the reader and the writer only
+     * need to share these two values.
+     */
+    uint64_t get_write_count() const
+    {
+        return m_write_count.load(std::memory_order_acquire);
+    }
+
+    uint64_t get_read_count() const
+    {
+        return m_read_count.load(std::memory_order_acquire);
+    }
+
+    void set_read_count(uint64_t count)
+    {
+        m_read_count.store(count, std::memory_order_release);
+    }
+
+private:
+    std::function<bool()> m_done;
+    std::atomic<uint64_t> m_write_count;
+    std::atomic<uint64_t> m_read_count;
+};
+
+/**
+ * Capture buffer reader class for reading from a capture_buffer_live
+ * object.  Returned packets are consumed on the next read.
+ */
+class capture_buffer_live_reader : public capture_buffer_reader
+{
+public:
+    capture_buffer_live_reader(capture_buffer_live& buffer);
+    capture_buffer_live_reader(const capture_buffer_live_reader&) = delete;
+    virtual ~capture_buffer_live_reader();
+
+    bool is_done() const override;
+
+    uint16_t read_packets(capture_packet* packets[], uint16_t count) override;
+
+    capture_buffer_stats get_stats() const override;
+
+    size_t get_offset() const override { return m_read_offset; }
+
+    void rewind() override {}
+
+protected:
+    capture_buffer_live& m_buffer;
+    uint64_t m_read_count;
+    ssize_t m_read_offset;
+    std::vector<capture_packet> m_packets;
+};
+
 /**
  * Capture buffer implementation which writes to a pcap
  * file using stdio for read/write.
@@ -519,6 +611,7 @@ private:
     uint32_t m_max_packet_size;
     FILE* m_fp_write;
     capture_buffer_stats m_stats;
+    std::vector<uint8_t> m_scratch;
 };
 
 /**
@@ -529,6 +622,8 @@ class capture_buffer_file_reader : public capture_buffer_reader
 {
 public:
     capture_buffer_file_reader(capture_buffer_file& buffer);
+    capture_buffer_file_reader(const capture_buffer& buffer,
+                               std::vector<std::string> filenames);
     capture_buffer_file_reader(const capture_buffer_file_reader&) = delete;
     virtual ~capture_buffer_file_reader();
 
@@ -543,9 +638,12 @@ public:
     void rewind() override;
 
 private:
+    bool open_file(size_t idx);
     bool read_file_header();
 
-    capture_buffer_file& m_buffer;
+    const capture_buffer& m_buffer;
+    std::vector<std::string> m_filenames;
+    size_t m_file_idx;
     FILE* m_fp_read;
     ssize_t m_read_offset;
     std::vector<capture_packet> m_packets;
@@ -553,6 +651,109 @@ private:
     bool m_eof;
 };
 
+/**
+ * Capture buffer implementation which streams packets to one or more
+ * pcapng files.
+ *
+ * Workers encode packets into a ring of fixed size segments and never
+ * block.  A dedicated writer thread writes filled segments to disk, using
+ * io_uring and O_DIRECT when available.  Each segment is padded to the
+ * direct I/O block size with a pcapng custom block, so the files remain
+ * readable by any pcapng reader.  Packets are dropped, and counted, when
+ * the writer falls behind.  Files may optionally be rotated by size and/or
+ * time; rotated files are named <stem>.<n><extension>.
+ */
+class capture_buffer_file_stream : public capture_buffer
+{
+public:
+    using keep_file = capture_buffer_file::keep_file;
+
+    capture_buffer_file_stream(
+        std::string_view filename,
+        uint64_t buffer_size,
+        keep_file keep_file = keep_file::disabled,
+        uint32_t max_packet_size = UINT32_MAX,
+        uint64_t rotate_size = 0,
+        std::chrono::milliseconds rotate_interval = {});
+    capture_buffer_file_stream(const capture_buffer_file_stream&) = delete;
+    virtual ~capture_buffer_file_stream();
+
+    uint16_t write_packets(
+        const openperf::packetio::packet::packet_buffer* const packets[],
+        uint16_t packets_length) override;
+
+    bool is_full() const override
+    {
+        return m_full.load(std::memory_order_relaxed);
+    }
+
+    std::unique_ptr<capture_buffer_reader> create_reader() override;
+
+    capture_buffer_stats get_stats() const override { return m_stats; }
+
+    std::vector<std::string> get_filenames() const;
+
+    /**
+     * Write all buffered packets to disk.  Blocks until complete.
+     */
+    void flush();
+
+private:
+    enum class segment_state { free, open, busy, full };
+
+    struct segment
+    {
+        std::atomic<segment_state> state;
+        uint32_t length;
+        iovec iov;
+    };
+
+    /* worker functions */
+    segment* next_segment();
+
+    /* writer thread functions */
+    void run_writer();
+    bool write_segment(size_t idx, bool steal);
+    void write_data(const iovec* iov, uint64_t user_data);
+    void reap_writes(unsigned wait_nr);
+    void complete_write(uint64_t user_data, int result);
+    bool open_file();
+    void close_file();
+
+    std::string m_filename;
+    keep_file m_keep_file;
+    uint32_t m_max_packet_size;
+    uint64_t m_rotate_size;
+    std::chrono::milliseconds m_rotate_interval;
+
+    /* segment ring; shared between the worker and the writer */
+    uint8_t* m_mem;
+    size_t m_mem_size;
+    std::unique_ptr<segment[]> m_segments;
+    size_t m_segment_count;
+    size_t m_fill_idx;
+    capture_buffer_stats m_stats;
+    std::atomic<bool> m_full;
+
+    /* writer state; only touched by the writer thread */
+    std::optional<utils::io_uring::ring> m_ring;
+    size_t m_write_idx;
+    unsigned m_inflight;
+    int m_fd;
+    uint64_t m_file_offset;
+    std::chrono::steady_clock::time_point m_file_start;
+    iovec m_header;
+
+    /* control <-> writer synchronization */
+    mutable std::mutex m_mutex;
+    std::condition_variable m_cond;
+    std::vector<std::string> m_filenames;
+    uint64_t m_flush_requested;
+    uint64_t m_flush_completed;
+    bool m_stop;
+    std::thread m_writer;
+};
+
 template <class ReaderHolderPtrType> struct greater_than
 {
     bool operator()(ReaderHolderPtrType a, ReaderHolderPtrType b)
@@ -602,6 +803,33 @@ private:
     burst_reader_type* m_reader_pending;
 };
 
+/**
+ * Capture buffer reader class which aggregates multiple live capture
+ * readers.  Packets are returned as they become available, so they are
+ * only in timestamp order per reader.
+ */
+class multi_capture_buffer_live_reader : public capture_buffer_reader
+{
+public:
+    multi_capture_buffer_live_reader(
+        std::vector<std::unique_ptr<capture_buffer_reader>>&& readers);
+    virtual ~multi_capture_buffer_live_reader() = default;
+
+    bool is_done() const override;
+
+    uint16_t read_packets(capture_packet* packets[], uint16_t count) override;
+
+    capture_buffer_stats get_stats() const override;
+
+    void rewind() override {}
+
+    size_t get_offset() const override;
+
+private:
+    std::vector<std::unique_ptr<capture_buffer_reader>> m_readers;
+    size_t m_next;
+};
+
 } // namespace openperf::packet::capture
 
 #endif // _OP_PACKET_CAPTURE_BUFFER_HPP_
@@ -2,7 +2,7 @@
 # Makefile component to build Capture code
 #
 
-CAP_DEPENDS += immer packetio packet_bpf spirent_pga timesync
+CAP_DEPENDS += api immer packetio packet_bpf spirent_pga timesync
 
 CAP_SOURCES += \
         api_transmogrify.cpp \
@@ -11,7 +11,6 @@ CAP_SOURCES += \
         init.cpp \
         pcap_transfer.cpp \
         pcap_writer.cpp \
-        pistache_utils.cpp \
     	server.cpp \
     	sink.cpp \
         sink_transmogrify.cpp \
@@ -890,7 +890,7 @@ void handler::get_capture_result_live(const request_type& request,
         return;
     }
 
-    auto transfer_ptr = pcap::create_pcap_transfer_context(response);
+    auto transfer_ptr = pcap::create_pcap_live_transfer_context(response);
 
     std::vector<id_ptr> ids;
     ids.emplace_back(std::make_unique<std::string>(id));
@@ -53,6 +53,7 @@ enum class block_type : uint32_t {
     SECTION = 0x0A0D0D0A,
     INTERFACE_DESCRIPTION = 1,
     ENHANCED_PACKET = 6,
+    CUSTOM = 0x40000BAD,
 };
 
 enum class link_type : uint16_t {
@@ -119,6 +120,15 @@ struct enhanced_packet_block
     uint32_t packet_len;
 } __attribute__((packed));
 
+// Custom block; readers must skip it if they don't understand the PEN.
+// We use it as filler to pad blocks out to arbitrary boundaries.
+struct custom_block
+{
+    block_type block_type;
+    uint32_t block_total_length;
+    uint32_t private_enterprise_number;
+} __attribute__((packed));
+
 enum class packet_direction { NONE, INBOUND, OUTBOUND };
 
 struct enhanced_packet_block_flags
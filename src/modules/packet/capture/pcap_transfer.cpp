@@ -13,7 +13,7 @@
 #include "packet/capture/pcap_writer.hpp"
 #include "packet/capture/pcap_transfer.hpp"
 
-#include "packet/capture/pistache_utils.hpp"
+#include "api/api_pistache_utils.hpp"
 
 using namespace openperf::pistache_utils;
 
@@ -21,6 +21,9 @@ namespace openperf::packet::capture::pcap {
 
 const std::string PCAPNG_MIME_TYPE = "application/x-pcapng";
 
+/* How long live transfers wait for more packets when the capture is idle */
+constexpr auto live_poll_interval = std::chrono::milliseconds(10);
+
 size_t calc_pcap_file_length(capture_buffer_reader& reader,
                              uint64_t packet_start,
                              uint64_t packet_end)
@@ -151,7 +154,8 @@ public:
                                  Pistache::Tcp::Transport* transport,
                                  uint64_t packet_start,
                                  uint64_t packet_end,
-                                 bool chunked = false)
+                                 bool chunked = false,
+                                 bool live = false)
         : m_transport(transport)
         , m_peer(std::move(peer))
         , m_writer(std::make_unique<pcap_buffer_writer>())
@@ -161,8 +165,12 @@ public:
         , m_buffer_sent(0)
         , m_total_bytes_sent(0)
         , m_chunked(chunked)
+        , m_live(live)
         , m_error(false)
-    {}
+    {
+        // Live transfers have no idea how much data they will send
+        assert(m_chunked || !m_live);
+    }
 
     ~pcap_thread_transfer_context() override
     {
@@ -172,6 +180,8 @@ public:
         }
     }
 
+    bool is_live() const override { return m_live; }
+
     size_t get_total_length() const override
     {
         // Currently code will enable chunk encoding if returned length is 0
@@ -238,6 +248,12 @@ private:
                 count = std::min(count, packets.size());
             }
             auto n = reader()->read_packets(packets.data(), count);
+            if (n == 0 && m_live) {
+                // Send what we have while waiting for more packets
+                flush();
+                std::this_thread::sleep_for(live_poll_interval);
+                continue;
+            }
             std::for_each(packets.data(),
                           packets.data() + n,
                           [&](auto& packet) { write_packet(*packet); });
@@ -466,6 +482,7 @@ private:
     size_t m_buffer_sent;
     size_t m_total_bytes_sent;
     bool m_chunked;
+    bool m_live;
     bool m_error;
 };
 
@@ -491,6 +508,8 @@ public:
 
     ~pcap_async_transfer_context() override = default;
 
+    bool is_live() const override { return false; }
+
     size_t get_total_length() const override
     {
         // Currently code will enable chunk encoding if returned length is 0
@@ -678,6 +697,18 @@ create_pcap_transfer_context(Pistache::Http::ResponseWriter& response,
     return context;
 }
 
+std::unique_ptr<transfer_context>
+create_pcap_live_transfer_context(Pistache::Http::ResponseWriter& response)
+{
+    return std::unique_ptr<transfer_context>{
+        new pcap_thread_transfer_context(response.peer(),
+                                         get_transport(response),
+                                         0,
+                                         UINT64_MAX,
+                                         true,
+                                         true)};
+}
+
 Pistache::Async::Promise<ssize_t> serve_capture_pcap(transfer_context& context)
 {
     return dynamic_cast<pcap_transfer_context&>(context).start();
@@ -14,6 +14,13 @@ create_pcap_transfer_context(Pistache::Http::ResponseWriter& response,
                              uint64_t packet_start = 0,
                              uint64_t packet_end = UINT64_MAX);
 
+/*
+ * Live transfers stream packets as they are captured until the capture
+ * stops or the client goes away.
+ */
+std::unique_ptr<transfer_context>
+create_pcap_live_transfer_context(Pistache::Http::ResponseWriter& response);
+
 Pistache::Async::Promise<ssize_t>
 send_pcap_response_header(Pistache::Http::ResponseWriter& response,
                           Pistache::Http::Version version,
@@ -356,6 +356,13 @@ reply_msg server::handle_request(const request_create_capture& request)
     if (user_config->stopTriggerIsSet()) {
         config.stop_trigger = user_config->getStopTrigger();
     }
+    if (user_config->fileRotateSizeIsSet()) {
+        config.file_rotate_size = user_config->getFileRotateSize();
+    }
+    if (user_config->fileRotateIntervalIsSet()) {
+        config.file_rotate_interval =
+            std::chrono::milliseconds(user_config->getFileRotateInterval());
+    }
     if (!request.capture->getId().empty()) {
         config.id = request.capture->getId();
     }
@@ -513,10 +520,10 @@ reply_msg server::handle_request(const request_delete_capture& request)
 
 std::unique_ptr<capture_buffer>
 create_capture_buffer([[maybe_unused]] const core::uuid& id,
-                      [[maybe_unused]] const sink& sink,
+                      [[maybe_unused]] const sink_result& result,
                       [[maybe_unused]] int worker)
 {
-    auto& config = sink.get_config();
+    auto& config = result.parent.get_config();
 
     switch (config.capture_mode) {
     case capture_mode::BUFFER: {
@@ -528,17 +535,21 @@ create_capture_buffer([[maybe_unused]] const core::uuid& id,
             new capture_buffer_mem(config.buffer_size, config.max_packet_size));
     }
     case capture_mode::LIVE: {
-        // TODO: Add support for live capture mode
-        OP_LOG(OP_LOG_ERROR, "Live capture mode is not supported yet.");
-        throw std::bad_alloc();
+        return std::unique_ptr<capture_buffer>(new capture_buffer_live(
+            config.buffer_size, config.max_packet_size, [&result]() {
+                return (result.state == capture_state::STOPPED);
+            }));
     }
     case capture_mode::FILE: {
         auto filename = openperf::core::to_string(id) + "-"
                         + std::to_string(worker) + ".pcapng";
-        return std::unique_ptr<capture_buffer>(
-            new capture_buffer_file(filename,
-                                    capture_buffer_file::keep_file::disabled,
-                                    config.max_packet_size));
+        return std::unique_ptr<capture_buffer>(new capture_buffer_file_stream(
+            filename,
+            config.buffer_size,
+            capture_buffer_file_stream::keep_file::disabled,
+            config.max_packet_size,
+            config.file_rotate_size,
+            config.file_rotate_interval));
     }
     }
 }
@@ -683,7 +694,7 @@ reply_msg server::handle_request(const request_start_capture& request)
         // Create capture buffers for each worker and add to result object
         for (size_t worker = 0, n = impl.worker_count(); worker < n; ++worker) {
             result->buffers.emplace_back(
-                create_capture_buffer(id, impl, worker));
+                create_capture_buffer(id, *result, worker));
         }
     } catch (const std::bad_alloc& e) {
         OP_LOG(OP_LOG_ERROR, "Failed allocating capture buffer.  %s", e.what());
@@ -934,6 +945,24 @@ reply_msg server::handle_request(request_create_capture_transfer& request)
         results.push_back(result.get());
     }
 
+    /*
+     * Live captures are consumed as they are read, so they can only be
+     * read by a single live transfer.
+     */
+    auto live = std::count_if(
+        results.begin(), results.end(), [](const auto& result) {
+            return (result->parent.get_config().capture_mode
+                    == capture_mode::LIVE);
+        });
+    if (live) {
+        if (results.size() != 1 || !request.transfer->is_live()) {
+            return (to_error(error_type::POSIX, EINVAL));
+        }
+        if (has_transfer(*results.front())) {
+            return (to_error(error_type::POSIX, EBUSY));
+        }
+    }
+
     m_transfers.emplace_back(
         transfer{std::unique_ptr<transfer_context>(request.transfer),
                  std::move(results)});
@@ -959,6 +988,10 @@ reply_msg server::handle_request(request_create_capture_transfer& request)
     }
     if (readers.size() == 1) {
         transfer.context->set_reader(readers[0]);
+    } else if (live) {
+        auto reader = std::unique_ptr<capture_buffer_reader>(
+            new multi_capture_buffer_live_reader(std::move(readers)));
+        transfer.context->set_reader(reader);
     } else {
         auto reader = std::unique_ptr<capture_buffer_reader>(
             new multi_capture_buffer_reader(std::move(readers)));
@@ -84,6 +84,7 @@ capture_buffer_stats sink_result::get_stats() const
         auto stats = buffer->get_stats();
         total.bytes += stats.bytes;
         total.packets += stats.packets;
+        total.dropped += stats.dropped;
     });
 
     return total;
@@ -52,6 +52,8 @@ struct sink_config
     std::chrono::duration<uint64_t, std::nano> duration;
     capture_mode capture_mode;
     bool buffer_wrap;
+    uint64_t file_rotate_size;
+    std::chrono::milliseconds file_rotate_interval;
 };
 
 struct sink_result
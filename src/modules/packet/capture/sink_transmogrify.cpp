@@ -42,6 +42,11 @@ capture_ptr to_swagger(const sink& src)
         dst_config->setStartTrigger(src_config.start_trigger);
     if (!src_config.stop_trigger.empty())
         dst_config->setStopTrigger(src_config.stop_trigger);
+    if (src_config.file_rotate_size)
+        dst_config->setFileRotateSize(src_config.file_rotate_size);
+    if (src_config.file_rotate_interval.count())
+        dst_config->setFileRotateInterval(
+            src_config.file_rotate_interval.count());
     dst->setConfig(dst_config);
 
     return (dst);
@@ -59,6 +64,7 @@ capture_result_ptr to_swagger(const core::uuid& id, const sink_result& src)
     auto stats = src.get_stats();
     dst->setPackets(stats.packets);
     dst->setBytes(stats.bytes);
+    dst->setDroppedPackets(stats.dropped);
 
     return (dst);
 }
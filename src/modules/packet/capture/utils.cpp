@@ -27,6 +27,15 @@ bool is_valid(const capture_type& capture, std::vector<std::string>& errors)
             + std::to_string(capture_buffer_size_min) + " bytes.");
     }
 
+    if (config->fileRotateSizeIsSet() && config->getFileRotateSize() <= 0) {
+        errors.emplace_back("Capture file rotate size must be positive.");
+    }
+
+    if (config->fileRotateIntervalIsSet()
+        && config->getFileRotateInterval() <= 0) {
+        errors.emplace_back("Capture file rotate interval must be positive.");
+    }
+
     if (config->filterIsSet()) {
         auto filter = config->getFilter();
         if (!packet::bpf::bpf_validate_filter(filter)) {
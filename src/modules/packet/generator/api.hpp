@@ -77,6 +77,53 @@ using learning_results_ptr = std::unique_ptr<learning_results_type>;
 
 using id_ptr = std::unique_ptr<std::string>;
 
+/*
+ * Compact flow statistics for streaming clients. Records are fixed size
+ * and trivially copyable, so they can be written to the wire as is.
+ * Intended packet and octet counts are left out, as they are expensive
+ * to calculate for every flow; clients can derive them from the
+ * generator's load.  The stream id is only valid when the corresponding
+ * flag is set.  All timestamps are in nanoseconds.
+ */
+enum class tx_flow_update_flags : uint32_t {
+    stream_id = (1 << 0),
+};
+
+struct tx_flow_update
+{
+    core::uuid id; /* same id as the TxFlow object */
+    uint64_t packet_count;
+    uint64_t octet_count;
+    int64_t timestamp_first;
+    int64_t timestamp_last;
+    uint32_t flags;
+    uint32_t stream_id;
+};
+
+static_assert(std::is_trivially_copyable_v<tx_flow_update>);
+static_assert(sizeof(tx_flow_update) == 56); /* wire format */
+
+/*
+ * Every frame of a tx flow stream starts with this header and is
+ * followed by `count` tx_flow_update records.  Values use host byte
+ * order.
+ */
+struct tx_flow_update_frame_header
+{
+    static constexpr uint32_t frame_magic = 0x4f505446; /* "OPTF" */
+    static constexpr uint16_t frame_version = 1;
+
+    uint32_t magic;
+    uint16_t version;
+    uint16_t record_length; /* sizeof(tx_flow_update) */
+    uint64_t count;
+    int64_t timestamp;
+};
+
+static_assert(sizeof(tx_flow_update_frame_header) == 24); /* wire format */
+
+using tx_flow_updates_ptr = std::unique_ptr<std::vector<tx_flow_update>>;
+
 enum class filter_type { none, generator_id, target_id };
 using filter_map_type = std::map<filter_type, std::string>;
 using filter_map_ptr = std::unique_ptr<filter_map_type>;
@@ -245,6 +292,22 @@ struct request_get_tx_flow
     std::string id;
 };
 
+/*
+ * Retrieve all flows that have sent packets since the previous request
+ * with the same subscription id.  The first request for a subscription id
+ * returns every flow.
+ */
+struct request_get_tx_flow_updates
+{
+    uint64_t subscription;
+    filter_map_ptr filter;
+};
+
+struct request_delete_tx_flow_subscription
+{
+    uint64_t subscription;
+};
+
 struct request_get_learning_results
 {
     std::string id;
@@ -280,6 +343,11 @@ struct reply_tx_flows
     std::vector<tx_flow_ptr> flows;
 };
 
+struct reply_tx_flow_updates
+{
+    tx_flow_updates_ptr updates;
+};
+
 struct reply_learning_results
 {
     std::vector<learning_results_ptr> results;
@@ -303,6 +371,8 @@ using request_msg = std::variant<request_list_generators,
                                  request_delete_generator_result,
                                  request_list_tx_flows,
                                  request_get_tx_flow,
+                                 request_get_tx_flow_updates,
+                                 request_delete_tx_flow_subscription,
                                  request_get_learning_results,
                                  request_retry_learning,
                                  request_start_learning,
@@ -334,6 +404,7 @@ struct reply_error
 using reply_msg = std::variant<reply_generators,
                                reply_generator_results,
                                reply_tx_flows,
+                               reply_tx_flow_updates,
                                reply_learning_results,
                                reply_ok,
                                reply_error>;
@@ -356,6 +427,8 @@ tx_flow_ptr to_swagger(const core::uuid& id,
                        const core::uuid& result_id,
                        const source_result& result,
                        size_t flow_idx);
+tx_flow_update
+to_update(const core::uuid& id, const source_result& result, size_t flow_idx);
 
 learning_results_ptr to_swagger(const learning_state_machine& lsm);
 
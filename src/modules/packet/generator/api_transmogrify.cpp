@@ -83,6 +83,14 @@ serialized_msg serialize_request(request_msg&& msg)
                      return (message::push(
                          serialized, request.id.data(), request.id.length()));
                  },
+                 [&](request_get_tx_flow_updates& request) -> int {
+                     return (message::push(serialized, request.subscription)
+                             || message::push(serialized,
+                                              std::move(request.filter)));
+                 },
+                 [&](const request_delete_tx_flow_subscription& request) {
+                     return (message::push(serialized, request.subscription));
+                 },
                  [&](const request_get_learning_results& request) {
                      return (message::push(
                          serialized, request.id.data(), request.id.length()));
@@ -122,6 +130,10 @@ serialized_msg serialize_reply(reply_msg&& msg)
                  [&](reply_tx_flows& reply) {
                      return (message::push(serialized, reply.flows));
                  },
+                 [&](reply_tx_flow_updates& reply) {
+                     return (
+                         message::push(serialized, std::move(reply.updates)));
+                 },
                  [&](reply_learning_results& reply) {
                      return (message::push(serialized, reply.results));
                  },
@@ -209,6 +221,17 @@ tl::expected<request_msg, int> deserialize_request(serialized_msg&& msg)
     case utils::variant_index<request_msg, request_get_tx_flow>(): {
         return (request_get_tx_flow{message::pop_string(msg)});
     }
+    case utils::variant_index<request_msg, request_get_tx_flow_updates>(): {
+        auto request = request_get_tx_flow_updates{};
+        request.subscription = message::pop<uint64_t>(msg);
+        request.filter.reset(message::pop<filter_map_type*>(msg));
+        return (request);
+    }
+    case utils::variant_index<request_msg,
+                              request_delete_tx_flow_subscription>(): {
+        return (request_delete_tx_flow_subscription{
+            message::pop<uint64_t>(msg)});
+    }
     case utils::variant_index<request_msg, request_get_learning_results>(): {
         return (request_get_learning_results{message::pop_string(msg)});
     }
@@ -242,6 +265,12 @@ tl::expected<reply_msg, int> deserialize_reply(serialized_msg&& msg)
     case utils::variant_index<reply_msg, reply_tx_flows>(): {
         return (reply_tx_flows{message::pop_unique_vector<tx_flow_type>(msg)});
     }
+    case utils::variant_index<reply_msg, reply_tx_flow_updates>(): {
+        auto reply = reply_tx_flow_updates{};
+        reply.updates.reset(
+            message::pop<std::vector<tx_flow_update>*>(msg));
+        return (reply);
+    }
     case utils::variant_index<reply_msg, reply_learning_results>(): {
         return (reply_learning_results{
             message::pop_unique_vector<learning_results_type>(msg)});
@@ -17,6 +17,7 @@ PG_SOURCES += \
 	traffic_transmogrify.cpp \
 	traffic/length_template.cpp \
 	traffic/header/explode.cpp \
+	traffic/header/lazy_container.cpp \
 	traffic/header/utils.cpp \
 	traffic/header/expand_impl/custom.cpp \
 	traffic/header/expand_impl/ethernet.cpp \
@@ -34,6 +35,7 @@ PG_SOURCES += \
 	traffic/protocol/protocol.cpp \
 	traffic/protocol/vlan.cpp \
 	traffic/sequence.cpp \
+	tx_flow_stream.cpp \
 	validation.cpp
 
 PG_VERSIONED_FILES := init.cpp
@@ -64,6 +66,7 @@ PG_TEST_DEPENDS += expected framework json range_v3 packet_protocol
 PG_TEST_SOURCES += \
 	traffic/length_template.cpp \
 	traffic/header/explode.cpp \
+	traffic/header/lazy_container.cpp \
 	traffic/header/utils.cpp \
 	traffic/header/expand_impl/custom.cpp \
 	traffic/header/expand_impl/ethernet.cpp \
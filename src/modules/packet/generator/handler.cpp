@@ -6,6 +6,7 @@
 #include "core/op_core.h"
 #include "message/serialized_message.hpp"
 #include "packet/generator/api.hpp"
+#include "packet/generator/tx_flow_stream.hpp"
 #include "packetio/init.hpp"
 
 #include "swagger/converters/packet_generator.hpp"
@@ -146,6 +147,7 @@ public:
     /* Tx flow operations */
     void list_tx_flows(const request_type& request, response_type response);
     void get_tx_flow(const request_type& request, response_type response);
+    void stream_tx_flows(const request_type& request, response_type response);
 
     /* Learning operations */
     void get_learning_results(const request_type& request,
@@ -155,11 +157,14 @@ public:
     void stop_learning(const request_type& request, response_type response);
 
 private:
+    void* m_context;
     std::unique_ptr<void, op_socket_deleter> m_socket;
+    std::vector<std::unique_ptr<openperf::api::flow_stream>> m_streams;
 };
 
 handler::handler(void* context, Pistache::Rest::Router& router)
-    : m_socket(op_socket_get_client(context, ZMQ_REQ, endpoint.data()))
+    : m_context(context)
+    , m_socket(op_socket_get_client(context, ZMQ_REQ, endpoint.data()))
 {
     using namespace Pistache::Rest::Routes;
 
@@ -213,6 +218,9 @@ handler::handler(void* context, Pistache::Rest::Router& router)
 
     Get(router, "/packet/tx-flows", bind(&handler::list_tx_flows, this));
     Get(router, "/packet/tx-flows/:id", bind(&handler::get_tx_flow, this));
+    Get(router,
+        "/packet/tx-flows/x/stream",
+        bind(&handler::stream_tx_flows, this));
 
     Get(router,
         "/packet/generators/:id/learning",
@@ -923,6 +931,62 @@ void handler::get_tx_flow(const request_type& request, response_type response)
     }
 }
 
+static tl::expected<uint64_t, int> to_uint64(const std::string& val_str)
+{
+    char* end_ptr = nullptr;
+    auto v = strtoull(val_str.c_str(), &end_ptr, 10);
+    if (!end_ptr || *end_ptr != '\0') { return tl::make_unexpected(EINVAL); }
+    return v;
+}
+
+void handler::stream_tx_flows(const request_type& request,
+                              response_type response)
+{
+    if (auto server_ok = check_server(); !server_ok) {
+        response.send(Http::Code::Method_Not_Allowed, server_ok.error());
+        return;
+    }
+
+    constexpr auto min_interval = std::chrono::milliseconds{10};
+    auto interval = std::chrono::milliseconds{1000};
+    if (auto query = request.query().get("interval")) {
+        auto v = to_uint64(query.value());
+        if (!v || std::chrono::milliseconds(*v) < min_interval) {
+            response.send(Http::Code::Bad_Request,
+                          json_error(EINVAL,
+                                     "interval value is not valid ("
+                                         + query.value() + ")"));
+            return;
+        }
+        interval = std::chrono::milliseconds{*v};
+    }
+
+    auto filter = filter_map_ptr{};
+    set_optional_filter(request, filter, filter_type::generator_id);
+    set_optional_filter(request, filter, filter_type::target_id);
+
+    /* Clean up after any streams that have finished */
+    m_streams.erase(
+        std::remove_if(std::begin(m_streams),
+                       std::end(m_streams),
+                       [](const auto& stream) { return (stream->done()); }),
+        std::end(m_streams));
+
+    auto stream = std::make_unique<openperf::api::flow_stream>(
+        "op_pg_stream",
+        std::make_unique<tx_flow_stream>(
+            m_context, filter ? std::move(*filter) : filter_map_type{}),
+        interval);
+    if (auto success = stream->start(response, request.version()); !success) {
+        OP_LOG(OP_LOG_ERROR,
+               "Failed to start tx flow stream: %s\n",
+               success.error().c_str());
+        return;
+    }
+
+    m_streams.push_back(std::move(stream));
+}
+
 void handler::get_learning_results(const request_type& request,
                                    response_type response)
 {
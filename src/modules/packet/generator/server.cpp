@@ -133,6 +133,15 @@ static std::string to_string(const request_msg& request)
                            [](const request_get_tx_flow& request) {
                                return ("get tx flow " + request.id);
                            },
+                           [](const request_get_tx_flow_updates& request) {
+                               return ("get tx flow updates for subscription "
+                                       + std::to_string(request.subscription));
+                           },
+                           [](const request_delete_tx_flow_subscription&
+                                  request) {
+                               return ("delete tx flow subscription "
+                                       + std::to_string(request.subscription));
+                           },
                            [](const request_get_learning_results&) {
                                return (std::string("get learning results"));
                            },
@@ -744,31 +753,35 @@ reply_msg server::handle_request(const request_delete_generator_result& request)
     return (reply_ok{});
 }
 
-reply_msg server::handle_request(const request_list_tx_flows& request)
+using result_filter_fn = std::function<bool(
+    const std::pair<const core::uuid, std::unique_ptr<source_result>>&)>;
+
+static result_filter_fn to_result_filter(const filter_map_ptr& filter)
 {
-    auto compare = std::function<bool(const result_map::value_type& pair)>{};
-    if (!request.filter) {
-        compare = [](const auto&) { return (true); };
-    } else {
-        auto& filter = *request.filter;
-        compare = [&](const auto& item) {
-            if (filter.count(filter_type::generator_id)
-                && filter[filter_type::generator_id]
-                       != item.second->parent().id()) {
-                return (false);
-            }
+    if (!filter) {
+        return ([](const auto&) { return (true); });
+    }
 
-            if (filter.count(filter_type::target_id)
-                && filter[filter_type::target_id]
-                       != item.second->parent().target()) {
-                return (false);
-            }
+    return ([&filter = *filter](const auto& item) {
+        if (filter.count(filter_type::generator_id)
+            && filter.at(filter_type::generator_id)
+                   != item.second->parent().id()) {
+            return (false);
+        }
 
-            return (true);
-        };
-    }
+        if (filter.count(filter_type::target_id)
+            && filter.at(filter_type::target_id)
+                   != item.second->parent().target()) {
+            return (false);
+        }
 
-    assert(compare);
+        return (true);
+    });
+}
+
+reply_msg server::handle_request(const request_list_tx_flows& request)
+{
+    auto compare = to_result_filter(request.filter);
 
     auto reply = reply_tx_flows{};
 
@@ -814,6 +827,56 @@ reply_msg server::handle_request(const request_get_tx_flow& request)
     return (reply);
 }
 
+reply_msg server::handle_request(const request_get_tx_flow_updates& request)
+{
+    auto compare = to_result_filter(request.filter);
+
+    /*
+     * Build a new state for the subscription so that results which have
+     * since been deleted or filtered out don't linger.
+     */
+    auto& last_state = m_subscriptions[request.subscription];
+    auto next_state = subscription_state{};
+
+    auto reply = reply_tx_flow_updates{
+        std::make_unique<std::vector<tx_flow_update>>()};
+
+    std::for_each(
+        std::begin(m_results),
+        std::end(m_results),
+        [&](const auto& result_pair) {
+            if (!compare(result_pair)) { return; }
+
+            const auto& [result_id, result] = result_pair;
+            const auto& flows = result->flows();
+
+            auto& tracker = next_state[result_id];
+            if (auto found = last_state.find(result_id);
+                found != std::end(last_state)) {
+                tracker = std::move(found->second);
+            }
+            tracker.resize(flows.size());
+
+            for (size_t idx = 0; idx < flows.size(); idx++) {
+                if (!tracker.update(idx, flows[idx].packet)) { continue; }
+
+                reply.updates->emplace_back(
+                    to_update(tx_flow_id(result_id, idx), *result, idx));
+            }
+        });
+
+    last_state = std::move(next_state);
+
+    return (reply);
+}
+
+reply_msg
+server::handle_request(const request_delete_tx_flow_subscription& request)
+{
+    m_subscriptions.erase(request.subscription);
+    return (reply_ok{});
+}
+
 reply_msg server::handle_request(const request_get_learning_results& request)
 {
     auto result = binary_find(std::begin(m_sources),
@@ -7,6 +7,7 @@
 #include "core/op_core.h"
 #include "packet/generator/api.hpp"
 #include "packet/generator/source.hpp"
+#include "packet/statistics/flow_update_tracker.hpp"
 #include "packetio/internal_client.hpp"
 
 namespace openperf::packet::generator::api {
@@ -40,6 +41,8 @@ public:
 
     reply_msg handle_request(const request_list_tx_flows&);
     reply_msg handle_request(const request_get_tx_flow&);
+    reply_msg handle_request(const request_get_tx_flow_updates&);
+    reply_msg handle_request(const request_delete_tx_flow_subscription&);
 
     reply_msg handle_request(const request_get_learning_results&);
     reply_msg handle_request(const request_retry_learning&);
@@ -73,6 +76,18 @@ private:
 
     /* result id --> result */
     result_map m_results;
+
+    /*
+     * Streaming clients only want flows that changed since their last
+     * update, so we track the last reported packet count of every flow
+     * for each subscription.  A result's flows never change, so flow
+     * indexes are stable.
+     */
+    using subscription_state =
+        std::map<core::uuid, packet::statistics::flow_update_tracker>;
+
+    /* subscription id --> result id --> flow tracker */
+    std::map<uint64_t, subscription_state> m_subscriptions;
 };
 
 } // namespace openperf::packet::generator::api
@@ -95,6 +95,46 @@ void source_result::update_drop_counters(uint16_t packets, size_t octets)
     m_dropped.octets += octets;
 }
 
+uint64_t source_result::gap_count() const { return (m_gaps.count); }
+
+std::chrono::nanoseconds source_result::gap_intended() const
+{
+    return (m_gaps.intended);
+}
+
+std::chrono::nanoseconds source_result::gap_average() const
+{
+    return (m_gaps.count ? m_gaps.total / m_gaps.count
+                         : std::chrono::nanoseconds::zero());
+}
+
+std::chrono::nanoseconds source_result::gap_min() const
+{
+    return (m_gaps.count ? m_gaps.min : std::chrono::nanoseconds::zero());
+}
+
+std::chrono::nanoseconds source_result::gap_max() const
+{
+    return (m_gaps.max);
+}
+
+std::chrono::nanoseconds source_result::gap_jitter() const
+{
+    return (m_gaps.count ? m_gaps.error / m_gaps.count
+                         : std::chrono::nanoseconds::zero());
+}
+
+void source_result::update_gap_counters(std::chrono::nanoseconds intended,
+                                        std::chrono::nanoseconds actual)
+{
+    m_gaps.count++;
+    m_gaps.intended = intended;
+    m_gaps.total += actual;
+    m_gaps.min = std::min(m_gaps.min, actual);
+    m_gaps.max = std::max(m_gaps.max, actual);
+    m_gaps.error += actual > intended ? actual - intended : intended - actual;
+}
+
 source_helper make_source_helper(packetio::internal::api::client& client,
                                  std::string_view target_id,
                                  [[maybe_unused]] core::event_loop& loop)
@@ -122,6 +162,7 @@ source::source(source_config&& config,
     , m_tx_limit(
           api::max_transmit_count(*m_config.api_config->getDuration(), m_load))
     , m_helper(make_source_helper(client, config.target, loop))
+    , m_zero_copy(m_config.api_config->isZeroCopy())
 {
     if (auto* maybe_intf_helper = std::get_if<interface_source>(&m_helper);
         maybe_intf_helper != nullptr) {
@@ -138,8 +179,12 @@ source::source(source&& other) noexcept
     , m_helper(other.m_helper)
     , m_tx_idx(other.m_tx_idx)
     , m_results(other.m_results.exchange(nullptr))
+    , m_zero_copy(other.m_zero_copy)
+    , m_templates(std::move(other.m_templates))
 {}
 
+source::~source() { release_templates(); }
+
 source& source::operator=(source&& other) noexcept
 {
     if (this != &other) {
@@ -151,6 +196,8 @@ source& source::operator=(source&& other) noexcept
         m_tx_idx = other.m_tx_idx;
         m_results.store(other.m_results.exchange(nullptr));
         m_helper = other.m_helper;
+        m_zero_copy = other.m_zero_copy;
+        std::swap(m_templates, other.m_templates);
     }
 
     return (*this);
@@ -230,6 +277,8 @@ bool source::uses_feature(packetio::packet::source_feature_flags flags) const
     auto needed = openperf::utils::bit_flags<source_feature_flags>{
         source_feature_flags::packet_checksums};
 
+    if (m_zero_copy) { needed |= source_feature_flags::header_templates; }
+
     if (m_sequence.has_signature_config()) {
         needed |= source_feature_flags::spirent_signature_encode;
 
@@ -263,6 +312,10 @@ void source::start(source_result* results)
 {
     m_tx_idx = 0;
     m_offsets.resize(m_sequence.flow_count()); /* no offsets */
+    if (m_zero_copy) {
+        release_templates();
+        m_templates.resize(m_sequence.flow_count(), nullptr);
+    }
     results->start(m_sequence.flow_count());
     m_results.store(results, std::memory_order_release);
 }
@@ -302,6 +355,9 @@ source_result* source::stop()
         auto lock = flag_lock(m_busy);
 
         results->stop();
+
+        /* Don't hold on to buffers while we're idle */
+        release_templates();
     }
 
     return (results);
@@ -319,6 +375,77 @@ get_header_length(const packetio::packet::header_lengths& hdr_lens)
             + hdr_lens.payload);
 }
 
+void source::release_templates()
+{
+    std::for_each(std::begin(m_templates), std::end(m_templates), [](auto* t) {
+        if (t) { packetio::packet::release(t); }
+    });
+    m_templates.clear();
+}
+
+/* Spirent signatures always occupy the last 20 octets of the frame */
+static constexpr uint16_t signature_length = 20;
+
+/*
+ * Generate an outgoing packet from the flow's header template, creating
+ * the template if necessary. Signature packets get a private tail segment
+ * for the signature; the signature encoder writes it at transmit time.
+ * Returns nullptr if the packet can't use a template, in which case the
+ * caller should copy the header into the buffer as usual.
+ */
+packetio::packet::packet_buffer* source::template_packet(
+    packetio::packet::packet_buffer* buffer,
+    unsigned flow_idx,
+    const uint8_t* hdr_ptr,
+    packetio::packet::header_lengths hdr_lens,
+    packetio::packet::packet_type::flags hdr_flags,
+    const std::optional<traffic::signature_config>& sig_config,
+    uint16_t pkt_len) const
+{
+    /* Payload fills are written per packet, so they need a private copy */
+    if (sig_config
+        && !std::holds_alternative<std::monostate>(sig_config->fill)) {
+        return (nullptr);
+    }
+
+    const auto tail_len = sig_config ? signature_length : 0;
+    const auto hdr_len = get_header_length(hdr_lens);
+    const auto tmpl_len = pkt_len - 4 - tail_len;
+    if (tmpl_len < hdr_len) { return (nullptr); }
+
+    auto& tmpl = m_templates[flow_idx];
+    if (!tmpl) {
+        if (!(tmpl = packetio::packet::allocate(buffer))) { return (nullptr); }
+
+        auto* data = packetio::packet::to_data<uint8_t>(tmpl);
+        utils::memcpy(data, hdr_ptr, hdr_len);
+        packetio::packet::length(tmpl, tmpl_len);
+        traffic::update_packet_header_lengths(
+            hdr_ptr, hdr_lens, hdr_flags, pkt_len - 4, data);
+    }
+
+    /* Flows with varying packet lengths can only use one of them */
+    if (packetio::packet::length(tmpl) != tmpl_len) { return (nullptr); }
+
+    if (!sig_config) {
+        packetio::packet::attach(buffer, tmpl);
+        packetio::packet::tx_offload(buffer, hdr_lens, hdr_flags);
+        return (buffer);
+    }
+
+    auto* head = packetio::packet::clone(tmpl);
+    if (!head) { return (nullptr); }
+
+    packetio::packet::length(buffer, tail_len);
+    if (!packetio::packet::chain(head, buffer)) {
+        packetio::packet::release(head);
+        return (nullptr);
+    }
+
+    packetio::packet::tx_offload(head, hdr_lens, hdr_flags);
+    return (head);
+}
+
 uint16_t source::transform(packetio::packet::packet_buffer* input[],
                            uint16_t input_length,
                            packetio::packet::packet_buffer* output[]) const
@@ -363,6 +490,29 @@ uint16_t source::transform(packetio::packet::packet_buffer* input[],
                              sig_config,
                              pkt_len] = pkt_data;
 
+                auto&& flow_counters = (*results)[flow_idx];
+
+                /* Use the flow's header template instead of copying */
+                if (auto* packet = m_zero_copy ? template_packet(buffer,
+                                                                 flow_idx,
+                                                                 hdr_ptr,
+                                                                 hdr_lens,
+                                                                 hdr_flags,
+                                                                 sig_config,
+                                                                 pkt_len)
+                                               : nullptr) {
+                    if (sig_config) {
+                        packetio::packet::signature(packet,
+                                                    sig_config->stream_id,
+                                                    m_offsets[flow_idx]
+                                                        + flow_counters.packet,
+                                                    sig_config->flags);
+                    }
+
+                    traffic::update(flow_counters, pkt_len, now);
+                    return (packet);
+                }
+
                 /* Copy header into place */
                 const auto hdr_len = get_header_length(hdr_lens);
                 auto* pkt = packetio::packet::to_data<uint8_t>(buffer);
@@ -376,8 +526,6 @@ uint16_t source::transform(packetio::packet::packet_buffer* input[],
                 /* Set packet type for offloads */
                 packetio::packet::tx_offload(buffer, hdr_lens, hdr_flags);
 
-                auto&& flow_counters = (*results)[flow_idx];
-
                 if (sig_config) {
                     /*
                      * Conveniently, the per flow packet counter can be used as
@@ -430,6 +578,14 @@ void source::update_drop_counters(uint16_t packets, size_t octets) const
     }
 }
 
+void source::update_gap_counters(std::chrono::nanoseconds intended,
+                                 std::chrono::nanoseconds actual) const
+{
+    if (auto* results = m_results.load(std::memory_order_relaxed)) {
+        results->update_gap_counters(intended, actual);
+    }
+}
+
 bool source::supports_learning() const
 {
     return (
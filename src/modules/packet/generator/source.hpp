@@ -48,6 +48,17 @@ private:
         uint64_t octets = 0;
     } m_dropped;
 
+    /* Inter-burst gap statistics; only updated by precise schedulers */
+    struct
+    {
+        uint64_t count = 0;
+        std::chrono::nanoseconds intended = std::chrono::nanoseconds::zero();
+        std::chrono::nanoseconds total = std::chrono::nanoseconds::zero();
+        std::chrono::nanoseconds min = std::chrono::nanoseconds::max();
+        std::chrono::nanoseconds max = std::chrono::nanoseconds::zero();
+        std::chrono::nanoseconds error = std::chrono::nanoseconds::zero();
+    } m_gaps;
+
     bool m_active = false;
 
 public:
@@ -70,6 +81,16 @@ public:
     uint64_t dropped_octets() const;
 
     void update_drop_counters(uint16_t packets, size_t octets);
+
+    uint64_t gap_count() const;
+    std::chrono::nanoseconds gap_intended() const;
+    std::chrono::nanoseconds gap_average() const;
+    std::chrono::nanoseconds gap_min() const;
+    std::chrono::nanoseconds gap_max() const;
+    std::chrono::nanoseconds gap_jitter() const;
+
+    void update_gap_counters(std::chrono::nanoseconds intended,
+                             std::chrono::nanoseconds actual);
 };
 
 struct source_load
@@ -89,7 +110,7 @@ public:
     source(source_config&& config,
            packetio::internal::api::client& client,
            core::event_loop& loop);
-    ~source() = default;
+    ~source();
 
     source(source&& other) noexcept;
     source& operator=(source&& other) noexcept;
@@ -126,6 +147,8 @@ public:
                        packetio::packet::packet_buffer* output[]) const;
 
     void update_drop_counters(uint16_t packets, size_t octets) const;
+    void update_gap_counters(std::chrono::nanoseconds intended,
+                             std::chrono::nanoseconds actual) const;
 
     /*
      * Methods related to ARP/ND learning.
@@ -160,6 +183,23 @@ private:
     mutable std::atomic<source_result*> m_results = nullptr;
     mutable std::atomic_flag m_busy = ATOMIC_FLAG_INIT;
 
+    /*
+     * Zero-copy mode: per flow, read-only header templates. Outgoing packets
+     * reference these instead of copying the headers.
+     */
+    bool m_zero_copy = false;
+    mutable std::vector<packetio::packet::packet_buffer*> m_templates;
+
+    packetio::packet::packet_buffer*
+    template_packet(packetio::packet::packet_buffer* buffer,
+                    unsigned flow_idx,
+                    const uint8_t* hdr_ptr,
+                    packetio::packet::header_lengths hdr_lens,
+                    packetio::packet::packet_type::flags hdr_flags,
+                    const std::optional<traffic::signature_config>& sig_config,
+                    uint16_t pkt_len) const;
+    void release_templates();
+
     /* Transform packets in chunks of this size */
     static constexpr size_t chunk_size = 64U;
 
@@ -190,6 +190,14 @@ generator_result_ptr to_swagger(const core::uuid& id,
     flow_counters->setPacketsDropped(result.dropped_packets());
     dst->setFlowCounters(flow_counters);
 
+    if (result.gap_count()) {
+        dst->setTxGapIntended(result.gap_intended().count());
+        dst->setTxGapAverage(result.gap_average().count());
+        dst->setTxGapMin(result.gap_min().count());
+        dst->setTxGapMax(result.gap_max().count());
+        dst->setTxGapJitter(result.gap_jitter().count());
+    }
+
     auto protocol_counters =
         std::make_shared<swagger::v1::model::PacketGeneratorProtocolCounters>();
     packet::statistics::api::populate_counters(result.protocols(),
@@ -236,6 +244,34 @@ tx_flow_ptr to_swagger(const core::uuid& id,
     return (dst);
 }
 
+template <typename Duration> static int64_t to_nanoseconds(Duration d)
+{
+    return (std::chrono::duration_cast<std::chrono::nanoseconds>(d).count());
+}
+
+tx_flow_update
+to_update(const core::uuid& id, const source_result& result, size_t flow_idx)
+{
+    const auto& src = result[flow_idx];
+
+    auto dst = tx_flow_update{};
+    dst.id = id;
+    dst.packet_count = src.packet;
+    dst.octet_count = src.octet;
+    if (src.packet) {
+        dst.timestamp_first = to_nanoseconds(src.first_.time_since_epoch());
+        dst.timestamp_last = to_nanoseconds(src.last_.time_since_epoch());
+    }
+
+    if (auto stream_id =
+            result.parent().sequence().get_signature_stream_id(flow_idx)) {
+        dst.flags |= static_cast<uint32_t>(tx_flow_update_flags::stream_id);
+        dst.stream_id = *stream_id;
+    }
+
+    return (dst);
+}
+
 learning_results_ptr to_swagger(const learning_state_machine& lsm)
 {
     auto dst =
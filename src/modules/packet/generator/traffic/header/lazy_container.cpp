@@ -0,0 +1,241 @@
+#include <optional>
+
+#include "packet/generator/traffic/protocol/all.hpp"
+#include "packet/generator/traffic/header/count.hpp"
+#include "packet/generator/traffic/header/expand.hpp"
+#include "packet/generator/traffic/header/lazy_container.hpp"
+#include "packet/generator/traffic/header/expand_impl/expand.tcc"
+
+namespace openperf::packet::generator::traffic::header {
+
+/*
+ * Generate the divisor for each "digit" of a cartesian index, e.g.
+ * sizes of {2, 3, 4} have a basis of {12, 4, 1}. The last item
+ * increments first, just like ranges::views::cartesian_product and
+ * explode_cartesian. Zipped items all use the index as is.
+ */
+static std::vector<size_t> to_basis(const std::vector<size_t>& sizes,
+                                    modifier_mux mux)
+{
+    auto basis = std::vector<size_t>(sizes.size(), 1);
+    if (mux == modifier_mux::cartesian) {
+        for (auto idx = sizes.size(); idx > 1; idx--) {
+            basis[idx - 2] = basis[idx - 1] * sizes[idx - 1];
+        }
+    }
+
+    return (basis);
+}
+
+static size_t to_size(const std::vector<size_t>& sizes, modifier_mux mux)
+{
+    return (mux == modifier_mux::cartesian
+                ? std::accumulate(std::begin(sizes),
+                                  std::end(sizes),
+                                  1UL,
+                                  std::multiplies<size_t>{})
+                : std::accumulate(std::begin(sizes),
+                                  std::end(sizes),
+                                  1UL,
+                                  std::lcm<size_t, size_t>));
+}
+
+static std::vector<modifier::value> to_values(const modifier::config& config)
+{
+    auto values = std::vector<modifier::value>{};
+    values.reserve(std::visit(config_length_visitor, config));
+
+    std::visit(
+        [&](const auto& mod_config) {
+            for (auto&& value : to_range(mod_config)) {
+                values.emplace_back(value);
+            }
+        },
+        config);
+
+    return (values);
+}
+
+/* A single layer, with patch offsets relative to the start of the layer */
+struct layer_data
+{
+    std::vector<uint8_t> base;
+    size_t size;
+    std::vector<lazy_container::patch> patches;
+};
+
+/*
+ * Set every value on a copy of the header and keep only the bytes, and
+ * bits, that the field actually changes. Returns nothing if no value
+ * differs from the base header.
+ */
+template <typename Header>
+static std::optional<lazy_container::patch>
+make_patch(const Header& header,
+           typename Header::field_name field,
+           const std::vector<modifier::value>& values)
+{
+    constexpr auto length = static_cast<uint16_t>(Header::protocol_length);
+    const auto* base = reinterpret_cast<const uint8_t*>(&header);
+
+    auto rendered = std::vector<uint8_t>(values.size() * length);
+    auto mask = std::vector<uint8_t>(length, 0);
+    for (size_t i = 0; i < values.size(); i++) {
+        auto tmp = Header{header};
+        detail::set_header_field(tmp, field, values[i]);
+
+        auto* dst = rendered.data() + i * length;
+        std::copy_n(reinterpret_cast<const uint8_t*>(&tmp), length, dst);
+        for (auto j = 0U; j < length; j++) { mask[j] |= dst[j] ^ base[j]; }
+    }
+
+    auto is_set = [](uint8_t byte) { return (byte != 0); };
+    auto first = std::find_if(std::begin(mask), std::end(mask), is_set);
+    if (first == std::end(mask)) { return (std::nullopt); }
+    auto last = std::find_if(std::rbegin(mask), std::rend(mask), is_set).base();
+
+    auto offset = static_cast<uint16_t>(std::distance(std::begin(mask), first));
+    auto patch = lazy_container::patch{
+        .offset = offset,
+        .length = static_cast<uint16_t>(std::distance(first, last)),
+        .divisor = 1,
+        .size = values.size(),
+        .mask = std::vector<uint8_t>(first, last)};
+
+    patch.values.reserve(patch.size * patch.length);
+    for (size_t i = 0; i < values.size(); i++) {
+        const auto* src = rendered.data() + i * length + offset;
+        for (auto j = 0U; j < patch.length; j++) {
+            patch.values.push_back(src[j] & patch.mask[j]);
+        }
+    }
+
+    return (patch);
+}
+
+template <typename Header>
+static layer_data make_layer(const config<Header>& config)
+{
+    constexpr auto length = static_cast<uint16_t>(Header::protocol_length);
+    const auto* header = reinterpret_cast<const uint8_t*>(&config.header);
+
+    auto layer = layer_data{std::vector<uint8_t>(header, header + length), 1};
+    if (config.modifiers.empty()) { return (layer); }
+
+    auto fields = std::vector<typename Header::field_name>{};
+    auto values = std::vector<std::vector<modifier::value>>{};
+    auto sizes = std::vector<size_t>{};
+    std::for_each(std::begin(config.modifiers),
+                  std::end(config.modifiers),
+                  [&](const auto& pair) {
+                      fields.push_back(pair.first);
+                      values.push_back(to_values(pair.second));
+                      sizes.push_back(values.back().size());
+                  });
+
+    auto basis = to_basis(sizes, config.mux);
+    layer.size = to_size(sizes, config.mux);
+
+    for (auto i = 0U; i < fields.size(); i++) {
+        if (auto patch = make_patch(config.header, fields[i], values[i])) {
+            patch->divisor = basis[i];
+            layer.patches.push_back(std::move(*patch));
+        }
+    }
+
+    return (layer);
+}
+
+/*
+ * Custom modifiers XOR their values into place and aren't idempotent,
+ * so just expand custom headers ahead of time and store them as a
+ * patch covering the whole layer.
+ */
+static layer_data make_layer(const custom_config& config)
+{
+    auto headers = expand(config);
+    auto length = static_cast<uint16_t>(config.header.data.size());
+
+    auto patch =
+        lazy_container::patch{.offset = 0,
+                              .length = length,
+                              .divisor = 1,
+                              .size = headers.size(),
+                              .mask = std::vector<uint8_t>(length, 0xff)};
+
+    patch.values.reserve(patch.size * length);
+    std::for_each(
+        std::begin(headers), std::end(headers), [&](const auto& pair) {
+            assert(pair.second == length);
+            std::copy_n(pair.first, length, std::back_inserter(patch.values));
+        });
+
+    auto layer = layer_data{std::vector<uint8_t>(length, 0), headers.size()};
+    layer.patches.push_back(std::move(patch));
+
+    return (layer);
+}
+
+lazy_container::lazy_container(const config_container& configs,
+                               modifier_mux mux)
+{
+    auto sizes = std::vector<size_t>{};
+    m_layers.reserve(configs.size());
+    std::for_each(
+        std::begin(configs), std::end(configs), [&](const auto& instance) {
+            auto data = std::visit(
+                [](const auto& config) { return (make_layer(config)); },
+                instance);
+
+            const auto offset = m_base.size();
+            const auto first_patch = m_patches.size();
+            for (auto& patch : data.patches) {
+                patch.offset += offset;
+                m_patches.push_back(std::move(patch));
+            }
+            m_base.insert(
+                std::end(m_base), std::begin(data.base), std::end(data.base));
+
+            m_layers.push_back(layer{.divisor = 1,
+                                     .size = data.size,
+                                     .first_patch = first_patch,
+                                     .last_patch = m_patches.size()});
+            sizes.push_back(data.size);
+        });
+
+    auto basis = to_basis(sizes, mux);
+    for (auto i = 0U; i < m_layers.size(); i++) {
+        m_layers[i].divisor = basis[i];
+    }
+    m_size = to_size(sizes, mux);
+}
+
+size_t lazy_container::size() const { return (m_size); }
+
+uint16_t lazy_container::header_length() const
+{
+    return (static_cast<uint16_t>(m_base.size()));
+}
+
+void lazy_container::render(size_t idx, uint8_t buffer[]) const
+{
+    assert(idx < size());
+
+    std::copy(std::begin(m_base), std::end(m_base), buffer);
+
+    for (const auto& layer : m_layers) {
+        const auto layer_idx = (idx / layer.divisor) % layer.size;
+        for (auto p = layer.first_patch; p < layer.last_patch; p++) {
+            const auto& patch = m_patches[p];
+            const auto* value =
+                patch.values.data()
+                + ((layer_idx / patch.divisor) % patch.size) * patch.length;
+            auto* dst = buffer + patch.offset;
+            for (auto i = 0U; i < patch.length; i++) {
+                dst[i] = (dst[i] & ~patch.mask[i]) | value[i];
+            }
+        }
+    }
+}
+
+} // namespace openperf::packet::generator::traffic::header
@@ -0,0 +1,68 @@
+#ifndef _OP_PACKET_GENERATOR_TRAFFIC_HEADER_LAZY_CONTAINER_HPP_
+#define _OP_PACKET_GENERATOR_TRAFFIC_HEADER_LAZY_CONTAINER_HPP_
+
+#include <vector>
+
+#include "packet/generator/traffic/header/config.hpp"
+
+namespace openperf::packet::generator::traffic::header {
+
+/**
+ * An ordered collection of headers that are generated on demand.
+ *
+ * Instead of expanding and exploding every modifier combination up front,
+ * we store a single base header plus the bytes of every modifier value.
+ * A header is generated by copying the base header and then patching in
+ * the value of each modified field. The value indexes are computed
+ * directly from the header index. Memory use is proportional to the sum
+ * of modifier lengths instead of their product.
+ *
+ * Headers are generated in exactly the same order as the container produced
+ * by make_headers() for the same configuration.
+ */
+class lazy_container
+{
+public:
+    /*
+     * The bytes a modifier writes into the header. Values only contain the
+     * bits set in the mask, so fields that share a byte can be patched
+     * independently.
+     */
+    struct patch
+    {
+        uint16_t offset; /* from the start of the header */
+        uint16_t length;
+        size_t divisor; /* value index = (layer index / divisor) % size */
+        size_t size;
+        std::vector<uint8_t> mask;
+        std::vector<uint8_t> values; /* size * length bytes */
+    };
+
+    struct layer
+    {
+        size_t divisor; /* layer index = (index / divisor) % size */
+        size_t size;
+        size_t first_patch;
+        size_t last_patch;
+    };
+
+    lazy_container(const config_container& configs, modifier_mux mux);
+
+    size_t size() const;
+
+    /* The length of every header in the container */
+    uint16_t header_length() const;
+
+    /* Write the header at idx into buffer; buffer must hold header_length() */
+    void render(size_t idx, uint8_t buffer[]) const;
+
+private:
+    std::vector<uint8_t> m_base;
+    std::vector<layer> m_layers;
+    std::vector<patch> m_patches;
+    size_t m_size;
+};
+
+} // namespace openperf::packet::generator::traffic::header
+
+#endif /* _OP_PACKET_GENERATOR_TRAFFIC_HEADER_LAZY_CONTAINER_HPP_ */
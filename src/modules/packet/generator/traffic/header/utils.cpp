@@ -40,8 +40,8 @@ config_container update_context_fields(config_container&& configs)
     return (std::move(configs));
 }
 
-constexpr auto count_headers_visitor = [](const auto& config) {
-    return (count_headers(config));
+constexpr auto count_headers_visitor = [](const auto& config) -> size_t {
+    return (config.modifiers.empty() ? 1 : count_headers(config));
 };
 
 static size_t count_headers_zip(const config_container& configs) noexcept
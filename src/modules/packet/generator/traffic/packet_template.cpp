@@ -1,5 +1,7 @@
+#include "memory/aligned_allocator.hpp"
 #include "packet/generator/traffic/packet_template.hpp"
 #include "packet/generator/traffic/header/utils.hpp"
+#include "utils/memcpy.hpp"
 
 namespace openperf::packet::generator::traffic {
 
@@ -113,12 +115,66 @@ maybe_set_pseudoheader_checksum(uint8_t header[],
     }
 }
 
+constexpr auto header_length_visitor = [](const auto& config) -> size_t {
+    using header_type = std::decay_t<decltype(config.header)>;
+    if constexpr (std::is_same_v<header_type, protocol::custom>) {
+        return (config.header.data.size());
+    } else {
+        return (header_type::protocol_length);
+    }
+};
+
+static size_t to_header_length(const header::config_container& configs)
+{
+    return (std::accumulate(std::begin(configs),
+                            std::end(configs),
+                            0UL,
+                            [](size_t lhs, const auto& instance) {
+                                return (lhs
+                                        + std::visit(header_length_visitor,
+                                                     instance));
+                            }));
+}
+
+/*
+ * Retrieve the next slot from this thread's ring of render buffers.
+ * Slots are large enough for any lazily generated header.
+ */
+static uint8_t* next_render_slot()
+{
+    constexpr auto slot_size = header::align_up(
+        packet_template::max_lazy_header_length);
+    using slot_vector = std::vector<
+        uint8_t,
+        memory::aligned_allocator<uint8_t, utils::memcpy_alignment()>>;
+
+    static thread_local auto slots =
+        slot_vector(packet_template::render_slot_count * slot_size);
+    static thread_local size_t cursor = 0;
+
+    return (slots.data()
+            + (cursor++ % packet_template::render_slot_count) * slot_size);
+}
+
 packet_template::packet_template(const header::config_container& configs,
-                                 header::modifier_mux mux)
-    : m_headers(header::make_headers(configs, mux))
-    , m_hdr_lens(header::to_packet_header_lengths(configs))
+                                 header::modifier_mux mux,
+                                 size_t max_size)
+    : m_hdr_lens(header::to_packet_header_lengths(configs))
     , m_flags(header::to_packet_type_flags(configs))
 {
+    /*
+     * Note: we need to decide before expanding anything, as generating
+     * modifier values may shuffle permuted modifier lists in place.
+     */
+    const auto hdr_len = to_header_length(configs);
+    const auto count = header::count_headers(configs, mux);
+    if (hdr_len <= max_lazy_header_length
+        && count > max_size / header::align_up(std::max(hdr_len, 1UL))) {
+        m_lazy.emplace(configs, mux);
+        return;
+    }
+
+    m_headers = header::make_headers(configs, mux);
     std::for_each(
         std::begin(m_headers), std::end(m_headers), [&](const auto& pair) {
             maybe_set_pseudoheader_checksum(
@@ -126,6 +182,8 @@ packet_template::packet_template(const header::config_container& configs,
         });
 }
 
+bool packet_template::lazy() const { return (m_lazy.has_value()); }
+
 packetio::packet::header_lengths packet_template::header_lengths() const
 {
     return (m_hdr_lens);
@@ -136,12 +194,22 @@ packetio::packet::packet_type::flags packet_template::header_flags() const
     return (m_flags);
 }
 
-size_t packet_template::size() const { return (m_headers.size()); }
+size_t packet_template::size() const
+{
+    return (m_lazy ? m_lazy->size() : m_headers.size());
+}
 
 packet_template::view_type packet_template::operator[](size_t idx) const
 {
     assert(idx < size());
 
+    if (m_lazy) {
+        auto* header = next_render_slot();
+        m_lazy->render(idx, header);
+        maybe_set_pseudoheader_checksum(header, m_hdr_lens, m_flags);
+        return (header);
+    }
+
     return (m_headers[idx].first);
 }
 
@@ -1,8 +1,11 @@
 #ifndef _OP_PACKET_GENERATOR_TRAFFIC_PACKET_TEMPLATE_HPP_
 #define _OP_PACKET_GENERATOR_TRAFFIC_PACKET_TEMPLATE_HPP_
 
+#include <optional>
+
 #include "packet/generator/traffic/header/container.hpp"
 #include "packet/generator/traffic/header/config.hpp"
+#include "packet/generator/traffic/header/lazy_container.hpp"
 #include "packet/generator/traffic/view_iterator.hpp"
 
 #include "packetio/packet_buffer.hpp"
@@ -12,6 +15,7 @@ namespace openperf::packet::generator::traffic {
 class packet_template
 {
     header::container m_headers;
+    std::optional<header::lazy_container> m_lazy;
     packetio::packet::header_lengths m_hdr_lens;
     packetio::packet::packet_type::flags m_flags;
 
@@ -20,14 +24,35 @@ public:
     using iterator = view_iterator<packet_template>;
     using const_iterator = const iterator;
 
+    /*
+     * Templates that would need more header storage than this are not
+     * expanded up front. Instead, headers are generated on demand from
+     * their index.
+     */
+    static constexpr size_t max_expanded_size = 16 * 1024 * 1024;
+
+    /* Headers longer than this are always expanded */
+    static constexpr size_t max_lazy_header_length = 1024;
+
     packet_template(const header::config_container& configs,
-                    header::modifier_mux mux);
+                    header::modifier_mux mux,
+                    size_t max_size = max_expanded_size);
+
+    /* Indicates that headers are generated on demand */
+    bool lazy() const;
 
     packetio::packet::header_lengths header_lengths() const;
     packetio::packet::packet_type::flags header_flags() const;
 
     size_t size() const;
 
+    /*
+     * Note: lazy templates write headers into a per-thread ring of scratch
+     * buffers, so the returned pointer is only valid until the same thread
+     * has looked up another render_slot_count - 1 headers.
+     */
+    static constexpr size_t render_slot_count = 256;
+
     view_type operator[](size_t idx) const;
 
     iterator begin();
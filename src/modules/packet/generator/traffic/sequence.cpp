@@ -3,188 +3,20 @@
 
 namespace openperf::packet::generator::traffic {
 
-namespace impl {
-
-template <typename Template, template <typename T> class Strategy>
-class sequence_generator
-{
-public:
-    /*
-     * This sequence generator combines multiple weighted packet templates
-     * into a single sequence of packets. The generated output consists of
-     * a sequence of index pairs:
-     * - the first item indicates the packet template
-     * - the second item indicates the index in the packet sequence
-     */
-    using view_type = std::pair<uint16_t, uint16_t>;
-    using iterator = view_iterator<sequence_generator>;
-    using const_iterator = const iterator;
-
-    sequence_generator(const definition_container& definitions)
-    {
-        m_template_sizes.reserve(definitions.size());
-        m_template_scalars.reserve(definitions.size());
-
-        std::transform(std::begin(definitions),
-                       std::end(definitions),
-                       std::back_inserter(m_template_sizes),
-                       [](auto&& item) {
-                           const auto size = std::get<Template>(item).size();
-                           /*
-                            * XXX: this limitation is arbitrary, but done in the
-                            * interest of keeping the generated sequence as
-                            * small as possible.
-                            */
-                           assert(size <= std::numeric_limits<uint16_t>::max());
-                           return (size);
-                       });
-
-        std::transform(std::begin(definitions),
-                       std::end(definitions),
-                       std::back_inserter(m_template_scalars),
-                       [](auto&& item) { return (std::get<2>(item)); });
-    }
-
-    size_t size() const
-    {
-        return (static_cast<const Strategy<Template>&>(*this).get_size());
-    }
-
-    view_type operator[](size_t idx) const
-    {
-        return (static_cast<const Strategy<Template>&>(*this).get_indexes(idx));
-    }
-
-    iterator begin() { return (iterator(*this)); };
-    const_iterator begin() const { return (iterator(*this)); };
-
-    iterator end() { return (iterator(*this, size())); };
-    const_iterator end() const { return (iterator(*this, size())); }
-
-protected:
-    using scalar_container = std::vector<unsigned>;
-    const scalar_container& template_sizes() const
-    {
-        return (m_template_sizes);
-    }
-    const scalar_container& template_scalars() const
-    {
-        return (m_template_scalars);
-    }
-
-private:
-    scalar_container m_template_sizes;
-    scalar_container m_template_scalars;
-};
-
-template <typename Template>
-class round_robin final : public sequence_generator<Template, round_robin>
-{
-    using parent = sequence_generator<Template, round_robin>;
-    typename parent::scalar_container m_weight_sums;
-
-public:
-    round_robin(const definition_container& definitions)
-        : parent::sequence_generator(definitions)
-    {
-        m_weight_sums.reserve(parent::template_scalars().size());
-        std::partial_sum(std::begin(parent::template_scalars()),
-                         std::end(parent::template_scalars()),
-                         std::back_inserter(m_weight_sums));
-    }
-
-    size_t get_size() const
-    {
-        auto lcm = std::accumulate(
-            std::begin(parent::template_sizes()),
-            std::end(parent::template_sizes()),
-            1UL,
-            [](size_t lhs, size_t rhs) { return (std::lcm(lhs, rhs)); });
-
-        return (lcm * m_weight_sums.back());
-    }
-
-    typename parent::view_type get_indexes(size_t idx) const
-    {
-        const auto sum = m_weight_sums.back();
-        auto quot = idx / sum;
-        auto rem = idx % sum;
-
-        auto tmp_idx = std::distance(std::begin(m_weight_sums),
-                                     std::upper_bound(std::begin(m_weight_sums),
-                                                      std::end(m_weight_sums),
-                                                      rem));
-
-        auto offset = quot * sum
-                      + (tmp_idx == 0 ? 0 : m_weight_sums[tmp_idx - 1])
-                      - quot * parent::template_scalars()[tmp_idx];
-
-        assert(static_cast<size_t>(offset) <= idx);
-
-        return {tmp_idx, (idx - offset) % parent::template_sizes()[tmp_idx]};
-    }
-};
-
-template <typename Template>
-class sequential final : public sequence_generator<Template, sequential>
-{
-    using parent = sequence_generator<Template, sequential>;
-    typename parent::scalar_container m_lengths;
-    typename parent::scalar_container m_lengths_sums;
-
-public:
-    sequential(const definition_container& definitions)
-        : parent::sequence_generator(definitions)
-    {
-        m_lengths.reserve(parent::template_scalars().size());
-        m_lengths_sums.reserve(parent::template_scalars().size());
-
-        std::transform(std::begin(parent::template_scalars()),
-                       std::end(parent::template_scalars()),
-                       std::begin(parent::template_sizes()),
-                       std::back_inserter(m_lengths),
-                       [](unsigned lhs, unsigned rhs) { return (lhs * rhs); });
-
-        std::partial_sum(std::begin(m_lengths),
-                         std::end(m_lengths),
-                         std::back_inserter(m_lengths_sums));
-    }
-
-    size_t get_size() const { return (m_lengths_sums.back()); }
-
-    typename parent::view_type get_indexes(size_t idx) const
-    {
-        const auto sum = m_lengths_sums.back();
-        auto quot = idx / sum;
-        auto rem = idx % sum;
-
-        auto tmp_idx = std::distance(
-            std::begin(m_lengths_sums),
-            std::upper_bound(
-                std::begin(m_lengths_sums), std::end(m_lengths_sums), rem));
-
-        auto offset = quot * sum
-                      + (tmp_idx == 0 ? 0 : m_lengths_sums[tmp_idx - 1])
-                      - quot * m_lengths[tmp_idx];
-
-        assert(static_cast<size_t>(offset) <= idx);
-
-        return {tmp_idx, (idx - offset) % parent::template_sizes()[tmp_idx]};
-    }
-};
-
-} // namespace impl
-
-sequence sequence::round_robin_sequence(definition_container&& definitions)
+sequence sequence::round_robin_sequence(definition_container&& definitions,
+                                        size_t max_table_size)
 {
     return (sequence(std::forward<definition_container>(definitions),
-                     order_type::round_robin));
+                     order_type::round_robin,
+                     max_table_size));
 }
 
-sequence sequence::sequential_sequence(definition_container&& definitions)
+sequence sequence::sequential_sequence(definition_container&& definitions,
+                                       size_t max_table_size)
 {
     return (sequence(std::forward<definition_container>(definitions),
-                     order_type::sequential));
+                     order_type::sequential,
+                     max_table_size));
 }
 
 template <typename InputIt1,
@@ -211,7 +43,9 @@ T fancy_inner_product(InputIt1 cursor1,
     return (sum);
 }
 
-sequence::sequence(definition_container&& definitions, order_type order)
+sequence::sequence(definition_container&& definitions,
+                   order_type order,
+                   size_t max_table_size)
 {
     m_definitions.reserve(definitions.size());
     std::transform(
@@ -227,11 +61,30 @@ sequence::sequence(definition_container&& definitions, order_type order)
                    std::end(packet_templates),
                    std::back_inserter(m_flow_offsets),
                    [&](const auto& pt) {
+                       /*
+                        * XXX: this limitation is arbitrary, but done in the
+                        * interest of keeping the index pairs as small as
+                        * possible. Lazy packet templates can easily exceed
+                        * 64k headers, so allow 32 bits.
+                        */
+                       assert(pt.size()
+                              <= std::numeric_limits<uint32_t>::max());
                        auto tmp = offset;
                        offset += pt.size();
                        return (tmp);
                    });
 
+    /*
+     * Keep prefix sums of every length template, so that we can sum
+     * lengths without walking the sequence.
+     */
+    m_length_sums.reserve(definitions.size());
+    for (const auto& lengths : m_definitions.get<1>()) {
+        auto& sums = m_length_sums.emplace_back(1, 0);
+        sums.reserve(lengths.size() + 1);
+        for (auto length : lengths) { sums.push_back(sums.back() + length); }
+    }
+
     /*
      * Both the sequence of packets and size depend on our order type.
      * We consider the length of each definition to be the
@@ -240,12 +93,31 @@ sequence::sequence(definition_container&& definitions, order_type order)
     const auto& length_templates = m_definitions.get<1>();
     const auto& weights = m_definitions.get<2>();
 
+    /*
+     * Every period of the packet sequence contains one run of packets
+     * from each definition.  Round robin runs are weight packets long and
+     * periods repeat until every template has been used; sequential runs
+     * cover the whole template weight times.
+     */
+    m_run_sums.reserve(definitions.size());
+    for (size_t i = 0; i < definitions.size(); i++) {
+        m_run_sums.push_back(
+            (m_run_sums.empty() ? 0 : m_run_sums.back())
+            + weights[i]
+                  * (order == order_type::round_robin
+                         ? 1
+                         : packet_templates[i].size()));
+    }
+
     if (order == order_type::round_robin) {
-        auto rr_packet_gen = impl::round_robin<packet_template>(definitions);
-        m_packet_indexes.reserve(rr_packet_gen.size());
-        std::copy(std::begin(rr_packet_gen),
-                  std::end(rr_packet_gen),
-                  std::back_inserter(m_packet_indexes));
+        auto template_lcm = std::accumulate(
+            std::begin(packet_templates),
+            std::end(packet_templates),
+            1UL,
+            [](size_t lhs, const auto& rhs) {
+                return (std::lcm(lhs, rhs.size()));
+            });
+        m_packet_period = template_lcm * m_run_sums.back();
 
         /*
          * Definitions with weights > 1 might have repeated packets in the
@@ -268,11 +140,7 @@ sequence::sequence(definition_container&& definitions, order_type order)
                  * std::accumulate(std::begin(weights), std::end(weights), 0UL);
 
     } else {
-        auto seq_packet_gen = impl::sequential<packet_template>(definitions);
-        m_packet_indexes.reserve(seq_packet_gen.size());
-        std::copy(std::begin(seq_packet_gen),
-                  std::end(seq_packet_gen),
-                  std::back_inserter(m_packet_indexes));
+        m_packet_period = m_run_sums.back();
 
         /*
          * Sequential generation iterates over each packet template in turn,
@@ -293,18 +161,65 @@ sequence::sequence(definition_container&& definitions, order_type order)
     }
 
     /*
-     * Finally, generate an index sequence for the lengths.
-     * The scratch keeps track of our offset into each definition.
+     * Finally, generate the index tables, if they are small enough.
+     * Otherwise, we compute the indexes for each packet as needed.
      */
-    auto scratch = std::vector<size_t>(definitions.size());
-    m_length_indexes.reserve(m_size);
+    if (m_packet_period + m_size > max_table_size) { return; }
+
+    auto packet_indexes = index_container{};
+    packet_indexes.reserve(m_packet_period);
+    for (size_t i = 0; i < m_packet_period; i++) {
+        packet_indexes.push_back(packet_index(i));
+    }
+
+    auto length_indexes = index_container{};
+    length_indexes.reserve(m_size);
     for (size_t i = 0; i < m_size; i++) {
-        auto pkt_key = m_packet_indexes[i % m_packet_indexes.size()];
-        m_length_indexes.emplace_back(
-            pkt_key.first,
-            scratch[pkt_key.first] % length_templates[pkt_key.first].size());
-        scratch[pkt_key.first]++;
+        length_indexes.push_back(length_index(i));
+    }
+
+    m_packet_indexes = std::move(packet_indexes);
+    m_length_indexes = std::move(length_indexes);
+}
+
+std::pair<uint16_t, size_t> sequence::locate(size_t idx) const
+{
+    const auto sum = m_run_sums.back();
+    auto quot = idx / sum;
+    auto rem = idx % sum;
+
+    auto def_idx = std::distance(
+        std::begin(m_run_sums),
+        std::upper_bound(std::begin(m_run_sums), std::end(m_run_sums), rem));
+    auto run_start = (def_idx == 0 ? 0 : m_run_sums[def_idx - 1]);
+
+    return {def_idx, quot * (m_run_sums[def_idx] - run_start) + rem - run_start};
+}
+
+sequence::index_pair sequence::packet_index(size_t idx) const
+{
+    if (!m_packet_indexes.empty()) {
+        return (m_packet_indexes[idx % m_packet_indexes.size()]);
+    }
+
+    const auto& packet_templates = m_definitions.get<0>();
+    auto [def_idx, count] = locate(idx);
+    return {def_idx, count % packet_templates[def_idx].size()};
+}
+
+/*
+ * Lengths are used in turn each time their definition shows up, and start
+ * over at the beginning of the sequence.
+ */
+sequence::index_pair sequence::length_index(size_t idx) const
+{
+    if (!m_length_indexes.empty()) {
+        return (m_length_indexes[idx % m_length_indexes.size()]);
     }
+
+    const auto& length_templates = m_definitions.get<1>();
+    auto [def_idx, count] = locate(idx % m_size);
+    return {def_idx, count % length_templates[def_idx].size()};
 }
 
 uint16_t sequence::max_packet_length() const
@@ -318,88 +233,98 @@ uint16_t sequence::max_packet_length() const
                             }));
 }
 
-template <typename InputIt, typename Size, typename T, typename BinaryOp>
-T ring_accumulate_n(
-    InputIt first, InputIt last, InputIt cursor, Size n, T sum, BinaryOp&& op)
+size_t sequence::definition_packets(uint16_t def_idx, size_t idx) const
 {
-    auto idx = 0U;
-    while (idx++ < n) {
-        sum = op(std::move(sum), *cursor++);
-        if (cursor == last) { cursor = first; };
-    }
+    const auto sum = m_run_sums.back();
+    const auto run_start = (def_idx == 0 ? 0 : m_run_sums[def_idx - 1]);
+    const auto run_length = m_run_sums[def_idx] - run_start;
+    const auto rem = idx % sum;
 
-    return (sum);
+    return ((idx / sum) * run_length
+            + (rem > run_start ? std::min(rem - run_start, run_length) : 0));
 }
 
-size_t sequence::sum_packet_lengths() const
+/*
+ * Lengths are used in turn, so every full pass over the length template
+ * adds the sum of all of its lengths.
+ */
+size_t sequence::sum_definition_lengths(uint16_t def_idx, size_t count) const
 {
-    const auto& length_templates = m_definitions.get<1>();
+    const auto& sums = m_length_sums[def_idx];
+    const auto nb_lengths = sums.size() - 1;
 
-    return (ring_accumulate_n(
-        std::begin(m_packet_indexes),
-        std::end(m_packet_indexes),
-        std::begin(m_packet_indexes),
-        size(),
-        0UL,
-        [&](auto&& lhs, const auto& rhs) {
-            auto len_idx = rhs.second % length_templates[rhs.first].size();
-            return (lhs + length_templates[rhs.first][len_idx]);
-        }));
+    return ((count / nb_lengths) * sums.back() + sums[count % nb_lengths]);
 }
 
-size_t sequence::sum_packet_lengths(size_t idx) const
+/*
+ * Only every nth packet of a definition uses a given template index, where
+ * n is the template size. Those packets cycle through the lengths
+ * congruent to the template index modulo gcd(n, # lengths), and that cycle
+ * repeats every lcm(n, # lengths) packets.
+ */
+size_t sequence::sum_definition_lengths(uint16_t def_idx,
+                                        uint32_t pkt_idx,
+                                        size_t count) const
 {
-    const auto& length_templates = m_definitions.get<1>();
-    auto q = lldiv(idx, m_packet_indexes.size());
-
-    auto sum =
-        std::accumulate(std::begin(m_packet_indexes),
-                        std::begin(m_packet_indexes) + q.rem,
-                        0UL,
-                        [&](size_t lhs, const auto& rhs) {
-                            auto len_idx =
-                                rhs.second % length_templates[rhs.first].size();
-                            return (lhs + length_templates[rhs.first][len_idx]);
-                        });
+    const auto& lengths = m_definitions.get<1>()[def_idx];
+    const auto nb_packets = m_definitions.get<0>()[def_idx].size();
+    const auto nb_lengths = lengths.size();
+    const auto gcd = std::gcd(nb_packets, nb_lengths);
+    const auto period = nb_packets / gcd * nb_lengths;
+
+    auto period_sum = 0UL;
+    for (auto i = pkt_idx % gcd; i < nb_lengths; i += gcd) {
+        period_sum += lengths[i];
+    }
 
-    if (q.quot) { sum += q.quot * sum_packet_lengths(); }
+    auto sum = (count / period) * period_sum;
+    for (auto i = (count / period) * period + pkt_idx; i < count;
+         i += nb_packets) {
+        sum += lengths[i % nb_lengths];
+    }
 
     return (sum);
 }
 
-template <typename InputIt, typename T, typename FilterOp, typename BinaryOp>
-T filter_accumulate(
-    InputIt cursor, InputIt last, T total, FilterOp&& filter, BinaryOp&& op)
+size_t sequence::sum_packet_lengths() const
 {
-    while (cursor != last) {
-        if (filter(*cursor)) { total = op(std::move(total), *cursor); }
-        ++cursor;
+    auto sum = 0UL;
+    for (uint16_t i = 0; i < m_length_sums.size(); i++) {
+        sum += sum_definition_lengths(i, definition_packets(i, size()));
     }
 
-    return (total);
+    return (sum);
+}
+
+size_t sequence::sum_packet_lengths(size_t idx) const
+{
+    auto q = lldiv(idx, size());
+
+    auto sum = 0UL;
+    for (uint16_t i = 0; i < m_length_sums.size(); i++) {
+        sum += sum_definition_lengths(i, definition_packets(i, q.rem));
+    }
+
+    if (q.quot) { sum += q.quot * sum_packet_lengths(); }
+
+    return (sum);
 }
 
 size_t sequence::sum_flow_packet_lengths(unsigned flow_idx) const
 {
-    return (filter_accumulate(
-        std::begin(*this),
-        std::end(*this),
-        0UL,
-        [&](auto&& tuple) { return (std::get<0>(tuple) == flow_idx); },
-        [](size_t sum, auto&& tuple) { return (sum += std::get<5>(tuple)); }));
+    auto [def_idx, pkt_idx] = locate_flow(flow_idx);
+    return (sum_definition_lengths(
+        def_idx, pkt_idx, definition_packets(def_idx, size())));
 }
 
 size_t sequence::sum_flow_packet_lengths(unsigned flow_idx,
                                          size_t pkt_idx) const
 {
-    auto q = lldiv(pkt_idx, m_packet_indexes.size());
+    auto [def_idx, tmp_idx] = locate_flow(flow_idx);
+    auto q = lldiv(pkt_idx, size());
 
-    auto sum = filter_accumulate(
-        std::begin(*this),
-        std::next(std::begin(*this), q.rem),
-        0UL,
-        [&](auto&& tuple) { return (std::get<0>(tuple) == flow_idx); },
-        [](size_t sum, auto&& tuple) { return (sum += std::get<5>(tuple)); });
+    auto sum = sum_definition_lengths(
+        def_idx, tmp_idx, definition_packets(def_idx, q.rem));
 
     if (q.quot) { sum += q.quot * sum_flow_packet_lengths(flow_idx); }
 
@@ -431,8 +356,7 @@ inline uint32_t to_stream_id(uint16_t stream_id, uint16_t flow_id)
     return (stream_id << 16 | flow_id + 1);
 }
 
-std::optional<uint32_t>
-sequence::get_signature_stream_id(unsigned flow_idx) const
+sequence::index_pair sequence::locate_flow(unsigned flow_idx) const
 {
     /*
      * Find the definition index for this flow index. Use
@@ -444,14 +368,22 @@ sequence::get_signature_stream_id(unsigned flow_idx) const
     assert(cursor != std::end(m_flow_offsets));
     auto def_idx = std::distance(std::begin(m_flow_offsets), cursor);
 
+    assert(flow_idx >= m_flow_offsets[def_idx]);
+
+    return {static_cast<uint16_t>(def_idx),
+            static_cast<uint32_t>(flow_idx - m_flow_offsets[def_idx])};
+}
+
+std::optional<uint32_t>
+sequence::get_signature_stream_id(unsigned flow_idx) const
+{
+    auto [def_idx, pkt_idx] = locate_flow(flow_idx);
+
     const auto& signature_configs = m_definitions.get<3>();
     auto sig_config = signature_configs[def_idx];
     if (!sig_config) { return (std::nullopt); }
 
-    assert(flow_idx >= m_flow_offsets[def_idx]);
-
-    return (to_stream_id(sig_config->stream_id,
-                         flow_idx - m_flow_offsets[def_idx]));
+    return (to_stream_id(sig_config->stream_id, pkt_idx));
 }
 
 size_t sequence::flow_count() const
@@ -466,10 +398,13 @@ size_t sequence::flow_count() const
 
 size_t sequence::flow_packets(unsigned flow_idx) const
 {
-    return (
-        std::count_if(std::begin(*this), std::end(*this), [&](auto&& tuple) {
-            return (std::get<0>(tuple) == flow_idx);
-        }));
+    const auto& packet_templates = m_definitions.get<0>();
+    auto [def_idx, pkt_idx] = locate_flow(flow_idx);
+    auto count = definition_packets(def_idx, size());
+
+    return (count > pkt_idx
+                ? (count - pkt_idx - 1) / packet_templates[def_idx].size() + 1
+                : 0);
 }
 
 size_t sequence::size() const { return (m_size); }
@@ -601,6 +536,19 @@ uint16_t sequence::unpack(size_t start_idx,
                           std::optional<signature_config> signature_configs[],
                           uint16_t pkt_lengths[]) const
 {
+    /* Without index tables, just generate each packet view in turn */
+    if (m_packet_indexes.empty()) {
+        for (uint16_t i = 0; i < count; i++) {
+            std::tie(flow_indexes[i],
+                     headers[i],
+                     header_lengths[i],
+                     header_flags[i],
+                     signature_configs[i],
+                     pkt_lengths[i]) = (*this)[start_idx + i];
+        }
+        return (count);
+    }
+
     auto pkt_offset = start_idx % m_packet_indexes.size();
     const auto& packet_templates = m_definitions.get<0>();
     const auto& sig_configs = m_definitions.get<3>();
@@ -644,8 +592,8 @@ sequence::view_type sequence::operator[](size_t idx) const
     const auto& sig_configs = m_definitions.get<3>();
     const auto& length_templates = m_definitions.get<1>();
 
-    auto pkt_key = m_packet_indexes[idx % m_packet_indexes.size()];
-    auto len_key = m_length_indexes[idx % m_length_indexes.size()];
+    auto pkt_key = packet_index(idx);
+    auto len_key = length_index(idx);
 
     return (std::make_tuple(m_flow_offsets[pkt_key.first] + pkt_key.second,
                             packet_templates[pkt_key.first][pkt_key.second],
@@ -36,9 +36,21 @@ public:
     static constexpr size_t signature = 4;
     static constexpr size_t packet_length = 5;
 
+    /*
+     * Sequences keep a table of template and length indexes for every
+     * packet, unless the tables would need more than this many entries.
+     * Larger sequences compute the indexes for each packet instead, so
+     * their memory use doesn't depend on the number of flows.
+     */
+    static constexpr size_t max_index_table_size = 1024 * 1024;
+
     /* Named constructors to simplify instantiation. */
-    static sequence round_robin_sequence(definition_container&& definitions);
-    static sequence sequential_sequence(definition_container&& definitions);
+    static sequence
+    round_robin_sequence(definition_container&& definitions,
+                         size_t max_table_size = max_index_table_size);
+    static sequence
+    sequential_sequence(definition_container&& definitions,
+                        size_t max_table_size = max_index_table_size);
 
     uint16_t max_packet_length() const;
 
@@ -101,19 +113,42 @@ public:
 
 protected:
     enum class order_type { round_robin, sequential };
-    sequence(definition_container&& definitions, order_type order);
+    sequence(definition_container&& definitions,
+             order_type order,
+             size_t max_table_size);
 
 private:
     using soa_definition_container =
         utils::soa_container<std::vector, definition>;
     soa_definition_container m_definitions;
 
-    using index_pair = std::pair<uint16_t, uint16_t>;
+    using index_pair = std::pair<uint16_t, uint32_t>;
     using index_container = std::vector<index_pair>;
 
-    index_container m_packet_indexes;
-    index_container m_length_indexes;
+    /* Definition index and the number of its packets before idx */
+    std::pair<uint16_t, size_t> locate(size_t idx) const;
+
+    /* Definition index and template index of a flow */
+    index_pair locate_flow(unsigned flow_idx) const;
+
+    /* The number of packets from a definition in [0, idx) */
+    size_t definition_packets(uint16_t def_idx, size_t idx) const;
+
+    /* Sums of lengths used in turn, for all or only some template indexes */
+    size_t sum_definition_lengths(uint16_t def_idx, size_t count) const;
+    size_t sum_definition_lengths(uint16_t def_idx,
+                                  uint32_t pkt_idx,
+                                  size_t count) const;
+
+    index_pair packet_index(size_t idx) const;
+    index_pair length_index(size_t idx) const;
+
+    index_container m_packet_indexes; /* empty if computed */
+    index_container m_length_indexes; /* empty if computed */
     std::vector<size_t> m_flow_offsets;
+    std::vector<std::vector<size_t>> m_length_sums; /* prefix sums */
+    std::vector<size_t> m_run_sums; /* packets per definition and period */
+    size_t m_packet_period;
     size_t m_size;
 };
 
@@ -0,0 +1,40 @@
+#ifndef _OP_PACKET_GENERATOR_TX_FLOW_STREAM_HPP_
+#define _OP_PACKET_GENERATOR_TX_FLOW_STREAM_HPP_
+
+#include "api/api_flow_stream.hpp"
+#include "core/op_core.h"
+#include "packet/generator/api.hpp"
+
+namespace openperf::packet::generator::api {
+
+/**
+ * Produces the frames of a binary tx flow stream.  Each frame is a
+ * tx_flow_update_frame_header followed by the records of every flow that
+ * sent packets since the previous frame.  The first frame contains every
+ * flow.
+ *
+ * The producer uses its own socket to query the generator server, so that
+ * streams don't block the REST handler.
+ */
+class tx_flow_stream final : public openperf::api::flow_stream::producer
+{
+public:
+    tx_flow_stream(void* context, filter_map_type filter);
+
+    bool next_frame(std::vector<iovec>& frame) override;
+    void finish() override;
+
+private:
+    uint64_t subscription() const;
+
+    void* m_context;
+    std::unique_ptr<void, op_socket_deleter> m_socket;
+    filter_map_type m_filter;
+
+    tx_flow_update_frame_header m_header;
+    tx_flow_updates_ptr m_updates;
+};
+
+} // namespace openperf::packet::generator::api
+
+#endif /* _OP_PACKET_GENERATOR_TX_FLOW_STREAM_HPP_ */
@@ -13,6 +13,7 @@
 
 #include "lwip/tcp.h"
 #include "lwip/priv/tcp_priv.h"
+#include "packet/stack/dpdk/pbuf_chain.hpp"
 #include "packet/stack/dpdk/pbuf_utils.h"
 #include "packet/stack/dpdk/net_interface.hpp"
 #include "packet/stack/lwip/gso_utils.h"
@@ -130,20 +131,55 @@ pbuf_drop_at(struct pbuf* p_head, uint16_t offset, uint16_t length)
     return (std::make_tuple(p_head, pbufs_freed));
 }
 
+/*
+ * Split a chain of referenced data at the given offset.  We can't write
+ * headers in front of referenced data, so the returned chain always starts
+ * with a new, empty, pbuf with enough headroom for the requested layer.
+ */
+static std::tuple<pbuf*, uint16_t>
+pbuf_split_reference_at(pbuf* p_head,
+                        pbuf* split_pbuf,
+                        pbuf* split_prev,
+                        uint16_t split_offset,
+                        pbuf_layer layer)
+{
+    auto head = pbuf_alloc(layer, 0, PBUF_RAM);
+    if (!head) return (std::make_tuple(nullptr, 0));
+
+    pbuf* tail = nullptr;
+    if (split_offset) {
+        tail = pbuf_alloc_reference(
+            reinterpret_cast<uint8_t*>(split_pbuf->payload) + split_offset,
+            split_pbuf->len - split_offset,
+            (split_pbuf->type_internal & PBUF_TYPE_FLAG_DATA_VOLATILE
+                 ? PBUF_REF
+                 : PBUF_ROM));
+        if (!tail) {
+            pbuf_free(head);
+            return (std::make_tuple(nullptr, 0));
+        }
+    }
+
+    split_reference_chain(
+        p_head, split_prev, split_pbuf, split_offset, head, tail);
+
+    return (std::make_tuple(head, tail ? 2 : 1));
+}
+
 /*
  * Split the specified pbuf chain at the given offset.
  * Returns the a pbuf that contains the chain after the split value
- * and whether a new pbuf was allocated or not.
+ * and the number of new pbufs allocated to do so.
  * The returned pbuf is guaranteed to have enough headroom for the requested
  * layer.
  */
-static std::tuple<pbuf*, bool>
+static std::tuple<pbuf*, uint16_t>
 pbuf_split_at(struct pbuf* p_head, uint16_t split, pbuf_layer layer)
 {
     LWIP_ERROR("(p_head != NULL) && (split < p_head->tot_len) (programmer "
                "violates API)",
                ((p_head != nullptr) && (split < p_head->tot_len)),
-               return (std::make_tuple(nullptr, false)););
+               return (std::make_tuple(nullptr, 0)););
 
     for (struct pbuf* p = p_head; p != nullptr; p = p->next)
         LWIP_ASSERT(
@@ -152,11 +188,11 @@ pbuf_split_at(struct pbuf* p_head, uint16_t split, pbuf_layer layer)
 
     if (split == 0 || split >= p_head->tot_len) {
         /* easy case; nothing to split */
-        return (std::make_tuple(nullptr, false));
+        return (std::make_tuple(nullptr, 0));
     }
 
     pbuf* to_return = nullptr;
-    bool new_pbuf = false;
+    uint16_t new_pbufs = 0;
     uint16_t split_offset = 0;
     struct pbuf* split_prev = nullptr;
     struct pbuf* split_pbuf =
@@ -166,7 +202,14 @@ pbuf_split_at(struct pbuf* p_head, uint16_t split, pbuf_layer layer)
     LWIP_ASSERT("offset != 0 or prev != 0)",
                 split_offset != 0 || split_prev != nullptr);
 
-    if (split_offset == 0) {
+    if (packet_stack_pbuf_is_reference(split_pbuf)) {
+        auto [head, nb_pbufs] = pbuf_split_reference_at(
+            p_head, split_pbuf, split_prev, split_offset, layer);
+        if (!head) return (std::make_tuple(nullptr, 0));
+
+        to_return = head;
+        new_pbufs = nb_pbufs;
+    } else if (split_offset == 0) {
         /* Nice!  We split on a pbuf boundary */
         LWIP_ASSERT("split pbuf header too small",
                     layer <= packet_stack_pbuf_header_available(split_pbuf));
@@ -185,7 +228,7 @@ pbuf_split_at(struct pbuf* p_head, uint16_t split, pbuf_layer layer)
             layer,
             split_pbuf->len - split_offset,
             (pbuf_match_type(split_pbuf, PBUF_RAM) ? PBUF_RAM : PBUF_POOL));
-        if (!next_pbuf) return (std::make_tuple(nullptr, false));
+        if (!next_pbuf) return (std::make_tuple(nullptr, 0));
 
         LWIP_ASSERT("split pbuf header too small",
                     layer <= packet_stack_pbuf_header_available(next_pbuf));
@@ -212,12 +255,12 @@ pbuf_split_at(struct pbuf* p_head, uint16_t split, pbuf_layer layer)
         }
 
         to_return = next_pbuf;
-        new_pbuf = true;
+        new_pbufs = 1;
     }
 
     to_return->flags = p_head->flags;
 
-    return (std::make_tuple(to_return, new_pbuf));
+    return (std::make_tuple(to_return, new_pbufs));
 }
 
 } // namespace openperf::packet::stack::dpdk::gso
@@ -420,10 +463,10 @@ int packet_stack_gso_segment_split(struct tcp_pcb* pcb,
         lwip_htonl(lwip_ntohl(seg->tcphdr->seqno) + seg->len);
 
     /*
-     * If we allocated a new pbuf to split the chain, we need to update the
+     * If we allocated new pbufs to split the chain, we need to update the
      * queue length.
      */
-    if (pbuf_incr) pcb->snd_queuelen++;
+    pcb->snd_queuelen += pbuf_incr;
 
     return ERR_OK;
 }
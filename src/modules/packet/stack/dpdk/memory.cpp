@@ -1,6 +1,7 @@
 #include <array>
 #include <algorithm>
 #include <string>
+#include <unistd.h>
 
 #include "lwip/memp.h"
 
@@ -129,6 +130,75 @@ int64_t packet_stack_memp_pool_used(const struct memp_desc* mem)
     return (total_used);
 }
 
+static void dma_unmap_devices(void* addr, size_t len)
+{
+    uint16_t port_id = 0;
+    RTE_ETH_FOREACH_DEV(port_id)
+    {
+        auto info = rte_eth_dev_info{};
+        if (rte_eth_dev_info_get(port_id, &info) != 0 || !info.device) {
+            continue;
+        }
+        rte_dev_dma_unmap(
+            info.device, addr, reinterpret_cast<uintptr_t>(addr), len);
+    }
+}
+
+bool packet_stack_memory_register(void* addr, size_t len)
+{
+    /*
+     * We don't have physical addresses for external memory, so devices
+     * must be able to DMA from our virtual addresses.
+     */
+    if (rte_eal_iova_mode() != RTE_IOVA_VA) {
+        OP_LOG(OP_LOG_INFO,
+               "Cannot transmit directly from %p; IOVA mode is not VA\n",
+               addr);
+        return (false);
+    }
+
+    if (rte_extmem_register(addr, len, nullptr, 0, sysconf(_SC_PAGESIZE)) != 0
+        && rte_errno != EEXIST) {
+        OP_LOG(OP_LOG_WARNING,
+               "Could not register external memory at %p: %s\n",
+               addr,
+               rte_strerror(rte_errno));
+        return (false);
+    }
+
+    /* Devices that don't need DMA mappings, e.g. virtual ones, are fine */
+    uint16_t port_id = 0;
+    RTE_ETH_FOREACH_DEV(port_id)
+    {
+        auto info = rte_eth_dev_info{};
+        if (rte_eth_dev_info_get(port_id, &info) != 0 || !info.device) {
+            continue;
+        }
+        if (rte_dev_dma_map(
+                info.device, addr, reinterpret_cast<uintptr_t>(addr), len)
+                != 0
+            && rte_errno != ENOTSUP) {
+            OP_LOG(OP_LOG_WARNING,
+                   "Could not map external memory at %p for DMA on port "
+                   "%u: %s\n",
+                   addr,
+                   port_id,
+                   rte_strerror(rte_errno));
+            dma_unmap_devices(addr, len);
+            rte_extmem_unregister(addr, len);
+            return (false);
+        }
+    }
+
+    return (true);
+}
+
+void packet_stack_memory_unregister(void* addr, size_t len)
+{
+    dma_unmap_devices(addr, len);
+    rte_extmem_unregister(addr, len);
+}
+
 struct pbuf* packet_stack_pbuf_alloc()
 {
     auto socket_id = rte_socket_id();
@@ -0,0 +1,56 @@
+#ifndef _OP_PACKET_STACK_DPDK_PBUF_CHAIN_HPP_
+#define _OP_PACKET_STACK_DPDK_PBUF_CHAIN_HPP_
+
+#include <cassert>
+#include <cstdint>
+
+namespace openperf::packet::stack::dpdk::gso {
+
+/**
+ * Split a chain of pbufs at a point inside referenced data, i.e. data we
+ * can't write headers in front of. Everything after the split point moves
+ * behind head, a new and empty pbuf with room for headers.
+ *
+ * If the split point is inside split_pbuf, then tail must be a new pbuf
+ * that references the rest of split_pbuf's data; it takes split_pbuf's
+ * place in the new chain. Otherwise, tail must be null and the chain is
+ * split on the boundary between split_prev and split_pbuf.
+ *
+ * Only pointers and lengths change. The new chain takes over every
+ * original pbuf after the split point, so no pbuf is in both chains and
+ * no reference counts need adjusting.
+ */
+template <typename Pbuf>
+void split_reference_chain(Pbuf* p_head,
+                           Pbuf* split_prev,
+                           Pbuf* split_pbuf,
+                           uint16_t split_offset,
+                           Pbuf* head,
+                           Pbuf* tail)
+{
+    assert((split_offset == 0) == (tail == nullptr));
+    assert(split_offset != 0 || split_prev != nullptr);
+
+    if (tail) {
+        tail->flags = split_pbuf->flags;
+        tail->next = split_pbuf->next;
+        if (tail->next) tail->tot_len += tail->next->tot_len;
+
+        split_pbuf->len = split_offset;
+        split_pbuf->next = nullptr;
+    } else {
+        split_prev->next = nullptr;
+        tail = split_pbuf;
+    }
+
+    head->next = tail;
+    head->tot_len = head->len + tail->tot_len;
+
+    for (auto p = p_head; p != nullptr; p = p->next) {
+        p->tot_len -= tail->tot_len;
+    }
+}
+
+} // namespace openperf::packet::stack::dpdk::gso
+
+#endif /* _OP_PACKET_STACK_DPDK_PBUF_CHAIN_HPP_ */
@@ -91,12 +91,56 @@ static uint16_t pbuf_actual_clen(const struct pbuf* p)
     return (count);
 }
 
+bool packet_stack_pbuf_is_reference(const struct pbuf* p)
+{
+    return (pbuf_match_allocsrc(p, PBUF_TYPE_ALLOC_SRC_MASK_STD_MEMP_PBUF));
+}
+
+static void pbuf_extbuf_free(void* addr __attribute__((unused)),
+                             void* opaque __attribute__((unused)))
+{
+    /* The referenced memory belongs to someone else; nothing to do */
+}
+
+/*
+ * PBUF_ROM/PBUF_REF pbufs point at memory outside of their mbuf, e.g. a
+ * socket's transmit buffer.  Attach that memory to the mbuf as an external
+ * buffer so that the NIC can transmit directly from it.  The mbuf's own,
+ * otherwise unused, data room holds the external buffer's shared info.
+ * Since the stack can adjust the payload of these pbufs at any time, we
+ * update the buffer address on every synchronization.
+ */
+static int mbuf_attach_reference(struct rte_mbuf* m, const struct pbuf* p)
+{
+    rte_iova_t iova = rte_mem_virt2iova(p->payload);
+    if (iova == RTE_BAD_IOVA) { return (-1); }
+
+    if (!RTE_MBUF_HAS_EXTBUF(m)) {
+        struct rte_mbuf_ext_shared_info* shinfo =
+            RTE_PTR_ALIGN_CEIL(m->buf_addr, sizeof(uintptr_t));
+        shinfo->free_cb = pbuf_extbuf_free;
+        shinfo->fcb_opaque = NULL;
+        rte_mbuf_ext_refcnt_set(shinfo, 1);
+        rte_pktmbuf_attach_extbuf(m, p->payload, iova, p->len, shinfo);
+    }
+
+    m->buf_addr = p->payload;
+    m->buf_iova = iova;
+    m->buf_len = p->len;
+
+    return (0);
+}
+
 struct rte_mbuf* packet_stack_mbuf_synchronize(struct pbuf* p_head)
 {
     struct pbuf* p = p_head;
     uint16_t nb_segs = pbuf_actual_clen(p);
     do {
         struct rte_mbuf* m = packet_stack_pbuf_to_mbuf(p);
+        if (packet_stack_pbuf_is_reference(p)
+            && mbuf_attach_reference(m, p) != 0) {
+            return (NULL);
+        }
         m->data_off = (uintptr_t)(p->payload) - (uintptr_t)(m->buf_addr);
         m->next =
             (pbuf_has_next(p) ? packet_stack_pbuf_to_mbuf(p->next) : NULL);
@@ -112,6 +156,9 @@ struct rte_mbuf* packet_stack_mbuf_synchronize(struct pbuf* p_head)
 
 uint16_t packet_stack_pbuf_data_available(const struct pbuf* p)
 {
+    /* Referenced data belongs to someone else; we can't write to it */
+    if (packet_stack_pbuf_is_reference(p)) { return (0); }
+
     struct rte_mbuf* m = packet_stack_pbuf_to_mbuf(p);
     uint16_t headroom = packet_stack_pbuf_header_available(p);
     return (m->buf_len > headroom ? m->buf_len - headroom : 0);
@@ -119,6 +166,8 @@ uint16_t packet_stack_pbuf_data_available(const struct pbuf* p)
 
 uint16_t packet_stack_pbuf_header_available(const struct pbuf* p)
 {
+    if (packet_stack_pbuf_is_reference(p)) { return (0); }
+
     struct rte_mbuf* m = packet_stack_pbuf_to_mbuf(p);
     uint16_t payload_offset =
         (uintptr_t)(p->payload) - (uintptr_t)(m->buf_addr);
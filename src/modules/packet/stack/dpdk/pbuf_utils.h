@@ -1,6 +1,9 @@
 #ifndef _OP_PACKET_STACK_DPDK_PBUF_UTILS_H_
 #define _OP_PACKET_STACK_DPDK_PBUF_UTILS_H_
 
+#include <stdbool.h>
+#include <stdint.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -16,6 +19,9 @@ struct rte_mbuf* packet_stack_pbuf_to_mbuf(const struct pbuf*);
 struct pbuf* packet_stack_pbuf_synchronize(struct rte_mbuf*);
 struct rte_mbuf* packet_stack_mbuf_synchronize(struct pbuf*);
 
+/* Check if the pbuf references memory outside of its mbuf */
+bool packet_stack_pbuf_is_reference(const struct pbuf*);
+
 /* Report the amount of space after/before the payload pointer, respectively */
 uint16_t packet_stack_pbuf_data_available(const struct pbuf*);
 uint16_t packet_stack_pbuf_header_available(const struct pbuf*);
@@ -68,10 +68,12 @@
 
 /*
  * The "extra args" value allows one to put extra data into the TCP PCB.
- * We use it here to keep track of the actual re-transmission count, as
+ * We use the first to keep track of the actual re-transmission count, as
  * iperf conveniently queries and displays it while tests are running.
+ * The second lets a closed zero copy socket's transmit buffer outlive
+ * the socket until the PCB is done with it.
  */
-#define LWIP_TCP_PCB_NUM_EXT_ARGS 1
+#define LWIP_TCP_PCB_NUM_EXT_ARGS 2
 
 /*
  * Pick a send {queue, buffer} length that minimizes internal processing.
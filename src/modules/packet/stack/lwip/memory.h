@@ -1,6 +1,7 @@
 #ifndef _OP_PACKET_STACK_LWIP_MEMORY_H_
 #define _OP_PACKET_STACK_LWIP_MEMORY_H_
 
+#include <stdbool.h>
 #include <stdint.h>
 #include <stddef.h>
 
@@ -17,6 +18,13 @@ int64_t packet_stack_memp_pool_avail(const struct memp_desc*);
 int64_t packet_stack_memp_pool_max(const struct memp_desc*);
 int64_t packet_stack_memp_pool_used(const struct memp_desc*);
 
+/*
+ * Make external memory usable as PBUF_ROM/PBUF_REF payload for transmitted
+ * packets.  Returns false if our devices can't transmit from it.
+ */
+bool packet_stack_memory_register(void* addr, size_t len);
+void packet_stack_memory_unregister(void* addr, size_t len);
+
 struct pbuf;
 struct pbuf* packet_stack_pbuf_alloc();
 void packet_stack_pbuf_free(struct pbuf*);
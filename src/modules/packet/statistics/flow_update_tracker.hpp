@@ -0,0 +1,46 @@
+#ifndef _OP_PACKET_STATISTICS_FLOW_UPDATE_TRACKER_HPP_
+#define _OP_PACKET_STATISTICS_FLOW_UPDATE_TRACKER_HPP_
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace openperf::packet::statistics {
+
+/**
+ * Tracks the last reported packet count of every flow in a result, so
+ * that streaming clients only get the flows that changed since their
+ * previous update.  Flows are identified by their index, so indexes must
+ * be stable for as long as the tracker is in use.  Updating all flows is a
+ * single linear pass over one counter per flow.
+ */
+class flow_update_tracker
+{
+public:
+    /* Make room for the given number of flows */
+    void resize(size_t nb_flows) { m_counts.resize(nb_flows, unreported); }
+
+    /*
+     * Record the current count of a flow.  Returns true if the count
+     * differs from the previous update, which is always the case for the
+     * first update of a flow.
+     */
+    bool update(size_t idx, uint64_t count)
+    {
+        if (m_counts[idx] == count) { return (false); }
+
+        m_counts[idx] = count;
+        return (true);
+    }
+
+    size_t size() const { return (m_counts.size()); }
+
+private:
+    static constexpr auto unreported = std::numeric_limits<uint64_t>::max();
+
+    std::vector<uint64_t> m_counts;
+};
+
+} // namespace openperf::packet::statistics
+
+#endif /* _OP_PACKET_STATISTICS_FLOW_UPDATE_TRACKER_HPP_ */
@@ -227,4 +227,34 @@ bool dpdk_drop_tx_overruns()
     return (do_tx_drop);
 }
 
+bool dpdk_tx_precise_pacing()
+{
+    static const auto precise_pacing =
+        config::file::op_config_get_param<OP_OPTION_TYPE_NONE>(
+            op_packetio_dpdk_tx_precise_pacing)
+            .value_or(false);
+
+    return (precise_pacing);
+}
+
+std::chrono::microseconds dpdk_worker_spin_period()
+{
+    static const auto spin_period =
+        config::file::op_config_get_param<OP_OPTION_TYPE_LONG>(
+            op_packetio_dpdk_worker_spin_period)
+            .value_or(0);
+
+    return (std::chrono::microseconds(std::max(spin_period, 0L)));
+}
+
+std::chrono::milliseconds dpdk_rx_queue_rebalance_period()
+{
+    static const auto rebalance_period =
+        config::file::op_config_get_param<OP_OPTION_TYPE_LONG>(
+            op_packetio_dpdk_rx_queue_rebalance_period)
+            .value_or(0);
+
+    return (std::chrono::milliseconds(std::max(rebalance_period, 0L)));
+}
+
 } /* namespace openperf::packetio::dpdk::config */
@@ -2,6 +2,7 @@
 #define _OP_PACKETIO_DPDK_ARG_PARSER_HPP_
 
 #include <algorithm>
+#include <chrono>
 #include <map>
 #include <optional>
 #include <string>
@@ -18,6 +19,9 @@ extern const char op_packetio_dpdk_ports_required[];
 extern const char op_packetio_dpdk_rx_worker_mask[];
 extern const char op_packetio_dpdk_tx_worker_mask[];
 extern const char op_packetio_dpdk_drop_tx_overruns[];
+extern const char op_packetio_dpdk_tx_precise_pacing[];
+extern const char op_packetio_dpdk_worker_spin_period[];
+extern const char op_packetio_dpdk_rx_queue_rebalance_period[];
 
 namespace openperf::packetio::dpdk::config {
 
@@ -64,6 +68,10 @@ inline void add_dpdk_argument(std::vector<std::string>& args,
 bool dpdk_disable_lro();
 bool dpdk_disable_rx_irq();
 bool dpdk_drop_tx_overruns();
+bool dpdk_tx_precise_pacing();
+std::chrono::microseconds dpdk_worker_spin_period(); /**< 0 == disabled */
+std::chrono::milliseconds
+dpdk_rx_queue_rebalance_period(); /**< 0 == disabled */
 
 } /* namespace openperf::packetio::dpdk::config */
 
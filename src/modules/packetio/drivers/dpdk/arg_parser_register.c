@@ -14,6 +14,12 @@ const char op_packetio_dpdk_tx_worker_mask[] =
     "modules.packetio.dpdk.tx-worker-mask";
 const char op_packetio_dpdk_drop_tx_overruns[] =
     "modules.packetio.dpdk.drop-tx-overruns";
+const char op_packetio_dpdk_tx_precise_pacing[] =
+    "modules.packetio.dpdk.tx-precise-pacing";
+const char op_packetio_dpdk_worker_spin_period[] =
+    "modules.packetio.dpdk.worker-spin-period";
+const char op_packetio_dpdk_rx_queue_rebalance_period[] =
+    "modules.packetio.dpdk.rx-queue-rebalance-period";
 
 MAKE_OPTION_DATA(
     dpdk,
@@ -54,6 +60,20 @@ MAKE_OPTION_DATA(
     MAKE_OPT("drop packets if the transmit queue is overrun",
              op_packetio_dpdk_drop_tx_overruns,
              0,
-             OP_OPTION_TYPE_NONE), );
+             OP_OPTION_TYPE_NONE),
+    MAKE_OPT("pace transmit traffic with busy-polled TSC deadlines",
+             op_packetio_dpdk_tx_precise_pacing,
+             0,
+             OP_OPTION_TYPE_NONE),
+    MAKE_OPT("enables adaptive polling; workers busy poll for the specified "
+             "number of microseconds after traffic stops before waiting",
+             op_packetio_dpdk_worker_spin_period,
+             0,
+             OP_OPTION_TYPE_LONG),
+    MAKE_OPT("enables receive queue rebalancing; workers exchange queues "
+             "based on their load every specified number of milliseconds",
+             op_packetio_dpdk_rx_queue_rebalance_period,
+             0,
+             OP_OPTION_TYPE_LONG), );
 
 REGISTER_CLI_OPTIONS(dpdk)
@@ -15,6 +15,7 @@ PIO_DRIVER_SOURCES += \
 	port/packet_type_decoder.cpp \
 	port/prbs_error_detector.cpp \
 	port/rss_hasher.cpp \
+	port/rx_pipeline.cpp \
 	port/signature_decoder.cpp \
 	port/signature_encoder.cpp \
 	port/signature_payload_filler.cpp \
@@ -21,6 +21,7 @@
 #include "rte_log.h"
 #include "rte_debug.h"
 #include "rte_cycles.h"
+#include "rte_cpuflags.h"
 #include "rte_memory.h"
 #include "rte_memcpy.h"
 #include "rte_memzone.h"
@@ -51,6 +52,7 @@
 #include "rte_flow_driver.h"
 #include "rte_net.h"
 #include "rte_thash.h"
+#include "rte_power_intrinsics.h"
 
 #ifdef __cplusplus
 namespace openperf::packetio::dpdk {
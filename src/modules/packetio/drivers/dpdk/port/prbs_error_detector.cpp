@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <cassert>
 #include <numeric>
 
@@ -6,18 +7,14 @@
 #include "packetio/drivers/dpdk/port/prbs_error_detector.hpp"
 #include "packetio/drivers/dpdk/port/signature_utils.hpp"
 #include "spirent_pga/api.h"
-#include "utils/prefetch_for_each.hpp"
-#include "utils/soa_container.hpp"
 
 namespace openperf::packetio::dpdk::port {
 
-template <typename T> using chunk_array = std::array<T, utils::chunk_size>;
-
 static unsigned mbuf_segment_count(const rte_mbuf* m) { return (m->nb_segs); }
 
-static uint16_t packet_count_for_segment_limit(rte_mbuf* const packets[],
-                                               uint16_t nb_packets,
-                                               uint16_t segment_limit)
+uint16_t packet_count_for_segment_limit(rte_mbuf* const packets[],
+                                        uint16_t nb_packets,
+                                        uint16_t segment_limit)
 {
     auto total_segs = 0U;
     auto cursor =
@@ -38,11 +35,10 @@ static bool has_prbs_payload(const rte_mbuf* m)
                    == pga_signature_prbs::enable);
 }
 
-static uint16_t get_payload_offset(const rte_mbuf* m)
+uint16_t get_prbs_payload_offset(const rte_mbuf* m,
+                                 uint32_t ptype,
+                                 const rte_net_hdr_lens& hdr_lens)
 {
-    auto hdr_lens = rte_net_hdr_lens{};
-    const auto ptype = rte_net_get_ptype(m, &hdr_lens, RTE_PTYPE_ALL_MASK);
-
     if (ptype & RTE_PTYPE_L2_ETHER_MPLS) {
         /*
          * XXX: DPDK's get_type function doesn't parse MPLS packets, so pick
@@ -78,126 +74,83 @@ static uint16_t get_payload_length(const rte_mbuf* m, uint16_t payload_offset)
                           - utils::signature_length);
 }
 
-static uint16_t detect_prbs_errors([[maybe_unused]] uint16_t port_id,
-                                   uint16_t queue_id,
-                                   rte_mbuf* packets[],
-                                   uint16_t nb_packets,
-                                   [[maybe_unused]] uint16_t max_packets,
-                                   void* user_param)
+void detect_prbs_errors(prbs_scratch& scratch,
+                        rte_mbuf* packets[],
+                        const uint16_t payload_offsets[],
+                        uint16_t nb_packets)
 {
-    auto& scratch = reinterpret_cast<callback_prbs_error_detector::scratch_t*>(
-        user_param)[queue_id];
-
-    auto start = 0U;
-    while (start < nb_packets) {
-        auto end = start
-                   + packet_count_for_segment_limit(
-                       packets + start, nb_packets - start, utils::chunk_size);
-
-        /*
-         * Copy all of the packets we need to check into a consecutive block.
-         * Since we parse headers to determine offsets, pre-fetch the header
-         * data as we go so that we minimize cache stalls.
-         */
-        auto nb_prbs_pkts = 0U;
-        openperf::utils::prefetch_for_each(
-            packets + start,
-            packets + end,
-            [](const auto* mbuf) {
-                rte_prefetch0(rte_pktmbuf_mtod(mbuf, void*));
-            },
-            [&](auto* mbuf) {
-                if (!has_prbs_payload(mbuf)) { return; }
-                const auto offset = get_payload_offset(mbuf);
-                if (rte_pktmbuf_pkt_len(mbuf)
-                    <= offset + utils::signature_length) {
-                    return;
-                }
-                scratch.packets.set(nb_prbs_pkts++, {mbuf, offset});
-            },
-            mbuf_prefetch_offset);
-
-        /* Find all of the payload data in the PRBS packets we found. */
-        auto nb_prbs_segs = 0U;
-        std::for_each(
-            std::begin(scratch.packets),
-            std::next(std::begin(scratch.packets), nb_prbs_pkts),
-            [&](const auto& item) {
-                const auto* mbuf = std::get<0>(item);
-                const auto offset = std::get<1>(item);
+    /* Copy all of the packets we need to check into a consecutive block. */
+    auto nb_prbs_pkts = 0U;
+    for (auto i = 0U; i < nb_packets; i++) {
+        auto* mbuf = packets[i];
+        if (!has_prbs_payload(mbuf)) { continue; }
+        const auto offset = payload_offsets[i];
+        if (rte_pktmbuf_pkt_len(mbuf) <= offset + utils::signature_length) {
+            continue;
+        }
+        scratch.packets.set(nb_prbs_pkts++, {mbuf, offset});
+    }
 
+    if (!nb_prbs_pkts) { return; }
+
+    /* Find all of the payload data in the PRBS packets we found. */
+    auto nb_prbs_segs = 0U;
+    std::for_each(
+        std::begin(scratch.packets),
+        std::next(std::begin(scratch.packets), nb_prbs_pkts),
+        [&](const auto& item) {
+            const auto* mbuf = std::get<0>(item);
+            const auto offset = std::get<1>(item);
+
+            scratch.segments.set(
+                nb_prbs_segs++,
+                {rte_pktmbuf_mtod_offset(mbuf, const uint8_t*, offset),
+                 get_payload_length(mbuf, offset),
+                 0});
+
+            /*
+             * If there are any subsequent segments, they shouldn't
+             * have any offsets to worry about.
+             */
+            while (mbuf->next != nullptr) {
+                mbuf = mbuf->next;
                 scratch.segments.set(
                     nb_prbs_segs++,
-                    {rte_pktmbuf_mtod_offset(mbuf, const uint8_t*, offset),
-                     get_payload_length(mbuf, offset),
+                    {rte_pktmbuf_mtod(mbuf, const uint8_t*),
+                     get_payload_length(mbuf),
                      0});
+            }
+        });
 
-                /*
-                 * If there are any subsequent segments, they shouldn't
-                 * have any offsets to worry about.
-                 */
-                while (mbuf->next != nullptr) {
-                    mbuf = mbuf->next;
-                    scratch.segments.set(
-                        nb_prbs_segs++,
-                        {rte_pktmbuf_mtod(mbuf, const uint8_t*),
-                         get_payload_length(mbuf),
-                         0});
-                }
-            });
-
-        /* Now check the prbs data */
-        pga_verify_prbs(scratch.segments.data<0>(),
-                        scratch.segments.data<1>(),
-                        nb_prbs_segs,
-                        scratch.segments.data<2>());
-
-        /* And update the packet metadata. */
-        auto seg_idx = 0U;
-        const auto& lengths = scratch.segments.data<1>();
-        const auto& errors = scratch.segments.data<2>();
-        std::for_each(
-            scratch.packets.data<0>(),
-            scratch.packets.data<0>() + nb_prbs_pkts,
-            [&](auto* mbuf) {
-                auto nb_segments = mbuf_segment_count(mbuf);
-                auto bit_errors = std::accumulate(
-                    &errors[seg_idx], &errors[seg_idx] + nb_segments, 0U);
-                auto octets = std::accumulate(
-                    &lengths[seg_idx], &lengths[seg_idx] + nb_segments, 0U);
-                mbuf_rx_prbs_set(mbuf, octets, bit_errors);
-                seg_idx += nb_segments;
-            });
-
-        start = end;
-    }
-
-    return (nb_packets);
-}
-
-std::string callback_prbs_error_detector::description()
-{
-    return ("Spirent PRBS error detecting");
-}
-
-rx_callback<callback_prbs_error_detector>::rx_callback_fn
-callback_prbs_error_detector::callback()
-{
-    return (detect_prbs_errors);
-}
-
-void* callback_prbs_error_detector::callback_arg() const
-{
-    if (scratch.size() != port_info::rx_queue_count(port_id())) {
-        scratch.resize(port_info::rx_queue_count(port_id()));
-    }
-    return (scratch.data());
+    /* Now check the prbs data */
+    pga_verify_prbs(scratch.segments.data<0>(),
+                    scratch.segments.data<1>(),
+                    nb_prbs_segs,
+                    scratch.segments.data<2>());
+
+    /* And update the packet metadata. */
+    auto seg_idx = 0U;
+    const auto& lengths = scratch.segments.data<1>();
+    const auto& errors = scratch.segments.data<2>();
+    std::for_each(
+        scratch.packets.data<0>(),
+        scratch.packets.data<0>() + nb_prbs_pkts,
+        [&](auto* mbuf) {
+            auto nb_segments = mbuf_segment_count(mbuf);
+            auto bit_errors = std::accumulate(
+                &errors[seg_idx], &errors[seg_idx] + nb_segments, 0U);
+            auto octets = std::accumulate(
+                &lengths[seg_idx], &lengths[seg_idx] + nb_segments, 0U);
+            mbuf_rx_prbs_set(mbuf, octets, bit_errors);
+            seg_idx += nb_segments;
+        });
 }
 
 static prbs_error_detector::variant_type
 make_prbs_error_detector(uint16_t port_id)
 {
-    return (callback_prbs_error_detector(port_id));
+    return (
+        rx_pipeline_feature<rx_pipeline_stage::prbs_error_detect>(port_id));
 }
 
 prbs_error_detector::prbs_error_detector(uint16_t port_id)
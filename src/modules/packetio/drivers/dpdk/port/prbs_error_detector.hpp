@@ -1,44 +1,43 @@
 #ifndef _OP_PACKETIO_DPDK_PORT_PRBS_ERROR_DETECTOR_HPP_
 #define _OP_PACKETIO_DPDK_PORT_PRBS_ERROR_DETECTOR_HPP_
 
-#include "packetio/drivers/dpdk/port/callback.hpp"
 #include "packetio/drivers/dpdk/port/feature_toggle.hpp"
+#include "packetio/drivers/dpdk/port/rx_pipeline.hpp"
 #include "packetio/drivers/dpdk/port/signature_utils.hpp"
-#include "utils/soa_container.hpp"
 
 namespace openperf::packetio::dpdk::port {
 
-struct callback_prbs_error_detector
-    : public rx_callback<callback_prbs_error_detector>
-{
-    using parent_type = rx_callback<callback_prbs_error_detector>;
-
-    using parent_type::rx_callback;
-    static std::string description();
-    static parent_type::rx_callback_fn callback();
-    void* callback_arg() const;
-
-    using prbs_packets =
-        openperf::utils::soa_container<utils::chunk_array,
-                                       std::tuple<rte_mbuf*, uint16_t>>;
-
-    using prbs_segments = openperf::utils::soa_container<
-        utils::chunk_array,
-        std::tuple<const uint8_t*, uint16_t, uint32_t>>;
-
-    struct alignas(RTE_CACHE_LINE_SIZE) scratch_t
-    {
-        prbs_packets packets;
-        prbs_segments segments;
-    };
-
-    mutable std::vector<scratch_t> scratch;
-};
+/**
+ * Return the number of packets, starting from the first, that have no more
+ * than segment_limit segments in total.
+ */
+uint16_t packet_count_for_segment_limit(rte_mbuf* const packets[],
+                                        uint16_t nb_packets,
+                                        uint16_t segment_limit);
+
+/**
+ * Find the offset of the payload from the headers found by
+ * rte_net_get_ptype.  Headers must be parsed with RTE_PTYPE_ALL_MASK.
+ */
+uint16_t get_prbs_payload_offset(const rte_mbuf* mbuf,
+                                 uint32_t ptype,
+                                 const rte_net_hdr_lens& hdr_lens);
+
+/**
+ * Check the PRBS payloads of a chunk of packets and write the results to
+ * the packet metadata.  Packets must already have decoded signatures and
+ * the chunk must contain no more than utils::chunk_size segments.
+ */
+void detect_prbs_errors(prbs_scratch& scratch,
+                        rte_mbuf* packets[],
+                        const uint16_t payload_offsets[],
+                        uint16_t nb_packets);
 
 struct prbs_error_detector
-    : feature_toggle<prbs_error_detector,
-                     callback_prbs_error_detector,
-                     null_feature>
+    : feature_toggle<
+          prbs_error_detector,
+          rx_pipeline_feature<rx_pipeline_stage::prbs_error_detect>,
+          null_feature>
 {
     variant_type feature;
     prbs_error_detector(uint16_t port_id);
@@ -1,12 +1,9 @@
 #include "packetio/drivers/dpdk/dpdk.h"
 #include "packetio/drivers/dpdk/port/rss_hasher.hpp"
-#include "utils/prefetch_for_each.hpp"
+#include "packetio/drivers/dpdk/port_info.hpp"
 
 namespace openperf::packetio::dpdk::port {
 
-constexpr uint32_t decode_mask =
-    RTE_PTYPE_L2_MASK | RTE_PTYPE_L3_MASK | RTE_PTYPE_L4_MASK;
-
 /*
  * Compiler machinations to get the best software RSS hasher
  */
@@ -136,42 +133,21 @@ static uint32_t calculate_ipv6_hash(const rte_mbuf* mbuf,
     }
 }
 
-static uint16_t hash_headers([[maybe_unused]] uint16_t port_id,
-                             [[maybe_unused]] uint16_t queue_id,
-                             rte_mbuf* packets[],
-                             uint16_t nb_packets,
-                             [[maybe_unused]] uint16_t max_packets,
-                             [[maybe_unused]] void* user_param)
-{
-    utils::prefetch_for_each(
-        packets,
-        packets + nb_packets,
-        [](const auto* mbuf) { rte_prefetch0(rte_pktmbuf_mtod(mbuf, void*)); },
-        [](auto* mbuf) {
-            auto hdr_lens = rte_net_hdr_lens{};
-            const auto ptype = rte_net_get_ptype(mbuf, &hdr_lens, decode_mask);
-            if (RTE_ETH_IS_IPV4_HDR(ptype)) {
-                mbuf->hash.rss = calculate_ipv4_hash(mbuf, hdr_lens, ptype);
-            } else if (RTE_ETH_IS_IPV6_HDR(ptype)) {
-                mbuf->hash.rss = calculate_ipv6_hash(mbuf, hdr_lens, ptype);
-            }
-        },
-        mbuf_prefetch_offset);
-
-    return (nb_packets);
-}
-
-std::string callback_rss_hasher::description() { return ("RSS hashing"); }
-
-rx_callback<callback_rss_hasher>::rx_callback_fn callback_rss_hasher::callback()
+void set_rss_hash(rte_mbuf* mbuf,
+                  const rte_net_hdr_lens& hdr_lens,
+                  uint32_t ptype)
 {
-    return (hash_headers);
+    if (RTE_ETH_IS_IPV4_HDR(ptype)) {
+        mbuf->hash.rss = calculate_ipv4_hash(mbuf, hdr_lens, ptype);
+    } else if (RTE_ETH_IS_IPV6_HDR(ptype)) {
+        mbuf->hash.rss = calculate_ipv6_hash(mbuf, hdr_lens, ptype);
+    }
 }
 
 static rss_hasher::variant_type make_rss_hasher(uint16_t port_id)
 {
     if (port_info::rss_offloads(port_id) == 0) {
-        return (callback_rss_hasher(port_id));
+        return (rx_pipeline_feature<rx_pipeline_stage::rss_hash>(port_id));
     }
 
     return (null_feature(port_id));
@@ -1,20 +1,23 @@
 #ifndef _OP_PACKETIO_DPDK_PORT_RSS_HASHER_HPP_
 #define _OP_PACKETIO_DPDK_PORT_RSS_HASHER_HPP_
 
-#include "packetio/drivers/dpdk/port/callback.hpp"
 #include "packetio/drivers/dpdk/port/feature_toggle.hpp"
+#include "packetio/drivers/dpdk/port/rx_pipeline.hpp"
 
 namespace openperf::packetio::dpdk::port {
 
-struct callback_rss_hasher final : public rx_callback<callback_rss_hasher>
-{
-    using rx_callback<callback_rss_hasher>::rx_callback;
-    static std::string description();
-    static rx_callback<callback_rss_hasher>::rx_callback_fn callback();
-};
+/**
+ * Set the mbuf's RSS hash from the headers found by rte_net_get_ptype.
+ * Non-IP packets are left alone.
+ */
+void set_rss_hash(rte_mbuf* mbuf,
+                  const rte_net_hdr_lens& hdr_lens,
+                  uint32_t ptype);
 
 struct rss_hasher
-    : feature_toggle<rss_hasher, callback_rss_hasher, null_feature>
+    : feature_toggle<rss_hasher,
+                     rx_pipeline_feature<rx_pipeline_stage::rss_hash>,
+                     null_feature>
 {
     variant_type feature;
     rss_hasher(uint16_t port_id);
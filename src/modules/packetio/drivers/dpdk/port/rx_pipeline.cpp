@@ -0,0 +1,276 @@
+#include <array>
+#include <map>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+
+#include "core/op_log.h"
+#include "packetio/drivers/dpdk/dpdk.h"
+#include "packetio/drivers/dpdk/port_info.hpp"
+#include "packetio/drivers/dpdk/port/packet_type_decoder.hpp"
+#include "packetio/drivers/dpdk/port/prbs_error_detector.hpp"
+#include "packetio/drivers/dpdk/port/rss_hasher.hpp"
+#include "packetio/drivers/dpdk/port/rx_pipeline.hpp"
+#include "packetio/drivers/dpdk/port/signature_decoder.hpp"
+#include "packetio/drivers/dpdk/port/timestamper.hpp"
+#include "utils/prefetch_for_each.hpp"
+
+namespace openperf::packetio::dpdk::port {
+
+template <unsigned Stages> constexpr bool has_stage(rx_pipeline_stage stage)
+{
+    return (Stages & static_cast<unsigned>(stage));
+}
+
+/*
+ * Generate all of the metadata required by Stages for a burst of packets.
+ * Every packet's headers are parsed at most once, and its signature is
+ * read at most once, no matter how many stages need them.  Signature
+ * decoding and PRBS checking are done in chunks, after the per packet
+ * pass, so that they can use the batch functions from the pga library.
+ */
+template <unsigned Stages>
+static uint16_t run_pipeline(uint16_t port_id,
+                             uint16_t queue_id,
+                             rte_mbuf* packets[],
+                             uint16_t nb_packets,
+                             rx_pipeline::context& ctx)
+{
+    constexpr auto timestamp = has_stage<Stages>(rx_pipeline_stage::timestamp);
+    constexpr auto packet_type =
+        has_stage<Stages>(rx_pipeline_stage::packet_type_decode);
+    constexpr auto rss_hash = has_stage<Stages>(rx_pipeline_stage::rss_hash);
+    constexpr auto signature =
+        has_stage<Stages>(rx_pipeline_stage::signature_decode);
+    constexpr auto prbs =
+        has_stage<Stages>(rx_pipeline_stage::prbs_error_detect);
+
+    /* PRBS payload offsets require parsing tunnels and inner headers, too */
+    constexpr auto parse_headers = packet_type || rss_hash || prbs;
+    constexpr auto parse_mask =
+        prbs ? RTE_PTYPE_ALL_MASK : packet_type_decode_mask;
+
+    if constexpr (Stages == 0) { return (nb_packets); }
+
+    [[maybe_unused]] auto& scratch = ctx.scratch[queue_id];
+
+    [[maybe_unused]] auto timestamper = std::optional<burst_timestamper>{};
+    if constexpr (timestamp) { timestamper.emplace(port_id); }
+
+    [[maybe_unused]] auto sig_offset = utils::phxtime{0};
+    if constexpr (signature) {
+        sig_offset = get_signature_timestamp_offset(ctx.epoch_offset);
+    }
+
+    auto start = 0U;
+    while (start < nb_packets) {
+        auto end = start
+                   + (prbs ? packet_count_for_segment_limit(packets + start,
+                                                            nb_packets - start,
+                                                            utils::chunk_size)
+                           : std::min(utils::chunk_size, nb_packets - start));
+        auto* chunk = packets + start;
+        auto count = end - start;
+
+        openperf::utils::prefetch_enumerate_for_each(
+            chunk,
+            chunk + count,
+            [](const auto* mbuf) {
+                rte_prefetch0(rte_pktmbuf_mtod(mbuf, void*));
+            },
+            [&](auto idx, auto* mbuf) {
+                if constexpr (timestamp) { (*timestamper)(mbuf); }
+
+                if constexpr (parse_headers) {
+                    auto hdr_lens = rte_net_hdr_lens{};
+                    const auto ptype =
+                        rte_net_get_ptype(mbuf, &hdr_lens, parse_mask);
+                    if constexpr (packet_type) {
+                        mbuf->packet_type = ptype & packet_type_decode_mask;
+                    }
+                    if constexpr (rss_hash) {
+                        set_rss_hash(mbuf, hdr_lens, ptype);
+                    }
+                    if constexpr (prbs) {
+                        scratch.payload_offsets[idx] =
+                            get_prbs_payload_offset(mbuf, ptype, hdr_lens);
+                    }
+                }
+
+                /*
+                 * The Spirent signature should start 20 bytes before the
+                 * end of the packet, so find it while the packet is hot.
+                 */
+                if constexpr (signature) {
+                    auto& payloads = scratch.signatures.payloads;
+                    const auto offset =
+                        rte_pktmbuf_pkt_len(mbuf) - utils::signature_length;
+                    payloads.data<0>()[idx] =
+                        static_cast<const uint8_t*>(rte_pktmbuf_read(
+                            mbuf,
+                            offset,
+                            utils::signature_length,
+                            payloads.data<1>()[idx]));
+                }
+            },
+            mbuf_prefetch_offset);
+
+        if constexpr (signature) {
+            decode_signatures(scratch.signatures, chunk, count, sig_offset);
+        }
+
+        if constexpr (prbs) {
+            detect_prbs_errors(
+                scratch.prbs, chunk, scratch.payload_offsets.data(), count);
+        }
+
+        start = end;
+    }
+
+    return (nb_packets);
+}
+
+using pipeline_fn = uint16_t (*)(uint16_t port_id,
+                                 uint16_t queue_id,
+                                 rte_mbuf* packets[],
+                                 uint16_t nb_packets,
+                                 rx_pipeline::context& ctx);
+
+template <size_t... I>
+constexpr auto make_pipeline_functions(std::index_sequence<I...>)
+{
+    return (std::array<pipeline_fn, sizeof...(I)>{&run_pipeline<I>...});
+}
+
+/* Every combination of stages gets its own specialized function */
+static constexpr auto pipeline_functions = make_pipeline_functions(
+    std::make_index_sequence<rx_pipeline_stage_max>{});
+
+static uint16_t run_rx_pipeline(uint16_t port_id,
+                                uint16_t queue_id,
+                                rte_mbuf* packets[],
+                                uint16_t nb_packets,
+                                [[maybe_unused]] uint16_t max_packets,
+                                void* user_param)
+{
+    auto& ctx = *reinterpret_cast<rx_pipeline::context*>(user_param);
+    const auto stages = ctx.stages.load(std::memory_order_acquire);
+    return (pipeline_functions[stages.value](
+        port_id, queue_id, packets, nb_packets, ctx));
+}
+
+std::string to_string(rx_pipeline_stage stage)
+{
+    switch (stage) {
+    case rx_pipeline_stage::timestamp:
+        return ("timestamping");
+    case rx_pipeline_stage::packet_type_decode:
+        return ("packet type decoding");
+    case rx_pipeline_stage::rss_hash:
+        return ("RSS hashing");
+    case rx_pipeline_stage::signature_decode:
+        return ("Spirent signature decoding");
+    case rx_pipeline_stage::prbs_error_detect:
+        return ("Spirent PRBS error detecting");
+    default:
+        return ("unknown");
+    }
+}
+
+rx_pipeline& rx_pipeline::get(uint16_t port_id)
+{
+    static std::map<uint16_t, std::unique_ptr<rx_pipeline>> pipelines;
+
+    auto item = pipelines.find(port_id);
+    if (item == std::end(pipelines)) {
+        auto pipeline = std::unique_ptr<rx_pipeline>(new rx_pipeline(port_id));
+        item = pipelines.emplace(port_id, std::move(pipeline)).first;
+    }
+
+    return (*item->second);
+}
+
+rx_pipeline::rx_pipeline(uint16_t port_id)
+    : m_port(port_id)
+    , m_context(std::make_unique<context>())
+{
+    m_context->stages.store(stage_flags{0}, std::memory_order_relaxed);
+}
+
+rx_pipeline::~rx_pipeline()
+{
+    if (!m_callbacks.empty()) { uninstall(); }
+}
+
+uint16_t rx_pipeline::port_id() const { return (m_port); }
+
+rx_pipeline::stage_flags rx_pipeline::stages() const
+{
+    return (m_context->stages.load(std::memory_order_relaxed));
+}
+
+void rx_pipeline::enable(rx_pipeline_stage stage)
+{
+    const auto current = stages();
+    if (current & stage) { return; }
+
+    OP_LOG(OP_LOG_INFO,
+           "Enabling software %s on port %u\n",
+           to_string(stage).c_str(),
+           m_port);
+
+    /* Install the callback before it can see the new stages */
+    if (m_callbacks.empty()) { install(); }
+    m_context->stages.store(current | stage, std::memory_order_release);
+}
+
+void rx_pipeline::disable(rx_pipeline_stage stage)
+{
+    const auto current = stages();
+    if (!(current & stage)) { return; }
+
+    OP_LOG(OP_LOG_INFO,
+           "Disabling software %s on port %u\n",
+           to_string(stage).c_str(),
+           m_port);
+
+    const auto next = stage_flags{current & ~stage};
+    m_context->stages.store(next, std::memory_order_release);
+    if (!next) { uninstall(); }
+}
+
+void rx_pipeline::install()
+{
+    const auto q_count = port_info::rx_queue_count(m_port);
+
+    /*
+     * Callbacks removed from a queue might still be running, so only
+     * reallocate scratch space when we have to.
+     */
+    if (m_context->scratch.size() != q_count) {
+        m_context->scratch.resize(q_count);
+    }
+    m_context->epoch_offset = utils::get_timestamp_epoch_offset();
+
+    for (uint16_t q = 0; q < q_count; q++) {
+        auto cb = rte_eth_add_rx_callback(
+            m_port, q, run_rx_pipeline, m_context.get());
+        if (!cb) {
+            throw std::runtime_error(
+                "Could not add receive pipeline callback to port "
+                + std::to_string(m_port) + ", queue " + std::to_string(q));
+        }
+        m_callbacks.push_back(cb);
+    }
+}
+
+void rx_pipeline::uninstall()
+{
+    for (uint16_t q = 0; q < m_callbacks.size(); q++) {
+        rte_eth_remove_rx_callback(m_port, q, m_callbacks[q]);
+    }
+
+    m_callbacks.clear();
+}
+
+} // namespace openperf::packetio::dpdk::port
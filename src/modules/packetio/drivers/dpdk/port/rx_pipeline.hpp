@@ -0,0 +1,176 @@
+#ifndef _OP_PACKETIO_DPDK_PORT_RX_PIPELINE_HPP_
+#define _OP_PACKETIO_DPDK_PORT_RX_PIPELINE_HPP_
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "packetio/drivers/dpdk/dpdk.h"
+#include "packetio/drivers/dpdk/port/signature_utils.hpp"
+#include "utils/enum_flags.hpp"
+#include "utils/soa_container.hpp"
+
+namespace openperf::packetio::dpdk::port {
+
+/*
+ * Software receive features that share a single pass over each burst.
+ * Stages run in declaration order, as later stages may depend on metadata
+ * generated by earlier ones, e.g. PRBS checking needs signature flags.
+ */
+enum class rx_pipeline_stage : uint8_t {
+    timestamp = (1 << 0),
+    packet_type_decode = (1 << 1),
+    rss_hash = (1 << 2),
+    signature_decode = (1 << 3),
+    prbs_error_detect = (1 << 4),
+};
+
+inline constexpr auto rx_pipeline_stage_max = (1 << 5);
+
+} // namespace openperf::packetio::dpdk::port
+
+declare_enum_flags(openperf::packetio::dpdk::port::rx_pipeline_stage);
+
+namespace openperf::packetio::dpdk::port {
+
+struct alignas(RTE_CACHE_LINE_SIZE) signature_scratch
+{
+    using payload_container = openperf::utils::soa_container<
+        utils::chunk_array,
+        std::tuple<const uint8_t*, std::byte[utils::signature_length]>>;
+
+    using sig_container = openperf::utils::soa_container<
+        utils::chunk_array,
+        std::tuple<uint32_t, uint32_t, uint64_t, int>>;
+
+    payload_container payloads;
+    std::array<int, utils::chunk_size> crc_matches;
+    sig_container signatures;
+};
+
+struct alignas(RTE_CACHE_LINE_SIZE) prbs_scratch
+{
+    using prbs_packets =
+        openperf::utils::soa_container<utils::chunk_array,
+                                       std::tuple<rte_mbuf*, uint16_t>>;
+
+    using prbs_segments = openperf::utils::soa_container<
+        utils::chunk_array,
+        std::tuple<const uint8_t*, uint16_t, uint32_t>>;
+
+    prbs_packets packets;
+    prbs_segments segments;
+};
+
+/**
+ * A port's fused software receive pipeline.
+ *
+ * Instead of a DPDK receive callback per feature, each of which walks the
+ * entire burst, we install a single callback per queue that parses each
+ * packet's headers and reads its signature once, generating all of the
+ * metadata the enabled stages need in a single pass.  Each combination of
+ * stages has its own, compile time specialized, burst function; changing
+ * the enabled stages just switches the function used for the next burst.
+ */
+class rx_pipeline
+{
+public:
+    using stage_flags = openperf::utils::bit_flags<rx_pipeline_stage>;
+
+    static rx_pipeline& get(uint16_t port_id);
+
+    ~rx_pipeline();
+
+    rx_pipeline(const rx_pipeline&) = delete;
+    rx_pipeline& operator=(const rx_pipeline&) = delete;
+
+    uint16_t port_id() const;
+    stage_flags stages() const;
+
+    void enable(rx_pipeline_stage stage);
+    void disable(rx_pipeline_stage stage);
+
+    struct alignas(RTE_CACHE_LINE_SIZE) scratch_t
+    {
+        std::array<uint16_t, utils::chunk_size> payload_offsets;
+        signature_scratch signatures;
+        prbs_scratch prbs;
+    };
+
+    struct context
+    {
+        std::atomic<stage_flags> stages;
+        time_t epoch_offset;
+        std::vector<scratch_t> scratch; /* indexed by queue id */
+    };
+
+private:
+    rx_pipeline(uint16_t port_id);
+
+    void install();
+    void uninstall();
+
+    uint16_t m_port;
+    std::unique_ptr<context> m_context;
+    std::vector<const rte_eth_rxtx_callback*> m_callbacks;
+};
+
+std::string to_string(rx_pipeline_stage stage);
+
+/**
+ * Feature wrapper for a single pipeline stage, suitable for use in a
+ * feature_toggle.
+ */
+template <rx_pipeline_stage Stage> class rx_pipeline_feature
+{
+public:
+    rx_pipeline_feature(uint16_t port_id)
+        : m_port(port_id)
+    {}
+
+    ~rx_pipeline_feature()
+    {
+        if (m_enabled) { disable(); }
+    }
+
+    rx_pipeline_feature(rx_pipeline_feature&& other) noexcept
+        : m_port(other.m_port)
+        , m_enabled(other.m_enabled)
+    {
+        other.m_enabled = false;
+    }
+
+    rx_pipeline_feature& operator=(rx_pipeline_feature&& other) noexcept
+    {
+        if (this != &other) {
+            m_port = other.m_port;
+            m_enabled = other.m_enabled;
+            other.m_enabled = false;
+        }
+        return (*this);
+    }
+
+    uint16_t port_id() const { return (m_port); }
+
+    void enable()
+    {
+        rx_pipeline::get(m_port).enable(Stage);
+        m_enabled = true;
+    }
+
+    void disable()
+    {
+        rx_pipeline::get(m_port).disable(Stage);
+        m_enabled = false;
+    }
+
+private:
+    uint16_t m_port;
+    bool m_enabled = false;
+};
+
+} // namespace openperf::packetio::dpdk::port
+
+#endif /* _OP_PACKETIO_DPDK_PORT_RX_PIPELINE_HPP_ */
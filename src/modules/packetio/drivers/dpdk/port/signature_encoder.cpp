@@ -28,10 +28,15 @@ static bool is_runt_ipv4_udp(const rte_mbuf* mbuf)
                    < min_ipv4_udp_payload_size);
 }
 
+/*
+ * The signature is always at the end of the last segment; zero-copy
+ * sources chain a private segment for it behind their shared headers.
+ */
 template <typename T> static T* to_signature(rte_mbuf* mbuf)
 {
+    auto* last = rte_pktmbuf_lastseg(mbuf);
     return (rte_pktmbuf_mtod_offset(
-        mbuf, T*, rte_pktmbuf_pkt_len(mbuf) - utils::signature_length));
+        last, T*, rte_pktmbuf_data_len(last) - utils::signature_length));
 }
 
 static uint32_t get_link_speed_safe(uint16_t port_id)
@@ -10,6 +10,10 @@
 
 namespace openperf::packetio::dpdk::port {
 
+/* Ethernet preamble + CRC */
+static constexpr auto ethernet_overhead = 24U;
+static constexpr auto ethernet_octets = 8U;
+
 static uint32_t get_link_speed_safe(uint16_t port_id)
 {
     /* Query the port's link speed */
@@ -26,61 +30,36 @@ static uint32_t get_link_speed_safe(uint16_t port_id)
                                             : port_info::max_speed(port_id));
 }
 
-static uint16_t timestamp_packets(uint16_t port_id,
-                                  [[maybe_unused]] uint16_t queue_id,
-                                  rte_mbuf* packets[],
-                                  uint16_t nb_packets,
-                                  [[maybe_unused]] uint16_t max_packets,
-                                  [[maybe_unused]] void* user_param)
+static burst_timestamper::picoseconds get_ps_per_octet(uint16_t port_id)
 {
     using namespace openperf::units;
-    using clock = openperf::timesync::chrono::realtime;
-
-    /* Ethernet preamble + CRC */
-    static constexpr auto ethernet_overhead = 24U;
-    static constexpr auto ethernet_octets = 8U;
-
-    /*
-     * An octet takes less than 1 nanosecond at 100G speeds, so
-     * calculate offsets in picoseconds.
-     */
     using mbps = rate<uint64_t, megabits>;
-    using nanoseconds = std::chrono::nanoseconds;
-    using picoseconds = std::chrono::duration<int64_t, std::pico>;
-
-    auto ps_per_octet =
-        to_duration<picoseconds>(mbps(get_link_speed_safe(port_id)))
-        * ethernet_octets;
 
-    /*
-     * Iterate through the packets. Assign each packet the current timestamp
-     * plus the sum of the bit-times of all preceding packets.
-     */
-    auto now = clock::now().time_since_epoch();
-    auto rx_octets = 0U;
-
-    std::for_each(packets, packets + nb_packets, [&](auto* m) {
-        mbuf_timestamp_set(m,
-                           now
-                               + std::chrono::duration_cast<nanoseconds>(
-                                   rx_octets * ps_per_octet));
-        rx_octets += rte_pktmbuf_pkt_len(m) + ethernet_overhead;
-    });
-
-    return (nb_packets);
+    return (to_duration<burst_timestamper::picoseconds>(
+                mbps(get_link_speed_safe(port_id)))
+            * ethernet_octets);
 }
 
-std::string callback_timestamper::description() { return ("timestamping"); }
+burst_timestamper::burst_timestamper(uint16_t port_id)
+    : m_now(openperf::timesync::chrono::realtime::now().time_since_epoch())
+    , m_ps_per_octet(get_ps_per_octet(port_id))
+{}
 
-rx_callback<callback_timestamper>::rx_callback_fn
-callback_timestamper::callback()
+void burst_timestamper::operator()(rte_mbuf* mbuf)
 {
-    return (timestamp_packets);
+    using nanoseconds = std::chrono::nanoseconds;
+
+    mbuf_timestamp_set(
+        mbuf,
+        m_now
+            + std::chrono::duration_cast<nanoseconds>(m_rx_octets
+                                                      * m_ps_per_octet));
+    m_rx_octets += rte_pktmbuf_pkt_len(mbuf) + ethernet_overhead;
 }
 
 static timestamper::variant_type make_timestamper(uint16_t port_id)
 {
-    return (callback_timestamper(port_id));
+    return (rx_pipeline_feature<rx_pipeline_stage::timestamp>(port_id));
 }
 
 timestamper::timestamper(uint16_t port_id)
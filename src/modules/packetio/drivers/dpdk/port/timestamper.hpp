@@ -1,22 +1,41 @@
 #ifndef _OP_PACKETIO_DPDK_PORT_TIMESTAMPER_HPP_
 #define _OP_PACKETIO_DPDK_PORT_TIMESTAMPER_HPP_
 
-#include "packetio/drivers/dpdk/port/callback.hpp"
+#include <chrono>
+
 #include "packetio/drivers/dpdk/port/feature_toggle.hpp"
+#include "packetio/drivers/dpdk/port/rx_pipeline.hpp"
 
 namespace openperf::packetio::dpdk::port {
 
-struct callback_timestamper : public rx_callback<callback_timestamper>
+/**
+ * Generates receive timestamps for the packets in a burst.  Each packet
+ * gets the burst's receive time plus the bit-times of all preceding
+ * packets.
+ */
+class burst_timestamper
 {
-    using parent_type = rx_callback<callback_timestamper>;
+public:
+    burst_timestamper(uint16_t port_id);
+
+    void operator()(rte_mbuf* mbuf);
+
+    /*
+     * An octet takes less than 1 nanosecond at 100G speeds, so
+     * calculate offsets in picoseconds.
+     */
+    using picoseconds = std::chrono::duration<int64_t, std::pico>;
 
-    using parent_type::rx_callback;
-    static std::string description();
-    static parent_type::rx_callback_fn callback();
+private:
+    std::chrono::nanoseconds m_now;
+    picoseconds m_ps_per_octet;
+    uint64_t m_rx_octets = 0;
 };
 
 struct timestamper
-    : feature_toggle<timestamper, callback_timestamper, null_feature>
+    : feature_toggle<timestamper,
+                     rx_pipeline_feature<rx_pipeline_stage::timestamp>,
+                     null_feature>
 {
     variant_type feature;
     timestamper(uint16_t port_id);
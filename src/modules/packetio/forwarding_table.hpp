@@ -10,12 +10,15 @@
 
 #include <array>
 #include <atomic>
+#include <memory>
+#include <vector>
 
 #include "immer/box.hpp"
 #include "immer/flex_vector.hpp"
 #include "immer/map.hpp"
 
 #include "packet/type/mac_address.hpp"
+#include "packetio/mac_table.hpp"
 
 namespace openperf::packetio {
 
@@ -36,27 +39,41 @@ public:
     using interface_map =
         immer::map<libpacket::type::mac_address, interface_sink_entry>;
     using sink_vector = immer::flex_vector<Sink>;
+    using multicast_sink_vector = std::vector<Sink>;
+    using interface_lookup = mac_table<interface_sinks>;
     static constexpr unsigned mac_address_length =
         libpacket::type::mac_address{}.size();
 
+    /*
+     * The interfaces on a port.  Writers publish a new table for every
+     * change.  The lookup table is shared between tables and updated in
+     * place until it needs to grow, which makes MAC lookups a single
+     * probe of a flat table instead of a walk through the map.
+     */
+    struct interface_table
+    {
+        interface_map interfaces;
+        std::shared_ptr<interface_lookup> lookup;
+    };
+
     forwarding_table();
     ~forwarding_table();
 
-    interface_map* insert_interface(uint16_t port_idx,
-                                    const libpacket::type::mac_address& mac,
-                                    Interface interface);
-    interface_map* remove_interface(uint16_t port_idx,
-                                    const libpacket::type::mac_address& mac);
+    interface_table* insert_interface(uint16_t port_idx,
+                                      const libpacket::type::mac_address& mac,
+                                      Interface interface);
+    interface_table* remove_interface(uint16_t port_idx,
+                                      const libpacket::type::mac_address& mac);
 
     sink_vector* insert_sink(uint16_t port_idx, direction dir, Sink sink);
     sink_vector* remove_sink(uint16_t port_idx, direction dir, Sink sink);
 
-    interface_map*
+    interface_table*
     insert_interface_sink(uint16_t port_idx,
                           const libpacket::type::mac_address& mac,
                           direction dir,
                           Sink sink);
-    interface_map*
+    interface_table*
     remove_interface_sink(uint16_t port_idx,
                           const libpacket::type::mac_address& mac,
                           direction dir,
@@ -79,6 +96,21 @@ public:
 
     sink_vector& get_tx_sinks(uint16_t port_idx) const;
 
+    /**
+     * Rebuild the port's multicast rx sink vector from the current
+     * interface sinks and publish it.  The writer must call this after
+     * changing the rx sinks or interfaces of a port and delete the
+     * returned vector once readers are done with it.
+     */
+    multicast_sink_vector* update_multicast_rx_sinks(uint16_t port_idx);
+
+    /**
+     * Retrieve the rx sinks of every interface on the port, e.g. for
+     * multicast dispatch.
+     */
+    const multicast_sink_vector&
+    get_multicast_rx_sinks(uint16_t port_idx) const;
+
     bool has_interface_rx_sinks(uint16_t port_idx) const;
 
     bool has_interface_tx_sinks(uint16_t port_idx) const;
@@ -93,6 +125,15 @@ public:
     find_interface_and_sinks(uint16_t port_idx,
                              const libpacket::type::mac_address& mac) const;
 
+    /**
+     * Look up the interfaces for a burst of destination MAC addresses.
+     * Entries for unknown addresses are set to nullptr.
+     */
+    void find_interface_and_sinks(uint16_t port_idx,
+                                  const uint8_t* const octets[],
+                                  const interface_sinks* entries[],
+                                  uint16_t count) const;
+
     /**
      * Visit all the interfaces sinks.
      *
@@ -107,9 +148,15 @@ public:
         const;
 
 private:
-    std::array<std::atomic<interface_map*>, MaxPorts> m_interfaces;
+    interface_table* update_interface(uint16_t port_idx,
+                                      const libpacket::type::mac_address& mac,
+                                      interface_map&& interfaces);
+
+    std::array<std::atomic<interface_table*>, MaxPorts> m_interfaces;
     std::array<std::atomic<sink_vector*>, MaxPorts> m_port_rx_sinks;
     std::array<std::atomic<sink_vector*>, MaxPorts> m_port_tx_sinks;
+    std::array<std::atomic<multicast_sink_vector*>, MaxPorts>
+        m_port_multicast_rx_sinks;
     std::array<std::atomic<int>, MaxPorts> m_port_interface_rx_sink_count;
     std::array<std::atomic<int>, MaxPorts> m_port_interface_tx_sink_count;
 };
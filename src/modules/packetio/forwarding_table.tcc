@@ -1,7 +1,10 @@
+#include <algorithm>
 #include <cassert>
+#include <iterator>
 #include <string>
 
 #include "packetio/forwarding_table.hpp"
+#include "packetio/mac_table.tcc"
 
 namespace openperf::packetio {
 
@@ -10,13 +13,35 @@ using mac_address = libpacket::type::mac_address;
 template <typename Interface>
 std::string get_interface_id(const Interface& ifp);
 
+/*
+ * Lookup tables are sized for twice the number of interfaces they hold,
+ * so growing them is amortized over many updates.
+ */
+inline constexpr size_t min_interface_lookup_size = 64;
+
+template <typename Lookup, typename InterfaceMap>
+std::shared_ptr<Lookup> make_interface_lookup(const InterfaceMap& interfaces)
+{
+    auto lookup = std::make_shared<Lookup>(
+        std::max(min_interface_lookup_size, interfaces.size() * 2));
+    for (const auto& [mac, entry] : interfaces) {
+        [[maybe_unused]] auto success = lookup->insert_or_assign(
+            Lookup::to_key(mac.octets.data()), std::addressof(entry.get()));
+        assert(success);
+    }
+    return (lookup);
+}
+
 template <typename Interface, typename Sink, int MaxPorts>
 forwarding_table<Interface, Sink, MaxPorts>::forwarding_table()
 {
     for (int i = 0; i < MaxPorts; i++) {
-        m_interfaces[i].store(new interface_map());
+        m_interfaces[i].store(new interface_table{
+            interface_map(),
+            std::make_shared<interface_lookup>(min_interface_lookup_size)});
         m_port_rx_sinks[i].store(new sink_vector());
         m_port_tx_sinks[i].store(new sink_vector());
+        m_port_multicast_rx_sinks[i].store(new multicast_sink_vector());
         m_port_interface_rx_sink_count[i].store(0);
         m_port_interface_tx_sink_count[i].store(0);
     }
@@ -29,34 +54,62 @@ forwarding_table<Interface, Sink, MaxPorts>::~forwarding_table()
         delete m_interfaces[i].exchange(nullptr);
         delete m_port_rx_sinks[i].exchange(nullptr);
         delete m_port_tx_sinks[i].exchange(nullptr);
+        delete m_port_multicast_rx_sinks[i].exchange(nullptr);
+    }
+}
+
+/*
+ * Publish a new interface table containing the updated interface map.
+ * The lookup entry for the changed MAC address is updated in place, so
+ * readers might see it slightly before the map.  That's fine, since the
+ * writer keeps the new map alive.
+ */
+template <typename Interface, typename Sink, int MaxPorts>
+typename forwarding_table<Interface, Sink, MaxPorts>::interface_table*
+forwarding_table<Interface, Sink, MaxPorts>::update_interface(
+    uint16_t port_idx, const mac_address& mac, interface_map&& interfaces)
+{
+    auto original = m_interfaces[port_idx].load(std::memory_order_relaxed);
+    auto lookup = original->lookup;
+    auto key = interface_lookup::to_key(mac.octets.data());
+
+    if (auto* entry = interfaces.find(mac); !entry) {
+        lookup->erase(key);
+    } else if (!lookup->insert_or_assign(key, std::addressof(entry->get()))) {
+        /* Out of room; older tables keep the previous lookup alive */
+        lookup = make_interface_lookup<interface_lookup>(interfaces);
     }
+
+    auto updated =
+        new interface_table{std::move(interfaces), std::move(lookup)};
+    return (
+        m_interfaces[port_idx].exchange(updated, std::memory_order_release));
 }
 
 template <typename Interface, typename Sink, int MaxPorts>
-typename forwarding_table<Interface, Sink, MaxPorts>::interface_map*
+typename forwarding_table<Interface, Sink, MaxPorts>::interface_table*
 forwarding_table<Interface, Sink, MaxPorts>::insert_interface(
     uint16_t port_idx, const mac_address& mac, Interface interface)
 {
     assert(port_idx < MaxPorts);
 
     auto original = m_interfaces[port_idx].load(std::memory_order_relaxed);
-    auto updated = new interface_map(std::move(
-        original->set(mac, interface_sinks{std::move(interface), {}, {}})));
-    return (
-        m_interfaces[port_idx].exchange(updated, std::memory_order_release));
+    return (update_interface(
+        port_idx,
+        mac,
+        original->interfaces.set(
+            mac, interface_sinks{std::move(interface), {}, {}})));
 }
 
 template <typename Interface, typename Sink, int MaxPorts>
-typename forwarding_table<Interface, Sink, MaxPorts>::interface_map*
+typename forwarding_table<Interface, Sink, MaxPorts>::interface_table*
 forwarding_table<Interface, Sink, MaxPorts>::remove_interface(
     uint16_t port_idx, const mac_address& mac)
 {
     assert(port_idx < MaxPorts);
 
     auto original = m_interfaces[port_idx].load(std::memory_order_relaxed);
-    auto updated = new interface_map(std::move(original->erase(mac)));
-    return (
-        m_interfaces[port_idx].exchange(updated, std::memory_order_release));
+    return (update_interface(port_idx, mac, original->interfaces.erase(mac)));
 }
 
 template <typename Interface, typename Sink, int MaxPorts>
@@ -95,14 +148,14 @@ forwarding_table<Interface, Sink, MaxPorts>::remove_sink(uint16_t port_idx,
 }
 
 template <typename Interface, typename Sink, int MaxPorts>
-typename forwarding_table<Interface, Sink, MaxPorts>::interface_map*
+typename forwarding_table<Interface, Sink, MaxPorts>::interface_table*
 forwarding_table<Interface, Sink, MaxPorts>::insert_interface_sink(
     uint16_t port_idx, const mac_address& mac, direction dir, Sink sink)
 {
     assert(port_idx < MaxPorts);
 
     auto original = m_interfaces[port_idx].load(std::memory_order_relaxed);
-    auto* entry = original->find(mac);
+    auto* entry = original->interfaces.find(mac);
     if (!entry) { return (nullptr); }
 
     auto copy = entry->update([&](auto if_sinks) {
@@ -114,8 +167,7 @@ forwarding_table<Interface, Sink, MaxPorts>::insert_interface_sink(
         return (if_sinks);
     });
 
-    auto updated =
-        new interface_map(std::move(original->set(mac, std::move(copy))));
+    auto interfaces = original->interfaces.set(mac, std::move(copy));
 
     if (dir == direction::RX) {
         m_port_interface_rx_sink_count[port_idx]++;
@@ -123,19 +175,18 @@ forwarding_table<Interface, Sink, MaxPorts>::insert_interface_sink(
         m_port_interface_tx_sink_count[port_idx]++;
     }
 
-    return (
-        m_interfaces[port_idx].exchange(updated, std::memory_order_release));
+    return (update_interface(port_idx, mac, std::move(interfaces)));
 }
 
 template <typename Interface, typename Sink, int MaxPorts>
-typename forwarding_table<Interface, Sink, MaxPorts>::interface_map*
+typename forwarding_table<Interface, Sink, MaxPorts>::interface_table*
 forwarding_table<Interface, Sink, MaxPorts>::remove_interface_sink(
     uint16_t port_idx, const mac_address& mac, direction dir, Sink sink)
 {
     assert(port_idx < MaxPorts);
 
     auto original = m_interfaces[port_idx].load(std::memory_order_relaxed);
-    auto* entry = original->find(mac);
+    auto* entry = original->interfaces.find(mac);
     if (!entry) return nullptr;
 
     auto copy = entry->update([&](auto if_sinks) {
@@ -146,8 +197,7 @@ forwarding_table<Interface, Sink, MaxPorts>::remove_interface_sink(
         return (if_sinks);
     });
 
-    auto updated =
-        new interface_map(std::move(original->set(mac, std::move(copy))));
+    auto interfaces = original->interfaces.set(mac, std::move(copy));
 
     if (dir == direction::RX) {
         m_port_interface_rx_sink_count[port_idx]--;
@@ -155,8 +205,7 @@ forwarding_table<Interface, Sink, MaxPorts>::remove_interface_sink(
         m_port_interface_tx_sink_count[port_idx]--;
     }
 
-    return (
-        m_interfaces[port_idx].exchange(updated, std::memory_order_release));
+    return (update_interface(port_idx, mac, std::move(interfaces)));
 }
 
 template <typename Interface, typename Sink, int MaxPorts>
@@ -165,7 +214,8 @@ const Interface* forwarding_table<Interface, Sink, MaxPorts>::find_interface(
 {
     assert(port_idx < MaxPorts);
 
-    const auto& map = *(m_interfaces[port_idx].load(std::memory_order_consume));
+    const auto& map =
+        m_interfaces[port_idx].load(std::memory_order_consume)->interfaces;
     auto item =
         std::find_if(std::begin(map), std::end(map), [&](const auto& pair) {
             return (get_interface_id(pair.second->ifp) == id);
@@ -179,8 +229,8 @@ template <typename Interface, typename Sink, int MaxPorts>
 const Interface* forwarding_table<Interface, Sink, MaxPorts>::find_interface(
     std::string_view id) const
 {
-    for (auto& map_ptr : m_interfaces) {
-        const auto& map = *(map_ptr.load(std::memory_order_consume));
+    for (auto& table : m_interfaces) {
+        const auto& map = table.load(std::memory_order_consume)->interfaces;
         auto item =
             std::find_if(std::begin(map), std::end(map), [&](const auto& pair) {
                 return (get_interface_id(pair.second->ifp) == id);
@@ -197,9 +247,8 @@ const Interface* forwarding_table<Interface, Sink, MaxPorts>::find_interface(
 {
     assert(port_idx < MaxPorts);
 
-    auto map = m_interfaces[port_idx].load(std::memory_order_consume);
-    auto item = map->find(mac);
-    return (item ? std::addressof((*item)->ifp) : nullptr);
+    auto entry = find_interface_and_sinks(port_idx, mac);
+    return (entry ? std::addressof(entry->ifp) : nullptr);
 }
 
 template <typename Interface, typename Sink, int MaxPorts>
@@ -208,9 +257,10 @@ const Interface* forwarding_table<Interface, Sink, MaxPorts>::find_interface(
 {
     assert(port_idx < MaxPorts);
 
-    auto map = m_interfaces[port_idx].load(std::memory_order_consume);
-    auto item = map->find(mac_address(octets));
-    return (item ? std::addressof((*item)->ifp) : nullptr);
+    const auto& lookup =
+        *m_interfaces[port_idx].load(std::memory_order_consume)->lookup;
+    auto entry = lookup.find(interface_lookup::to_key(octets));
+    return (entry ? std::addressof(entry->ifp) : nullptr);
 }
 
 template <typename Interface, typename Sink, int MaxPorts>
@@ -219,7 +269,7 @@ forwarding_table<Interface, Sink, MaxPorts>::get_interfaces(
     uint16_t port_idx) const
 {
     assert(port_idx < MaxPorts);
-    return (*m_interfaces[port_idx].load(std::memory_order_consume));
+    return (m_interfaces[port_idx].load(std::memory_order_consume)->interfaces);
 }
 
 template <typename Interface, typename Sink, int MaxPorts>
@@ -240,6 +290,37 @@ forwarding_table<Interface, Sink, MaxPorts>::get_tx_sinks(
     return (*m_port_tx_sinks[port_idx].load(std::memory_order_consume));
 }
 
+template <typename Interface, typename Sink, int MaxPorts>
+typename forwarding_table<Interface, Sink, MaxPorts>::multicast_sink_vector*
+forwarding_table<Interface, Sink, MaxPorts>::update_multicast_rx_sinks(
+    uint16_t port_idx)
+{
+    assert(port_idx < MaxPorts);
+
+    auto updated = new multicast_sink_vector();
+    const auto& map =
+        m_interfaces[port_idx].load(std::memory_order_relaxed)->interfaces;
+    for (const auto& [mac, entry] : map) {
+        std::copy(std::begin(entry->rx_sinks),
+                  std::end(entry->rx_sinks),
+                  std::back_inserter(*updated));
+    }
+
+    return (m_port_multicast_rx_sinks[port_idx].exchange(
+        updated, std::memory_order_release));
+}
+
+template <typename Interface, typename Sink, int MaxPorts>
+const typename forwarding_table<Interface, Sink, MaxPorts>::
+    multicast_sink_vector&
+    forwarding_table<Interface, Sink, MaxPorts>::get_multicast_rx_sinks(
+        uint16_t port_idx) const
+{
+    assert(port_idx < MaxPorts);
+    return (
+        *m_port_multicast_rx_sinks[port_idx].load(std::memory_order_consume));
+}
+
 template <typename Interface, typename Sink, int MaxPorts>
 bool forwarding_table<Interface, Sink, MaxPorts>::has_interface_rx_sinks(
     uint16_t port_idx) const
@@ -267,9 +348,8 @@ forwarding_table<Interface, Sink, MaxPorts>::find_interface_rx_sinks(
 {
     assert(port_idx < MaxPorts);
 
-    auto map = m_interfaces[port_idx].load(std::memory_order_consume);
-    auto item = map->find(mac);
-    return (item ? &((*item)->rx_sinks) : nullptr);
+    auto entry = find_interface_and_sinks(port_idx, mac);
+    return (entry ? &(entry->rx_sinks) : nullptr);
 }
 
 template <typename Interface, typename Sink, int MaxPorts>
@@ -279,9 +359,8 @@ forwarding_table<Interface, Sink, MaxPorts>::find_interface_tx_sinks(
 {
     assert(port_idx < MaxPorts);
 
-    auto map = m_interfaces[port_idx].load(std::memory_order_consume);
-    auto item = map->find(mac);
-    return (item ? &((*item)->tx_sinks) : nullptr);
+    auto entry = find_interface_and_sinks(port_idx, mac);
+    return (entry ? &(entry->tx_sinks) : nullptr);
 }
 
 template <typename Interface, typename Sink, int MaxPorts>
@@ -291,9 +370,35 @@ forwarding_table<Interface, Sink, MaxPorts>::find_interface_and_sinks(
 {
     assert(port_idx < MaxPorts);
 
-    auto map = m_interfaces[port_idx].load(std::memory_order_consume);
-    auto item = map->find(mac);
-    return (item ? &(item->get()) : nullptr);
+    const auto& lookup =
+        *m_interfaces[port_idx].load(std::memory_order_consume)->lookup;
+    return (lookup.find(interface_lookup::to_key(mac.octets.data())));
+}
+
+template <typename Interface, typename Sink, int MaxPorts>
+void forwarding_table<Interface, Sink, MaxPorts>::find_interface_and_sinks(
+    uint16_t port_idx,
+    const uint8_t* const octets[],
+    const interface_sinks* entries[],
+    uint16_t count) const
+{
+    assert(port_idx < MaxPorts);
+
+    static constexpr uint16_t chunk_size = 32;
+    std::array<typename interface_lookup::key_type, chunk_size> keys;
+
+    const auto& lookup =
+        *m_interfaces[port_idx].load(std::memory_order_consume)->lookup;
+    for (uint16_t offset = 0; offset < count; offset += chunk_size) {
+        auto n = std::min(chunk_size, static_cast<uint16_t>(count - offset));
+        std::transform(octets + offset,
+                       octets + offset + n,
+                       keys.data(),
+                       [](const auto* ptr) {
+                           return (interface_lookup::to_key(ptr));
+                       });
+        lookup.find(keys.data(), entries + offset, n);
+    }
 }
 
 template <typename Interface, typename Sink, int MaxPorts>
@@ -304,8 +409,9 @@ void forwarding_table<Interface, Sink, MaxPorts>::visit_interface_sinks(
 {
     assert(port_idx < MaxPorts);
 
-    auto interface_map = m_interfaces[port_idx].load(std::memory_order_consume);
-    for (auto [mac, entry] : *interface_map) {
+    const auto& map =
+        m_interfaces[port_idx].load(std::memory_order_consume)->interfaces;
+    for (auto [mac, entry] : map) {
         auto& sinks =
             (dir == direction::RX) ? entry->rx_sinks : entry->tx_sinks;
         for (auto& sink : sinks) {
@@ -2,6 +2,7 @@
 #define _OP_PACKETIO_GENERIC_SOURCE_HPP_
 
 #include <any>
+#include <chrono>
 #include <memory>
 #include <string>
 #include <typeindex>
@@ -20,6 +21,7 @@ enum class source_feature_flags {
     spirent_signature_encode = (1 << 0),
     spirent_payload_fill = (1 << 1),
     packet_checksums = (1 << 2),
+    header_templates = (1 << 3),
 };
 
 class generic_source
@@ -57,6 +59,16 @@ public:
         m_self->update_drop_counters(packets, octets);
     }
 
+    /*
+     * Report the intended vs. the achieved gap between consecutive
+     * bursts. Only used by transmit schedulers that can measure it.
+     */
+    void update_gap_counters(std::chrono::nanoseconds intended,
+                             std::chrono::nanoseconds actual) const
+    {
+        m_self->update_gap_counters(intended, actual);
+    }
+
     bool uses_feature(enum source_feature_flags flags) const
     {
         return (m_self->uses_feature(flags));
@@ -90,6 +102,9 @@ private:
                                    packet_buffer* output[]) const = 0;
         virtual void update_drop_counters(uint16_t packets,
                                           size_t octets) const = 0;
+        virtual void
+        update_gap_counters(std::chrono::nanoseconds intended,
+                            std::chrono::nanoseconds actual) const = 0;
         virtual bool uses_feature(enum source_feature_flags) const = 0;
         virtual const std::type_info& type_info() const = 0;
     };
@@ -147,6 +162,16 @@ private:
         std::void_t<decltype(&T::update_drop_counters)>> : std::true_type
     {};
 
+    template <typename T, typename = std::void_t<>>
+    struct has_update_gap_counters : std::false_type
+    {};
+
+    template <typename T>
+    struct has_update_gap_counters<
+        T,
+        std::void_t<decltype(&T::update_gap_counters)>> : std::true_type
+    {};
+
     template <typename Source> struct source_model final : source_concept
     {
         source_model(Source s)
@@ -202,6 +227,14 @@ private:
             }
         }
 
+        void update_gap_counters(std::chrono::nanoseconds intended,
+                                 std::chrono::nanoseconds actual) const override
+        {
+            if constexpr (has_update_gap_counters<Source>::value) {
+                m_source.update_gap_counters(intended, actual);
+            }
+        }
+
         bool uses_feature(enum source_feature_flags flags) const override
         {
             if constexpr (has_uses_feature<Source>::value) {
@@ -34,6 +34,16 @@ enum class context { NONE = 0, STACK };
 using source_swap_function = std::function<void(
     const packet::generic_source& outgoing, packet::generic_source& incoming)>;
 
+/**
+ * Per worker cycle accounting.  Busy cycles are spent servicing queues and
+ * events; idle cycles are spent spinning, pausing, or waiting for events.
+ */
+struct worker_cycles
+{
+    uint64_t busy;
+    uint64_t idle;
+};
+
 class generic_workers
 {
 public:
@@ -73,6 +83,16 @@ public:
         return (m_self->get_worker_ids(packet::traffic_direction::TX, obj_id));
     }
 
+    std::vector<unsigned> get_rx_queue_workers(std::string_view port_id) const
+    {
+        return (m_self->get_rx_queue_workers(port_id));
+    }
+
+    std::optional<worker_cycles> get_worker_cycles(unsigned worker_id) const
+    {
+        return (m_self->get_worker_cycles(worker_id));
+    }
+
     transmit_function get_transmit_function(std::string_view port_id) const
     {
         return (m_self->get_transmit_function(port_id));
@@ -180,6 +200,10 @@ private:
         virtual std::vector<unsigned>
         get_worker_ids(packet::traffic_direction direction,
                        std::optional<std::string_view> obj_id) const = 0;
+        virtual std::vector<unsigned>
+        get_rx_queue_workers(std::string_view port_id) const = 0;
+        virtual std::optional<worker_cycles>
+        get_worker_cycles(unsigned worker_id) const = 0;
         virtual transmit_function
         get_transmit_function(std::string_view port_id) const = 0;
         virtual tl::expected<void, int>
@@ -228,6 +252,18 @@ private:
             return (m_workers.get_worker_ids(direction, obj_id));
         }
 
+        std::vector<unsigned>
+        get_rx_queue_workers(std::string_view port_id) const override
+        {
+            return (m_workers.get_rx_queue_workers(port_id));
+        }
+
+        std::optional<worker_cycles>
+        get_worker_cycles(unsigned worker_id) const override
+        {
+            return (m_workers.get_worker_cycles(worker_id));
+        }
+
         transmit_function
         get_transmit_function(std::string_view port_id) const override
         {
@@ -61,8 +61,8 @@ struct service
 
         m_loop = std::make_unique<openperf::core::event_loop>();
         m_workers = workers::make(context, *m_loop, *m_driver);
-        m_port_server =
-            std::make_unique<port::api::server>(context, *m_loop, *m_driver);
+        m_port_server = std::make_unique<port::api::server>(
+            context, *m_loop, *m_driver, *m_workers);
         m_internal_server = std::make_unique<internal::api::server>(
             context, *m_loop, *m_driver, *m_workers);
 
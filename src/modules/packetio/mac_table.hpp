@@ -0,0 +1,83 @@
+#ifndef _OP_PACKETIO_MAC_TABLE_HPP_
+#define _OP_PACKETIO_MAC_TABLE_HPP_
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace openperf::packetio {
+
+/*
+ * Open addressing MAC address table for the receive fast path.
+ *
+ * Entries live in cache line sized buckets of contiguous keys, so most
+ * lookups touch a single cache line.  The table stores pointers to values
+ * owned elsewhere and supports a single writer and multiple concurrent
+ * readers.  Erased entries leave tombstones behind that are only
+ * reclaimed when the writer builds a new table, hence readers never see
+ * a slot change keys underneath them.
+ */
+template <typename Value> class mac_table
+{
+public:
+    using key_type = uint64_t;
+    using value_type = Value;
+
+    /* max_size counts tombstones, too */
+    explicit mac_table(size_t max_size);
+    ~mac_table() = default;
+
+    mac_table(const mac_table&) = delete;
+    mac_table& operator=(const mac_table&) = delete;
+
+    static key_type to_key(const uint8_t octets[]);
+
+    /*
+     * Add or replace the value for the given key.  Returns false if there
+     * is no room for a new key, in which case the writer needs to build
+     * a larger table.  Writer only.
+     */
+    bool insert_or_assign(key_type key, const value_type* value);
+
+    /* Writer only */
+    void erase(key_type key);
+
+    const value_type* find(key_type key) const;
+
+    /* Look up a burst of keys; prefetches all buckets before probing */
+    void find(const key_type keys[],
+              const value_type* values[],
+              size_t count) const;
+
+    size_t size() const;
+    size_t max_size() const;
+
+private:
+    static constexpr size_t cache_line_size = 64;
+
+    struct alignas(cache_line_size) bucket
+    {
+        static constexpr size_t capacity = 4;
+
+        std::array<std::atomic<key_type>, capacity> keys;
+        std::array<std::atomic<const value_type*>, capacity> values;
+    };
+
+    static_assert(sizeof(bucket) == cache_line_size);
+
+    size_t to_bucket_index(key_type key) const;
+
+    std::unique_ptr<bucket[]> m_buckets;
+    size_t m_mask = 0;
+    unsigned m_shift = 0;
+
+    size_t m_max_size = 0;
+    size_t m_size = 0; /* live entries */
+    size_t m_used = 0; /* live entries + tombstones */
+};
+
+} // namespace openperf::packetio
+
+#endif /* _OP_PACKETIO_MAC_TABLE_HPP_ */
@@ -0,0 +1,159 @@
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
+#include "packetio/mac_table.hpp"
+
+namespace openperf::packetio {
+
+namespace detail {
+
+/* Fibonacci hashing multiplier, e.g. 2^64 / phi */
+inline constexpr uint64_t mac_hash_multiplier = 0x9e3779b97f4a7c15;
+
+/* MAC keys only use the lower 48 bits, so these can never collide */
+inline constexpr uint64_t mac_key_empty = ~0ULL;
+inline constexpr uint64_t mac_key_tombstone = ~0ULL - 1;
+
+/*
+ * Keep buckets no more than half full, on average, so that probe
+ * sequences stay short.
+ */
+inline constexpr size_t mac_keys_per_bucket = 2;
+
+inline constexpr size_t mac_min_bucket_count = 2;
+
+inline unsigned log2_mac_bucket_count(size_t max_size)
+{
+    auto count = std::max(mac_min_bucket_count,
+                          (max_size + mac_keys_per_bucket - 1)
+                              / mac_keys_per_bucket);
+    return (64 - __builtin_clzll(count - 1));
+}
+
+} // namespace detail
+
+template <typename Value>
+mac_table<Value>::mac_table(size_t max_size)
+    : m_buckets(std::make_unique<bucket[]>(
+        1ULL << detail::log2_mac_bucket_count(max_size)))
+    , m_mask((1ULL << detail::log2_mac_bucket_count(max_size)) - 1)
+    , m_shift(64 - detail::log2_mac_bucket_count(max_size))
+    , m_max_size(max_size)
+{
+    for (size_t i = 0; i <= m_mask; i++) {
+        for (auto& key : m_buckets[i].keys) {
+            key.store(detail::mac_key_empty, std::memory_order_relaxed);
+        }
+        for (auto& value : m_buckets[i].values) {
+            value.store(nullptr, std::memory_order_relaxed);
+        }
+    }
+}
+
+template <typename Value>
+typename mac_table<Value>::key_type
+mac_table<Value>::to_key(const uint8_t octets[])
+{
+    auto key = key_type{0};
+    std::memcpy(&key, octets, 6);
+    return (key);
+}
+
+template <typename Value>
+size_t mac_table<Value>::to_bucket_index(key_type key) const
+{
+    return ((key * detail::mac_hash_multiplier) >> m_shift);
+}
+
+template <typename Value>
+bool mac_table<Value>::insert_or_assign(key_type key, const value_type* value)
+{
+    assert(key < detail::mac_key_tombstone);
+
+    /*
+     * Tombstones are never reused, so the first empty slot ends the probe
+     * sequence and is where new keys go.
+     */
+    for (auto idx = to_bucket_index(key);; idx = (idx + 1) & m_mask) {
+        auto& b = m_buckets[idx];
+        for (size_t i = 0; i < bucket::capacity; i++) {
+            auto k = b.keys[i].load(std::memory_order_relaxed);
+            if (k == key) {
+                b.values[i].store(value, std::memory_order_release);
+                return (true);
+            }
+            if (k == detail::mac_key_empty) {
+                if (m_used == m_max_size) { return (false); }
+
+                /* Readers must never find a key without a value */
+                b.values[i].store(value, std::memory_order_relaxed);
+                b.keys[i].store(key, std::memory_order_release);
+                m_size++;
+                m_used++;
+                return (true);
+            }
+        }
+    }
+}
+
+template <typename Value> void mac_table<Value>::erase(key_type key)
+{
+    for (auto idx = to_bucket_index(key);; idx = (idx + 1) & m_mask) {
+        auto& b = m_buckets[idx];
+        for (size_t i = 0; i < bucket::capacity; i++) {
+            auto k = b.keys[i].load(std::memory_order_relaxed);
+            if (k == key) {
+                /*
+                 * Leave the value alone; concurrent readers might have
+                 * matched the key already.
+                 */
+                b.keys[i].store(detail::mac_key_tombstone,
+                                std::memory_order_release);
+                m_size--;
+                return;
+            }
+            if (k == detail::mac_key_empty) { return; }
+        }
+    }
+}
+
+template <typename Value>
+const Value* mac_table<Value>::find(key_type key) const
+{
+    for (auto idx = to_bucket_index(key);; idx = (idx + 1) & m_mask) {
+        const auto& b = m_buckets[idx];
+        for (size_t i = 0; i < bucket::capacity; i++) {
+            auto k = b.keys[i].load(std::memory_order_acquire);
+            if (k == key) {
+                return (b.values[i].load(std::memory_order_acquire));
+            }
+            if (k == detail::mac_key_empty) { return (nullptr); }
+        }
+    }
+}
+
+template <typename Value>
+void mac_table<Value>::find(const key_type keys[],
+                            const value_type* values[],
+                            size_t count) const
+{
+    std::for_each(keys, keys + count, [&](auto key) {
+        __builtin_prefetch(std::addressof(m_buckets[to_bucket_index(key)]));
+    });
+
+    std::transform(
+        keys, keys + count, values, [&](auto key) { return (find(key)); });
+}
+
+template <typename Value> size_t mac_table<Value>::size() const
+{
+    return (m_size);
+}
+
+template <typename Value> size_t mac_table<Value>::max_size() const
+{
+    return (m_max_size);
+}
+
+} // namespace openperf::packetio
@@ -1,3 +1,5 @@
+#include <cstring>
+
 #include "packetio/drivers/dpdk/dpdk.h"
 #include "packetio/drivers/dpdk/mbuf_metadata.hpp"
 #include "packetio/packet_buffer.hpp"
@@ -53,6 +55,17 @@ void* front(packet_buffer* buffer)
     return (rte_pktmbuf_prepend(buffer, buffer->data_off));
 }
 
+void copy_data(const packet_buffer* buffer, void* dst, uint32_t length)
+{
+    const auto* src = rte_pktmbuf_read(buffer, 0, length, dst);
+    if (src && src != dst) { std::memcpy(dst, src, length); }
+}
+
+const void* read_data(const packet_buffer* buffer, void* buf, uint32_t length)
+{
+    return (rte_pktmbuf_read(buffer, 0, length, buf));
+}
+
 void length(packet_buffer* buffer, uint16_t size)
 {
     rte_pktmbuf_data_len(buffer) = size;
@@ -87,8 +100,10 @@ void tx_offload(packet_buffer* buffer,
         ol_flags |= RTE_MBUF_F_TX_TCP_CKSUM;
     }
 
-    /* Update packet metadata */
-    buffer->ol_flags = ol_flags;
+    /* Update packet metadata; preserve any zero-copy attachment */
+    buffer->ol_flags = (buffer->ol_flags
+                        & (RTE_MBUF_F_INDIRECT | RTE_MBUF_F_EXTERNAL))
+                       | ol_flags;
     buffer->tx_offload = hdr_lens.value & mask.value;
 }
 
@@ -122,6 +137,28 @@ void signature_fill_prbs(packet_buffer* buffer, uint16_t offset)
     dpdk::mbuf_signature_tx_set_fill_prbs(buffer, offset);
 }
 
+packet_buffer* allocate(const packet_buffer* buffer)
+{
+    return (static_cast<packet_buffer*>(rte_pktmbuf_alloc(buffer->pool)));
+}
+
+packet_buffer* clone(packet_buffer* tmpl)
+{
+    return (static_cast<packet_buffer*>(rte_pktmbuf_clone(tmpl, tmpl->pool)));
+}
+
+void attach(packet_buffer* buffer, packet_buffer* tmpl)
+{
+    rte_pktmbuf_attach(buffer, tmpl);
+}
+
+bool chain(packet_buffer* head, packet_buffer* tail)
+{
+    return (rte_pktmbuf_chain(head, tail) == 0);
+}
+
+void release(packet_buffer* buffer) { rte_pktmbuf_free(buffer); }
+
 void packet_type_flags(packet_buffer* buffer, packet_type::flags flags)
 {
     buffer->packet_type = flags.value;
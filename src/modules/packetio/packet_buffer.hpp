@@ -30,6 +30,19 @@ void* append(packet_buffer* buffer, uint16_t offset);
 
 void* front(packet_buffer* buffer);
 
+/*
+ * Copy the first length octets of packet data into dst.  Unlike
+ * to_data(), these work for packets with multiple segments, e.g.
+ * zero-copy generator packets.
+ */
+void copy_data(const packet_buffer* buffer, void* dst, uint32_t length);
+
+/*
+ * Return a pointer to the first length octets of packet data, copying
+ * them into buf if they span multiple segments.
+ */
+const void* read_data(const packet_buffer* buffer, void* buf, uint32_t length);
+
 /**
  * Templatized versions to convert pointers to specific types.
  */
@@ -108,6 +121,27 @@ void signature_fill_incr(packet_buffer* buffer, uint16_t offset, uint8_t value);
 
 void signature_fill_prbs(packet_buffer* buffer, uint16_t offset);
 
+/**
+ * Zero-copy functions. Any buffer may be used as a template, e.g. a
+ * read-only buffer whose data is shared by other buffers. Buffers
+ * attached to or cloned from a template hold a reference to it.
+ */
+
+/* Allocate a new buffer from the same pool as the given buffer */
+packet_buffer* allocate(const packet_buffer* buffer);
+
+/* Allocate a new buffer that references the template's data */
+packet_buffer* clone(packet_buffer* tmpl);
+
+/* Make a freshly allocated buffer reference the template's data */
+void attach(packet_buffer* buffer, packet_buffer* tmpl);
+
+/* Append tail to the end of head; returns false on failure */
+bool chain(packet_buffer* head, packet_buffer* tail);
+
+/* Drop our reference to a buffer */
+void release(packet_buffer* buffer);
+
 /**
  * Rx functions; some values are only set on receive path
  */
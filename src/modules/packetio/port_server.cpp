@@ -5,10 +5,12 @@
 #include "utils/overloaded_visitor.hpp"
 
 #include "swagger/v1/model/Port.h"
+#include "swagger/v1/model/PortStatus.h"
 
 namespace openperf::packetio::port::api {
 
 using generic_driver = openperf::packetio::driver::generic_driver;
+using generic_workers = openperf::packetio::workers::generic_workers;
 
 static std::string to_string(const request_msg& request)
 {
@@ -76,14 +78,36 @@ static int handle_rpc_request(const op_event_data* data, void* arg)
 
 server::server(void* context,
                openperf::core::event_loop& loop,
-               generic_driver& driver)
+               generic_driver& driver,
+               generic_workers& workers)
     : m_socket(op_socket_get_server(context, ZMQ_REP, endpoint.data()))
     , m_driver(driver)
+    , m_workers(workers)
 {
     struct op_event_callbacks callbacks = {.on_read = handle_rpc_request};
     loop.add(m_socket.get(), &callbacks, this);
 }
 
+port_ptr server::make_port(const port::generic_port& port) const
+{
+    auto out_port = make_swagger_port(port);
+
+    /*
+     * Receive queues may move between workers, so report where they are,
+     * along with how busy those workers are.
+     */
+    auto& status = *out_port->getStatus();
+    for (auto id : m_workers.get_rx_queue_workers(port.id())) {
+        status.getRxQueueWorkers().push_back(id);
+        auto cycles = m_workers.get_worker_cycles(id).value_or(
+            workers::worker_cycles{0, 0});
+        status.getRxQueueWorkerBusyCycles().push_back(cycles.busy);
+        status.getRxQueueWorkerIdleCycles().push_back(cycles.idle);
+    }
+
+    return (out_port);
+}
+
 reply_msg server::handle_request(const request_list_ports& request)
 {
     /*
@@ -113,7 +137,7 @@ reply_msg server::handle_request(const request_list_ports& request)
     std::transform(std::begin(ports),
                    std::end(ports),
                    std::back_inserter(reply.ports),
-                   [](const auto& port) { return (make_swagger_port(port)); });
+                   [&](const auto& port) { return (make_port(port)); });
 
     return (reply);
 };
@@ -134,7 +158,7 @@ reply_msg server::handle_request(const request_create_port& request)
     }
 
     auto reply = reply_ports{};
-    reply.ports.emplace_back(make_swagger_port(m_driver.port(id).value()));
+    reply.ports.emplace_back(make_port(m_driver.port(id).value()));
     return (reply);
 };
 
@@ -144,7 +168,7 @@ reply_msg server::handle_request(const request_get_port& request)
     if (!port) { return (reply_error{.type = error_type::NOT_FOUND}); }
 
     auto reply = reply_ports{};
-    reply.ports.emplace_back(make_swagger_port(*port));
+    reply.ports.emplace_back(make_port(*port));
     return (reply);
 };
 
@@ -161,7 +185,7 @@ reply_msg server::handle_request(const request_update_port& request)
 
     auto reply = reply_ports{};
     reply.ports.emplace_back(
-        make_swagger_port(m_driver.port(request.port->getId()).value()));
+        make_port(m_driver.port(request.port->getId()).value()));
     return (reply);
 };
 
@@ -3,6 +3,7 @@
 
 #include "core/op_core.h"
 #include "packetio/generic_driver.hpp"
+#include "packetio/generic_workers.hpp"
 #include "packetio/port_api.hpp"
 
 namespace openperf {
@@ -18,7 +19,8 @@ class server
 public:
     server(void* context,
            core::event_loop& loop,
-           driver::generic_driver& driver);
+           driver::generic_driver& driver,
+           workers::generic_workers& workers);
 
     reply_msg handle_request(const request_list_ports&);
     reply_msg handle_request(const request_create_port&);
@@ -27,8 +29,11 @@ public:
     reply_msg handle_request(const request_delete_port&);
 
 private:
+    port_ptr make_port(const port::generic_port& port) const;
+
     std::unique_ptr<void, op_socket_deleter> m_socket;
     driver::generic_driver& m_driver;
+    workers::generic_workers& m_workers;
 };
 
 } // namespace packetio::port::api
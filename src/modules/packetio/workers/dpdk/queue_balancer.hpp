@@ -0,0 +1,112 @@
+#ifndef _OP_PACKETIO_DPDK_QUEUE_BALANCER_HPP_
+#define _OP_PACKETIO_DPDK_QUEUE_BALANCER_HPP_
+
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <vector>
+
+namespace openperf::packetio::dpdk {
+
+/**
+ * The load on a receive queue over some measurement interval, e.g. the
+ * TSC cycles its worker spent receiving from it.
+ */
+struct queue_load
+{
+    uint16_t port_id;
+    uint16_t queue_id;
+    unsigned worker_id;
+    uint64_t load;
+};
+
+struct queue_move
+{
+    uint16_t port_id;
+    uint16_t queue_id;
+    unsigned from;
+    unsigned to;
+};
+
+/**
+ * Find a single queue to move from the busiest worker to the idlest one.
+ *
+ * We only move a queue when the load difference between those workers is
+ * more than imbalance_ratio of the busiest worker's load, and only if
+ * moving the queue shrinks that difference.  Of the candidate queues, we
+ * pick the one that would leave the two workers the most evenly loaded.
+ * Moving one queue per interval keeps the balancer from thrashing queues
+ * back and forth when the load is bursty.
+ *
+ * @param[in] queues
+ *   the current load on each receive queue
+ * @param[in] workers
+ *   the ids of all workers eligible to receive queues
+ * @param[in] min_load
+ *   the minimum load on the busiest worker before we bother moving queues
+ * @param[in] imbalance_ratio
+ *   the minimum imbalance, as a fraction of the busiest worker's load
+ */
+inline std::optional<queue_move>
+find_queue_move(const std::vector<queue_load>& queues,
+                const std::vector<unsigned>& workers,
+                uint64_t min_load,
+                double imbalance_ratio = 0.25)
+{
+    if (workers.size() < 2) { return (std::nullopt); }
+
+    auto worker_loads = std::map<unsigned, uint64_t>{};
+    std::for_each(std::begin(workers), std::end(workers), [&](auto id) {
+        worker_loads.emplace(id, 0);
+    });
+    std::for_each(std::begin(queues), std::end(queues), [&](const auto& q) {
+        if (auto item = worker_loads.find(q.worker_id);
+            item != std::end(worker_loads)) {
+            item->second += q.load;
+        }
+    });
+
+    auto by_load = [](const auto& left, const auto& right) {
+        return (left.second < right.second);
+    };
+    auto [idlest, busiest] = std::minmax_element(
+        std::begin(worker_loads), std::end(worker_loads), by_load);
+
+    if (busiest->second < min_load) { return (std::nullopt); }
+
+    auto imbalance = busiest->second - idlest->second;
+    if (imbalance <= imbalance_ratio * busiest->second) {
+        return (std::nullopt);
+    }
+
+    /*
+     * Moving a queue with load L changes the imbalance to |imbalance - 2L|,
+     * so any queue with 0 < L < imbalance helps.  Pick the one closest to
+     * half of the imbalance.
+     */
+    auto distance = [&](const queue_load& q) {
+        auto twice = 2 * q.load;
+        return (twice > imbalance ? twice - imbalance : imbalance - twice);
+    };
+
+    const queue_load* best = nullptr;
+    for (const auto& q : queues) {
+        if (q.worker_id != busiest->first || q.load == 0
+            || q.load >= imbalance) {
+            continue;
+        }
+        if (!best || distance(q) < distance(*best)) { best = &q; }
+    }
+
+    if (!best) { return (std::nullopt); }
+
+    return (queue_move{.port_id = best->port_id,
+                       .queue_id = best->queue_id,
+                       .from = busiest->first,
+                       .to = idlest->first});
+}
+
+} // namespace openperf::packetio::dpdk
+
+#endif /* _OP_PACKETIO_DPDK_QUEUE_BALANCER_HPP_ */
@@ -25,6 +25,9 @@ rx_queue::rx_queue(uint16_t port_id, uint16_t queue_id)
     : m_port(port_id)
     , m_queue(queue_id)
     , m_flags(0)
+    , m_worker(RTE_MAX_LCORE)
+    , m_packets(0)
+    , m_cycles(0)
 {}
 
 uint16_t rx_queue::port_id() const { return (m_port); }
@@ -41,6 +44,37 @@ void rx_queue::flags(bitflags flags)
     m_flags.store(flags, std::memory_order_release);
 }
 
+uint16_t rx_queue::worker_id() const
+{
+    return (m_worker.load(std::memory_order_acquire));
+}
+
+void rx_queue::worker_id(uint16_t id)
+{
+    m_worker.store(id, std::memory_order_release);
+}
+
+bool rx_queue::hand_off(uint16_t from, uint16_t to)
+{
+    return (
+        m_worker.compare_exchange_strong(from, to, std::memory_order_acq_rel));
+}
+
+rx_queue::load rx_queue::get_load() const
+{
+    return {m_packets.load(std::memory_order_relaxed),
+            m_cycles.load(std::memory_order_relaxed)};
+}
+
+void rx_queue::add_load(uint16_t packets, uint64_t cycles) const
+{
+    /* Single writer, so no need for atomic read-modify-write operations */
+    m_packets.store(m_packets.load(std::memory_order_relaxed) + packets,
+                    std::memory_order_relaxed);
+    m_cycles.store(m_cycles.load(std::memory_order_relaxed) + cycles,
+                   std::memory_order_relaxed);
+}
+
 bool rx_queue::add(int poll_fd, void* data)
 {
     auto fd = get_queue_fd(port_id(), queue_id());
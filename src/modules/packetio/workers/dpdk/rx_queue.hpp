@@ -36,10 +36,38 @@ public:
     bool enable();
     bool disable();
 
+    /*
+     * The id of the worker servicing the queue.  When a queue moves
+     * between workers, the old worker stores the new worker's id once it
+     * has stopped servicing the queue.
+     */
+    uint16_t worker_id() const;
+    void worker_id(uint16_t id);
+
+    /*
+     * Hand the queue from one worker to another.  The new worker starts
+     * servicing the queue once it sees its own id.  Fails if the queue
+     * doesn't belong to the old worker.
+     */
+    bool hand_off(uint16_t from, uint16_t to);
+
+    /* Receive load; only the servicing worker may add to it */
+    struct load
+    {
+        uint64_t packets; /**< packets received */
+        uint64_t cycles;  /**< TSC cycles spent receiving them */
+    };
+
+    load get_load() const;
+    void add_load(uint16_t packets, uint64_t cycles) const;
+
 private:
     uint16_t m_port;
     uint16_t m_queue;
     std::atomic<bitflags> m_flags;
+    std::atomic<uint16_t> m_worker;
+    mutable std::atomic<uint64_t> m_packets;
+    mutable std::atomic<uint64_t> m_cycles;
     struct rte_epoll_event m_event;
 };
 
@@ -0,0 +1,141 @@
+#ifndef _OP_PACKETIO_DPDK_TIMING_WHEEL_HPP_
+#define _OP_PACKETIO_DPDK_TIMING_WHEEL_HPP_
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace openperf::packetio::dpdk::schedule {
+
+/**
+ * A hashed timing wheel for scheduling large numbers of periodic events.
+ *
+ * Deadlines are expressed in ticks, e.g. TSC cycles, and are hashed into
+ * one of 2^WheelBits slots, each of which covers 2^SlotBits ticks.
+ * Inserting an entry and expiring a slot are both O(1) with respect to the
+ * number of scheduled entries. Entries more than one revolution in the
+ * future simply stay in their slot until the wheel comes back around.
+ *
+ * Entries are expired in slot order; entries within a slot are expired in
+ * insertion order.
+ */
+template <typename T, unsigned SlotBits = 10, unsigned WheelBits = 12>
+class timing_wheel
+{
+    static_assert(SlotBits + WheelBits < 64);
+
+public:
+    static constexpr size_t slot_count = 1ULL << WheelBits;
+
+    struct entry
+    {
+        uint64_t deadline;
+        T value;
+    };
+
+    timing_wheel(uint64_t now = 0)
+        : m_cursor(to_slot(now))
+    {}
+
+    bool empty() const { return (m_size == 0); }
+
+    size_t size() const { return (m_size); }
+
+    void insert(uint64_t deadline, T value)
+    {
+        /* Past deadlines go in the current slot so we don't miss them */
+        auto slot = std::max(to_slot(deadline), m_cursor);
+        m_slots[slot & slot_mask].push_back({deadline, std::move(value)});
+        m_size++;
+    }
+
+    /**
+     * Remove every entry with a deadline <= now and pass it to fn, which
+     * may insert new entries. If fn returns false, expiration stops and
+     * all unexpired entries remain in the wheel.
+     *
+     * @return
+     *   the number of expired entries
+     */
+    template <typename Function> size_t expire(uint64_t now, Function&& fn)
+    {
+        auto target = to_slot(now);
+        if (target < m_cursor) { return (0); }
+
+        /* Don't visit any slot more than once */
+        auto first = std::max(m_cursor, target - std::min(target, slot_mask));
+
+        size_t expired = 0;
+        for (auto slot = first; slot <= target; slot++) {
+            /* New entries for past slots will land in this slot */
+            m_cursor = slot;
+
+            /*
+             * Swap the bucket out so that fn can safely insert entries.
+             * Entries that aren't due yet go back into the bucket. If fn
+             * added entries to this slot, check them too.
+             */
+            auto& bucket = m_slots[slot & slot_mask];
+            auto added = bucket.size();
+            while (added) {
+                m_scratch.swap(bucket);
+                size_t kept = 0;
+                auto stop = false;
+                for (auto& item : m_scratch) {
+                    if (stop || item.deadline > now) {
+                        bucket.push_back(std::move(item));
+                        kept++;
+                        continue;
+                    }
+
+                    m_size--;
+                    expired++;
+                    stop = !fn(item.deadline, item.value);
+                }
+                m_scratch.clear();
+                if (stop) { return (expired); }
+
+                added = bucket.size() - kept;
+            }
+        }
+
+        return (expired);
+    }
+
+    template <typename Function> void for_each(Function&& fn) const
+    {
+        for (const auto& bucket : m_slots) {
+            for (const auto& item : bucket) { fn(item.deadline, item.value); }
+        }
+    }
+
+    void clear()
+    {
+        for (auto& bucket : m_slots) { bucket.clear(); }
+        m_size = 0;
+    }
+
+    void reset(uint64_t now)
+    {
+        clear();
+        m_cursor = to_slot(now);
+    }
+
+private:
+    static constexpr uint64_t slot_mask = slot_count - 1;
+
+    static constexpr uint64_t to_slot(uint64_t ticks)
+    {
+        return (ticks >> SlotBits);
+    }
+
+    std::array<std::vector<entry>, slot_count> m_slots;
+    std::vector<entry> m_scratch;
+    uint64_t m_cursor;
+    size_t m_size = 0;
+};
+
+} // namespace openperf::packetio::dpdk::schedule
+
+#endif /* _OP_PACKETIO_DPDK_TIMING_WHEEL_HPP_ */
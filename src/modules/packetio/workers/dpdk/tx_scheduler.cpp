@@ -99,6 +99,19 @@ std::chrono::nanoseconds next_deadline(const Source& source)
     return (units::to_duration<ns>(source.packet_rate() / source.burst_size()));
 }
 
+/* Use 128 bit intermediates so that long intervals don't overflow */
+static uint64_t to_tsc_ticks(std::chrono::nanoseconds ns)
+{
+    return (static_cast<unsigned __int128>(ns.count()) * rte_get_tsc_hz()
+            / std::nano::den);
+}
+
+static std::chrono::nanoseconds from_tsc_ticks(uint64_t ticks)
+{
+    return (std::chrono::nanoseconds(static_cast<unsigned __int128>(ticks)
+                                     * std::nano::den / rte_get_tsc_hz()));
+}
+
 tx_scheduler::tx_scheduler(const worker::tib& tib,
                            uint16_t port_idx,
                            uint16_t queue_idx)
@@ -106,6 +119,7 @@ tx_scheduler::tx_scheduler(const worker::tib& tib,
     , m_portid(port_idx)
     , m_queueid(queue_idx)
     , m_timerfd(timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK))
+    , m_precise(config::dpdk_tx_precise_pacing())
 {
     if (m_timerfd == -1) {
         throw std::runtime_error("Could not create kernel timer: "
@@ -173,10 +187,48 @@ void tx_scheduler::do_reschedule(const schedule::time_point& now)
     while (m_time_reschedule < now) { m_time_reschedule += schedule_poll; }
 }
 
+/*
+ * Precise mode version of the above. Since the timing wheel can hold
+ * thousands of sources, we sort the scheduled keys up front instead of
+ * searching the schedule for every source.
+ */
+void tx_scheduler::do_reschedule_precise(uint64_t now)
+{
+    auto scheduled = std::vector<worker::tib::safe_key_type>{};
+    scheduled.reserve(m_wheel.size());
+    m_wheel.for_each([&](uint64_t, const schedule::precise_entry& entry) {
+        scheduled.push_back(entry.key);
+    });
+    std::sort(std::begin(scheduled), std::end(scheduled));
+
+    for (const auto& key_source : m_tib.get_sources(port_id(), queue_id())) {
+        const auto key = worker::tib::to_safe_key(key_source->first);
+        const auto& source = key_source->second;
+        if (source.active()
+            && !std::binary_search(
+                std::begin(scheduled), std::end(scheduled), key)) {
+            m_wheel.insert(now + to_tsc_ticks(next_deadline(source)),
+                           {key, 0});
+        }
+    }
+
+    auto period = to_tsc_ticks(schedule_poll);
+    while (m_tsc_reschedule <= now) { m_tsc_reschedule += period; }
+}
+
 uint16_t tx_scheduler::port_id() const { return (m_portid); }
 
 uint16_t tx_scheduler::queue_id() const { return (m_queueid); }
 
+bool tx_scheduler::precise() const { return (m_precise); }
+
+bool tx_scheduler::busy_poll() const
+{
+    return (m_precise
+            && (std::holds_alternative<schedule::state_running>(state())
+                || std::holds_alternative<schedule::state_blocked>(state())));
+}
+
 int tx_scheduler::event_fd() const { return (m_timerfd); }
 
 void* tx_scheduler::event_callback_argument() { return (this); }
@@ -382,11 +434,76 @@ static void do_drop(uint16_t port_idx,
     mbufs.clear();
 }
 
+/*
+ * Precise mode version of the running state handler. Instead of sleeping
+ * until the next deadline, we transmit everything that is due and let the
+ * worker call us again on its next loop iteration. Since we know exactly
+ * when each burst leaves, we also report the achieved inter-burst gap.
+ */
+std::optional<schedule::state>
+tx_scheduler::do_run_precise(const schedule::state_running&)
+{
+    /*
+     * We're called on every worker loop iteration, so only check the
+     * link when we look for new sources.
+     */
+    auto now = rte_get_tsc_cycles();
+    if (m_tsc_reschedule <= now) {
+        if (link_down(port_id())) return (schedule::state_link_check{});
+        do_reschedule_precise(now);
+    }
+
+    auto next_state = std::optional<schedule::state>{};
+    m_wheel.expire(now, [&](uint64_t deadline, schedule::precise_entry& entry) {
+        /* Source could have been removed while it was scheduled */
+        auto source = m_tib.get_source(entry.key);
+        if (!source) return (true);
+
+        auto burst_size = source->burst_size();
+        auto sent =
+            do_transmit(port_id(), queue_id(), source, burst_size, m_buffer);
+
+        auto departure = rte_get_tsc_cycles();
+        auto interval = to_tsc_ticks(next_deadline(*source));
+        if (entry.last_departure) {
+            source->update_gap_counters(
+                from_tsc_ticks(interval),
+                from_tsc_ticks(departure - entry.last_departure));
+        }
+
+        if (!m_buffer.empty()) {
+            if (config::dpdk_drop_tx_overruns()) {
+                do_drop(port_id(), queue_id(), source, m_buffer);
+            } else {
+                uint16_t remaining = burst_size - sent - m_buffer.size();
+                next_state = schedule::state_blocked{
+                    remaining, {schedule::clock::now(), entry.key}};
+                return (false);
+            }
+        }
+
+        /* Update from the previous deadline so that intervals don't drift */
+        if (source->active()) {
+            m_wheel.insert(deadline + interval, {entry.key, departure});
+        }
+
+        return (true);
+    });
+
+    if (next_state) return (next_state);
+
+    if (m_wheel.empty()) return (schedule::state_idle{});
+
+    return (std::nullopt);
+}
+
 std::optional<schedule::state>
 tx_scheduler::on_timeout(const schedule::state_running& state)
 {
     assert(m_buffer.empty());
 
+    if (m_precise) return (do_run_precise(state));
+
     if (link_down(port_id())) return (schedule::state_link_check{});
 
     if (state.reschedule) {
@@ -495,7 +612,7 @@ tx_scheduler::on_timeout(const schedule::state_blocked& blocked)
         rte_eth_tx_burst(port_id(), queue_id(), m_buffer.data(), to_send);
     if (sent < to_send) {
         m_buffer.erase(std::begin(m_buffer), std::begin(m_buffer) + sent);
-        set_timer_oneshot(m_timerfd, block_poll);
+        if (!m_precise) { set_timer_oneshot(m_timerfd, block_poll); }
         return (std::nullopt);
     }
     assert(sent == to_send);
@@ -507,7 +624,7 @@ tx_scheduler::on_timeout(const schedule::state_blocked& blocked)
     /* Still blocked */
     if (sent < blocked.remaining) {
         blocked.remaining -= sent;
-        set_timer_oneshot(m_timerfd, block_poll);
+        if (!m_precise) { set_timer_oneshot(m_timerfd, block_poll); }
         return (std::nullopt);
     }
 
@@ -519,7 +636,13 @@ tx_scheduler::on_timeout(const schedule::state_blocked& blocked)
      */
     assert(sent == blocked.remaining);
     assert(m_buffer.empty());
-    if (source->active()) m_schedule.push({schedule::clock::now(), key});
+    if (source->active()) {
+        if (m_precise) {
+            m_wheel.insert(rte_get_tsc_cycles(), {key, 0});
+        } else {
+            m_schedule.push({schedule::clock::now(), key});
+        }
+    }
 
     /* If we don't have any active sources, return to the idle state */
     if (!have_active_sources(m_tib, port_id(), queue_id())) {
@@ -553,6 +676,7 @@ void tx_scheduler::on_transition(const schedule::state_link_check&)
     /* Drop any scheduled items as we can't do anything with them without a link
      * either */
     while (!m_schedule.empty()) { m_schedule.pop(); }
+    m_wheel.clear();
 
     set_timer_interval(m_timerfd, link_poll);
 }
@@ -561,6 +685,22 @@ void tx_scheduler::on_transition(const schedule::state_running& state)
 {
     assert(m_buffer.empty());
 
+    if (m_precise) {
+        auto now = rte_get_tsc_cycles();
+        if (m_wheel.empty()) {
+            m_wheel.reset(now);
+            m_tsc_reschedule = now;
+            do_reschedule_precise(now);
+        }
+
+        /*
+         * The worker busy polls us while running, so the kernel timer
+         * is just a safety net.
+         */
+        set_timer_interval(m_timerfd, idle_poll);
+        return;
+    }
+
     auto now = schedule::clock::now();
     if (m_schedule.empty()) {
         /* Generate a schedule for all available entities */
@@ -591,7 +731,7 @@ void tx_scheduler::on_transition(const schedule::state_blocked&)
 {
     assert(!m_buffer.empty());
     assert(!config::dpdk_drop_tx_overruns());
-    set_timer_oneshot(m_timerfd, block_poll);
+    if (!m_precise) { set_timer_oneshot(m_timerfd, block_poll); }
 }
 
 } // namespace openperf::packetio::dpdk
@@ -9,6 +9,7 @@
 #include "packetio/generic_source.hpp"
 #include "packetio/workers/dpdk/worker_api.hpp"
 #include "packetio/workers/dpdk/pollable_event.tcc"
+#include "packetio/workers/dpdk/timing_wheel.hpp"
 
 namespace openperf::packetio::dpdk {
 
@@ -25,6 +26,13 @@ struct entry
 
 constexpr bool operator>(const entry& left, const entry& right);
 
+/* Timing wheel entry for precise, e.g. TSC based, scheduling */
+struct precise_entry
+{
+    worker::tib::safe_key_type key;
+    uint64_t last_departure; /* TSC of previous burst; 0 if none */
+};
+
 struct state_idle
 {}; /* No events are scheduled */
 struct state_link_check
@@ -49,6 +57,8 @@ template <typename Derived, typename StateVariant> class finite_state_machine
     StateVariant m_state;
 
 public:
+    const StateVariant& state() const { return (m_state); }
+
     void run()
     {
         auto& child = static_cast<Derived&>(*this);
@@ -100,7 +110,19 @@ class tx_scheduler
 
     schedule::time_point m_time_reschedule;
 
+    /*
+     * In precise mode, sources are scheduled on a timing wheel using TSC
+     * deadlines and the worker busy polls us instead of waiting for the
+     * kernel timer to fire.
+     */
+    bool m_precise;
+    schedule::timing_wheel<schedule::precise_entry> m_wheel;
+    uint64_t m_tsc_reschedule = 0;
+
     void do_reschedule(const schedule::time_point& now);
+    void do_reschedule_precise(uint64_t now);
+    std::optional<schedule::state>
+    do_run_precise(const schedule::state_running&);
 
 public:
     tx_scheduler(const worker::tib& tib, uint16_t port_idx, uint16_t queue_idx);
@@ -109,6 +131,12 @@ public:
     uint16_t port_id() const;
     uint16_t queue_id() const;
 
+    /* Indicates whether this scheduler uses precise pacing */
+    bool precise() const;
+
+    /* Indicates whether this scheduler needs to be busy polled */
+    bool busy_poll() const;
+
     int event_fd() const;
     void* event_callback_argument();
     pollable_event<tx_scheduler>::event_callback
@@ -86,4 +86,10 @@ void tx_source::update_drop_counters(uint16_t packets, size_t octets) const
     m_source.update_drop_counters(packets, octets);
 }
 
+void tx_source::update_gap_counters(std::chrono::nanoseconds intended,
+                                    std::chrono::nanoseconds actual) const
+{
+    m_source.update_gap_counters(intended, actual);
+}
+
 } // namespace openperf::packetio::dpdk
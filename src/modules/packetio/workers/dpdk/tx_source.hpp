@@ -38,6 +38,8 @@ public:
     packet::packets_per_hour packet_rate() const;
     uint16_t pull(rte_mbuf* packets[], uint16_t count) const;
     void update_drop_counters(uint16_t packets, size_t octets) const;
+    void update_gap_counters(std::chrono::nanoseconds intended,
+                             std::chrono::nanoseconds actual) const;
 };
 
 } // namespace openperf::packetio::dpdk
@@ -1,5 +1,7 @@
 #include <algorithm>
 #include <array>
+#include <atomic>
+#include <cinttypes>
 #include <memory>
 #include <optional>
 #include <variant>
@@ -10,6 +12,7 @@
 #include "core/op_log.h"
 #include "core/op_thread.h"
 #include "utils/prefetch_for_each.hpp"
+#include "packetio/drivers/dpdk/arg_parser.hpp"
 #include "packetio/drivers/dpdk/dpdk.h"
 #include "packetio/drivers/dpdk/mbuf_metadata.hpp"
 
@@ -33,6 +36,31 @@ const std::string_view endpoint = "inproc://op_packetio_workers_control";
 
 static constexpr int idle_loop_timeout = 10; /* milliseconds */
 
+/*
+ * How long to wait for events while another worker is handing us a queue
+ * and we have nothing else to do.
+ */
+static constexpr int hand_off_poll_timeout = 1; /* milliseconds */
+
+/*
+ * Maximum number of times we service every receive queue before we check
+ * for control messages.  Without a limit, a saturated worker might never
+ * look at its messages.
+ */
+static constexpr unsigned rx_burst_budget = 16;
+
+/*
+ * How often spinning workers check their event fds when they are busy.
+ * Each check is a system call, so we don't want to make one every loop.
+ */
+static constexpr auto event_poll_period = std::chrono::microseconds(20);
+
+/*
+ * Maximum length of a single power aware pause when adaptive polling.
+ * Linux limits UMWAIT/TPAUSE to roughly 100k cycles by default anyway.
+ */
+static constexpr auto idle_pause_period = std::chrono::microseconds(50);
+
 /**
  * We only have two states we transition between, based on our messages:
  * stopped and started.  We use each struct as a tag for each state.  And
@@ -90,19 +118,17 @@ static bool all_pollable(const std::vector<task_ptr>& tasks)
 }
 
 /**
- * Resolve interfaces for the packets and store interface in the packet
- * ancillary data.  If the mbuf is destined to an interface which is not
- * found, the mbuf is added to the list of packets to free.
+ * Look up the interfaces for the destination MAC addresses of a burst of
+ * packets.  Multicast addresses never match an interface.
  */
-static std::pair<uint16_t, uint16_t> rx_resolve_interfaces(const fib* fib,
-                                                           const rx_queue* rxq,
-                                                           rte_mbuf* incoming[],
-                                                           uint16_t n,
-                                                           rte_mbuf* to_stack[],
-                                                           rte_mbuf* to_free[])
+static void rx_lookup_interfaces(const fib* fib,
+                                 uint16_t port_id,
+                                 rte_mbuf* const incoming[],
+                                 uint16_t n,
+                                 const worker::fib::interface_sinks* entries[])
 {
-    uint16_t nb_to_stack = 0, nb_to_free = 0;
-    auto port_id = rxq->port_id();
+    std::array<const uint8_t*, pkt_burst_size> dst_addrs;
+    uint16_t nb_dst_addrs = 0;
 
     /*
      * Pre-fetching the payload data to the CPU cache is critical for
@@ -112,38 +138,67 @@ static std::pair<uint16_t, uint16_t> rx_resolve_interfaces(const fib* fib,
     utils::prefetch_for_each(
         incoming,
         incoming + n,
-        [](auto mbuf) {
+        [](auto* mbuf) {
             /* prefetch mbuf payload */
             rte_prefetch0(rte_pktmbuf_mtod(mbuf, void*));
         },
-        [&](auto mbuf) {
-            auto eth = rte_pktmbuf_mtod(mbuf, struct rte_ether_hdr*);
-            if (rte_is_unicast_ether_addr(&eth->dst_addr)) {
-                if (auto* ifp = fib->find_interface(port_id,
-                                                    eth->dst_addr.addr_bytes)) {
-                    mbuf_tag_set(mbuf, ifp);
-                    to_stack[nb_to_stack++] = mbuf;
-                } else {
-                    mbuf_tag_clear(mbuf);
-                    to_free[nb_to_free++] = mbuf;
-                }
-            } else {
-                mbuf_tag_clear(mbuf);
-                to_stack[nb_to_stack++] = mbuf;
-            }
+        [&](auto* mbuf) {
+            auto* eth = rte_pktmbuf_mtod(mbuf, struct rte_ether_hdr*);
+            dst_addrs[nb_dst_addrs++] = eth->dst_addr.addr_bytes;
         },
         mbuf_prefetch_offset);
 
+    /* The fib prefetches its buckets for the whole burst before probing */
+    fib->find_interface_and_sinks(port_id, dst_addrs.data(), entries, n);
+}
+
+static bool rx_is_unicast(const rte_mbuf* mbuf)
+{
+    return (rte_is_unicast_ether_addr(
+        &rte_pktmbuf_mtod(mbuf, const struct rte_ether_hdr*)->dst_addr));
+}
+
+/**
+ * Resolve interfaces for the packets and store interface in the packet
+ * ancillary data.  If the mbuf is destined to an interface which is not
+ * found, the mbuf is added to the list of packets to free.
+ */
+static std::pair<uint16_t, uint16_t> rx_resolve_interfaces(const fib* fib,
+                                                           const rx_queue* rxq,
+                                                           rte_mbuf* incoming[],
+                                                           uint16_t n,
+                                                           rte_mbuf* to_stack[],
+                                                           rte_mbuf* to_free[])
+{
+    uint16_t nb_to_stack = 0, nb_to_free = 0;
+    std::array<const worker::fib::interface_sinks*, pkt_burst_size> entries;
+
+    rx_lookup_interfaces(fib, rxq->port_id(), incoming, n, entries.data());
+
+    for (uint16_t i = 0; i < n; i++) {
+        auto* mbuf = incoming[i];
+        if (entries[i]) {
+            mbuf_tag_set(mbuf, std::addressof(entries[i]->ifp));
+            to_stack[nb_to_stack++] = mbuf;
+        } else if (rx_is_unicast(mbuf)) {
+            mbuf_tag_clear(mbuf);
+            to_free[nb_to_free++] = mbuf;
+        } else {
+            mbuf_tag_clear(mbuf);
+            to_stack[nb_to_stack++] = mbuf;
+        }
+    }
+
     return std::make_pair(nb_to_stack, nb_to_free);
 }
 
 /**
- * Dispatch unicast packets to sinks on the interface.
+ * Dispatch packets to the specified interface sinks.
  */
-static void rx_interface_sink_push_unicast_burst(
-    const std::vector<packet::generic_sink>& sinks,
-    rte_mbuf* incoming[],
-    uint16_t n)
+static void
+rx_interface_sink_push_burst(const std::vector<packet::generic_sink>& sinks,
+                             rte_mbuf* incoming[],
+                             uint16_t n)
 {
     for (auto& sink : sinks) {
         if (!sink.active()) { continue; }
@@ -155,34 +210,6 @@ static void rx_interface_sink_push_unicast_burst(
     }
 }
 
-/**
- * Dispatch multicast packets to all interface sinks on the port.
- *
- * This function assumes all packets in the incoming burst are
- * multicast packets.
- */
-static void rx_interface_sink_push_multicast_burst(const fib* fib,
-                                                   const rx_queue* rxq,
-                                                   rte_mbuf* incoming[],
-                                                   uint16_t n)
-{
-    // Multicast dispatch to all sinks on port
-    // This will be slow when there are a lot of interfaces
-    for (auto&& [idx, entry] : fib->get_interfaces(rxq->port_id())) {
-        auto ifp = entry->ifp;
-        for (auto& sink : entry->rx_sinks) {
-            if (sink.active()) {
-                OP_LOG(OP_LOG_TRACE,
-                       "Dispatching packets to interface sink %s\n",
-                       sink.id().c_str());
-                sink.push(
-                    reinterpret_cast<packet::packet_buffer* const*>(incoming),
-                    n);
-            }
-        }
-    }
-}
-
 /**
  * Dispatch packets to interface sinks on the port.
  *
@@ -205,76 +232,51 @@ rx_interface_sink_dispatch(const fib* fib,
     uint16_t nbursts = 0;
     uint16_t nb_to_stack = 0, nb_to_free = 0;
 
-    rte_ether_addr* last_dst_addr = nullptr;
-    const worker::fib::interface_sinks* last_entry = nullptr;
-
-    /*
-     * Pre-fetching the payload data to the CPU cache is critical for
-     * parsing performance.  This series of loops is inteded to keep the
-     * cache filled with pending data.
-     */
+    std::array<const worker::fib::interface_sinks*, pkt_burst_size> entries;
+    rx_lookup_interfaces(fib, rxq->port_id(), incoming, n, entries.data());
 
-    utils::prefetch_for_each(
-        incoming,
-        incoming + n,
-        [](auto* mbuf) {
-            /* prefetch mbuf payload */
-            rte_prefetch0(rte_pktmbuf_mtod(mbuf, void*));
-        },
-        [&](auto* mbuf) {
-            auto* eth = rte_pktmbuf_mtod(mbuf, struct rte_ether_hdr*);
-            auto* dst_addr = &eth->dst_addr;
-            bool unicast = rte_is_unicast_ether_addr(dst_addr);
-
-            if (unicast) {
-                // Unicast packets must match an interface or they will
-                // be discarded
-                if (!last_dst_addr
-                    || !rte_is_same_ether_addr(dst_addr, last_dst_addr)) {
-                    last_dst_addr = dst_addr;
-                    last_entry = fib->find_interface_and_sinks(
-                        rxq->port_id(), dst_addr->addr_bytes);
-                }
-                if (!last_entry) {
-                    // Packet doesn't match any interfaces
-                    to_free[nb_to_free++] = mbuf;
-                    return;
-                } else {
-                    // Store interface pointers to avoid multiple
-                    // lookups for the same packet
-                    mbuf_tag_set(mbuf, std::addressof(last_entry->ifp));
-                    to_stack[nb_to_stack++] = mbuf;
-                }
-            } else {
-                // Multicast packets don't need to match anything
-                // They will be delivered to all sinks on the port.
-                to_stack[nb_to_stack++] = mbuf;
-                mbuf_tag_clear(mbuf);
-            }
+    for (uint16_t i = 0; i < n; i++) {
+        auto* mbuf = incoming[i];
+        auto* entry = entries[i];
+        if (entry) {
+            // Store interface pointers to avoid multiple
+            // lookups for the same packet
+            mbuf_tag_set(mbuf, std::addressof(entry->ifp));
+            to_stack[nb_to_stack++] = mbuf;
+        } else if (rx_is_unicast(mbuf)) {
+            // Unicast packets must match an interface or they will
+            // be discarded
+            to_free[nb_to_free++] = mbuf;
+            continue;
+        } else {
+            // Multicast packets don't need to match anything
+            // They will be delivered to all sinks on the port.
+            mbuf_tag_clear(mbuf);
+            to_stack[nb_to_stack++] = mbuf;
+        }
 
-            if (!burst || std::get<IFP_SINKS>(*burst) != last_entry) {
-                // Start a new burst
-                bursts[nbursts++] = burst_tuple{nb_to_stack - 1, 1, last_entry};
-            } else {
-                // Extend the current burst
-                ++std::get<COUNT>(*burst);
-            }
-        },
-        mbuf_prefetch_offset);
+        if (!burst || std::get<IFP_SINKS>(*burst) != entry) {
+            // Start a new burst
+            burst = &bursts[nbursts++];
+            *burst = burst_tuple{nb_to_stack - 1, 1, entry};
+        } else {
+            // Extend the current burst
+            ++std::get<COUNT>(*burst);
+        }
+    }
 
     std::for_each(bursts.data(), bursts.data() + nbursts, [&](auto& tuple) {
         auto entry = std::get<IFP_SINKS>(tuple);
         if (entry) {
-            rx_interface_sink_push_unicast_burst(entry->rx_sinks,
-                                                 to_stack
-                                                     + std::get<START>(tuple),
-                                                 std::get<COUNT>(tuple));
+            rx_interface_sink_push_burst(entry->rx_sinks,
+                                         to_stack + std::get<START>(tuple),
+                                         std::get<COUNT>(tuple));
         } else {
-            rx_interface_sink_push_multicast_burst(fib,
-                                                   rxq,
-                                                   to_stack
-                                                       + std::get<START>(tuple),
-                                                   std::get<COUNT>(tuple));
+            /* Multicast packets go to all interface sinks on the port */
+            rx_interface_sink_push_burst(
+                fib->get_multicast_rx_sinks(rxq->port_id()),
+                to_stack + std::get<START>(tuple),
+                std::get<COUNT>(tuple));
         }
     });
 
@@ -434,6 +436,14 @@ static void rx_sink_dispatch(const fib* fib,
     }
 }
 
+/* Queue load is only needed when the controller rebalances queues */
+static bool rx_load_enabled()
+{
+    static const bool enabled =
+        config::dpdk_rx_queue_rebalance_period().count() > 0;
+    return (enabled);
+}
+
 static uint16_t rx_burst(const fib* fib, const rx_queue* rxq)
 {
     std::array<rte_mbuf*, pkt_burst_size> incoming;
@@ -443,6 +453,8 @@ static uint16_t rx_burst(const fib* fib, const rx_queue* rxq)
 
     if (!n) return (0);
 
+    const auto start = rx_load_enabled() ? rte_rdtsc() : 0;
+
     OP_LOG(OP_LOG_TRACE,
            "Received %d packet%s on %d:%d\n",
            n,
@@ -463,6 +475,9 @@ static uint16_t rx_burst(const fib* fib, const rx_queue* rxq)
         rx_interface_dispatch(fib, rxq, incoming.data(), n);
     }
 
+    /* Track queue load so the controller can balance queues among workers */
+    if (rx_load_enabled()) { rxq->add_load(n, rte_rdtsc() - start); }
+
     return (n);
 }
 
@@ -493,7 +508,8 @@ static void tx_interface_sink_dispatch(const fib* fib,
             if (sinks) {
                 // Start a new burst
                 assert(nbursts < bursts.size());
-                bursts[nbursts++] = burst_tuple{processed, 1, sinks};
+                burst = &bursts[nbursts++];
+                *burst = burst_tuple{processed, 1, sinks};
             } else {
                 // No sinks found, so can skip this burst
                 burst = nullptr;
@@ -713,16 +729,91 @@ static void disable_event_interrupt(const task_ptr& task)
     std::visit(disable_visitor, task);
 }
 
+/*
+ * Each worker only updates its own counters, so we don't need atomic
+ * read-modify-write operations.  Anyone may read them, though.
+ */
+struct alignas(RTE_CACHE_LINE_SIZE) cycle_counters
+{
+    std::atomic<uint64_t> busy = {0};
+    std::atomic<uint64_t> idle = {0};
+};
+
+static std::array<cycle_counters, RTE_MAX_LCORE> worker_cycle_counters;
+
+class cycle_accountant
+{
+    cycle_counters& m_counters;
+    uint64_t m_last;
+
+    uint64_t elapsed()
+    {
+        auto now = rte_rdtsc();
+        auto delta = now - m_last;
+        m_last = now;
+        return (delta);
+    }
+
+    static void add(std::atomic<uint64_t>& counter, uint64_t delta)
+    {
+        counter.store(counter.load(std::memory_order_relaxed) + delta,
+                      std::memory_order_relaxed);
+    }
+
+public:
+    cycle_accountant()
+        : m_counters(worker_cycle_counters[rte_lcore_id()])
+        , m_last(rte_rdtsc())
+    {}
+
+    /* Charge all cycles since the previous call to the named counter */
+    void busy() { add(m_counters.busy, elapsed()); }
+    void idle() { add(m_counters.idle, elapsed()); }
+};
+
+worker_cycles get_worker_cycles(unsigned worker_id)
+{
+    assert(worker_id < RTE_MAX_LCORE);
+    const auto& counters = worker_cycle_counters[worker_id];
+    return {counters.busy.load(std::memory_order_relaxed),
+            counters.idle.load(std::memory_order_relaxed)};
+}
+
 struct run_args
 {
     void* control;
     recycler* recycler;
     event_loop::generic_event_loop& loop;
     const fib* fib;
-    const std::vector<task_ptr>& rx_queues;
+    std::vector<task_ptr>& rx_queues;
+    std::vector<task_ptr>& pending_rx_queues;
     const std::vector<task_ptr>& pollables;
 };
 
+/*
+ * Start servicing the queues that other workers have finished handing off
+ * to us.  Adopted queues are appended to our receive queues.  Returns the
+ * number of adopted queues.
+ */
+static size_t adopt_rx_queues(run_args& args)
+{
+    if (args.pending_rx_queues.empty()) { return (0); }
+
+    auto cursor = std::stable_partition(
+        std::begin(args.pending_rx_queues),
+        std::end(args.pending_rx_queues),
+        [](const auto& item) {
+            return (std::get<rx_queue*>(item)->worker_id() != rte_lcore_id());
+        });
+    auto nb_adopted = std::distance(cursor, std::end(args.pending_rx_queues));
+
+    args.rx_queues.insert(
+        std::end(args.rx_queues), cursor, std::end(args.pending_rx_queues));
+    args.pending_rx_queues.erase(cursor, std::end(args.pending_rx_queues));
+
+    return (nb_adopted);
+}
+
 static void run_pollable(run_args&& args)
 {
     bool messages = false;
@@ -750,8 +841,28 @@ static void run_pollable(run_args&& args)
         } while (service_event(args.loop, args.fib, q));
     }
 
+    auto cycles = cycle_accountant();
+
+    /* Queues we adopt need the same interrupt treatment as above */
+    auto adopt = [&]() {
+        const auto first = args.rx_queues.size();
+        if (!adopt_rx_queues(args)) { return; }
+
+        for (auto i = first; i < args.rx_queues.size(); i++) {
+            auto& q = args.rx_queues[i];
+            poller.add(q);
+            do {
+                enable_event_interrupt(q);
+            } while (service_event(args.loop, args.fib, q));
+        }
+    };
+
     while (!messages) {
-        auto& events = poller.poll();
+        cycles.busy();
+        adopt();
+        auto& events = poller.poll(
+            args.pending_rx_queues.empty() ? -1 : hand_off_poll_timeout);
+        cycles.idle();
         {
             auto guard = utils::recycle::guard(*args.recycler, rte_lcore_id());
             for (auto& event : events) {
@@ -811,6 +922,60 @@ static bool have_active_rx_sinks(const fib* fib,
         }));
 }
 
+static bool have_precise_schedulers(const std::vector<task_ptr>& pollables)
+{
+    return (std::any_of(
+        std::begin(pollables), std::end(pollables), [](const auto& item) {
+            auto* scheduler = std::get_if<tx_scheduler*>(&item);
+            return (scheduler && (*scheduler)->precise());
+        }));
+}
+
+/*
+ * Run every scheduler that wants to be busy polled, e.g. precise schedulers
+ * with active sources. Returns true if any scheduler was run.
+ */
+static bool run_busy_schedulers(const std::vector<task_ptr>& pollables)
+{
+    auto busy = false;
+    for (auto& item : pollables) {
+        auto* scheduler = std::get_if<tx_scheduler*>(&item);
+        if (scheduler && (*scheduler)->busy_poll()) {
+            (*scheduler)->run();
+            busy = true;
+        }
+    }
+    return (busy);
+}
+
+/*
+ * Service all receive queues until they are empty or we run out of burst
+ * budget.  Busy schedulers check their deadlines after every burst, so
+ * receive load can't delay transmission.  Returns the number of packets
+ * received and whether any scheduler ran.
+ */
+static std::pair<unsigned, bool> service_rx_queues(run_args& args)
+{
+    unsigned pkts, nb_pkts = 0, budget = rx_burst_budget;
+    auto busy = run_busy_schedulers(args.pollables);
+    do {
+        pkts = 0;
+        for (auto& q : args.rx_queues) {
+            pkts += service_event(args.loop, args.fib, q);
+            busy |= run_busy_schedulers(args.pollables);
+        }
+        nb_pkts += pkts;
+    } while (pkts && --budget);
+
+    return {nb_pkts, busy};
+}
+
+static uint64_t to_tsc_cycles(std::chrono::nanoseconds duration)
+{
+    return (rte_get_tsc_hz() * duration.count()
+            / std::chrono::nanoseconds(std::chrono::seconds(1)).count());
+}
+
 static void run_spinning(run_args&& args)
 {
     bool messages = false;
@@ -822,35 +987,245 @@ static void run_spinning(run_args&& args)
 
     for (auto& p : args.pollables) { poller.add(p); }
 
+    auto cycles = cycle_accountant();
+
+    const auto poll_cycles = to_tsc_cycles(event_poll_period);
+    auto next_poll = rte_rdtsc();
+
     while (!messages) {
         args.recycler->reader_checkpoint(rte_lcore_id());
+        adopt_rx_queues(args);
 
-        /* Service all receive queues until empty */
-        uint16_t pkts;
-        do {
-            pkts = 0;
-            for (auto& q : args.rx_queues) {
-                pkts += service_event(args.loop, args.fib, q);
-            }
-        } while (pkts);
+        auto [nb_pkts, busy] = service_rx_queues(args);
+
+        if (nb_pkts || busy) {
+            cycles.busy();
+        } else {
+            cycles.idle();
+        }
 
         /*
          * All queues are idle. Generate a poll timeout based on whether we
-         * have any active sinks or not. We don't want to consume a CPU if
-         * nobody wants any packets.
+         * have any active sinks or busy schedulers. We don't want to consume
+         * a CPU if nobody wants any packets.
+         */
+        int timeout =
+            (busy || have_active_rx_sinks(args.fib, args.rx_queues)
+                 ? 0
+                 : (args.pending_rx_queues.empty() ? idle_loop_timeout
+                                                   : hand_off_poll_timeout));
+
+        /*
+         * Don't make a system call on every loop just to find out that
+         * nothing happened.  Check our events when we are going to wait
+         * for them anyway, or once the poll period has passed.
          */
-        int timeout = (have_active_rx_sinks(args.fib, args.rx_queues)
-                           ? 0
-                           : idle_loop_timeout);
-        for (auto& event : poller.poll(timeout)) {
+        if (!timeout && rte_rdtsc() < next_poll) { continue; }
+
+        auto& events = poller.poll(timeout);
+        cycles.idle();
+        for (auto& event : events) {
+            service_event(args.loop, args.fib, event);
+        }
+        next_poll = rte_rdtsc() + poll_cycles;
+
+        /*
+         * Perform all loop updates before exiting or restarting the
+         * loop.
+         */
+        loop_adapter.update_poller(poller);
+        cycles.busy();
+    }
+
+    for (auto& p : args.pollables) { poller.del(p); }
+
+    poller.del(&ctrl_sock);
+}
+
+/*
+ * Stall until the deadline, or until a packet arrives, in a power friendly
+ * manner.  Where the CPU supports it, we use UMWAIT to monitor the next
+ * receive descriptor of every queue so that we wake as soon as a packet
+ * arrives.  Otherwise, we use TPAUSE to wait for the deadline.  Returns
+ * false if the CPU supports neither.
+ */
+static bool power_wait(const std::vector<task_ptr>& rx_queues,
+                       uint64_t deadline)
+{
+    static const auto intrinsics = []() {
+        auto tmp = rte_cpu_intrinsics{};
+        rte_cpu_get_intrinsics_support(&tmp);
+        return (tmp);
+    }();
+
+    static constexpr size_t max_monitor_queues = 8;
+    const auto nb_queues = rx_queues.size();
+
+    if (nb_queues && nb_queues <= max_monitor_queues
+        && (nb_queues == 1 ? intrinsics.power_monitor
+                           : intrinsics.power_monitor_multi)) {
+        auto conditions =
+            std::array<rte_power_monitor_cond, max_monitor_queues>{};
+        auto nb_conditions = 0U;
+        for (auto& item : rx_queues) {
+            const auto* rxq = std::get<rx_queue*>(item);
+            if (rte_eth_get_monitor_addr(rxq->port_id(),
+                                         rxq->queue_id(),
+                                         &conditions[nb_conditions])
+                != 0) {
+                break;
+            }
+            nb_conditions++;
+        }
+
+        if (nb_conditions == nb_queues
+            && (nb_queues == 1 ? rte_power_monitor(conditions.data(), deadline)
+                               : rte_power_monitor_multi(
+                                   conditions.data(), nb_queues, deadline))
+                   == 0) {
+            return (true);
+        }
+    }
+
+    if (intrinsics.power_pause) {
+        rte_power_pause(deadline);
+        return (true);
+    }
+
+    return (false);
+}
+
+/*
+ * Adaptive polling busy polls all queues while traffic is flowing.  Once
+ * the queues have been idle for the spin period, we switch to the cheapest
+ * available way of waiting for more: a power aware CPU pause, receive
+ * interrupts, or, as a last resort, continued spinning.
+ */
+static void run_adaptive(run_args&& args, std::chrono::microseconds spin_period)
+{
+    bool messages = false;
+    auto ctrl_sock = zmq_socket(args.control, &messages);
+    auto& loop_adapter = args.loop.get<event_loop_adapter>();
+    auto poller = epoll_poller();
+
+    const auto spin_cycles = to_tsc_cycles(spin_period);
+    const auto pause_cycles = to_tsc_cycles(idle_pause_period);
+
+    auto interrupts = all_pollable(args.rx_queues);
+
+    poller.add(&ctrl_sock);
+
+    for (auto& p : args.pollables) { poller.add(p); }
+
+    if (interrupts) {
+        for (auto& q : args.rx_queues) { poller.add(q); }
+    }
+
+    auto cycles = cycle_accountant();
+
+    /* Service pending events and return true if there were any */
+    auto service_events = [&](int timeout) {
+        auto& events = poller.poll(timeout);
+        cycles.idle();
+        for (auto& event : events) {
             service_event(args.loop, args.fib, event);
         }
+        return (!events.empty());
+    };
+
+    /* Check for events without blocking, but only once per poll period */
+    const auto poll_cycles = to_tsc_cycles(event_poll_period);
+    auto next_poll = rte_rdtsc();
+    auto check_events = [&](uint64_t now) {
+        if (now < next_poll) { return; }
+        service_events(0);
+        next_poll = now + poll_cycles;
+    };
+
+    /*
+     * Enable interrupts and wait for something to happen.  As in
+     * run_pollable, we have to make sure the queues are empty after we
+     * enable interrupts, otherwise we might never get one.  Returns true
+     * if we found any work before the wait timed out.
+     */
+    auto wait_for_interrupts = [&]() {
+        uint16_t pkts = 0;
+        for (auto& q : args.rx_queues) {
+            enable_event_interrupt(q);
+            pkts += service_event(args.loop, args.fib, q);
+        }
+
+        auto events = !pkts && service_events(idle_loop_timeout);
+
+        for (auto& q : args.rx_queues) { disable_event_interrupt(q); }
+
+        return (pkts || events);
+    };
+
+    /*
+     * Adopted queues need to be in the poller if we use interrupts.  If
+     * one of them can't be, fall back to not using interrupts at all.
+     */
+    auto adopt = [&]() {
+        const auto first = args.rx_queues.size();
+        if (!adopt_rx_queues(args) || !interrupts) { return; }
+
+        for (auto i = first; i < args.rx_queues.size(); i++) {
+            if (!poller.add(args.rx_queues[i])) {
+                for (auto j = 0U; j < i; j++) { poller.del(args.rx_queues[j]); }
+                interrupts = false;
+                return;
+            }
+        }
+    };
+
+    auto last_busy = rte_rdtsc();
+    while (!messages) {
+        args.recycler->reader_checkpoint(rte_lcore_id());
+        adopt();
+
+        auto [nb_pkts, busy] = service_rx_queues(args);
+
+        if (nb_pkts || busy) {
+            cycles.busy();
+            last_busy = rte_rdtsc();
+            check_events(last_busy);
+        } else if (!have_active_rx_sinks(args.fib, args.rx_queues)) {
+            /* Nobody wants packets; don't bother with the queues */
+            cycles.idle();
+            service_events(args.pending_rx_queues.empty()
+                               ? idle_loop_timeout
+                               : hand_off_poll_timeout);
+        } else if (auto now = rte_rdtsc(); now - last_busy < spin_cycles) {
+            cycles.idle();
+            rte_pause();
+            check_events(now);
+        } else {
+            cycles.idle();
+            if (!power_wait(args.rx_queues, now + pause_cycles)) {
+                if (interrupts) {
+                    /*
+                     * If we were woken for a reason, spin for a while to
+                     * look for more traffic; otherwise keep waiting.
+                     */
+                    if (wait_for_interrupts()) { last_busy = rte_rdtsc(); }
+                } else {
+                    rte_pause();
+                }
+            }
+            service_events(0);
+        }
 
         /*
          * Perform all loop updates before exiting or restarting the
          * loop.
          */
         loop_adapter.update_poller(poller);
+        cycles.busy();
+    }
+
+    if (interrupts) {
+        for (auto& q : args.rx_queues) { poller.del(q); }
     }
 
     for (auto& p : args.pollables) { poller.del(p); }
@@ -868,7 +1243,15 @@ static void run(run_args&& args)
      */
     if (op_socket_has_messages(args.control)) return;
 
-    if (args.rx_queues.empty() || all_pollable(args.rx_queues)) {
+    if (auto spin_period = config::dpdk_worker_spin_period();
+        spin_period.count()) {
+        run_adaptive(std::forward<run_args>(args), spin_period);
+        return;
+    }
+
+    /* Precise transmit schedulers must be busy polled */
+    if ((args.rx_queues.empty() || all_pollable(args.rx_queues))
+        && !have_precise_schedulers(args.pollables)) {
         run_pollable(std::forward<run_args>(args));
     } else {
         run_spinning(std::forward<run_args>(args));
@@ -892,6 +1275,9 @@ class worker : public finite_state_machine<worker, state, command_msg>
     std::vector<task_ptr> m_rx_queues;
     std::vector<task_ptr> m_pollables;
 
+    /* Queues moving to us that their old owner hasn't handed off yet */
+    std::vector<task_ptr> m_pending_rx_queues;
+
     void add_config(const std::vector<descriptor>& descriptors)
     {
         for (auto& d : descriptors) {
@@ -913,6 +1299,7 @@ class worker : public finite_state_machine<worker, state, command_msg>
                                rxq->port_id(),
                                rxq->queue_id(),
                                rte_lcore_id());
+                        rxq->worker_id(rte_lcore_id());
                         m_rx_queues.emplace_back(rxq);
                     },
                     [&](tx_queue* txq) {
@@ -964,6 +1351,11 @@ class worker : public finite_state_machine<worker, state, command_msg>
                                                       std::end(m_rx_queues),
                                                       task_ptr{rxq}),
                                           std::end(m_rx_queues));
+                        m_pending_rx_queues.erase(
+                            std::remove(std::begin(m_pending_rx_queues),
+                                        std::end(m_pending_rx_queues),
+                                        task_ptr{rxq}),
+                            std::end(m_pending_rx_queues));
                     },
                     [&](tx_queue* txq) {
                         OP_LOG(OP_LOG_DEBUG,
@@ -988,6 +1380,50 @@ class worker : public finite_state_machine<worker, state, command_msg>
         }
     }
 
+    void move_config(const std::vector<descriptor>& descriptors)
+    {
+        for (auto& d : descriptors) {
+            if (!std::holds_alternative<rx_queue*>(d.ptr)) continue;
+
+            auto* rxq = std::get<rx_queue*>(d.ptr);
+
+            /*
+             * Don't wait for the old owner to release incoming queues.
+             * We keep servicing our other queues and start on this one as
+             * soon as we see that it has been handed off to us.
+             */
+            if (d.worker_id == rte_lcore_id()) {
+                m_pending_rx_queues.emplace_back(rxq);
+                continue;
+            }
+
+            auto item = std::find(std::begin(m_rx_queues),
+                                  std::end(m_rx_queues),
+                                  task_ptr{rxq});
+            if (item == std::end(m_rx_queues)) continue;
+
+            /*
+             * We aren't servicing any queues while handling messages, so
+             * it's safe to hand off outgoing queues now.
+             */
+            OP_LOG(OP_LOG_DEBUG,
+                   "Moving RX port queue %u:%u from worker %u to worker %u\n",
+                   rxq->port_id(),
+                   rxq->queue_id(),
+                   rte_lcore_id(),
+                   d.worker_id);
+            if (!rxq->hand_off(rte_lcore_id(), d.worker_id)) {
+                OP_LOG(OP_LOG_ERROR,
+                       "Worker %u does not own RX port queue %u:%u\n",
+                       rte_lcore_id(),
+                       rxq->port_id(),
+                       rxq->queue_id());
+                continue;
+            }
+            m_rx_queues.erase(item);
+        }
+    }
+
     run_args make_run_args()
     {
         return (run_args{.control = m_control,
@@ -995,6 +1431,7 @@ class worker : public finite_state_machine<worker, state, command_msg>
                          .loop = m_loop,
                          .fib = m_fib,
                          .rx_queues = m_rx_queues,
+                         .pending_rx_queues = m_pending_rx_queues,
                          .pollables = m_pollables});
     }
 
@@ -1039,6 +1476,21 @@ public:
         return (std::nullopt);
     }
 
+    std::optional<state> on_event(state_stopped&,
+                                  const move_descriptors_msg& move)
+    {
+        move_config(move.descriptors);
+        return (std::nullopt);
+    }
+
+    std::optional<state> on_event(state_started&,
+                                  const move_descriptors_msg& move)
+    {
+        move_config(move.descriptors);
+        run(make_run_args());
+        return (std::nullopt);
+    }
+
     /* Generic state transition functions */
     template <typename State>
     std::optional<state> on_event(State&, const start_msg& start)
@@ -1051,6 +1503,16 @@ public:
     template <typename State>
     std::optional<state> on_event(State&, const stop_msg& stop)
     {
+        auto cycles = get_worker_cycles(rte_lcore_id());
+        auto total = cycles.busy + cycles.idle;
+        OP_LOG(OP_LOG_DEBUG,
+               "Worker %u: %" PRIu64 " busy cycles, %" PRIu64
+               " idle cycles (%.1f%% busy)\n",
+               rte_lcore_id(),
+               cycles.busy,
+               cycles.idle,
+               total ? 100.0 * cycles.busy / total : 0.0);
+
         op_task_sync_ping(m_context, stop.endpoint.data());
         return (std::make_optional(state_stopped{}));
     }
@@ -11,6 +11,7 @@
 #include "packetio/forwarding_table.hpp"
 #include "packetio/generic_interface.hpp"
 #include "packetio/generic_sink.hpp"
+#include "packetio/generic_workers.hpp"
 #include "packetio/transmit_table.hpp"
 #include "packetio/workers/dpdk/tx_source.hpp"
 #include "utils/recycle.hpp"
@@ -75,12 +76,25 @@ struct del_descriptors_msg
     std::vector<worker::descriptor> descriptors;
 };
 
+/*
+ * Hand receive queues to the workers in the descriptors.  The current
+ * owner stops servicing each queue before the new owner starts, so no
+ * queue is ever serviced by two workers at once.
+ */
+struct move_descriptors_msg
+{
+    std::vector<worker::descriptor> descriptors;
+};
+
 /**
  * Our worker is a finite state machine and these messages are
  * the events that trigger state changes.
  */
-using command_msg =
-    std::variant<start_msg, stop_msg, add_descriptors_msg, del_descriptors_msg>;
+using command_msg = std::variant<start_msg,
+                                 stop_msg,
+                                 add_descriptors_msg,
+                                 del_descriptors_msg,
+                                 move_descriptors_msg>;
 
 extern const std::string_view endpoint;
 
@@ -93,6 +107,7 @@ public:
     void stop(void* context, unsigned nb_workers);
     void add_descriptors(const std::vector<worker::descriptor>&);
     void del_descriptors(const std::vector<worker::descriptor>&);
+    void move_descriptors(const std::vector<worker::descriptor>&);
 
 private:
     std::unique_ptr<void, op_socket_deleter> m_socket;
@@ -108,6 +123,10 @@ struct main_args
 
 int main(void*);
 
+using worker_cycles = workers::worker_cycles;
+
+worker_cycles get_worker_cycles(unsigned worker_id);
+
 int send_message(void* socket, const command_msg& msg);
 std::optional<command_msg> recv_message(void* socket, int flags = 0);
 
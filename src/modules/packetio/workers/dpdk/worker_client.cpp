@@ -93,4 +93,15 @@ void client::del_descriptors(const std::vector<descriptor>& descriptors)
     }
 }
 
+void client::move_descriptors(const std::vector<descriptor>& descriptors)
+{
+    if (auto error =
+            send_message(m_socket.get(), move_descriptors_msg{descriptors});
+        error && error != ETERM) {
+        throw std::runtime_error(
+            "Could not send move descriptors message to workers: "
+            + std::string(zmq_strerror(error)));
+    }
+}
+
 } // namespace openperf::packetio::dpdk::worker
@@ -10,6 +10,7 @@
 #include "packetio/drivers/dpdk/topology_utils.hpp"
 #include "packetio/workers/dpdk/event_loop_adapter.hpp"
 #include "packetio/workers/dpdk/port_feature_controller.tcc"
+#include "packetio/workers/dpdk/queue_balancer.hpp"
 #include "packetio/workers/dpdk/tx_source.hpp"
 #include "packetio/workers/dpdk/worker_tx_functions.hpp"
 #include "packetio/workers/dpdk/worker_queues.hpp"
@@ -122,6 +123,118 @@ static void setup_recycler_callback(openperf::core::event_loop& loop,
     loop.add(timeout.count(), &callbacks, recycler);
 }
 
+/*
+ * Periodically moves receive queues from busy workers to idle ones, based
+ * on the cycles each worker spends servicing its queues.  This object lives
+ * on the heap so that the event loop's pointer to it survives moves of the
+ * controller.
+ */
+class rx_queue_balancer
+{
+public:
+    rx_queue_balancer(worker::client& client,
+                      const std::vector<queue::descriptor>& descriptors,
+                      std::chrono::milliseconds period)
+        : m_client(client)
+    {
+        for (const auto& d : descriptors) {
+            if (d.direction != queue::queue_direction::RX) continue;
+            m_queues.emplace(std::make_pair(d.port_id, d.queue_id),
+                             queue_state{.worker_id = d.worker_id});
+            m_worker_ids.push_back(d.worker_id);
+        }
+
+        std::sort(std::begin(m_worker_ids), std::end(m_worker_ids));
+        m_worker_ids.erase(
+            std::unique(std::begin(m_worker_ids), std::end(m_worker_ids)),
+            std::end(m_worker_ids));
+
+        /* Don't bother moving queues unless some worker is 10% busy */
+        m_min_load = rte_get_tsc_hz() / 1000 * period.count() / 10;
+    }
+
+    bool enabled() const { return (m_worker_ids.size() > 1); }
+
+    void rebalance()
+    {
+        auto& queues = worker::port_queues::instance();
+
+        /* Sample the load on each queue since the last run */
+        auto loads = std::vector<queue_load>{};
+        auto moving = false;
+        for (auto& [key, state] : m_queues) {
+            const auto& [port_id, queue_id] = key;
+            const auto* rxq = queues[port_id].rx(queue_id);
+            auto cycles = rxq->get_load().cycles;
+
+            /* The old owner hasn't handed the queue off yet */
+            if (rxq->worker_id() != state.worker_id) { moving = true; }
+
+            loads.push_back(queue_load{.port_id = port_id,
+                                       .queue_id = queue_id,
+                                       .worker_id = state.worker_id,
+                                       .load = cycles - state.last_cycles});
+            state.last_cycles = cycles;
+        }
+
+        /*
+         * Only move one queue at a time, so that a queue is never moved
+         * again before its previous move has finished.
+         */
+        if (moving) return;
+
+        auto move = find_queue_move(loads, m_worker_ids, m_min_load);
+        if (!move) return;
+
+        OP_LOG(OP_LOG_DEBUG,
+               "Moving RX port queue %u:%u from worker %u to worker %u\n",
+               move->port_id,
+               move->queue_id,
+               move->from,
+               move->to);
+
+        /*
+         * Workers process messages in order, so we can track the queue
+         * assignment here without waiting for the move to finish.
+         */
+        m_queues[std::make_pair(move->port_id, move->queue_id)].worker_id =
+            move->to;
+        m_client.move_descriptors({worker::descriptor(
+            move->to, queues[move->port_id].rx(move->queue_id))});
+    }
+
+private:
+    struct queue_state
+    {
+        unsigned worker_id = 0;
+        uint64_t last_cycles = 0;
+    };
+
+    worker::client& m_client;
+    std::map<std::pair<uint16_t, uint16_t>, queue_state> m_queues;
+    std::vector<unsigned> m_worker_ids;
+    uint64_t m_min_load = 0;
+};
+
+static int handle_rx_balancer_timeout(const op_event_data*, void* arg)
+{
+    auto balancer = reinterpret_cast<rx_queue_balancer*>(arg);
+    balancer->rebalance();
+    return (0);
+}
+
+static void setup_rx_balancer_callback(openperf::core::event_loop& loop,
+                                       rx_queue_balancer* balancer,
+                                       std::chrono::milliseconds period)
+{
+    std::chrono::duration<uint64_t, std::nano> timeout = period;
+
+    struct op_event_callbacks callbacks = {.on_timeout =
+                                               handle_rx_balancer_timeout};
+
+    loop.add(timeout.count(), &callbacks, balancer);
+}
+
 template <typename T>
 T& get_unique_port_object(std::vector<std::unique_ptr<T>>& things,
                           uint16_t port_id)
@@ -137,6 +250,21 @@ T& get_unique_port_object(std::vector<std::unique_ptr<T>>& things,
     return (*(item->get()));
 }
 
+/*
+ * Workers dispatch multicast packets to every interface rx sink on the port
+ * via a flat vector, so it needs to be rebuilt whenever those sinks change.
+ */
+static void update_multicast_rx_sinks(worker::fib& fib,
+                                      worker::recycler& recycler,
+                                      uint16_t port_idx)
+{
+    auto to_delete = fib.update_multicast_rx_sinks(port_idx);
+    recycler.writer_add_gc_callback([to_delete]() {
+        delete to_delete;
+        return (worker::recycler::gc_callback_result::ok);
+    });
+}
+
 static void maybe_enable_rxq_tag_detection(const port::filter& filter)
 {
     if (filter.type() == port::filter_type::flow) {
@@ -250,6 +378,17 @@ worker_controller::worker_controller(void* context,
 
     /* And start them */
     m_workers->start(m_context, num_workers());
+
+    /* Finally, move receive queues between workers as load changes */
+    if (auto period = config::dpdk_rx_queue_rebalance_period();
+        period.count()) {
+        auto balancer = std::make_unique<rx_queue_balancer>(
+            *m_workers, portq_descriptors, period);
+        if (balancer->enabled()) {
+            m_rx_balancer = std::move(balancer);
+            setup_rx_balancer_callback(loop, m_rx_balancer.get(), period);
+        }
+    }
 }
 
 worker_controller::~worker_controller()
@@ -274,6 +413,7 @@ worker_controller::worker_controller(worker_controller&& other) noexcept
     , m_tx_schedulers(std::move(other.m_tx_schedulers))
     , m_tx_loads(std::move(other.m_tx_loads))
     , m_tx_workers(std::move(other.m_tx_workers))
+    , m_rx_balancer(std::move(other.m_rx_balancer))
     , m_sink_features(std::move(other.m_sink_features))
     , m_source_features(std::move(other.m_source_features))
 {}
@@ -293,6 +433,7 @@ worker_controller::operator=(worker_controller&& other) noexcept
         m_tx_schedulers = std::move(other.m_tx_schedulers);
         m_tx_loads = std::move(other.m_tx_loads);
         m_tx_workers = std::move(other.m_tx_workers);
+        m_rx_balancer = std::move(other.m_rx_balancer);
         m_sink_features = std::move(other.m_sink_features);
         m_source_features = std::move(other.m_source_features);
     }
@@ -306,14 +447,25 @@ get_queue_worker_ids(packet::traffic_direction direction,
     auto port_indexes = topology::get_ports();
     auto q_descriptors = topology::queue_distribute(port_indexes);
 
-    /* If caller gave us a port, filter out all non-matching descriptors */
+    /*
+     * If caller gave us a port, filter out all non-matching descriptors.
+     * Note: if we're rebalancing, any RX worker could end up servicing
+     * the port's queues, so keep all of them.
+     */
     if (port_id) {
-        q_descriptors.erase(std::remove_if(std::begin(q_descriptors),
-                                           std::end(q_descriptors),
-                                           [&](const auto& d) {
-                                               return (d.port_id != *port_id);
-                                           }),
-                            std::end(q_descriptors));
+        const auto keep_rx = config::dpdk_rx_queue_rebalance_period().count();
+        q_descriptors.erase(
+            std::remove_if(std::begin(q_descriptors),
+                           std::end(q_descriptors),
+                           [&](const auto& d) {
+                               if (keep_rx
+                                   && d.direction
+                                          == queue::queue_direction::RX) {
+                                   return (false);
+                               }
+                               return (d.port_id != *port_id);
+                           }),
+            std::end(q_descriptors));
     }
 
     /*
@@ -380,6 +532,37 @@ worker_controller::get_worker_ids(packet::traffic_direction direction,
                    : get_queue_worker_ids(direction));
 }
 
+std::vector<unsigned>
+worker_controller::get_rx_queue_workers(std::string_view port_id) const
+{
+    auto port_idx = m_driver.port_index(port_id);
+    if (!port_idx) { return {}; }
+
+    /* Only ports with queues have workers */
+    auto port_indexes = topology::get_ports();
+    if (std::find(std::begin(port_indexes), std::end(port_indexes), *port_idx)
+        == std::end(port_indexes)) {
+        return {};
+    }
+
+    /* Queues know which worker is currently servicing them */
+    auto& container = worker::port_queues::instance()[*port_idx];
+    auto workers = std::vector<unsigned>{};
+    for (uint16_t i = 0; i < container.rx_queues(); i++) {
+        workers.push_back(container.rx(i)->worker_id());
+    }
+
+    return (workers);
+}
+
+std::optional<workers::worker_cycles>
+worker_controller::get_worker_cycles(unsigned worker_id) const
+{
+    if (worker_id >= RTE_MAX_LCORE) { return (std::nullopt); }
+
+    return (worker::get_worker_cycles(worker_id));
+}
+
 template <typename T>
 workers::transmit_function to_transmit_function(T tx_function)
 {
@@ -404,9 +587,10 @@ worker_controller::get_transmit_function(std::string_view port_id) const
         /*
          * For LwIP based stack, we use a portion of the mbuf private area to
          * store the lwip pbuf.  Because the net_ring driver hands transmitted
-         * packets directly to another port, we must copy the packet before
-         * transmitting to avoid a data race on the reference count in the
-         * private area to prevent use-after-free bugs.
+         * packets directly to another port, we must give the receiver its
+         * own mbufs before transmitting to avoid a data race on the reference
+         * count in the private area to prevent use-after-free bugs.  Only the
+         * packet headers are copied; payload is shared via indirect mbufs.
          */
         return (use_direct ? to_transmit_function(worker::tx_copy_direct)
                            : to_transmit_function(worker::tx_copy_queued));
@@ -474,6 +658,7 @@ void worker_controller::del_interface(
         delete to_delete;
         return (worker::recycler::gc_callback_result::ok);
     });
+    update_multicast_rx_sinks(*m_fib, *m_recycler, *port_idx);
 
     auto& filter = m_sink_features.get<port::filter>(*port_idx);
     filter.del_mac_address(mac,
@@ -585,6 +770,7 @@ worker_controller::add_sink(packet::traffic_direction direction,
                 delete to_delete;
                 return (worker::recycler::gc_callback_result::ok);
             });
+            update_multicast_rx_sinks(*m_fib, *m_recycler, port_idx);
         }
         if (direction == packet::traffic_direction::TX
             || direction == packet::traffic_direction::RXTX) {
@@ -689,6 +875,7 @@ void worker_controller::del_sink(packet::traffic_direction direction,
                     delete to_delete;
                     return (worker::recycler::gc_callback_result::ok);
                 });
+                update_multicast_rx_sinks(*m_fib, *m_recycler, port_idx);
 
                 m_sink_features.update(*m_fib, port_idx);
             }
@@ -794,6 +981,21 @@ uint64_t get_source_load(const packet::generic_source& source)
     return ((source.packet_rate() / source.burst_size()).count());
 }
 
+/*
+ * Sources using header templates transmit multi-segment packets with shared,
+ * read-only headers, so the port must gather segments and calculate
+ * checksums for us.
+ */
+static bool supports_header_templates(uint16_t port_idx)
+{
+    constexpr auto needed_offloads =
+        (RTE_ETH_TX_OFFLOAD_MULTI_SEGS | RTE_ETH_TX_OFFLOAD_IPV4_CKSUM
+         | RTE_ETH_TX_OFFLOAD_TCP_CKSUM | RTE_ETH_TX_OFFLOAD_UDP_CKSUM);
+
+    return ((port_info::tx_offloads(port_idx) & needed_offloads)
+            == needed_offloads);
+}
+
 std::optional<uint16_t>
 find_queue(worker::tib& tib, uint16_t port_idx, std::string_view source_id)
 {
@@ -822,6 +1024,16 @@ worker_controller::add_source(std::string_view dst_id,
         return (tl::make_unexpected(EALREADY));
     }
 
+    if (source.uses_feature(packet::source_feature_flags::header_templates)
+        && !supports_header_templates(*port_idx)) {
+        OP_LOG(OP_LOG_ERROR,
+               "Port %.*s does not support zero-copy transmit for source %s\n",
+               static_cast<int>(dst_id.length()),
+               dst_id.data(),
+               source.id().c_str());
+        return (tl::make_unexpected(ENOTSUP));
+    }
+
     auto [queue_idx, worker_idx] =
         get_queue_and_worker_idx(m_tx_workers, m_tx_loads, *port_idx);
 
@@ -35,6 +35,8 @@ class event_loop;
 
 namespace openperf::packetio::dpdk {
 
+class rx_queue_balancer;
+
 class worker_controller
 {
 public:
@@ -55,6 +57,11 @@ public:
         packet::traffic_direction direction = packet::traffic_direction::RXTX,
         std::optional<std::string_view> obj_id = std::nullopt) const;
 
+    std::vector<unsigned> get_rx_queue_workers(std::string_view port_id) const;
+
+    std::optional<workers::worker_cycles>
+    get_worker_cycles(unsigned worker_id) const;
+
     workers::transmit_function
     get_transmit_function(std::string_view port_id) const;
 
@@ -134,6 +141,8 @@ private:
     load_map m_tx_loads;     /* map from worker id --> worker load */
     worker_map m_tx_workers; /* map from (port id, queue id) --> worker id */
 
+    std::unique_ptr<rx_queue_balancer> m_rx_balancer; /* RX queue mover */
+
     sink_feature_controller m_sink_features;
     source_feature_controller m_source_features;
 };
@@ -55,6 +55,14 @@ static serialized_msg serialize_message(const command_msg& msg)
                                                    vec.data(),
                                                    sizeof(*std::begin(vec))
                                                        * vec.size()));
+                 },
+                 [&](const move_descriptors_msg& move) {
+                     assert(move.descriptors.size());
+                     auto& vec = move.descriptors;
+                     return (message::zmq_msg_init(&serialized.data,
+                                                   vec.data(),
+                                                   sizeof(*std::begin(vec))
+                                                       * vec.size()));
                  }),
              msg));
 
@@ -106,6 +114,12 @@ static command_msg deserialize_message(const serialized_msg& msg)
         std::vector<descriptor> descriptors(data, data + count);
         return (del_descriptors_msg{descriptors});
     }
+    case utils::variant_index<command_msg, move_descriptors_msg>(): {
+        auto data = message::zmq_msg_data<descriptor*>(&msg.data);
+        auto count = zmq_msg_size(&msg.data) / sizeof(descriptor);
+        std::vector<descriptor> descriptors(data, data + count);
+        return (move_descriptors_msg{descriptors});
+    }
     default:
         throw std::runtime_error("Unhandled deserialization case; fix me!");
     }
@@ -1,3 +1,6 @@
+#include <algorithm>
+#include <array>
+
 #include "core/op_log.h"
 #include "packetio/drivers/dpdk/dpdk.h"
 #include "packetio/drivers/dpdk/mbuf_metadata.hpp"
@@ -7,18 +10,27 @@
 
 namespace openperf::packetio::dpdk::worker {
 
-/* Copy mbuf header and packet data */
-static void eal_mbuf_copy_seg(rte_mbuf* dst, const rte_mbuf* src)
+/*
+ * Packet headers are copied into a new mbuf; everything after this
+ * offset is shared with the original via indirect mbufs.  This needs to
+ * cover the L2 - L4 headers of any packet the stack would modify in place.
+ */
+static constexpr uint16_t tx_header_copy_length = 2 * RTE_CACHE_LINE_SIZE;
+
+/* Copy mbuf header and the first length bytes of packet data */
+static void
+eal_mbuf_copy_seg(rte_mbuf* dst, const rte_mbuf* src, uint16_t length)
 {
     assert(dst);
     assert(src);
+    assert(length <= rte_pktmbuf_data_len(src));
 
     dst->data_off = src->data_off;
     dst->port = src->port;
     dst->ol_flags = src->ol_flags;
     dst->packet_type = src->packet_type;
-    dst->pkt_len = src->pkt_len;
-    dst->data_len = src->data_len;
+    dst->pkt_len = length;
+    dst->data_len = length;
     dst->vlan_tci = src->vlan_tci;
     dst->vlan_tci_outer = src->vlan_tci_outer;
     dst->tx_offload = src->tx_offload;
@@ -27,36 +39,50 @@ static void eal_mbuf_copy_seg(rte_mbuf* dst, const rte_mbuf* src)
 
     rte_memcpy(rte_pktmbuf_mtod(dst, void*),
                rte_pktmbuf_mtod(src, const void*),
-               rte_pktmbuf_data_len(src));
+               length);
 }
 
-/* Make a complete copy of an mbuf chain with mbufs from the same pool as the
- * source */
-static rte_mbuf* eal_mbuf_copy_chain(const rte_mbuf* src_head)
+/*
+ * Make a private copy of an mbuf chain for the receiver without copying
+ * the payload.
+ *
+ * The LwIP based stack stores its pbuf in the mbuf private area and
+ * modifies packet headers in place on input, e.g. TCP headers are byte
+ * swapped.  Because the net_ring driver hands transmitted packets directly
+ * to another port, the receiver needs its own mbufs and its own copy of the
+ * headers, otherwise it would race with the sender's reference counts and
+ * corrupt packets queued for retransmission.  Payload is never modified,
+ * so it is shared via indirect mbufs.  Small packets are copied entirely.
+ */
+static rte_mbuf* eal_mbuf_split_chain(const rte_mbuf* src_head)
 {
     assert(src_head);
 
     rte_mbuf* dst_head = rte_pktmbuf_alloc(src_head->pool);
     if (!dst_head) return (nullptr);
-    eal_mbuf_copy_seg(dst_head, src_head);
+
+    auto header_length =
+        std::min(rte_pktmbuf_data_len(src_head), tx_header_copy_length);
+    eal_mbuf_copy_seg(dst_head, src_head, header_length);
 
     /*
      * Ugh.  The mbuf free function sanity checks the mbufs, so it can panic
      * if pkt_len and nb_segs is not accurate.  Hence, we have to update those
      * fields as we go along so that we can free the mbuf if there is an error.
      */
-    rte_pktmbuf_pkt_len(dst_head) = rte_pktmbuf_data_len(dst_head);
-
-    const rte_mbuf* src = src_head;
     rte_mbuf* dst = dst_head;
-    while (src->next != nullptr) {
-        src = src->next;
+    for (auto* src = src_head; src != nullptr; src = src->next) {
+        auto offset = (src == src_head ? header_length : 0);
+        if (offset == rte_pktmbuf_data_len(src)) { continue; }
+
         auto next = rte_pktmbuf_alloc(src->pool);
         if (!next) {
             rte_pktmbuf_free(dst_head);
             return (nullptr);
         }
-        eal_mbuf_copy_seg(next, src);
+        rte_pktmbuf_attach(next, const_cast<rte_mbuf*>(src));
+        rte_pktmbuf_adj(next, offset);
+
         dst->next = next;
         dst = dst->next;
         dst_head->nb_segs++;
@@ -68,28 +94,46 @@ static rte_mbuf* eal_mbuf_copy_chain(const rte_mbuf* src_head)
     return (dst_head);
 }
 
+/*
+ * Replace the mbufs with private copies for the receiver.  Returns the
+ * number of copies made, which is less than nb_mbufs if we run out of mbufs.
+ *
+ * Note: caller expects the driver to free the mbufs when transmitted,
+ * hence we free the original mbufs here and the driver frees the copies.
+ */
+static uint16_t
+eal_mbuf_split_burst(rte_mbuf* mbufs[], rte_mbuf* copies[], uint16_t nb_mbufs)
+{
+    for (uint16_t i = 0; i < nb_mbufs; i++) {
+        copies[i] = eal_mbuf_split_chain(mbufs[i]);
+        rte_pktmbuf_free(mbufs[i]);
+        if (!copies[i]) { return (i); }
+    }
+
+    return (nb_mbufs);
+}
+
 uint16_t tx_copy_direct(int port_idx,
                         uint32_t,
                         struct rte_mbuf* mbufs[],
                         uint16_t nb_mbufs)
 {
     auto& queues = worker::port_queues::instance();
+    std::array<rte_mbuf*, pkt_burst_size> copies;
 
     uint16_t sent = 0;
 
-    for (uint16_t i = 0; i < nb_mbufs; i++) {
-        /*
-         * Note: caller expects the driver to free the mbuf when transmitted,
-         * hence we free the original mbuf here and the driver frees the copy.
-         */
-        auto copy = eal_mbuf_copy_chain(mbufs[i]);
-        rte_pktmbuf_free(mbufs[i]);
-        if (!copy
-            || !worker_transmit(
-                queues.fib<worker::fib*>(), port_idx, 0, &copy, 1)) {
-            return (sent);
-        }
-        sent++;
+    while (sent < nb_mbufs) {
+        auto to_copy =
+            std::min(static_cast<uint16_t>(nb_mbufs - sent), pkt_burst_size);
+        auto nb_copies =
+            eal_mbuf_split_burst(mbufs + sent, copies.data(), to_copy);
+        auto nb_sent = worker_transmit(
+            queues.fib<worker::fib*>(), port_idx, 0, copies.data(), nb_copies);
+        rte_pktmbuf_free_bulk(copies.data() + nb_sent, nb_copies - nb_sent);
+        sent += nb_sent;
+
+        if (nb_sent < to_copy) { break; }
     }
 
     return (sent);
@@ -100,20 +144,22 @@ uint16_t tx_copy_queued(int port_idx,
                         struct rte_mbuf* mbufs[],
                         uint16_t nb_mbufs)
 {
-    uint16_t sent = 0;
     auto& queues = worker::port_queues::instance();
+    std::array<rte_mbuf*, pkt_burst_size> copies;
 
-    for (uint16_t i = 0; i < nb_mbufs; i++) {
-        /*
-         * Note: caller expects the driver to free the mbuf when transmitted,
-         * hence we free the original mbuf here and the driver frees the copy.
-         */
-        auto copy = eal_mbuf_copy_chain(mbufs[i]);
-        rte_pktmbuf_free(mbufs[i]);
-        if (!copy || !queues[port_idx].tx(hash)->enqueue(&copy, 1)) {
-            return (sent);
-        }
-        sent++;
+    uint16_t sent = 0;
+
+    while (sent < nb_mbufs) {
+        auto to_copy =
+            std::min(static_cast<uint16_t>(nb_mbufs - sent), pkt_burst_size);
+        auto nb_copies =
+            eal_mbuf_split_burst(mbufs + sent, copies.data(), to_copy);
+        auto nb_sent =
+            queues[port_idx].tx(hash)->enqueue(copies.data(), nb_copies);
+        rte_pktmbuf_free_bulk(copies.data() + nb_sent, nb_copies - nb_sent);
+        sent += nb_sent;
+
+        if (nb_sent < to_copy) { break; }
     }
 
     return (sent);
@@ -2,6 +2,7 @@
 #define _OP_SOCKET_CIRCULAR_BUFFER_PRODUCER_HPP_
 
 #include <atomic>
+#include <sys/types.h>
 #include <sys/uio.h>
 
 namespace openperf::socket {
@@ -35,6 +36,23 @@ public:
     size_t write(const void* ptr, size_t length);
     size_t write(const iovec iov[], size_t iovcnt);
 
+    /*
+     * Read data from the file descriptor directly into the buffer.
+     * If offset is not null, read from that offset and update it;
+     * otherwise, read from the current file position.
+     * Returns -1 and sets errno on error.
+     */
+    ssize_t write(int fd, size_t length, off_t* offset);
+
+    /*
+     * Like the writes above, but place the data skip octets past the
+     * write cursor and don't publish it.  Lets callers fill in a header
+     * after the data it describes; commit() publishes the lot.
+     */
+    size_t pwrite(const void* ptr, size_t length, size_t skip);
+    ssize_t pwrite(int fd, size_t length, off_t* offset, size_t skip);
+    void commit(size_t length);
+
     template <typename NotifyFunction>
     size_t
     write_and_notify(const void* ptr, size_t length, NotifyFunction&& notify);
@@ -2,6 +2,7 @@
 #include <cerrno>
 #include <cstring>
 #include <numeric>
+#include <unistd.h>
 
 #include "framework/utils/memcpy.hpp"
 #include "socket/circular_buffer_producer.hpp"
@@ -190,6 +191,71 @@ size_t circular_buffer_producer<Derived>::write(const iovec iov[],
     return (written1 + written2);
 }
 
+template <typename Derived>
+ssize_t
+circular_buffer_producer<Derived>::write(int fd, size_t length, off_t* offset)
+{
+    auto nb_read = pwrite(fd, length, offset, 0);
+    if (nb_read > 0) { commit(nb_read); }
+    return (nb_read);
+}
+
+template <typename Derived>
+size_t circular_buffer_producer<Derived>::pwrite(const void* ptr,
+                                                 size_t length,
+                                                 size_t skip)
+{
+    auto available = writable();
+    if (available <= skip) return (0);
+
+    auto to_write = std::min(available - skip, length);
+    auto start = mask(mask(load_write()) + skip);
+
+    const size_t chunk1 = std::min(to_write, len() - start);
+    const size_t chunk2 = to_write - chunk1;
+
+    openperf::utils::memcpy(base() + start, ptr, chunk1);
+    openperf::utils::memcpy(
+        base(), reinterpret_cast<const uint8_t*>(ptr) + chunk1, chunk2);
+
+    return (to_write);
+}
+
+template <typename Derived>
+ssize_t circular_buffer_producer<Derived>::pwrite(int fd,
+                                                  size_t length,
+                                                  off_t* offset,
+                                                  size_t skip)
+{
+    auto available = writable();
+    if (available <= skip) return (0);
+
+    auto to_write = std::min(available - skip, length);
+    if (!to_write) return (0);
+
+    auto start = mask(mask(load_write()) + skip);
+
+    /* Use a two entry vector to account for the wrap of the buffer */
+    const size_t chunk1 = std::min(to_write, len() - start);
+    const size_t chunk2 = to_write - chunk1;
+    const iovec iov[2] = {{.iov_base = base() + start, .iov_len = chunk1},
+                          {.iov_base = base(), .iov_len = chunk2}};
+    const int iovcnt = chunk2 ? 2 : 1;
+
+    auto nb_read = (offset ? ::preadv(fd, iov, iovcnt, *offset)
+                           : ::readv(fd, iov, iovcnt));
+    if (nb_read <= 0) return (nb_read);
+
+    if (offset) { *offset += nb_read; }
+    return (nb_read);
+}
+
+template <typename Derived>
+void circular_buffer_producer<Derived>::commit(size_t length)
+{
+    store_write(load_write() + length);
+}
+
 template <typename Derived>
 template <typename NotifyFunction>
 size_t circular_buffer_producer<Derived>::write_and_notify(
@@ -625,6 +625,36 @@ ssize_t client::recvmsg(int s, struct msghdr* message, int flags)
     return (*recv_result);
 }
 
+int client::recvmmsg(int s,
+                     struct mmsghdr* msgvec,
+                     unsigned int vlen,
+                     int flags,
+                     struct timespec* timeout)
+{
+    assert(*m_init_flag);
+
+    /*
+     * We never wait for more than the first datagram, so there is
+     * nothing for the timeout to do.
+     */
+    (void)timeout;
+
+    auto result = m_channels.find(s);
+    if (result == nullptr) {
+        errno = EINVAL;
+        return (-1);
+    }
+
+    auto& [id, channel] = *result;
+    auto recv_result = channel.recv(msgvec, vlen, flags);
+    if (!recv_result) {
+        errno = recv_result.error();
+        return (-1);
+    }
+
+    return (*recv_result);
+}
+
 /***
  * Transmit functions
  ***/
@@ -690,4 +720,47 @@ ssize_t client::writev(int s, const struct iovec* iov, int iovcnt)
     return (sendmsg(s, &msg, 0));
 }
 
+int client::sendmmsg(int s,
+                     struct mmsghdr* msgvec,
+                     unsigned int vlen,
+                     int flags)
+{
+    assert(*m_init_flag);
+
+    auto result = m_channels.find(s);
+    if (result == nullptr) {
+        errno = EINVAL;
+        return (-1);
+    }
+
+    auto& [id, channel] = *result;
+    auto send_result = channel.send(msgvec, vlen, flags);
+    if (!send_result) {
+        errno = send_result.error();
+        return (-1);
+    }
+
+    return (*send_result);
+}
+
+ssize_t client::sendfile(int out_fd, int in_fd, off_t* offset, size_t count)
+{
+    assert(*m_init_flag);
+
+    auto result = m_channels.find(out_fd);
+    if (result == nullptr) {
+        errno = EINVAL;
+        return (-1);
+    }
+
+    auto& [id, channel] = *result;
+    auto send_result = channel.send_file(in_fd, offset, count);
+    if (!send_result) {
+        errno = send_result.error();
+        return (-1);
+    }
+
+    return (*send_result);
+}
+
 } // namespace openperf::socket::api
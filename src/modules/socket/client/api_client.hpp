@@ -79,6 +79,11 @@ public:
                      struct sockaddr* from,
                      socklen_t* fromlen);
     ssize_t recvmsg(int s, struct msghdr* message, int flags);
+    int recvmmsg(int s,
+                 struct mmsghdr* msgvec,
+                 unsigned int vlen,
+                 int flags,
+                 struct timespec* timeout);
 
     /* Transmit functions */
     ssize_t send(int s, const void* dataptr, size_t len, int flags);
@@ -91,6 +96,8 @@ public:
                    socklen_t tolen);
     ssize_t write(int s, const void* dataptr, size_t len);
     ssize_t writev(int s, const struct iovec* iov, int iovcnt);
+    int sendmmsg(int s, struct mmsghdr* msgvec, unsigned int vlen, int flags);
+    ssize_t sendfile(int out_fd, int in_fd, off_t* offset, size_t count);
 };
 
 } // namespace openperf::socket::api
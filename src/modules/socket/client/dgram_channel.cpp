@@ -1,4 +1,5 @@
 #include <cassert>
+#include <limits>
 #include <unistd.h>
 
 #include "framework/utils/memcpy.hpp"
@@ -221,27 +222,27 @@ static size_t buffer_required(size_t length)
     return (sizeof(dgram_channel_descriptor) + length);
 }
 
-tl::expected<size_t, int> dgram_channel::send(const iovec iov[],
-                                              size_t iovcnt,
-                                              int flags __attribute__((unused)),
-                                              const sockaddr* to)
+static size_t iov_length(const iovec iov[], size_t iovcnt)
 {
-    auto iov_length = std::accumulate(
+    return (std::accumulate(
         iov, iov + iovcnt, 0UL, [](size_t total, const iovec& iov) {
             return (total + iov.iov_len);
-        });
-    if (!iov_length) return (0); /* success? */
+        }));
+}
 
+/* Wait until we can write a datagram of the specified length */
+tl::expected<size_t, int> dgram_channel::wait_for_space(size_t length)
+{
     /*
      * Let the user know if they're trying to send something larger
      * than our channel.
      */
-    if (producer_len() < buffer_required(iov_length)) {
+    if (producer_len() < buffer_required(length)) {
         return (tl::make_unexpected(EMSGSIZE));
     }
 
     size_t buffer_available = 0;
-    while ((buffer_available = writable()) < buffer_required(iov_length)) {
+    while ((buffer_available = writable()) < buffer_required(length)) {
         if (auto error =
                 (socket_flags.load(std::memory_order_relaxed) & EFD_NONBLOCK
                      ? block()
@@ -251,22 +252,55 @@ tl::expected<size_t, int> dgram_channel::send(const iovec iov[],
         }
     }
 
-    assert(buffer_required(iov_length) <= buffer_available);
+    return (buffer_available);
+}
 
-    /*
-     * We have enough buffer space for the message, so generate a header and
-     * write it out.
-     */
+/* Write a datagram into the buffer; the caller must verify there is room */
+size_t dgram_channel::write_datagram(const iovec iov[],
+                                     size_t iovcnt,
+                                     const sockaddr* to)
+{
     auto desc = dgram_channel_descriptor{
         .address = to_addr(to),
-        .length = static_cast<uint16_t>(iov_length),
+        .length = static_cast<uint16_t>(iov_length(iov, iovcnt)),
     };
-    write(std::addressof(desc), sizeof(desc));
 
-    /* Now, write the io vector */
-    auto written = write(iov, iovcnt);
+    /*
+     * Write the io vector behind the descriptor and publish them together.
+     * Separate writes could come up short, since the writable space is
+     * rounded down after each one.
+     */
+    auto written = pwrite(std::addressof(desc), sizeof(desc), 0);
+    std::for_each(iov, iov + iovcnt, [&](const iovec& vec) {
+        written += pwrite(vec.iov_base, vec.iov_len, written);
+    });
+    commit(written);
+
+    return (written - sizeof(desc));
+}
+
+tl::expected<size_t, int> dgram_channel::send(const iovec iov[],
+                                              size_t iovcnt,
+                                              int flags __attribute__((unused)),
+                                              const sockaddr* to)
+{
+    auto length = iov_length(iov, iovcnt);
+    if (!length) return (0); /* success? */
+
+    auto buffer_available = wait_for_space(length);
+    if (!buffer_available) {
+        return (tl::make_unexpected(buffer_available.error()));
+    }
+
+    assert(buffer_required(length) <= *buffer_available);
 
-    if (buffer_required(written) == buffer_available
+    /*
+     * We have enough buffer space for the message, so generate a header and
+     * write it out.
+     */
+    auto written = write_datagram(iov, iovcnt, to);
+
+    if (buffer_required(written) == *buffer_available
         && socket_flags.load(std::memory_order_relaxed) & EFD_NONBLOCK
         && !writable()) {
         block(); /* pre-emptive block */
@@ -277,6 +311,80 @@ tl::expected<size_t, int> dgram_channel::send(const iovec iov[],
     return (written);
 }
 
+tl::expected<unsigned, int> dgram_channel::send(mmsghdr msgvec[],
+                                                unsigned vlen,
+                                                int flags
+                                                __attribute__((unused)))
+{
+    auto nb_sent = 0U;
+    while (nb_sent < vlen) {
+        auto& msg = msgvec[nb_sent].msg_hdr;
+        auto length = iov_length(msg.msg_iov, msg.msg_iovlen);
+
+        if (length && writable() < buffer_required(length)) {
+            /* Let the server start on what we have before waiting for more */
+            if (nb_sent) { notify(); }
+
+            if (auto available = wait_for_space(length); !available) {
+                if (nb_sent) break;
+                return (tl::make_unexpected(available.error()));
+            }
+        }
+
+        msgvec[nb_sent].msg_len =
+            length ? write_datagram(msg.msg_iov,
+                                    msg.msg_iovlen,
+                                    reinterpret_cast<const sockaddr*>(
+                                        msg.msg_name))
+                   : 0;
+        nb_sent++;
+    }
+
+    if (socket_flags.load(std::memory_order_relaxed) & EFD_NONBLOCK
+        && !writable()) {
+        block(); /* pre-emptive block */
+    }
+
+    notify();
+
+    return (nb_sent);
+}
+
+tl::expected<size_t, int>
+dgram_channel::send_file(int fd, off_t* offset, size_t count)
+{
+    /*
+     * Datagrams can't be split, so wait for enough space for the largest
+     * datagram we could send before reading anything.  That way we never
+     * read data we can't send.
+     */
+    auto length = std::min({count,
+                            producer_len() - buffer_required(0),
+                            size_t{std::numeric_limits<uint16_t>::max()}});
+    if (!length) return (0);
+
+    if (auto available = wait_for_space(length); !available) {
+        return (tl::make_unexpected(available.error()));
+    }
+
+    /*
+     * Read the payload straight into the buffer, behind the space for its
+     * descriptor, then fill in the descriptor now that we know the length.
+     */
+    auto desc = dgram_channel_descriptor{};
+    auto nb_read = pwrite(fd, length, offset, sizeof(desc));
+    if (nb_read < 0) { return (tl::make_unexpected(errno)); }
+    if (nb_read == 0) { return (0); }
+
+    desc.length = static_cast<uint16_t>(nb_read);
+    pwrite(std::addressof(desc), sizeof(desc), 0);
+    commit(buffer_required(nb_read));
+
+    notify();
+
+    return (nb_read);
+}
+
 static dgram_channel_descriptor* to_dgram_descriptor(
     const circular_buffer_consumer<dgram_channel>::peek_data&& peek,
     struct dgram_channel_descriptor& storage)
@@ -309,24 +417,16 @@ static dgram_channel_descriptor* to_dgram_descriptor(
     return (readable < buffer_required(desc->length) ? nullptr : desc);
 }
 
-tl::expected<size_t, int> dgram_channel::recv(
-    iovec iov[], size_t iovcnt, int flags, sockaddr* from, socklen_t* fromlen)
+/* Copy the datagram at the front of the buffer into the io vector */
+static size_t read_datagram(dgram_channel& channel,
+                            const dgram_channel_descriptor& desc,
+                            iovec iov[],
+                            size_t iovcnt,
+                            sockaddr* from,
+                            socklen_t* fromlen)
 {
-    dgram_channel_descriptor* desc = nullptr;
-    auto storage = dgram_channel_descriptor{};
-    while ((desc = to_dgram_descriptor(peek(), storage)) == nullptr) {
-        if (socket_flags.load(std::memory_order_relaxed) & EFD_NONBLOCK)
-            return (tl::make_unexpected(EAGAIN));
-
-        if (auto error = ack_wait(); error != 0) {
-            return (tl::make_unexpected(error));
-        }
-    }
-
-    assert(desc);
-
-    if (desc->address) {
-        auto src = to_sockaddr(desc->address.value());
+    if (desc.address) {
+        auto src = to_sockaddr(desc.address.value());
         if (from && fromlen) {
             auto srclen = length_of(src);
             openperf::utils::memcpy(from, &src, std::min(*fromlen, srclen));
@@ -339,17 +439,39 @@ tl::expected<size_t, int> dgram_channel::recv(
      * or we run out of vector entries, whichever comes first.
      */
     auto read_size = 0UL;
-    auto offset = sizeof(*desc);
+    auto offset = sizeof(desc);
     size_t idx = 0;
-    while (read_size < desc->length && idx < iovcnt) {
-        auto to_read = desc->length - read_size;
+    while (read_size < desc.length && idx < iovcnt) {
+        auto to_read = desc.length - read_size;
 
-        read_size += pread(
+        auto nb_read = channel.pread(
             iov[idx].iov_base, std::min(to_read, iov[idx].iov_len), offset);
-        offset += read_size;
+        read_size += nb_read;
+        offset += nb_read;
         idx++;
     }
 
+    return (read_size);
+}
+
+tl::expected<size_t, int> dgram_channel::recv(
+    iovec iov[], size_t iovcnt, int flags, sockaddr* from, socklen_t* fromlen)
+{
+    dgram_channel_descriptor* desc = nullptr;
+    auto storage = dgram_channel_descriptor{};
+    while ((desc = to_dgram_descriptor(peek(), storage)) == nullptr) {
+        if (socket_flags.load(std::memory_order_relaxed) & EFD_NONBLOCK)
+            return (tl::make_unexpected(EAGAIN));
+
+        if (auto error = ack_wait(); error != 0) {
+            return (tl::make_unexpected(error));
+        }
+    }
+
+    assert(desc);
+
+    auto read_size = read_datagram(*this, *desc, iov, iovcnt, from, fromlen);
+
     if (!(flags & MSG_PEEK)) {
         /* Drop the whole packet, whether it's read or not */
         drop(buffer_required(desc->length));
@@ -369,6 +491,52 @@ tl::expected<size_t, int> dgram_channel::recv(
     return (read_size);
 }
 
+tl::expected<unsigned, int>
+dgram_channel::recv(mmsghdr msgvec[], unsigned vlen, int flags)
+{
+    auto nb_recv = 0U;
+    auto storage = dgram_channel_descriptor{};
+    while (nb_recv < vlen) {
+        auto* desc = to_dgram_descriptor(peek(), storage);
+        if (!desc) {
+            /* Only wait for the first datagram */
+            if (nb_recv) break;
+
+            if (socket_flags.load(std::memory_order_relaxed) & EFD_NONBLOCK)
+                return (tl::make_unexpected(EAGAIN));
+
+            if (auto error = ack_wait(); error != 0) {
+                return (tl::make_unexpected(error));
+            }
+            continue;
+        }
+
+        auto& msg = msgvec[nb_recv].msg_hdr;
+        msgvec[nb_recv].msg_len =
+            read_datagram(*this,
+                          *desc,
+                          msg.msg_iov,
+                          msg.msg_iovlen,
+                          reinterpret_cast<sockaddr*>(msg.msg_name),
+                          &msg.msg_namelen);
+        nb_recv++;
+
+        /* Peeking at more than one datagram doesn't make sense */
+        if (flags & MSG_PEEK) break;
+
+        drop(buffer_required(desc->length));
+    }
+
+    /* Update our notification state once for the whole batch */
+    if (!readable()) {
+        ack();
+    } else {
+        ack_undo();
+    }
+
+    return (nb_recv);
+}
+
 tl::expected<void, int> dgram_channel::block_writes()
 {
     if (auto error = block()) { return (tl::make_unexpected(error)); }
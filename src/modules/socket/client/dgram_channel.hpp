@@ -51,6 +51,11 @@ protected:
     std::atomic_uint64_t& ack_write_idx();
     const std::atomic_uint64_t& ack_write_idx() const;
 
+private:
+    tl::expected<size_t, int> wait_for_space(size_t length);
+    size_t
+    write_datagram(const iovec iov[], size_t iovcnt, const sockaddr* to);
+
 public:
     dgram_channel(int client_fd, int server_fd);
     ~dgram_channel();
@@ -74,6 +79,19 @@ public:
                                    sockaddr* from,
                                    socklen_t* fromlen);
 
+    /*
+     * Batched versions of the above. Each message is a separate datagram,
+     * but the server is notified only once per batch. Receive only waits
+     * for the first datagram, e.g. as if MSG_WAITFORONE was set.
+     */
+    tl::expected<unsigned, int>
+    send(mmsghdr msgvec[], unsigned vlen, int flags);
+    tl::expected<unsigned, int>
+    recv(mmsghdr msgvec[], unsigned vlen, int flags);
+
+    /* Send up to count bytes from the file descriptor as one datagram */
+    tl::expected<size_t, int> send_file(int fd, off_t* offset, size_t count);
+
     tl::expected<void, int> block_writes();
     tl::expected<void, int> wait_readable();
     tl::expected<void, int> wait_writable();
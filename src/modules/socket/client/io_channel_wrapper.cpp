@@ -110,6 +110,90 @@ tl::expected<size_t, int> io_channel_wrapper::recv(
     return (std::visit(recv_visitor, m_channel));
 }
 
+/*
+ * Stream channels have no message boundaries, so just handle each message
+ * in turn. Stop early instead of blocking once we've handled a message.
+ */
+static tl::expected<unsigned, int>
+send_each(stream_channel* channel, mmsghdr msgvec[], unsigned vlen, int flags)
+{
+    auto idx = 0U;
+    while (idx < vlen && (!idx || channel->writable())) {
+        auto& msg = msgvec[idx].msg_hdr;
+        auto result =
+            channel->send(msg.msg_iov,
+                          msg.msg_iovlen,
+                          flags,
+                          reinterpret_cast<const sockaddr*>(msg.msg_name));
+        if (!result) {
+            if (idx) break;
+            return (tl::make_unexpected(result.error()));
+        }
+        msgvec[idx++].msg_len = *result;
+    }
+
+    return (idx);
+}
+
+static tl::expected<unsigned, int>
+recv_each(stream_channel* channel, mmsghdr msgvec[], unsigned vlen, int flags)
+{
+    auto idx = 0U;
+    while (idx < vlen && (!idx || channel->readable())) {
+        auto& msg = msgvec[idx].msg_hdr;
+        auto result =
+            channel->recv(msg.msg_iov,
+                          msg.msg_iovlen,
+                          flags,
+                          reinterpret_cast<sockaddr*>(msg.msg_name),
+                          &msg.msg_namelen);
+        if (!result) {
+            if (idx) break;
+            return (tl::make_unexpected(result.error()));
+        }
+        msgvec[idx++].msg_len = *result;
+    }
+
+    return (idx);
+}
+
+tl::expected<unsigned, int>
+io_channel_wrapper::send(mmsghdr msgvec[], unsigned vlen, int flags)
+{
+    return (std::visit(
+        utils::overloaded_visitor(
+            [&](dgram_channel* channel) -> tl::expected<unsigned, int> {
+                return (channel->send(msgvec, vlen, flags));
+            },
+            [&](stream_channel* channel) -> tl::expected<unsigned, int> {
+                return (send_each(channel, msgvec, vlen, flags));
+            }),
+        m_channel));
+}
+
+tl::expected<unsigned, int>
+io_channel_wrapper::recv(mmsghdr msgvec[], unsigned vlen, int flags)
+{
+    return (std::visit(
+        utils::overloaded_visitor(
+            [&](dgram_channel* channel) -> tl::expected<unsigned, int> {
+                return (channel->recv(msgvec, vlen, flags));
+            },
+            [&](stream_channel* channel) -> tl::expected<unsigned, int> {
+                return (recv_each(channel, msgvec, vlen, flags));
+            }),
+        m_channel));
+}
+
+tl::expected<size_t, int>
+io_channel_wrapper::send_file(int fd, off_t* offset, size_t count)
+{
+    auto send_file_visitor = [&](auto channel) -> tl::expected<size_t, int> {
+        return (channel->send_file(fd, offset, count));
+    };
+    return (std::visit(send_file_visitor, m_channel));
+}
+
 int io_channel_wrapper::ack()
 {
     auto ack_visitor = [&](auto channel) -> int { return (channel->ack()); };
@@ -43,6 +43,14 @@ public:
                                    sockaddr* from,
                                    socklen_t* fromlen);
 
+    tl::expected<unsigned, int>
+    send(mmsghdr msgvec[], unsigned vlen, int flags);
+
+    tl::expected<unsigned, int>
+    recv(mmsghdr msgvec[], unsigned vlen, int flags);
+
+    tl::expected<size_t, int> send_file(int fd, off_t* offset, size_t count);
+
     int ack();
     int ack_undo();
 
@@ -211,6 +211,48 @@ tl::expected<size_t, int> stream_channel::send(const iovec iov[],
     return (written);
 }
 
+tl::expected<size_t, int>
+stream_channel::send_file(int fd, off_t* offset, size_t count)
+{
+    if (auto error = socket_error.load(std::memory_order_relaxed); error != 0) {
+        return (tl::make_unexpected(error));
+    }
+
+    if (!count) return (0);
+
+    size_t buf_available = 0;
+    while ((buf_available = writable()) == 0) {
+        if (auto error =
+                (socket_flags.load(std::memory_order_relaxed) & EFD_NONBLOCK
+                     ? block()
+                     : block_wait());
+            error != 0) {
+            return (tl::make_unexpected(error));
+        }
+
+        /* Check if an error woke us up */
+        if (auto error = socket_error.load(std::memory_order_acquire);
+            error != 0) {
+            return (tl::make_unexpected(error));
+        }
+    }
+
+    assert(buf_available);
+
+    auto written = write(fd, count, offset);
+    if (written < 0) { return (tl::make_unexpected(errno)); }
+
+    if (static_cast<size_t>(written) == buf_available
+        && socket_flags.load(std::memory_order_relaxed) & EFD_NONBLOCK
+        && !writable()) {
+        block(); /* pre-emptive block */
+    }
+
+    if (written) { notify(); }
+
+    return (written);
+}
+
 tl::expected<size_t, int>
 stream_channel::recv(iovec iov[],
                      size_t iovcnt,
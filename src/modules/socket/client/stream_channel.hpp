@@ -77,6 +77,9 @@ public:
                                    sockaddr* from,
                                    socklen_t* fromlen);
 
+    /* Copy data from the file descriptor straight into the transmit buffer */
+    tl::expected<size_t, int> send_file(int fd, off_t* offset, size_t count);
+
     tl::expected<void, int> block_writes();
     tl::expected<void, int> wait_readable();
     tl::expected<void, int> wait_writable();
@@ -69,7 +69,11 @@ $(SOCKCLI_OBJ_DIR)/client/dgram_channel.o: OP_CXXFLAGS += -Wno-unused-private-fi
 $(SOCKCLI_OBJ_DIR)/client/stream_channel.o: OP_CXXFLAGS += -Wno-unused-private-field
 
 SOCKTEST_SOURCES += \
-	$(SOCK_COMMON_SOURCES)
+	$(SOCK_COMMON_SOURCES) \
+	client/dgram_channel.cpp
 
 SOCKTEST_DEPENDS += expected
 SOCKTEST_LDLIBS += -lrt
+
+# See comment above.
+$(SOCKTEST_OBJ_DIR)/client/dgram_channel.o: OP_CXXFLAGS += -Wno-unused-private-field
@@ -20,6 +20,8 @@
 #include "socket/stream_channel.hpp"
 #include "socket/server/api_handler.hpp"
 #include "socket/server/api_server.hpp"
+#include "socket/server/tcp_socket.hpp"
+#include "packet/stack/lwip/memory.h"
 #include "core/op_core.h"
 #include "core/op_uuid.hpp"
 #include "config/op_config_file.hpp"
@@ -190,6 +192,16 @@ int server::start()
     if (!result) { return (result.error()); }
 
     m_task = *result;
+
+    /*
+     * If our devices can transmit directly from shared memory, then TCP
+     * sockets don't need to copy client data into stack buffers.
+     */
+    if (packet_stack_memory_register(m_shm.base(), m_shm.size())) {
+        OP_LOG(OP_LOG_DEBUG, "Enabling zero copy TCP transmit\n");
+        socket::server::tcp_socket::zero_copy(true);
+    }
+
     return (0);
 }
 
@@ -200,6 +212,9 @@ void server::stop()
     auto client = packetio::internal::api::client(m_context);
     client.del_task(m_task);
     m_task.clear();
+
+    socket::server::tcp_socket::zero_copy(false);
+    packet_stack_memory_unregister(m_shm.base(), m_shm.size());
 }
 
 void server::foreach_socket(
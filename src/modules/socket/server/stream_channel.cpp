@@ -223,10 +223,19 @@ size_t stream_channel::send(const iovec iov[], size_t iovcnt)
     return (written);
 }
 
-iovec stream_channel::recv_peek() const
+iovec stream_channel::recv_peek(size_t offset) const
 {
     /* XXX: should return both iovec items */
-    return (peek()[0]);
+    for (auto& iov : peek()) {
+        if (offset < iov.iov_len) {
+            return (iovec{
+                .iov_base = reinterpret_cast<uint8_t*>(iov.iov_base) + offset,
+                .iov_len = iov.iov_len - offset});
+        }
+        offset -= iov.iov_len;
+    }
+
+    return (iovec{});
 }
 
 size_t stream_channel::recv_drop(size_t length)
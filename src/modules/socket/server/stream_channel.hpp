@@ -77,7 +77,11 @@ public:
     size_t send_consumable() const;
     size_t send(const iovec iov[], size_t iovcnt);
 
-    iovec recv_peek() const;
+    /*
+     * Peek at the contiguous readable data starting offset bytes past the
+     * read cursor; offset allows skipping data that we can't drop yet.
+     */
+    iovec recv_peek(size_t offset = 0) const;
     size_t recv_drop(size_t length);
 
     void dump() const;
@@ -0,0 +1,87 @@
+#ifndef _OP_SOCKET_SERVER_TCP_SEND_QUEUE_HPP_
+#define _OP_SOCKET_SERVER_TCP_SEND_QUEUE_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <sys/uio.h>
+
+namespace openperf::socket::server {
+
+/**
+ * Tracks the transmit data at the front of a stream channel that has been
+ * handed to the TCP stack but not yet acknowledged by the peer.
+ *
+ * In zero copy mode, the stack references channel data in place, so that
+ * data has to stay in the channel until the peer acknowledges it. Otherwise,
+ * the stack copies the data and we drop it from the channel right away.
+ * Either way, data is acknowledged in the order it was sent.
+ */
+class tcp_send_queue
+{
+    size_t m_length = 0;
+    bool m_zero_copy = false;
+
+public:
+    tcp_send_queue(bool zero_copy = false)
+        : m_zero_copy(zero_copy)
+    {}
+
+    tcp_send_queue(tcp_send_queue&& other) noexcept
+        : m_length(std::exchange(other.m_length, 0))
+        , m_zero_copy(other.m_zero_copy)
+    {}
+
+    tcp_send_queue& operator=(tcp_send_queue&& other) noexcept
+    {
+        if (this != &other) {
+            m_length = std::exchange(other.m_length, 0);
+            m_zero_copy = other.m_zero_copy;
+        }
+        return (*this);
+    }
+
+    bool zero_copy() const { return (m_zero_copy); }
+
+    /* Channel data the stack references that the peer hasn't acknowledged */
+    size_t length() const { return (m_length); }
+
+    /* Channel data that hasn't been given to the stack yet */
+    template <typename Channel> size_t unsent(const Channel& channel) const
+    {
+        return (channel.readable() - m_length);
+    }
+
+    template <typename Channel> iovec peek(const Channel& channel) const
+    {
+        return (channel.recv_peek(m_length));
+    }
+
+    /* The stack took the first length bytes of the unsent data */
+    template <typename Channel> void sent(Channel& channel, size_t length)
+    {
+        if (m_zero_copy) {
+            m_length += length;
+        } else {
+            channel.recv_drop(length);
+        }
+    }
+
+    /*
+     * The peer acknowledged length bytes, so the stack is done with them.
+     * Acknowledgements can cover more than our data, e.g. a FIN, so never
+     * drop more than we have queued. Returns the number of bytes dropped.
+     */
+    template <typename Channel> size_t acked(Channel& channel, size_t length)
+    {
+        auto to_drop = std::min(length, m_length);
+        if (!to_drop) { return (0); }
+
+        m_length -= to_drop;
+        return (channel.recv_drop(to_drop));
+    }
+};
+
+} // namespace openperf::socket::server
+
+#endif /* _OP_SOCKET_SERVER_TCP_SEND_QUEUE_HPP_ */
@@ -1,6 +1,9 @@
+#include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <cstring>
 #include <numeric>
+#include <utility>
 
 #include "socket/server/compat/linux/tcp.h"
 #include "socket/server/lwip_utils.hpp"
@@ -65,6 +68,7 @@ template <typename BufferEmptyFunction>
 static size_t do_tcp_transmit(tcp_pcb* pcb,
                               const void* ptr,
                               size_t length,
+                              uint8_t write_flags,
                               BufferEmptyFunction&& empty)
 {
     static constexpr uint16_t tcp_send_max =
@@ -83,7 +87,7 @@ static size_t do_tcp_transmit(tcp_pcb* pcb,
         if (tcp_write(pcb,
                       reinterpret_cast<const uint8_t*>(ptr) + written,
                       tcp_send_max,
-                      TCP_WRITE_FLAG_COPY | TCP_WRITE_FLAG_MORE)
+                      write_flags | TCP_WRITE_FLAG_MORE)
             != ERR_OK) {
             return (written);
         }
@@ -94,7 +98,7 @@ static size_t do_tcp_transmit(tcp_pcb* pcb,
     /* We want to set the PSH flag if this next write will empty the buffer */
     const auto push =
         std::forward<BufferEmptyFunction>(empty)(written + to_write);
-    const auto flags = TCP_WRITE_FLAG_COPY | (-(!push) & TCP_WRITE_FLAG_MORE);
+    const auto flags = write_flags | (-(!push) & TCP_WRITE_FLAG_MORE);
     if (tcp_write(pcb,
                   reinterpret_cast<const uint8_t*>(ptr) + written,
                   to_write,
@@ -111,24 +115,27 @@ static size_t do_tcp_transmit(tcp_pcb* pcb,
     return (written);
 }
 
-static void do_tcp_transmit_all(tcp_pcb* pcb, stream_channel& channel)
+static void
+do_tcp_transmit_all(tcp_pcb* pcb, stream_channel& channel, tcp_send_queue& sendq)
 {
-    size_t total_readable = channel.readable();
+    const uint8_t write_flags = sendq.zero_copy() ? 0 : TCP_WRITE_FLAG_COPY;
+    size_t total_readable = sendq.unsent(channel);
     size_t total_written = 0;
     for (;;) {
-        auto iov = channel.recv_peek();
-        if (channel.recv_drop(
-                do_tcp_transmit(pcb,
-                                iov.iov_base,
-                                iov.iov_len,
-                                [&](size_t written) {
-                                    total_written += written;
-                                    return (written == iov.iov_len
-                                            && total_written >= total_readable);
-                                }))
-            == 0) {
-            break;
-        }
+        auto iov = sendq.peek(channel);
+        auto written = do_tcp_transmit(pcb,
+                                       iov.iov_base,
+                                       iov.iov_len,
+                                       write_flags,
+                                       [&](size_t written) {
+                                           total_written += written;
+                                           return (written == iov.iov_len
+                                                   && total_written
+                                                          >= total_readable);
+                                       });
+        if (written == 0) { break; }
+
+        sendq.sent(channel, written);
     }
 }
 
@@ -157,6 +164,30 @@ do_tcp_receive_all(tcp_pcb* pcb, stream_channel& channel, pbuf_queue& queue)
     }
 }
 
+static std::atomic_bool tcp_zero_copy = false;
+
+void tcp_socket::zero_copy(bool enable)
+{
+    tcp_zero_copy.store(enable, std::memory_order_relaxed);
+}
+
+/*
+ * lwIP's first extra argument holds the retransmit count; we use the second
+ * to hand our channel to a pcb that still references its buffer after the
+ * socket is gone.
+ */
+static constexpr uint8_t tcp_linger_ext_arg_id = 1;
+
+static void tcp_linger_destroy(uint8_t id __attribute__((unused)), void* data)
+{
+    stream_channel_deleter{}(reinterpret_cast<stream_channel*>(data));
+}
+
+static const tcp_ext_arg_callbacks tcp_linger_callbacks = {
+    .destroy = tcp_linger_destroy,
+    .passive_open = nullptr,
+};
+
 void tcp_socket::tcp_pcb_deleter::operator()(tcp_pcb* pcb)
 {
     /* quick and dirty */
@@ -175,6 +206,7 @@ tcp_socket::tcp_socket(openperf::socket::server::allocator* allocator,
     : m_channel(new (allocator->allocate(sizeof(stream_channel)))
                     stream_channel(flags, *allocator))
     , m_pcb(pcb)
+    , m_sendq(tcp_zero_copy.load(std::memory_order_relaxed))
 {
     ::tcp_arg(m_pcb.get(), this);
     ::tcp_poll(m_pcb.get(), nullptr, 2U);
@@ -187,6 +219,7 @@ tcp_socket::tcp_socket(openperf::socket::server::allocator& allocator,
     : m_channel(new (allocator.allocate(sizeof(stream_channel)))
                     stream_channel(flags, allocator))
     , m_pcb(tcp_new_ip_type(ip_type))
+    , m_sendq(tcp_zero_copy.load(std::memory_order_relaxed))
 {
     ::tcp_arg(m_pcb.get(), this);
     ::tcp_poll(m_pcb.get(), nullptr, 2U);
@@ -200,6 +233,17 @@ tcp_socket::~tcp_socket()
      * this socket to handle its callbacks...
      */
     if (m_pcb) { ::tcp_arg(m_pcb.get(), nullptr); }
+
+    /*
+     * If the pcb still references data in our channel's buffer, then the
+     * channel has to live as long as the pcb does.  Let lwIP free it.
+     */
+    if (m_pcb && m_sendq.length()) {
+        ::tcp_ext_arg_set_callbacks(
+            m_pcb.get(), tcp_linger_ext_arg_id, &tcp_linger_callbacks);
+        ::tcp_ext_arg_set(
+            m_pcb.get(), tcp_linger_ext_arg_id, m_channel.release());
+    }
 }
 
 /**
@@ -212,6 +256,7 @@ tcp_socket& tcp_socket::operator=(tcp_socket&& other) noexcept
         m_channel = std::move(other.m_channel);
         m_pcb = std::move(other.m_pcb);
         m_acceptq = std::move(other.m_acceptq);
+        m_sendq = std::move(other.m_sendq);
         ::tcp_arg(m_pcb.get(), this);
         state(other.state());
     }
@@ -222,6 +267,7 @@ tcp_socket::tcp_socket(tcp_socket&& other) noexcept
     : m_channel(std::move(other.m_channel))
     , m_pcb(std::move(other.m_pcb))
     , m_acceptq(std::move(other.m_acceptq))
+    , m_sendq(std::move(other.m_sendq))
 {
     ::tcp_arg(m_pcb.get(), this);
     state(other.state());
@@ -247,13 +293,19 @@ int tcp_socket::do_lwip_accept(tcp_pcb* newpcb, int err)
     return (ERR_OK);
 }
 
-int tcp_socket::do_lwip_sent(uint16_t size __attribute__((unused)))
+int tcp_socket::do_lwip_sent(uint16_t size)
 {
+    /*
+     * The peer acknowledged some data, so the stack no longer needs it.
+     * Let the client reuse that part of the channel buffer.
+     */
+    m_sendq.acked(*m_channel, size);
+
     /*
      * The stack just cleared some data from the send buffer. See if
      * we can fill it up again.
      */
-    do_tcp_transmit_all(m_pcb.get(), *m_channel);
+    do_tcp_transmit_all(m_pcb.get(), *m_channel, m_sendq);
 
     return (ERR_OK);
 }
@@ -322,7 +374,7 @@ int tcp_socket::do_lwip_poll()
     }
 
     /* Try to transmit any data in our send buffer. */
-    do_tcp_transmit_all(m_pcb.get(), *m_channel);
+    do_tcp_transmit_all(m_pcb.get(), *m_channel, m_sendq);
 
     return (ERR_OK);
 }
@@ -392,7 +444,7 @@ void tcp_socket::handle_io()
     m_channel->ack();
 
     do_tcp_receive_all(m_pcb.get(), *m_channel, m_recvq);
-    do_tcp_transmit_all(m_pcb.get(), *m_channel);
+    do_tcp_transmit_all(m_pcb.get(), *m_channel, m_sendq);
 }
 
 tcp_socket::on_request_reply
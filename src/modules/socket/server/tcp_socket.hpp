@@ -11,6 +11,7 @@
 #include "socket/server/pbuf_queue.hpp"
 #include "socket/server/socket_utils.hpp"
 #include "socket/server/stream_channel.hpp"
+#include "socket/server/tcp_send_queue.hpp"
 
 struct pbuf;
 struct tcp_pcb;
@@ -61,6 +62,7 @@ class tcp_socket : public socket_state_machine<tcp_socket, tcp_socket_state>
     tcp_pcb_ptr m_pcb;
     std::queue<tcp_pcb*, std::list<tcp_pcb*>> m_acceptq;
     pbuf_queue m_recvq;
+    tcp_send_queue m_sendq;
 
     openperf::socket::server::allocator* channel_allocator();
 
@@ -80,6 +82,13 @@ public:
     tcp_socket& operator=(tcp_socket&& other) noexcept;
     tcp_socket(tcp_socket&& other) noexcept;
 
+    /*
+     * Allow new sockets to transmit directly from their channel's buffer,
+     * i.e. without copying data into stack buffers.  This requires that
+     * our devices can transmit from the shared memory segment.
+     */
+    static void zero_copy(bool enable);
+
     /***
      * lwIP callback functions
      ***/
@@ -26,6 +26,12 @@ BlockGeneratorConfig::BlockGeneratorConfig()
     m_Write_size = 0;
     m_RatioIsSet = false;
     m_Pattern = "";
+    m_Engine = "aio";
+    m_EngineIsSet = false;
+    m_Sqpoll = false;
+    m_SqpollIsSet = false;
+    m_Direct_io = false;
+    m_Direct_ioIsSet = false;
     
 }
 
@@ -52,6 +58,18 @@ nlohmann::json BlockGeneratorConfig::toJson() const
         val["ratio"] = ModelBase::toJson(m_Ratio);
     }
     val["pattern"] = ModelBase::toJson(m_Pattern);
+    if(m_EngineIsSet)
+    {
+        val["engine"] = ModelBase::toJson(m_Engine);
+    }
+    if(m_SqpollIsSet)
+    {
+        val["sqpoll"] = m_Sqpoll;
+    }
+    if(m_Direct_ioIsSet)
+    {
+        val["direct_io"] = m_Direct_io;
+    }
     
 
     return val;
@@ -75,6 +93,19 @@ void BlockGeneratorConfig::fromJson(nlohmann::json& val)
         
     }
     setPattern(val.at("pattern"));
+    if(val.find("engine") != val.end())
+    {
+        setEngine(val.at("engine"));
+        
+    }
+    if(val.find("sqpoll") != val.end())
+    {
+        setSqpoll(val.at("sqpoll"));
+    }
+    if(val.find("direct_io") != val.end())
+    {
+        setDirectIo(val.at("direct_io"));
+    }
     
 }
 
@@ -150,6 +181,57 @@ void BlockGeneratorConfig::setPattern(std::string value)
     m_Pattern = value;
     
 }
+std::string BlockGeneratorConfig::getEngine() const
+{
+    return m_Engine;
+}
+void BlockGeneratorConfig::setEngine(std::string value)
+{
+    m_Engine = value;
+    m_EngineIsSet = true;
+}
+bool BlockGeneratorConfig::engineIsSet() const
+{
+    return m_EngineIsSet;
+}
+void BlockGeneratorConfig::unsetEngine()
+{
+    m_EngineIsSet = false;
+}
+bool BlockGeneratorConfig::isSqpoll() const
+{
+    return m_Sqpoll;
+}
+void BlockGeneratorConfig::setSqpoll(bool value)
+{
+    m_Sqpoll = value;
+    m_SqpollIsSet = true;
+}
+bool BlockGeneratorConfig::sqpollIsSet() const
+{
+    return m_SqpollIsSet;
+}
+void BlockGeneratorConfig::unsetSqpoll()
+{
+    m_SqpollIsSet = false;
+}
+bool BlockGeneratorConfig::isDirectIo() const
+{
+    return m_Direct_io;
+}
+void BlockGeneratorConfig::setDirectIo(bool value)
+{
+    m_Direct_io = value;
+    m_Direct_ioIsSet = true;
+}
+bool BlockGeneratorConfig::directIoIsSet() const
+{
+    return m_Direct_ioIsSet;
+}
+void BlockGeneratorConfig::unsetDirect_io()
+{
+    m_Direct_ioIsSet = false;
+}
 
 }
 }
@@ -86,7 +86,28 @@ public:
     /// </summary>
     std::string getPattern() const;
     void setPattern(std::string value);
-    
+        /// <summary>
+    /// I/O submission engine. The io_uring engine uses registered buffers and batched submission to reduce per-operation overhead. 
+    /// </summary>
+    std::string getEngine() const;
+    void setEngine(std::string value);
+    bool engineIsSet() const;
+    void unsetEngine();
+    /// <summary>
+    /// Use a kernel thread to poll the io_uring submission queue. This removes submission system calls at the expense of a busy kernel thread. Only valid with the io_uring engine. 
+    /// </summary>
+    bool isSqpoll() const;
+    void setSqpoll(bool value);
+    bool sqpollIsSet() const;
+    void unsetSqpoll();
+    /// <summary>
+    /// Bypass the page cache by opening the resource with O_DIRECT. Read and write sizes must be a multiple of 512 bytes. 
+    /// </summary>
+    bool isDirectIo() const;
+    void setDirectIo(bool value);
+    bool directIoIsSet() const;
+    void unsetDirect_io();
+
 protected:
     int32_t m_Queue_depth;
 
@@ -102,6 +123,12 @@ protected:
     bool m_RatioIsSet;
     std::string m_Pattern;
 
+    std::string m_Engine;
+    bool m_EngineIsSet;
+    bool m_Sqpoll;
+    bool m_SqpollIsSet;
+    bool m_Direct_io;
+    bool m_Direct_ioIsSet;
 };
 
 }
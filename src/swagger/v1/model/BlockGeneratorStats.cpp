@@ -29,6 +29,14 @@ BlockGeneratorStats::BlockGeneratorStats()
     m_Latency_minIsSet = false;
     m_Latency_max = 0L;
     m_Latency_maxIsSet = false;
+    m_Latency_p50 = 0L;
+    m_Latency_p50IsSet = false;
+    m_Latency_p99 = 0L;
+    m_Latency_p99IsSet = false;
+    m_Latency_p999 = 0L;
+    m_Latency_p999IsSet = false;
+    m_Latency_p9999 = 0L;
+    m_Latency_p9999IsSet = false;
     
 }
 
@@ -59,6 +67,22 @@ nlohmann::json BlockGeneratorStats::toJson() const
     {
         val["latency_max"] = m_Latency_max;
     }
+    if(m_Latency_p50IsSet)
+    {
+        val["latency_p50"] = m_Latency_p50;
+    }
+    if(m_Latency_p99IsSet)
+    {
+        val["latency_p99"] = m_Latency_p99;
+    }
+    if(m_Latency_p999IsSet)
+    {
+        val["latency_p999"] = m_Latency_p999;
+    }
+    if(m_Latency_p9999IsSet)
+    {
+        val["latency_p9999"] = m_Latency_p9999;
+    }
     
 
     return val;
@@ -80,6 +104,22 @@ void BlockGeneratorStats::fromJson(nlohmann::json& val)
     {
         setLatencyMax(val.at("latency_max"));
     }
+    if(val.find("latency_p50") != val.end())
+    {
+        setLatencyP50(val.at("latency_p50"));
+    }
+    if(val.find("latency_p99") != val.end())
+    {
+        setLatencyP99(val.at("latency_p99"));
+    }
+    if(val.find("latency_p999") != val.end())
+    {
+        setLatencyP999(val.at("latency_p999"));
+    }
+    if(val.find("latency_p9999") != val.end())
+    {
+        setLatencyP9999(val.at("latency_p9999"));
+    }
     
 }
 
@@ -172,6 +212,74 @@ void BlockGeneratorStats::unsetLatency_max()
 {
     m_Latency_maxIsSet = false;
 }
+int64_t BlockGeneratorStats::getLatencyP50() const
+{
+    return m_Latency_p50;
+}
+void BlockGeneratorStats::setLatencyP50(int64_t value)
+{
+    m_Latency_p50 = value;
+    m_Latency_p50IsSet = true;
+}
+bool BlockGeneratorStats::latencyP50IsSet() const
+{
+    return m_Latency_p50IsSet;
+}
+void BlockGeneratorStats::unsetLatency_p50()
+{
+    m_Latency_p50IsSet = false;
+}
+int64_t BlockGeneratorStats::getLatencyP99() const
+{
+    return m_Latency_p99;
+}
+void BlockGeneratorStats::setLatencyP99(int64_t value)
+{
+    m_Latency_p99 = value;
+    m_Latency_p99IsSet = true;
+}
+bool BlockGeneratorStats::latencyP99IsSet() const
+{
+    return m_Latency_p99IsSet;
+}
+void BlockGeneratorStats::unsetLatency_p99()
+{
+    m_Latency_p99IsSet = false;
+}
+int64_t BlockGeneratorStats::getLatencyP999() const
+{
+    return m_Latency_p999;
+}
+void BlockGeneratorStats::setLatencyP999(int64_t value)
+{
+    m_Latency_p999 = value;
+    m_Latency_p999IsSet = true;
+}
+bool BlockGeneratorStats::latencyP999IsSet() const
+{
+    return m_Latency_p999IsSet;
+}
+void BlockGeneratorStats::unsetLatency_p999()
+{
+    m_Latency_p999IsSet = false;
+}
+int64_t BlockGeneratorStats::getLatencyP9999() const
+{
+    return m_Latency_p9999;
+}
+void BlockGeneratorStats::setLatencyP9999(int64_t value)
+{
+    m_Latency_p9999 = value;
+    m_Latency_p9999IsSet = true;
+}
+bool BlockGeneratorStats::latencyP9999IsSet() const
+{
+    return m_Latency_p9999IsSet;
+}
+void BlockGeneratorStats::unsetLatency_p9999()
+{
+    m_Latency_p9999IsSet = false;
+}
 
 }
 }
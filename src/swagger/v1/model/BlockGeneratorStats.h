@@ -91,6 +91,34 @@ public:
     void setLatencyMax(int64_t value);
     bool latencyMaxIsSet() const;
     void unsetLatency_max();
+    /// <summary>
+    /// The 50th percentile of observed latency values (in nanoseconds) 
+    /// </summary>
+    int64_t getLatencyP50() const;
+    void setLatencyP50(int64_t value);
+    bool latencyP50IsSet() const;
+    void unsetLatency_p50();
+    /// <summary>
+    /// The 99th percentile of observed latency values (in nanoseconds) 
+    /// </summary>
+    int64_t getLatencyP99() const;
+    void setLatencyP99(int64_t value);
+    bool latencyP99IsSet() const;
+    void unsetLatency_p99();
+    /// <summary>
+    /// The 99.9th percentile of observed latency values (in nanoseconds) 
+    /// </summary>
+    int64_t getLatencyP999() const;
+    void setLatencyP999(int64_t value);
+    bool latencyP999IsSet() const;
+    void unsetLatency_p999();
+    /// <summary>
+    /// The 99.99th percentile of observed latency values (in nanoseconds) 
+    /// </summary>
+    int64_t getLatencyP9999() const;
+    void setLatencyP9999(int64_t value);
+    bool latencyP9999IsSet() const;
+    void unsetLatency_p9999();
 
 protected:
     int64_t m_Ops_target;
@@ -109,6 +137,14 @@ protected:
     bool m_Latency_minIsSet;
     int64_t m_Latency_max;
     bool m_Latency_maxIsSet;
+    int64_t m_Latency_p50;
+    bool m_Latency_p50IsSet;
+    int64_t m_Latency_p99;
+    bool m_Latency_p99IsSet;
+    int64_t m_Latency_p999;
+    bool m_Latency_p999IsSet;
+    int64_t m_Latency_p9999;
+    bool m_Latency_p9999IsSet;
 };
 
 }
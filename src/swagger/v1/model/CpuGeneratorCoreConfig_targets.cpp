@@ -22,6 +22,8 @@ CpuGeneratorCoreConfig_targets::CpuGeneratorCoreConfig_targets()
     m_Data_type = "";
     m_Instruction_set = "";
     m_Weight = 0;
+    m_Operation = "";
+    m_OperationIsSet = false;
     
 }
 
@@ -41,6 +43,10 @@ nlohmann::json CpuGeneratorCoreConfig_targets::toJson() const
     val["data_type"] = ModelBase::toJson(m_Data_type);
     val["instruction_set"] = ModelBase::toJson(m_Instruction_set);
     val["weight"] = m_Weight;
+    if(m_OperationIsSet)
+    {
+        val["operation"] = ModelBase::toJson(m_Operation);
+    }
     
 
     return val;
@@ -51,6 +57,11 @@ void CpuGeneratorCoreConfig_targets::fromJson(nlohmann::json& val)
     setDataType(val.at("data_type"));
     setInstructionSet(val.at("instruction_set"));
     setWeight(val.at("weight"));
+    if(val.find("operation") != val.end())
+    {
+        setOperation(val.at("operation"));
+        
+    }
     
 }
 
@@ -82,6 +93,23 @@ void CpuGeneratorCoreConfig_targets::setWeight(int32_t value)
     m_Weight = value;
     
 }
+std::string CpuGeneratorCoreConfig_targets::getOperation() const
+{
+    return m_Operation;
+}
+void CpuGeneratorCoreConfig_targets::setOperation(std::string value)
+{
+    m_Operation = value;
+    m_OperationIsSet = true;
+}
+bool CpuGeneratorCoreConfig_targets::operationIsSet() const
+{
+    return m_OperationIsSet;
+}
+void CpuGeneratorCoreConfig_targets::unsetOperation()
+{
+    m_OperationIsSet = false;
+}
 
 }
 }
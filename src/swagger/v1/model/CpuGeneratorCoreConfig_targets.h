@@ -63,7 +63,14 @@ public:
     /// </summary>
     int32_t getWeight() const;
     void setWeight(int32_t value);
-    
+        /// <summary>
+    /// CPU load operation
+    /// </summary>
+    std::string getOperation() const;
+    void setOperation(std::string value);
+    bool operationIsSet() const;
+    void unsetOperation();
+
 protected:
     std::string m_Data_type;
 
@@ -71,6 +78,8 @@ protected:
 
     int32_t m_Weight;
 
+    std::string m_Operation;
+    bool m_OperationIsSet;
 };
 
 }
@@ -25,6 +25,12 @@ CpuGeneratorCoreStats::CpuGeneratorCoreStats()
     m_System = 0L;
     m_User = 0L;
     m_Error = 0L;
+    m_Cycles = 0L;
+    m_CyclesIsSet = false;
+    m_Instructions = 0L;
+    m_InstructionsIsSet = false;
+    m_Cache_misses = 0L;
+    m_Cache_missesIsSet = false;
     
 }
 
@@ -55,6 +61,18 @@ nlohmann::json CpuGeneratorCoreStats::toJson() const
         }
         val["targets"] = jsonArray;
             }
+    if(m_CyclesIsSet)
+    {
+        val["cycles"] = m_Cycles;
+    }
+    if(m_InstructionsIsSet)
+    {
+        val["instructions"] = m_Instructions;
+    }
+    if(m_Cache_missesIsSet)
+    {
+        val["cache_misses"] = m_Cache_misses;
+    }
     
 
     return val;
@@ -87,6 +105,18 @@ void CpuGeneratorCoreStats::fromJson(nlohmann::json& val)
             
         }
     }
+    if(val.find("cycles") != val.end())
+    {
+        setCycles(val.at("cycles"));
+    }
+    if(val.find("instructions") != val.end())
+    {
+        setInstructions(val.at("instructions"));
+    }
+    if(val.find("cache_misses") != val.end())
+    {
+        setCacheMisses(val.at("cache_misses"));
+    }
     
 }
 
@@ -149,6 +179,57 @@ std::vector<std::shared_ptr<CpuGeneratorTargetStats>>& CpuGeneratorCoreStats::ge
 {
     return m_Targets;
 }
+int64_t CpuGeneratorCoreStats::getCycles() const
+{
+    return m_Cycles;
+}
+void CpuGeneratorCoreStats::setCycles(int64_t value)
+{
+    m_Cycles = value;
+    m_CyclesIsSet = true;
+}
+bool CpuGeneratorCoreStats::cyclesIsSet() const
+{
+    return m_CyclesIsSet;
+}
+void CpuGeneratorCoreStats::unsetCycles()
+{
+    m_CyclesIsSet = false;
+}
+int64_t CpuGeneratorCoreStats::getInstructions() const
+{
+    return m_Instructions;
+}
+void CpuGeneratorCoreStats::setInstructions(int64_t value)
+{
+    m_Instructions = value;
+    m_InstructionsIsSet = true;
+}
+bool CpuGeneratorCoreStats::instructionsIsSet() const
+{
+    return m_InstructionsIsSet;
+}
+void CpuGeneratorCoreStats::unsetInstructions()
+{
+    m_InstructionsIsSet = false;
+}
+int64_t CpuGeneratorCoreStats::getCacheMisses() const
+{
+    return m_Cache_misses;
+}
+void CpuGeneratorCoreStats::setCacheMisses(int64_t value)
+{
+    m_Cache_misses = value;
+    m_Cache_missesIsSet = true;
+}
+bool CpuGeneratorCoreStats::cacheMissesIsSet() const
+{
+    return m_Cache_missesIsSet;
+}
+void CpuGeneratorCoreStats::unsetCache_misses()
+{
+    m_Cache_missesIsSet = false;
+}
 
 }
 }
@@ -27,6 +27,12 @@ CpuGeneratorStats::CpuGeneratorStats()
     m_Steal = 0L;
     m_StealIsSet = false;
     m_Error = 0L;
+    m_Cycles = 0L;
+    m_CyclesIsSet = false;
+    m_Instructions = 0L;
+    m_InstructionsIsSet = false;
+    m_Cache_misses = 0L;
+    m_Cache_missesIsSet = false;
     
 }
 
@@ -61,6 +67,18 @@ nlohmann::json CpuGeneratorStats::toJson() const
         }
         val["cores"] = jsonArray;
             }
+    if(m_CyclesIsSet)
+    {
+        val["cycles"] = m_Cycles;
+    }
+    if(m_InstructionsIsSet)
+    {
+        val["instructions"] = m_Instructions;
+    }
+    if(m_Cache_missesIsSet)
+    {
+        val["cache_misses"] = m_Cache_misses;
+    }
     
 
     return val;
@@ -97,6 +115,18 @@ void CpuGeneratorStats::fromJson(nlohmann::json& val)
             
         }
     }
+    if(val.find("cycles") != val.end())
+    {
+        setCycles(val.at("cycles"));
+    }
+    if(val.find("instructions") != val.end())
+    {
+        setInstructions(val.at("instructions"));
+    }
+    if(val.find("cache_misses") != val.end())
+    {
+        setCacheMisses(val.at("cache_misses"));
+    }
     
 }
 
@@ -176,6 +206,57 @@ std::vector<std::shared_ptr<CpuGeneratorCoreStats>>& CpuGeneratorStats::getCores
 {
     return m_Cores;
 }
+int64_t CpuGeneratorStats::getCycles() const
+{
+    return m_Cycles;
+}
+void CpuGeneratorStats::setCycles(int64_t value)
+{
+    m_Cycles = value;
+    m_CyclesIsSet = true;
+}
+bool CpuGeneratorStats::cyclesIsSet() const
+{
+    return m_CyclesIsSet;
+}
+void CpuGeneratorStats::unsetCycles()
+{
+    m_CyclesIsSet = false;
+}
+int64_t CpuGeneratorStats::getInstructions() const
+{
+    return m_Instructions;
+}
+void CpuGeneratorStats::setInstructions(int64_t value)
+{
+    m_Instructions = value;
+    m_InstructionsIsSet = true;
+}
+bool CpuGeneratorStats::instructionsIsSet() const
+{
+    return m_InstructionsIsSet;
+}
+void CpuGeneratorStats::unsetInstructions()
+{
+    m_InstructionsIsSet = false;
+}
+int64_t CpuGeneratorStats::getCacheMisses() const
+{
+    return m_Cache_misses;
+}
+void CpuGeneratorStats::setCacheMisses(int64_t value)
+{
+    m_Cache_misses = value;
+    m_Cache_missesIsSet = true;
+}
+bool CpuGeneratorStats::cacheMissesIsSet() const
+{
+    return m_Cache_missesIsSet;
+}
+void CpuGeneratorStats::unsetCache_misses()
+{
+    m_Cache_missesIsSet = false;
+}
 
 }
 }
@@ -90,7 +90,28 @@ public:
     /// Statistics of the CPU cores (in the order they were specified in generator configuration)
     /// </summary>
     std::vector<std::shared_ptr<CpuGeneratorCoreStats>>& getCores();
-    
+        /// <summary>
+    /// Core clock cycles used by load threads
+    /// </summary>
+    int64_t getCycles() const;
+    void setCycles(int64_t value);
+    bool cyclesIsSet() const;
+    void unsetCycles();
+    /// <summary>
+    /// Instructions retired by load threads
+    /// </summary>
+    int64_t getInstructions() const;
+    void setInstructions(int64_t value);
+    bool instructionsIsSet() const;
+    void unsetInstructions();
+    /// <summary>
+    /// Last level cache misses of load threads
+    /// </summary>
+    int64_t getCacheMisses() const;
+    void setCacheMisses(int64_t value);
+    bool cacheMissesIsSet() const;
+    void unsetCache_misses();
+
 protected:
     int64_t m_Available;
 
@@ -108,6 +129,12 @@ protected:
 
     std::vector<std::shared_ptr<CpuGeneratorCoreStats>> m_Cores;
 
+    int64_t m_Cycles;
+    bool m_CyclesIsSet;
+    int64_t m_Instructions;
+    bool m_InstructionsIsSet;
+    int64_t m_Cache_misses;
+    bool m_Cache_missesIsSet;
 };
 
 }
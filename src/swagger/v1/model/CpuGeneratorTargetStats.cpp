@@ -22,6 +22,8 @@ CpuGeneratorTargetStats::CpuGeneratorTargetStats()
     m_Data_type = "";
     m_Instruction_set = "";
     m_Operations = 0L;
+    m_Operation = "";
+    m_OperationIsSet = false;
     
 }
 
@@ -41,6 +43,10 @@ nlohmann::json CpuGeneratorTargetStats::toJson() const
     val["data_type"] = ModelBase::toJson(m_Data_type);
     val["instruction_set"] = ModelBase::toJson(m_Instruction_set);
     val["operations"] = m_Operations;
+    if(m_OperationIsSet)
+    {
+        val["operation"] = ModelBase::toJson(m_Operation);
+    }
     
 
     return val;
@@ -51,6 +57,11 @@ void CpuGeneratorTargetStats::fromJson(nlohmann::json& val)
     setDataType(val.at("data_type"));
     setInstructionSet(val.at("instruction_set"));
     setOperations(val.at("operations"));
+    if(val.find("operation") != val.end())
+    {
+        setOperation(val.at("operation"));
+        
+    }
     
 }
 
@@ -82,6 +93,23 @@ void CpuGeneratorTargetStats::setOperations(int64_t value)
     m_Operations = value;
     
 }
+std::string CpuGeneratorTargetStats::getOperation() const
+{
+    return m_Operation;
+}
+void CpuGeneratorTargetStats::setOperation(std::string value)
+{
+    m_Operation = value;
+    m_OperationIsSet = true;
+}
+bool CpuGeneratorTargetStats::operationIsSet() const
+{
+    return m_OperationIsSet;
+}
+void CpuGeneratorTargetStats::unsetOperation()
+{
+    m_OperationIsSet = false;
+}
 
 }
 }
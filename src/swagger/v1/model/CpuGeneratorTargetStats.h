@@ -63,7 +63,14 @@ public:
     /// </summary>
     int64_t getOperations() const;
     void setOperations(int64_t value);
-    
+        /// <summary>
+    /// CPU load operation
+    /// </summary>
+    std::string getOperation() const;
+    void setOperation(std::string value);
+    bool operationIsSet() const;
+    void unsetOperation();
+
 protected:
     std::string m_Data_type;
 
@@ -71,6 +78,8 @@ protected:
 
     int64_t m_Operations;
 
+    std::string m_Operation;
+    bool m_OperationIsSet;
 };
 
 }
@@ -27,6 +27,18 @@ MemoryGeneratorConfig::MemoryGeneratorConfig()
     m_Write_size = 0;
     m_Write_threads = 0;
     m_Pattern = "";
+    m_Page_size = "";
+    m_Page_sizeIsSet = false;
+    m_Buffer_numa_node = 0;
+    m_Buffer_numa_nodeIsSet = false;
+    m_Read_numa_node = 0;
+    m_Read_numa_nodeIsSet = false;
+    m_Write_numa_node = 0;
+    m_Write_numa_nodeIsSet = false;
+    m_Access_kernel = "";
+    m_Access_kernelIsSet = false;
+    m_Non_temporal = false;
+    m_Non_temporalIsSet = false;
     
 }
 
@@ -51,6 +63,30 @@ nlohmann::json MemoryGeneratorConfig::toJson() const
     val["write_size"] = m_Write_size;
     val["write_threads"] = m_Write_threads;
     val["pattern"] = ModelBase::toJson(m_Pattern);
+    if(m_Page_sizeIsSet)
+    {
+        val["page_size"] = ModelBase::toJson(m_Page_size);
+    }
+    if(m_Buffer_numa_nodeIsSet)
+    {
+        val["buffer_numa_node"] = m_Buffer_numa_node;
+    }
+    if(m_Read_numa_nodeIsSet)
+    {
+        val["read_numa_node"] = m_Read_numa_node;
+    }
+    if(m_Write_numa_nodeIsSet)
+    {
+        val["write_numa_node"] = m_Write_numa_node;
+    }
+    if(m_Access_kernelIsSet)
+    {
+        val["access_kernel"] = ModelBase::toJson(m_Access_kernel);
+    }
+    if(m_Non_temporalIsSet)
+    {
+        val["non_temporal"] = m_Non_temporal;
+    }
     
 
     return val;
@@ -66,6 +102,32 @@ void MemoryGeneratorConfig::fromJson(nlohmann::json& val)
     setWriteSize(val.at("write_size"));
     setWriteThreads(val.at("write_threads"));
     setPattern(val.at("pattern"));
+    if(val.find("page_size") != val.end())
+    {
+        setPageSize(val.at("page_size"));
+        
+    }
+    if(val.find("buffer_numa_node") != val.end())
+    {
+        setBufferNumaNode(val.at("buffer_numa_node"));
+    }
+    if(val.find("read_numa_node") != val.end())
+    {
+        setReadNumaNode(val.at("read_numa_node"));
+    }
+    if(val.find("write_numa_node") != val.end())
+    {
+        setWriteNumaNode(val.at("write_numa_node"));
+    }
+    if(val.find("access_kernel") != val.end())
+    {
+        setAccessKernel(val.at("access_kernel"));
+        
+    }
+    if(val.find("non_temporal") != val.end())
+    {
+        setNonTemporal(val.at("non_temporal"));
+    }
     
 }
 
@@ -142,6 +204,108 @@ void MemoryGeneratorConfig::setPattern(std::string value)
     m_Pattern = value;
     
 }
+std::string MemoryGeneratorConfig::getPageSize() const
+{
+    return m_Page_size;
+}
+void MemoryGeneratorConfig::setPageSize(std::string value)
+{
+    m_Page_size = value;
+    m_Page_sizeIsSet = true;
+}
+bool MemoryGeneratorConfig::pageSizeIsSet() const
+{
+    return m_Page_sizeIsSet;
+}
+void MemoryGeneratorConfig::unsetPage_size()
+{
+    m_Page_sizeIsSet = false;
+}
+int32_t MemoryGeneratorConfig::getBufferNumaNode() const
+{
+    return m_Buffer_numa_node;
+}
+void MemoryGeneratorConfig::setBufferNumaNode(int32_t value)
+{
+    m_Buffer_numa_node = value;
+    m_Buffer_numa_nodeIsSet = true;
+}
+bool MemoryGeneratorConfig::bufferNumaNodeIsSet() const
+{
+    return m_Buffer_numa_nodeIsSet;
+}
+void MemoryGeneratorConfig::unsetBuffer_numa_node()
+{
+    m_Buffer_numa_nodeIsSet = false;
+}
+int32_t MemoryGeneratorConfig::getReadNumaNode() const
+{
+    return m_Read_numa_node;
+}
+void MemoryGeneratorConfig::setReadNumaNode(int32_t value)
+{
+    m_Read_numa_node = value;
+    m_Read_numa_nodeIsSet = true;
+}
+bool MemoryGeneratorConfig::readNumaNodeIsSet() const
+{
+    return m_Read_numa_nodeIsSet;
+}
+void MemoryGeneratorConfig::unsetRead_numa_node()
+{
+    m_Read_numa_nodeIsSet = false;
+}
+int32_t MemoryGeneratorConfig::getWriteNumaNode() const
+{
+    return m_Write_numa_node;
+}
+void MemoryGeneratorConfig::setWriteNumaNode(int32_t value)
+{
+    m_Write_numa_node = value;
+    m_Write_numa_nodeIsSet = true;
+}
+bool MemoryGeneratorConfig::writeNumaNodeIsSet() const
+{
+    return m_Write_numa_nodeIsSet;
+}
+void MemoryGeneratorConfig::unsetWrite_numa_node()
+{
+    m_Write_numa_nodeIsSet = false;
+}
+std::string MemoryGeneratorConfig::getAccessKernel() const
+{
+    return m_Access_kernel;
+}
+void MemoryGeneratorConfig::setAccessKernel(std::string value)
+{
+    m_Access_kernel = value;
+    m_Access_kernelIsSet = true;
+}
+bool MemoryGeneratorConfig::accessKernelIsSet() const
+{
+    return m_Access_kernelIsSet;
+}
+void MemoryGeneratorConfig::unsetAccess_kernel()
+{
+    m_Access_kernelIsSet = false;
+}
+bool MemoryGeneratorConfig::isNonTemporal() const
+{
+    return m_Non_temporal;
+}
+void MemoryGeneratorConfig::setNonTemporal(bool value)
+{
+    m_Non_temporal = value;
+    m_Non_temporalIsSet = true;
+}
+bool MemoryGeneratorConfig::nonTemporalIsSet() const
+{
+    return m_Non_temporalIsSet;
+}
+void MemoryGeneratorConfig::unsetNon_temporal()
+{
+    m_Non_temporalIsSet = false;
+}
 
 }
 }
@@ -88,7 +88,49 @@ public:
     /// </summary>
     std::string getPattern() const;
     void setPattern(std::string value);
-    
+        /// <summary>
+    /// Page size used to back the memory buffer
+    /// </summary>
+    std::string getPageSize() const;
+    void setPageSize(std::string value);
+    bool pageSizeIsSet() const;
+    void unsetPage_size();
+    /// <summary>
+    /// NUMA node to allocate the memory buffer from
+    /// </summary>
+    int32_t getBufferNumaNode() const;
+    void setBufferNumaNode(int32_t value);
+    bool bufferNumaNodeIsSet() const;
+    void unsetBuffer_numa_node();
+    /// <summary>
+    /// NUMA node to run read worker threads on
+    /// </summary>
+    int32_t getReadNumaNode() const;
+    void setReadNumaNode(int32_t value);
+    bool readNumaNodeIsSet() const;
+    void unsetRead_numa_node();
+    /// <summary>
+    /// NUMA node to run write worker threads on
+    /// </summary>
+    int32_t getWriteNumaNode() const;
+    void setWriteNumaNode(int32_t value);
+    bool writeNumaNodeIsSet() const;
+    void unsetWrite_numa_node();
+    /// <summary>
+    /// Memory access kernel; defaults to scalar
+    /// </summary>
+    std::string getAccessKernel() const;
+    void setAccessKernel(std::string value);
+    bool accessKernelIsSet() const;
+    void unsetAccess_kernel();
+    /// <summary>
+    /// Bypass the cache with non-temporal loads and stores
+    /// </summary>
+    bool isNonTemporal() const;
+    void setNonTemporal(bool value);
+    bool nonTemporalIsSet() const;
+    void unsetNon_temporal();
+
 protected:
     int64_t m_Buffer_size;
 
@@ -106,6 +148,18 @@ protected:
 
     std::string m_Pattern;
 
+    std::string m_Page_size;
+    bool m_Page_sizeIsSet;
+    int32_t m_Buffer_numa_node;
+    bool m_Buffer_numa_nodeIsSet;
+    int32_t m_Read_numa_node;
+    bool m_Read_numa_nodeIsSet;
+    int32_t m_Write_numa_node;
+    bool m_Write_numa_nodeIsSet;
+    std::string m_Access_kernel;
+    bool m_Access_kernelIsSet;
+    bool m_Non_temporal;
+    bool m_Non_temporalIsSet;
 };
 
 }
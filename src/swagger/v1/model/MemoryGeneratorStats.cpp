@@ -24,6 +24,14 @@ MemoryGeneratorStats::MemoryGeneratorStats()
     m_Bytes_target = 0L;
     m_Bytes_actual = 0L;
     m_Latency_total = 0L;
+    m_Latency_p50 = 0L;
+    m_Latency_p50IsSet = false;
+    m_Latency_p99 = 0L;
+    m_Latency_p99IsSet = false;
+    m_Latency_p999 = 0L;
+    m_Latency_p999IsSet = false;
+    m_Latency_p9999 = 0L;
+    m_Latency_p9999IsSet = false;
     
 }
 
@@ -45,6 +53,22 @@ nlohmann::json MemoryGeneratorStats::toJson() const
     val["bytes_target"] = m_Bytes_target;
     val["bytes_actual"] = m_Bytes_actual;
     val["latency_total"] = m_Latency_total;
+    if(m_Latency_p50IsSet)
+    {
+        val["latency_p50"] = m_Latency_p50;
+    }
+    if(m_Latency_p99IsSet)
+    {
+        val["latency_p99"] = m_Latency_p99;
+    }
+    if(m_Latency_p999IsSet)
+    {
+        val["latency_p999"] = m_Latency_p999;
+    }
+    if(m_Latency_p9999IsSet)
+    {
+        val["latency_p9999"] = m_Latency_p9999;
+    }
     
 
     return val;
@@ -57,6 +81,22 @@ void MemoryGeneratorStats::fromJson(nlohmann::json& val)
     setBytesTarget(val.at("bytes_target"));
     setBytesActual(val.at("bytes_actual"));
     setLatencyTotal(val.at("latency_total"));
+    if(val.find("latency_p50") != val.end())
+    {
+        setLatencyP50(val.at("latency_p50"));
+    }
+    if(val.find("latency_p99") != val.end())
+    {
+        setLatencyP99(val.at("latency_p99"));
+    }
+    if(val.find("latency_p999") != val.end())
+    {
+        setLatencyP999(val.at("latency_p999"));
+    }
+    if(val.find("latency_p9999") != val.end())
+    {
+        setLatencyP9999(val.at("latency_p9999"));
+    }
     
 }
 
@@ -106,6 +146,74 @@ void MemoryGeneratorStats::setLatencyTotal(int64_t value)
     m_Latency_total = value;
     
 }
+int64_t MemoryGeneratorStats::getLatencyP50() const
+{
+    return m_Latency_p50;
+}
+void MemoryGeneratorStats::setLatencyP50(int64_t value)
+{
+    m_Latency_p50 = value;
+    m_Latency_p50IsSet = true;
+}
+bool MemoryGeneratorStats::latencyP50IsSet() const
+{
+    return m_Latency_p50IsSet;
+}
+void MemoryGeneratorStats::unsetLatency_p50()
+{
+    m_Latency_p50IsSet = false;
+}
+int64_t MemoryGeneratorStats::getLatencyP99() const
+{
+    return m_Latency_p99;
+}
+void MemoryGeneratorStats::setLatencyP99(int64_t value)
+{
+    m_Latency_p99 = value;
+    m_Latency_p99IsSet = true;
+}
+bool MemoryGeneratorStats::latencyP99IsSet() const
+{
+    return m_Latency_p99IsSet;
+}
+void MemoryGeneratorStats::unsetLatency_p99()
+{
+    m_Latency_p99IsSet = false;
+}
+int64_t MemoryGeneratorStats::getLatencyP999() const
+{
+    return m_Latency_p999;
+}
+void MemoryGeneratorStats::setLatencyP999(int64_t value)
+{
+    m_Latency_p999 = value;
+    m_Latency_p999IsSet = true;
+}
+bool MemoryGeneratorStats::latencyP999IsSet() const
+{
+    return m_Latency_p999IsSet;
+}
+void MemoryGeneratorStats::unsetLatency_p999()
+{
+    m_Latency_p999IsSet = false;
+}
+int64_t MemoryGeneratorStats::getLatencyP9999() const
+{
+    return m_Latency_p9999;
+}
+void MemoryGeneratorStats::setLatencyP9999(int64_t value)
+{
+    m_Latency_p9999 = value;
+    m_Latency_p9999IsSet = true;
+}
+bool MemoryGeneratorStats::latencyP9999IsSet() const
+{
+    return m_Latency_p9999IsSet;
+}
+void MemoryGeneratorStats::unsetLatency_p9999()
+{
+    m_Latency_p9999IsSet = false;
+}
 
 }
 }
@@ -72,7 +72,35 @@ public:
     /// </summary>
     int64_t getLatencyTotal() const;
     void setLatencyTotal(int64_t value);
-    
+        /// <summary>
+    /// The 50th percentile of observed latency values (in nanoseconds, averaged over each batch of operations) 
+    /// </summary>
+    int64_t getLatencyP50() const;
+    void setLatencyP50(int64_t value);
+    bool latencyP50IsSet() const;
+    void unsetLatency_p50();
+    /// <summary>
+    /// The 99th percentile of observed latency values (in nanoseconds, averaged over each batch of operations) 
+    /// </summary>
+    int64_t getLatencyP99() const;
+    void setLatencyP99(int64_t value);
+    bool latencyP99IsSet() const;
+    void unsetLatency_p99();
+    /// <summary>
+    /// The 99.9th percentile of observed latency values (in nanoseconds, averaged over each batch of operations) 
+    /// </summary>
+    int64_t getLatencyP999() const;
+    void setLatencyP999(int64_t value);
+    bool latencyP999IsSet() const;
+    void unsetLatency_p999();
+    /// <summary>
+    /// The 99.99th percentile of observed latency values (in nanoseconds, averaged over each batch of operations) 
+    /// </summary>
+    int64_t getLatencyP9999() const;
+    void setLatencyP9999(int64_t value);
+    bool latencyP9999IsSet() const;
+    void unsetLatency_p9999();
+
 protected:
     int64_t m_Ops_target;
 
@@ -84,6 +112,14 @@ protected:
 
     int64_t m_Latency_total;
 
+    int64_t m_Latency_p50;
+    bool m_Latency_p50IsSet;
+    int64_t m_Latency_p99;
+    bool m_Latency_p99IsSet;
+    int64_t m_Latency_p999;
+    bool m_Latency_p999IsSet;
+    int64_t m_Latency_p9999;
+    bool m_Latency_p9999IsSet;
 };
 
 }
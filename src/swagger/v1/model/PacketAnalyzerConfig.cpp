@@ -22,6 +22,8 @@ PacketAnalyzerConfig::PacketAnalyzerConfig()
     m_Filter = "";
     m_FilterIsSet = false;
     m_Flow_digestsIsSet = false;
+    m_Max_flows = 0L;
+    m_Max_flowsIsSet = false;
     
 }
 
@@ -70,6 +72,10 @@ nlohmann::json PacketAnalyzerConfig::toJson() const
             val["flow_digests"] = jsonArray;
         }
     }
+    if(m_Max_flowsIsSet)
+    {
+        val["max_flows"] = m_Max_flows;
+    }
     
 
     return val;
@@ -112,6 +118,10 @@ void PacketAnalyzerConfig::fromJson(nlohmann::json& val)
         }
         }
     }
+    if(val.find("max_flows") != val.end())
+    {
+        setMaxFlows(val.at("max_flows"));
+    }
     
 }
 
@@ -153,6 +163,23 @@ void PacketAnalyzerConfig::unsetFlow_digests()
 {
     m_Flow_digestsIsSet = false;
 }
+int64_t PacketAnalyzerConfig::getMaxFlows() const
+{
+    return m_Max_flows;
+}
+void PacketAnalyzerConfig::setMaxFlows(int64_t value)
+{
+    m_Max_flows = value;
+    m_Max_flowsIsSet = true;
+}
+bool PacketAnalyzerConfig::maxFlowsIsSet() const
+{
+    return m_Max_flowsIsSet;
+}
+void PacketAnalyzerConfig::unsetMax_flows()
+{
+    m_Max_flowsIsSet = false;
+}
 
 }
 }
@@ -70,6 +70,13 @@ public:
     std::vector<std::string>& getFlowDigests();
     bool flowDigestsIsSet() const;
     void unsetFlow_digests();
+    /// <summary>
+    /// Maximum number of unique flows the analyzer can track. Flow statistics are allocated when analyzer results are created. Packets belonging to additional flows are counted as overflows. 
+    /// </summary>
+    int64_t getMaxFlows() const;
+    void setMaxFlows(int64_t value);
+    bool maxFlowsIsSet() const;
+    void unsetMax_flows();
 
 protected:
     std::string m_Filter;
@@ -80,6 +87,8 @@ protected:
 
     std::vector<std::string> m_Flow_digests;
     bool m_Flow_digestsIsSet;
+    int64_t m_Max_flows;
+    bool m_Max_flowsIsSet;
 };
 
 }
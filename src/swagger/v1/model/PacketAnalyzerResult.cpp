@@ -25,6 +25,8 @@ PacketAnalyzerResult::PacketAnalyzerResult()
     m_Active = false;
     m_Flow_digestsIsSet = false;
     m_FlowsIsSet = false;
+    m_Flow_overflow = 0L;
+    m_Flow_overflowIsSet = false;
     
 }
 
@@ -65,6 +67,10 @@ nlohmann::json PacketAnalyzerResult::toJson() const
             val["flows"] = jsonArray;
         }
     }
+    if(m_Flow_overflowIsSet)
+    {
+        val["flow_overflow"] = m_Flow_overflow;
+    }
     
 
     return val;
@@ -101,6 +107,10 @@ void PacketAnalyzerResult::fromJson(nlohmann::json& val)
         }
         }
     }
+    if(val.find("flow_overflow") != val.end())
+    {
+        setFlowOverflow(val.at("flow_overflow"));
+    }
     
 }
 
@@ -187,6 +197,23 @@ void PacketAnalyzerResult::unsetFlows()
 {
     m_FlowsIsSet = false;
 }
+int64_t PacketAnalyzerResult::getFlowOverflow() const
+{
+    return m_Flow_overflow;
+}
+void PacketAnalyzerResult::setFlowOverflow(int64_t value)
+{
+    m_Flow_overflow = value;
+    m_Flow_overflowIsSet = true;
+}
+bool PacketAnalyzerResult::flowOverflowIsSet() const
+{
+    return m_Flow_overflowIsSet;
+}
+void PacketAnalyzerResult::unsetFlow_overflow()
+{
+    m_Flow_overflowIsSet = false;
+}
 
 }
 }
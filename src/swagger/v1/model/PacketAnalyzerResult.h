@@ -92,6 +92,13 @@ public:
     std::vector<std::string>& getFlows();
     bool flowsIsSet() const;
     void unsetFlows();
+    /// <summary>
+    /// Number of received packets that were not included in flow statistics because the analyzer flow table was full. 
+    /// </summary>
+    int64_t getFlowOverflow() const;
+    void setFlowOverflow(int64_t value);
+    bool flowOverflowIsSet() const;
+    void unsetFlow_overflow();
 
 protected:
     std::string m_Id;
@@ -108,6 +115,8 @@ protected:
     bool m_Flow_digestsIsSet;
     std::vector<std::string> m_Flows;
     bool m_FlowsIsSet;
+    int64_t m_Flow_overflow;
+    bool m_Flow_overflowIsSet;
 };
 
 }
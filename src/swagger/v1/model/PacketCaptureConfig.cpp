@@ -35,6 +35,10 @@ PacketCaptureConfig::PacketCaptureConfig()
     m_DurationIsSet = false;
     m_Packet_count = 0L;
     m_Packet_countIsSet = false;
+    m_File_rotate_size = 0L;
+    m_File_rotate_sizeIsSet = false;
+    m_File_rotate_interval = 0L;
+    m_File_rotate_intervalIsSet = false;
     
 }
 
@@ -81,6 +85,14 @@ nlohmann::json PacketCaptureConfig::toJson() const
     {
         val["packet_count"] = m_Packet_count;
     }
+    if(m_File_rotate_sizeIsSet)
+    {
+        val["file_rotate_size"] = m_File_rotate_size;
+    }
+    if(m_File_rotate_intervalIsSet)
+    {
+        val["file_rotate_interval"] = m_File_rotate_interval;
+    }
     
 
     return val;
@@ -121,6 +133,14 @@ void PacketCaptureConfig::fromJson(nlohmann::json& val)
     {
         setPacketCount(val.at("packet_count"));
     }
+    if(val.find("file_rotate_size") != val.end())
+    {
+        setFileRotateSize(val.at("file_rotate_size"));
+    }
+    if(val.find("file_rotate_interval") != val.end())
+    {
+        setFileRotateInterval(val.at("file_rotate_interval"));
+    }
     
 }
 
@@ -262,6 +282,40 @@ void PacketCaptureConfig::unsetPacket_count()
 {
     m_Packet_countIsSet = false;
 }
+int64_t PacketCaptureConfig::getFileRotateSize() const
+{
+    return m_File_rotate_size;
+}
+void PacketCaptureConfig::setFileRotateSize(int64_t value)
+{
+    m_File_rotate_size = value;
+    m_File_rotate_sizeIsSet = true;
+}
+bool PacketCaptureConfig::fileRotateSizeIsSet() const
+{
+    return m_File_rotate_sizeIsSet;
+}
+void PacketCaptureConfig::unsetFile_rotate_size()
+{
+    m_File_rotate_sizeIsSet = false;
+}
+int64_t PacketCaptureConfig::getFileRotateInterval() const
+{
+    return m_File_rotate_interval;
+}
+void PacketCaptureConfig::setFileRotateInterval(int64_t value)
+{
+    m_File_rotate_interval = value;
+    m_File_rotate_intervalIsSet = true;
+}
+bool PacketCaptureConfig::fileRotateIntervalIsSet() const
+{
+    return m_File_rotate_intervalIsSet;
+}
+void PacketCaptureConfig::unsetFile_rotate_interval()
+{
+    m_File_rotate_intervalIsSet = false;
+}
 
 }
 }
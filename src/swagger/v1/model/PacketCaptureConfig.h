@@ -107,6 +107,20 @@ public:
     void setPacketCount(int64_t value);
     bool packetCountIsSet() const;
     void unsetPacket_count();
+    /// <summary>
+    /// In file mode, start a new capture file when the current file reaches this size in bytes. 
+    /// </summary>
+    int64_t getFileRotateSize() const;
+    void setFileRotateSize(int64_t value);
+    bool fileRotateSizeIsSet() const;
+    void unsetFile_rotate_size();
+    /// <summary>
+    /// In file mode, start a new capture file when the current file has been open for this long in msec. 
+    /// </summary>
+    int64_t getFileRotateInterval() const;
+    void setFileRotateInterval(int64_t value);
+    bool fileRotateIntervalIsSet() const;
+    void unsetFile_rotate_interval();
 
 protected:
     std::string m_Mode;
@@ -127,6 +141,10 @@ protected:
     bool m_DurationIsSet;
     int64_t m_Packet_count;
     bool m_Packet_countIsSet;
+    int64_t m_File_rotate_size;
+    bool m_File_rotate_sizeIsSet;
+    int64_t m_File_rotate_interval;
+    bool m_File_rotate_intervalIsSet;
 };
 
 }
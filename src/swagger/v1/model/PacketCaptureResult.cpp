@@ -26,6 +26,7 @@ PacketCaptureResult::PacketCaptureResult()
     m_State = "";
     m_Packets = 0L;
     m_Bytes = 0L;
+    m_Dropped_packets = 0L;
     
 }
 
@@ -51,6 +52,7 @@ nlohmann::json PacketCaptureResult::toJson() const
     val["state"] = ModelBase::toJson(m_State);
     val["packets"] = m_Packets;
     val["bytes"] = m_Bytes;
+    val["dropped_packets"] = m_Dropped_packets;
     
 
     return val;
@@ -67,6 +69,7 @@ void PacketCaptureResult::fromJson(nlohmann::json& val)
     setState(val.at("state"));
     setPackets(val.at("packets"));
     setBytes(val.at("bytes"));
+    setDroppedPackets(val.at("dropped_packets"));
     
 }
 
@@ -132,6 +135,15 @@ void PacketCaptureResult::setBytes(int64_t value)
 {
     m_Bytes = value;
     
+}
+int64_t PacketCaptureResult::getDroppedPackets() const
+{
+    return m_Dropped_packets;
+}
+void PacketCaptureResult::setDroppedPackets(int64_t value)
+{
+    m_Dropped_packets = value;
+    
 }
 
 }
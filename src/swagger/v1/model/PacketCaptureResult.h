@@ -80,6 +80,11 @@ public:
     /// </summary>
     int64_t getBytes() const;
     void setBytes(int64_t value);
+        /// <summary>
+    /// Number of packets dropped because the capture could not keep up with the packet rate. 
+    /// </summary>
+    int64_t getDroppedPackets() const;
+    void setDroppedPackets(int64_t value);
     
 protected:
     std::string m_Id;
@@ -94,6 +99,8 @@ protected:
 
     int64_t m_Bytes;
 
+    int64_t m_Dropped_packets;
+
 };
 
 }
@@ -24,6 +24,8 @@ PacketGeneratorConfig::PacketGeneratorConfig()
     m_Order = "";
     m_OrderIsSet = false;
     m_Protocol_countersIsSet = false;
+    m_Zero_copy = false;
+    m_Zero_copyIsSet = false;
     
 }
 
@@ -70,6 +72,10 @@ nlohmann::json PacketGeneratorConfig::toJson() const
         }
         val["traffic"] = jsonArray;
             }
+    if(m_Zero_copyIsSet)
+    {
+        val["zero_copy"] = m_Zero_copy;
+    }
     
 
     return val;
@@ -117,6 +123,10 @@ void PacketGeneratorConfig::fromJson(nlohmann::json& val)
             
         }
     }
+    if(val.find("zero_copy") != val.end())
+    {
+        setZeroCopy(val.at("zero_copy"));
+    }
     
 }
 
@@ -189,6 +199,23 @@ std::vector<std::shared_ptr<TrafficDefinition>>& PacketGeneratorConfig::getTraff
 {
     return m_Traffic;
 }
+bool PacketGeneratorConfig::isZeroCopy() const
+{
+    return m_Zero_copy;
+}
+void PacketGeneratorConfig::setZeroCopy(bool value)
+{
+    m_Zero_copy = value;
+    m_Zero_copyIsSet = true;
+}
+bool PacketGeneratorConfig::zeroCopyIsSet() const
+{
+    return m_Zero_copyIsSet;
+}
+void PacketGeneratorConfig::unsetZero_copy()
+{
+    m_Zero_copyIsSet = false;
+}
 
 }
 }
@@ -86,7 +86,14 @@ public:
     /// List of traffic definitions
     /// </summary>
     std::vector<std::shared_ptr<TrafficDefinition>>& getTraffic();
-    
+        /// <summary>
+    /// Build each flow's headers once in a shared, read-only template buffer and chain per packet data to it instead of copying headers into every packet. Requires transmit checksum and multi-segment offloads on the target port.
+    /// </summary>
+    bool isZeroCopy() const;
+    void setZeroCopy(bool value);
+    bool zeroCopyIsSet() const;
+    void unsetZero_copy();
+
 protected:
     std::shared_ptr<TrafficDuration> m_Duration;
 
@@ -100,6 +107,8 @@ protected:
     bool m_Protocol_countersIsSet;
     std::vector<std::shared_ptr<TrafficDefinition>> m_Traffic;
 
+    bool m_Zero_copy;
+    bool m_Zero_copyIsSet;
 };
 
 }
@@ -24,6 +24,16 @@ PacketGeneratorResult::PacketGeneratorResult()
     m_Generator_idIsSet = false;
     m_Active = false;
     m_RemainingIsSet = false;
+    m_Tx_gap_intended = 0L;
+    m_Tx_gap_intendedIsSet = false;
+    m_Tx_gap_average = 0L;
+    m_Tx_gap_averageIsSet = false;
+    m_Tx_gap_min = 0L;
+    m_Tx_gap_minIsSet = false;
+    m_Tx_gap_max = 0L;
+    m_Tx_gap_maxIsSet = false;
+    m_Tx_gap_jitter = 0L;
+    m_Tx_gap_jitterIsSet = false;
     
 }
 
@@ -60,6 +70,26 @@ nlohmann::json PacketGeneratorResult::toJson() const
     {
         val["remaining"] = ModelBase::toJson(m_Remaining);
     }
+    if(m_Tx_gap_intendedIsSet)
+    {
+        val["tx_gap_intended"] = m_Tx_gap_intended;
+    }
+    if(m_Tx_gap_averageIsSet)
+    {
+        val["tx_gap_average"] = m_Tx_gap_average;
+    }
+    if(m_Tx_gap_minIsSet)
+    {
+        val["tx_gap_min"] = m_Tx_gap_min;
+    }
+    if(m_Tx_gap_maxIsSet)
+    {
+        val["tx_gap_max"] = m_Tx_gap_max;
+    }
+    if(m_Tx_gap_jitterIsSet)
+    {
+        val["tx_gap_jitter"] = m_Tx_gap_jitter;
+    }
     
 
     return val;
@@ -93,6 +123,26 @@ void PacketGeneratorResult::fromJson(nlohmann::json& val)
         }
         
     }
+    if(val.find("tx_gap_intended") != val.end())
+    {
+        setTxGapIntended(val.at("tx_gap_intended"));
+    }
+    if(val.find("tx_gap_average") != val.end())
+    {
+        setTxGapAverage(val.at("tx_gap_average"));
+    }
+    if(val.find("tx_gap_min") != val.end())
+    {
+        setTxGapMin(val.at("tx_gap_min"));
+    }
+    if(val.find("tx_gap_max") != val.end())
+    {
+        setTxGapMax(val.at("tx_gap_max"));
+    }
+    if(val.find("tx_gap_jitter") != val.end())
+    {
+        setTxGapJitter(val.at("tx_gap_jitter"));
+    }
     
 }
 
@@ -171,6 +221,91 @@ void PacketGeneratorResult::unsetRemaining()
 {
     m_RemainingIsSet = false;
 }
+int64_t PacketGeneratorResult::getTxGapIntended() const
+{
+    return m_Tx_gap_intended;
+}
+void PacketGeneratorResult::setTxGapIntended(int64_t value)
+{
+    m_Tx_gap_intended = value;
+    m_Tx_gap_intendedIsSet = true;
+}
+bool PacketGeneratorResult::txGapIntendedIsSet() const
+{
+    return m_Tx_gap_intendedIsSet;
+}
+void PacketGeneratorResult::unsetTx_gap_intended()
+{
+    m_Tx_gap_intendedIsSet = false;
+}
+int64_t PacketGeneratorResult::getTxGapAverage() const
+{
+    return m_Tx_gap_average;
+}
+void PacketGeneratorResult::setTxGapAverage(int64_t value)
+{
+    m_Tx_gap_average = value;
+    m_Tx_gap_averageIsSet = true;
+}
+bool PacketGeneratorResult::txGapAverageIsSet() const
+{
+    return m_Tx_gap_averageIsSet;
+}
+void PacketGeneratorResult::unsetTx_gap_average()
+{
+    m_Tx_gap_averageIsSet = false;
+}
+int64_t PacketGeneratorResult::getTxGapMin() const
+{
+    return m_Tx_gap_min;
+}
+void PacketGeneratorResult::setTxGapMin(int64_t value)
+{
+    m_Tx_gap_min = value;
+    m_Tx_gap_minIsSet = true;
+}
+bool PacketGeneratorResult::txGapMinIsSet() const
+{
+    return m_Tx_gap_minIsSet;
+}
+void PacketGeneratorResult::unsetTx_gap_min()
+{
+    m_Tx_gap_minIsSet = false;
+}
+int64_t PacketGeneratorResult::getTxGapMax() const
+{
+    return m_Tx_gap_max;
+}
+void PacketGeneratorResult::setTxGapMax(int64_t value)
+{
+    m_Tx_gap_max = value;
+    m_Tx_gap_maxIsSet = true;
+}
+bool PacketGeneratorResult::txGapMaxIsSet() const
+{
+    return m_Tx_gap_maxIsSet;
+}
+void PacketGeneratorResult::unsetTx_gap_max()
+{
+    m_Tx_gap_maxIsSet = false;
+}
+int64_t PacketGeneratorResult::getTxGapJitter() const
+{
+    return m_Tx_gap_jitter;
+}
+void PacketGeneratorResult::setTxGapJitter(int64_t value)
+{
+    m_Tx_gap_jitter = value;
+    m_Tx_gap_jitterIsSet = true;
+}
+bool PacketGeneratorResult::txGapJitterIsSet() const
+{
+    return m_Tx_gap_jitterIsSet;
+}
+void PacketGeneratorResult::unsetTx_gap_jitter()
+{
+    m_Tx_gap_jitterIsSet = false;
+}
 
 }
 }
@@ -90,6 +90,41 @@ public:
     void setRemaining(std::shared_ptr<TrafficDurationRemainder> value);
     bool remainingIsSet() const;
     void unsetRemaining();
+    /// <summary>
+    /// Configured interval between bursts, in nanoseconds. Only present when measured by precise transmit pacing.
+    /// </summary>
+    int64_t getTxGapIntended() const;
+    void setTxGapIntended(int64_t value);
+    bool txGapIntendedIsSet() const;
+    void unsetTx_gap_intended();
+    /// <summary>
+    /// Average achieved interval between bursts, in nanoseconds
+    /// </summary>
+    int64_t getTxGapAverage() const;
+    void setTxGapAverage(int64_t value);
+    bool txGapAverageIsSet() const;
+    void unsetTx_gap_average();
+    /// <summary>
+    /// Minimum achieved interval between bursts, in nanoseconds
+    /// </summary>
+    int64_t getTxGapMin() const;
+    void setTxGapMin(int64_t value);
+    bool txGapMinIsSet() const;
+    void unsetTx_gap_min();
+    /// <summary>
+    /// Maximum achieved interval between bursts, in nanoseconds
+    /// </summary>
+    int64_t getTxGapMax() const;
+    void setTxGapMax(int64_t value);
+    bool txGapMaxIsSet() const;
+    void unsetTx_gap_max();
+    /// <summary>
+    /// Average absolute difference between the achieved and configured burst interval, in nanoseconds
+    /// </summary>
+    int64_t getTxGapJitter() const;
+    void setTxGapJitter(int64_t value);
+    bool txGapJitterIsSet() const;
+    void unsetTx_gap_jitter();
 
 protected:
     std::string m_Id;
@@ -106,6 +141,16 @@ protected:
 
     std::shared_ptr<TrafficDurationRemainder> m_Remaining;
     bool m_RemainingIsSet;
+    int64_t m_Tx_gap_intended;
+    bool m_Tx_gap_intendedIsSet;
+    int64_t m_Tx_gap_average;
+    bool m_Tx_gap_averageIsSet;
+    int64_t m_Tx_gap_min;
+    bool m_Tx_gap_minIsSet;
+    int64_t m_Tx_gap_max;
+    bool m_Tx_gap_maxIsSet;
+    int64_t m_Tx_gap_jitter;
+    bool m_Tx_gap_jitterIsSet;
 };
 
 }
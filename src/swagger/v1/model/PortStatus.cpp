@@ -22,6 +22,9 @@ PortStatus::PortStatus()
     m_Link = "";
     m_Speed = 0L;
     m_Duplex = "";
+    m_Rx_queue_workersIsSet = false;
+    m_Rx_queue_worker_busy_cyclesIsSet = false;
+    m_Rx_queue_worker_idle_cyclesIsSet = false;
     
 }
 
@@ -41,6 +44,42 @@ nlohmann::json PortStatus::toJson() const
     val["link"] = ModelBase::toJson(m_Link);
     val["speed"] = m_Speed;
     val["duplex"] = ModelBase::toJson(m_Duplex);
+    {
+        nlohmann::json jsonArray;
+        for( auto& item : m_Rx_queue_workers )
+        {
+            jsonArray.push_back(ModelBase::toJson(item));
+        }
+        
+        if(jsonArray.size() > 0)
+        {
+            val["rx_queue_workers"] = jsonArray;
+        }
+    }
+    {
+        nlohmann::json jsonArray;
+        for( auto& item : m_Rx_queue_worker_busy_cycles )
+        {
+            jsonArray.push_back(ModelBase::toJson(item));
+        }
+        
+        if(jsonArray.size() > 0)
+        {
+            val["rx_queue_worker_busy_cycles"] = jsonArray;
+        }
+    }
+    {
+        nlohmann::json jsonArray;
+        for( auto& item : m_Rx_queue_worker_idle_cycles )
+        {
+            jsonArray.push_back(ModelBase::toJson(item));
+        }
+        
+        if(jsonArray.size() > 0)
+        {
+            val["rx_queue_worker_idle_cycles"] = jsonArray;
+        }
+    }
     
 
     return val;
@@ -51,6 +90,42 @@ void PortStatus::fromJson(nlohmann::json& val)
     setLink(val.at("link"));
     setSpeed(val.at("speed"));
     setDuplex(val.at("duplex"));
+    {
+        m_Rx_queue_workers.clear();
+        nlohmann::json jsonArray;
+        if(val.find("rx_queue_workers") != val.end())
+        {
+        for( auto& item : val["rx_queue_workers"] )
+        {
+            m_Rx_queue_workers.push_back(item);
+            
+        }
+        }
+    }
+    {
+        m_Rx_queue_worker_busy_cycles.clear();
+        nlohmann::json jsonArray;
+        if(val.find("rx_queue_worker_busy_cycles") != val.end())
+        {
+        for( auto& item : val["rx_queue_worker_busy_cycles"] )
+        {
+            m_Rx_queue_worker_busy_cycles.push_back(item);
+            
+        }
+        }
+    }
+    {
+        m_Rx_queue_worker_idle_cycles.clear();
+        nlohmann::json jsonArray;
+        if(val.find("rx_queue_worker_idle_cycles") != val.end())
+        {
+        for( auto& item : val["rx_queue_worker_idle_cycles"] )
+        {
+            m_Rx_queue_worker_idle_cycles.push_back(item);
+            
+        }
+        }
+    }
     
 }
 
@@ -82,6 +157,42 @@ void PortStatus::setDuplex(std::string value)
     m_Duplex = value;
     
 }
+std::vector<int64_t>& PortStatus::getRxQueueWorkers()
+{
+    return m_Rx_queue_workers;
+}
+bool PortStatus::rxQueueWorkersIsSet() const
+{
+    return m_Rx_queue_workersIsSet;
+}
+void PortStatus::unsetRx_queue_workers()
+{
+    m_Rx_queue_workersIsSet = false;
+}
+std::vector<int64_t>& PortStatus::getRxQueueWorkerBusyCycles()
+{
+    return m_Rx_queue_worker_busy_cycles;
+}
+bool PortStatus::rxQueueWorkerBusyCyclesIsSet() const
+{
+    return m_Rx_queue_worker_busy_cyclesIsSet;
+}
+void PortStatus::unsetRx_queue_worker_busy_cycles()
+{
+    m_Rx_queue_worker_busy_cyclesIsSet = false;
+}
+std::vector<int64_t>& PortStatus::getRxQueueWorkerIdleCycles()
+{
+    return m_Rx_queue_worker_idle_cycles;
+}
+bool PortStatus::rxQueueWorkerIdleCyclesIsSet() const
+{
+    return m_Rx_queue_worker_idle_cyclesIsSet;
+}
+void PortStatus::unsetRx_queue_worker_idle_cycles()
+{
+    m_Rx_queue_worker_idle_cyclesIsSet = false;
+}
 
 }
 }
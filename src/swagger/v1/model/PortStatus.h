@@ -22,6 +22,7 @@
 #include "ModelBase.h"
 
 #include <string>
+#include <vector>
 
 namespace swagger {
 namespace v1 {
@@ -63,7 +64,25 @@ public:
     /// </summary>
     std::string getDuplex() const;
     void setDuplex(std::string value);
-    
+        /// <summary>
+    /// Worker servicing each receive queue, indexed by queue id
+    /// </summary>
+    std::vector<int64_t>& getRxQueueWorkers();
+    bool rxQueueWorkersIsSet() const;
+    void unsetRx_queue_workers();
+        /// <summary>
+    /// Busy cycles of the worker servicing each receive queue, indexed by queue id
+    /// </summary>
+    std::vector<int64_t>& getRxQueueWorkerBusyCycles();
+    bool rxQueueWorkerBusyCyclesIsSet() const;
+    void unsetRx_queue_worker_busy_cycles();
+        /// <summary>
+    /// Idle cycles of the worker servicing each receive queue, indexed by queue id
+    /// </summary>
+    std::vector<int64_t>& getRxQueueWorkerIdleCycles();
+    bool rxQueueWorkerIdleCyclesIsSet() const;
+    void unsetRx_queue_worker_idle_cycles();
+
 protected:
     std::string m_Link;
 
@@ -71,6 +90,12 @@ protected:
 
     std::string m_Duplex;
 
+    std::vector<int64_t> m_Rx_queue_workers;
+    bool m_Rx_queue_workersIsSet;
+    std::vector<int64_t> m_Rx_queue_worker_busy_cycles;
+    bool m_Rx_queue_worker_busy_cyclesIsSet;
+    std::vector<int64_t> m_Rx_queue_worker_idle_cycles;
+    bool m_Rx_queue_worker_idle_cyclesIsSet;
 };
 
 }
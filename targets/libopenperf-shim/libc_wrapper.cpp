@@ -48,6 +48,7 @@ void wrapper::init()
     recv = load_symbol<decltype(recv)>(RTLD_NEXT, "recv");
     recvfrom = load_symbol<decltype(recvfrom)>(RTLD_NEXT, "recvfrom");
     recvmsg = load_symbol<decltype(recvmsg)>(RTLD_NEXT, "recvmsg");
+    recvmmsg = load_symbol<decltype(recvmmsg)>(RTLD_NEXT, "recvmmsg");
 
     send = load_symbol<decltype(send)>(RTLD_NEXT, "send");
     sendmsg = load_symbol<decltype(sendmsg)>(RTLD_NEXT, "sendmsg");
@@ -55,6 +56,10 @@ void wrapper::init()
     setsockopt = load_symbol<decltype(setsockopt)>(RTLD_NEXT, "setsockopt");
     write = load_symbol<decltype(write)>(RTLD_NEXT, "write");
     writev = load_symbol<decltype(writev)>(RTLD_NEXT, "writev");
+    sendmmsg = load_symbol<decltype(sendmmsg)>(RTLD_NEXT, "sendmmsg");
+    sendfile = load_symbol<decltype(sendfile)>(RTLD_NEXT, "sendfile");
+    sendfile64 = load_symbol<decltype(sendfile64)>(RTLD_NEXT, "sendfile64");
+    splice = load_symbol<decltype(splice)>(RTLD_NEXT, "splice");
 }
 
 } // namespace libc
@@ -1,7 +1,9 @@
 #ifndef _OP_SHIM_LIBC_WRAPPER_HPP_
 #define _OP_SHIM_LIBC_WRAPPER_HPP_
 
+#include <fcntl.h>
 #include <sys/socket.h>
+#include <sys/types.h>
 
 namespace openperf {
 namespace socket {
@@ -50,6 +52,11 @@ struct wrapper : singleton<wrapper>
                         struct sockaddr* from,
                         socklen_t* fromlen);
     ssize_t (*recvmsg)(int s, struct msghdr* message, int flags);
+    int (*recvmmsg)(int s,
+                    struct mmsghdr* msgvec,
+                    unsigned int vlen,
+                    int flags,
+                    struct timespec* timeout);
     ssize_t (*send)(int s, const void* dataptr, size_t len, int flags);
     ssize_t (*sendmsg)(int s, const struct msghdr* message, int flags);
     ssize_t (*sendto)(int s,
@@ -60,6 +67,21 @@ struct wrapper : singleton<wrapper>
                       socklen_t tolen);
     ssize_t (*write)(int s, const void* dataptr, size_t len);
     ssize_t (*writev)(int s, const struct iovec* iov, int iovcnt);
+    int (*sendmmsg)(int s,
+                    struct mmsghdr* msgvec,
+                    unsigned int vlen,
+                    int flags);
+    ssize_t (*sendfile)(int out_fd, int in_fd, off_t* offset, size_t count);
+    ssize_t (*sendfile64)(int out_fd,
+                          int in_fd,
+                          off64_t* offset,
+                          size_t count);
+    ssize_t (*splice)(int fd_in,
+                      loff_t* off_in,
+                      int fd_out,
+                      loff_t* off_out,
+                      size_t len,
+                      unsigned int flags);
 
     void init();
 };
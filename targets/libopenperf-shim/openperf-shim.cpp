@@ -133,6 +133,24 @@ auto call_and_log_function(const char* function_name,
                                  __VA_ARGS__)                                  \
          : client.function(__VA_ARGS__))
 
+/*
+ * sendfile64 and splice use different offset types, so copy the offset
+ * into an off_t for the client.
+ */
+template <typename Offset>
+ssize_t client_sendfile(openperf::socket::api::client& client,
+                        int out_fd,
+                        int in_fd,
+                        Offset* offset,
+                        size_t count)
+{
+    auto tmp = static_cast<off_t>(offset ? *offset : 0);
+    auto result = client_call(
+        sendfile, out_fd, in_fd, (offset ? &tmp : nullptr), count);
+    if (offset && result > 0) { *offset = tmp; }
+    return (result);
+}
+
 extern "C" {
 
 int accept(int s, struct sockaddr* addr, socklen_t* addrlen)
@@ -421,6 +439,23 @@ ssize_t recvmsg(int s, struct msghdr* message, int flags)
                                 : libc.recvmsg(s, message, flags));
 }
 
+int recvmmsg(int s,
+             struct mmsghdr* msgvec,
+             unsigned int vlen,
+             int flags,
+             struct timespec* timeout)
+{
+    auto& libc = openperf::socket::libc::wrapper::instance();
+    if (!client_initialized) {
+        return (libc.recvmmsg(s, msgvec, vlen, flags, timeout));
+    }
+
+    auto& client = openperf::socket::api::client::instance();
+    return (client.is_socket(s)
+                ? client_call(recvmmsg, s, msgvec, vlen, flags, timeout)
+                : libc.recvmmsg(s, msgvec, vlen, flags, timeout));
+}
+
 /* Transmit functions */
 ssize_t send(int s, const void* dataptr, size_t len, int flags)
 {
@@ -479,4 +514,74 @@ ssize_t writev(int s, const struct iovec* iov, int iovcnt)
     return (client.is_socket(s) ? client_call(writev, s, iov, iovcnt)
                                 : libc.writev(s, iov, iovcnt));
 }
+
+int sendmmsg(int s, struct mmsghdr* msgvec, unsigned int vlen, int flags)
+{
+    auto& libc = openperf::socket::libc::wrapper::instance();
+    if (!client_initialized) { return (libc.sendmmsg(s, msgvec, vlen, flags)); }
+
+    auto& client = openperf::socket::api::client::instance();
+    return (client.is_socket(s) ? client_call(sendmmsg, s, msgvec, vlen, flags)
+                                : libc.sendmmsg(s, msgvec, vlen, flags));
+}
+
+ssize_t sendfile(int out_fd, int in_fd, off_t* offset, size_t count)
+{
+    auto& libc = openperf::socket::libc::wrapper::instance();
+    if (!client_initialized) {
+        return (libc.sendfile(out_fd, in_fd, offset, count));
+    }
+
+    auto& client = openperf::socket::api::client::instance();
+    return (client.is_socket(out_fd)
+                ? client_sendfile(client, out_fd, in_fd, offset, count)
+                : libc.sendfile(out_fd, in_fd, offset, count));
+}
+
+ssize_t sendfile64(int out_fd, int in_fd, off64_t* offset, size_t count)
+{
+    auto& libc = openperf::socket::libc::wrapper::instance();
+    if (!client_initialized) {
+        return (libc.sendfile64(out_fd, in_fd, offset, count));
+    }
+
+    auto& client = openperf::socket::api::client::instance();
+    return (client.is_socket(out_fd)
+                ? client_sendfile(client, out_fd, in_fd, offset, count)
+                : libc.sendfile64(out_fd, in_fd, offset, count));
+}
+
+ssize_t splice(int fd_in,
+               loff_t* off_in,
+               int fd_out,
+               loff_t* off_out,
+               size_t len,
+               unsigned int flags)
+{
+    auto& libc = openperf::socket::libc::wrapper::instance();
+    if (!client_initialized) {
+        return (libc.splice(fd_in, off_in, fd_out, off_out, len, flags));
+    }
+
+    /*
+     * We can only splice data into our sockets. Since sockets don't
+     * have offsets, this works just like sendfile.
+     */
+    auto& client = openperf::socket::api::client::instance();
+    if (client.is_socket(fd_in)) {
+        errno = EINVAL;
+        return (-1);
+    }
+
+    if (!client.is_socket(fd_out)) {
+        return (libc.splice(fd_in, off_in, fd_out, off_out, len, flags));
+    }
+
+    if (off_out) {
+        errno = ESPIPE;
+        return (-1);
+    }
+
+    return (client_sendfile(client, fd_out, fd_in, off_in, len));
+}
 }
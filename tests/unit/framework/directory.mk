@@ -11,7 +11,9 @@ TEST_SOURCES += \
 	framework/test_cpuset.cpp \
 	framework/test_enum_flags.cpp \
 	framework/test_hashtab.cpp \
+	framework/test_histogram.cpp \
 	framework/test_init_factory.cpp \
+	framework/test_io_uring.cpp \
 	framework/test_list.cpp \
 	framework/test_logging.cpp \
 	framework/test_offset_ptr.cpp \
@@ -0,0 +1,87 @@
+#include <random>
+#include <type_traits>
+
+#include "catch.hpp"
+
+#include "utils/histogram.hpp"
+
+using namespace openperf::utils;
+
+TEST_CASE("log-linear histogram", "[histogram]")
+{
+    using histogram = log_linear_histogram<7, 40>;
+
+    static_assert(std::is_trivially_copyable_v<histogram>);
+
+    SECTION("bucketing, ")
+    {
+        /* Small values are exact */
+        for (uint64_t i = 0; i < 128; i++) {
+            REQUIRE(histogram::to_index(i) == i);
+            REQUIRE(histogram::lowest_value(i) == i);
+            REQUIRE(histogram::highest_value(i) == i);
+        }
+
+        /* Buckets are contiguous and ordered */
+        for (size_t idx = 1; idx < histogram::bucket_count; idx++) {
+            REQUIRE(histogram::lowest_value(idx)
+                    == histogram::highest_value(idx - 1) + 1);
+            REQUIRE(histogram::to_index(histogram::lowest_value(idx)) == idx);
+            REQUIRE(histogram::to_index(histogram::highest_value(idx))
+                    == idx);
+        }
+
+        REQUIRE(histogram::highest_value(histogram::bucket_count - 1)
+                == histogram::max_value);
+        REQUIRE(histogram::to_index(~0ULL) == histogram::bucket_count - 1);
+
+        /* Relative error is bounded by the number of sub-buckets */
+        auto rng = std::mt19937_64{};
+        for (auto i = 0; i < 10000; i++) {
+            auto value = rng() >> (rng() % 40 + 24);
+            auto idx = histogram::to_index(value);
+            auto error = histogram::highest_value(idx) - value;
+            REQUIRE(error <= value / 64);
+        }
+    }
+
+    SECTION("empty, ")
+    {
+        auto h = histogram{};
+        REQUIRE(h.total() == 0);
+        REQUIRE(h.value_at_quantile(0.5) == 0);
+    }
+
+    SECTION("quantiles, ")
+    {
+        auto h = histogram{};
+        for (uint64_t i = 1; i <= 10000; i++) { h.record(i); }
+        REQUIRE(h.total() == 10000);
+
+        auto within = [](uint64_t value, uint64_t expected) {
+            return (value >= expected && value <= expected + expected / 64);
+        };
+
+        REQUIRE(h.value_at_quantile(0) == 1);
+        REQUIRE(within(h.value_at_quantile(0.5), 5000));
+        REQUIRE(within(h.value_at_quantile(0.99), 9900));
+        REQUIRE(within(h.value_at_quantile(0.999), 9990));
+        REQUIRE(within(h.value_at_quantile(1), 10000));
+    }
+
+    SECTION("weighted record and merge, ")
+    {
+        auto h1 = histogram{}, h2 = histogram{};
+        h1.record(100, 99);
+        h2.record(100000, 1);
+
+        auto sum = h1 + h2;
+        REQUIRE(sum.total() == 100);
+        REQUIRE(sum.value_at_quantile(0.99) == 100);
+        REQUIRE(sum.value_at_quantile(0.999) >= 100000);
+
+        sum.reset();
+        REQUIRE(sum.total() == 0);
+        REQUIRE(sum.count_at(100) == 0);
+    }
+}
@@ -0,0 +1,223 @@
+#include <array>
+#include <cerrno>
+#include <cstdlib>
+#include <algorithm>
+#include <optional>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/socket.h>
+
+#include "catch.hpp"
+
+#include "utils/io_uring.hpp"
+
+using namespace openperf::utils;
+
+static std::optional<io_uring::ring> make_ring(unsigned entries)
+{
+    /* Not every kernel/container allows io_uring; skip if we can't use it */
+    try {
+        return (io_uring::ring(entries));
+    } catch (const std::system_error& e) {
+        WARN("io_uring unavailable: " << e.what());
+        return (std::nullopt);
+    }
+}
+
+TEST_CASE("io_uring", "[io_uring]")
+{
+    constexpr size_t block_size = 4096;
+    constexpr unsigned nb_blocks = 8;
+
+    char path[] = "/tmp/op_test_io_uring_XXXXXX";
+    auto fd = mkstemp(path);
+    REQUIRE(fd >= 0);
+    unlink(path);
+
+    SECTION("ring, ")
+    {
+        auto ring = make_ring(nb_blocks);
+        if (!ring) { return; }
+
+        REQUIRE(ring->fd() >= 0);
+        REQUIRE(ring->sq_entries() >= nb_blocks);
+
+        SECTION("no-op, ")
+        {
+            auto* sqe = ring->get_sqe();
+            REQUIRE(sqe);
+            io_uring::prep_rw(sqe, IORING_OP_NOP, -1, nullptr, 0, 0, 42);
+            REQUIRE(ring->submit(1) == 1);
+
+            auto count = ring->for_each_cqe([](const io_uring_cqe& cqe) {
+                REQUIRE(cqe.user_data == 42);
+                REQUIRE(cqe.res == 0);
+            });
+            REQUIRE(count == 1);
+        }
+
+        SECTION("full submission queue, ")
+        {
+            for (unsigned i = 0; i < ring->sq_entries(); i++) {
+                REQUIRE(ring->get_sqe());
+            }
+            REQUIRE(ring->get_sqe() == nullptr);
+
+            /* Zeroed entries are no-ops; submitting them frees the queue */
+            REQUIRE(ring->submit() == static_cast<int>(ring->sq_entries()));
+            REQUIRE(ring->get_sqe());
+        }
+
+        SECTION("timeout, ")
+        {
+            auto error =
+                ring->submit_and_wait(1, std::chrono::milliseconds(10));
+            REQUIRE((error == 0 || error == -ETIME));
+            REQUIRE(ring->for_each_cqe([](const io_uring_cqe&) {}) == 0);
+        }
+
+        SECTION("fixed buffers and files, ")
+        {
+            auto buffer = static_cast<uint8_t*>(
+                std::aligned_alloc(block_size, block_size * nb_blocks));
+            REQUIRE(buffer);
+
+            auto iovecs = std::array<iovec, nb_blocks>{};
+            for (unsigned i = 0; i < nb_blocks; i++) {
+                iovecs[i] = {buffer + i * block_size, block_size};
+                std::fill_n(buffer + i * block_size, block_size, i + 1);
+            }
+
+            REQUIRE(ring->register_buffers(iovecs.data(), nb_blocks) == 0);
+            REQUIRE(ring->register_files(&fd, 1) == 0);
+
+            /* Write each block in one batch */
+            for (unsigned i = 0; i < nb_blocks; i++) {
+                auto* sqe = ring->get_sqe();
+                REQUIRE(sqe);
+                io_uring::prep_write_fixed(sqe,
+                                           0,
+                                           iovecs[i].iov_base,
+                                           block_size,
+                                           i * block_size,
+                                           i,
+                                           i);
+                sqe->flags |= IOSQE_FIXED_FILE;
+            }
+            REQUIRE(ring->submit() == nb_blocks);
+
+            auto completed = 0U;
+            while (completed < nb_blocks) {
+                REQUIRE(ring->submit_and_wait(1, std::chrono::seconds(1))
+                        == 0);
+                completed += ring->for_each_cqe([&](const io_uring_cqe& cqe) {
+                    REQUIRE(cqe.res == block_size);
+                });
+            }
+
+            /* Clear the buffers and read everything back */
+            std::fill_n(buffer, block_size * nb_blocks, 0);
+            for (unsigned i = 0; i < nb_blocks; i++) {
+                auto* sqe = ring->get_sqe();
+                REQUIRE(sqe);
+                io_uring::prep_read_fixed(sqe,
+                                          0,
+                                          iovecs[i].iov_base,
+                                          block_size,
+                                          i * block_size,
+                                          i,
+                                          i);
+                sqe->flags |= IOSQE_FIXED_FILE;
+            }
+            REQUIRE(ring->submit(nb_blocks) == nb_blocks);
+            REQUIRE(ring->cq_ready() >= nb_blocks);
+
+            completed = ring->for_each_cqe([&](const io_uring_cqe& cqe) {
+                REQUIRE(cqe.res == block_size);
+            });
+            REQUIRE(completed == nb_blocks);
+
+            for (unsigned i = 0; i < nb_blocks; i++) {
+                auto* block = buffer + i * block_size;
+                REQUIRE(std::all_of(block, block + block_size, [&](auto x) {
+                    return (x == i + 1);
+                }));
+            }
+
+            REQUIRE(ring->unregister_files() == 0);
+            REQUIRE(ring->unregister_buffers() == 0);
+            std::free(buffer);
+        }
+
+        SECTION("provided buffers and multishot receive, ")
+        {
+            constexpr uint16_t group_id = 1;
+            constexpr unsigned nb_bufs = 4;
+
+            /* Provided buffer rings need a recent kernel */
+            auto bufs = std::optional<io_uring::buffer_ring>{};
+            try {
+                bufs.emplace(*ring, group_id, nb_bufs, block_size);
+            } catch (const std::system_error& e) {
+                WARN("io_uring buffer rings unavailable: " << e.what());
+                return;
+            }
+
+            int sv[2];
+            REQUIRE(socketpair(AF_UNIX, SOCK_STREAM, 0, sv) == 0);
+
+            auto* sqe = ring->get_sqe();
+            REQUIRE(sqe);
+            io_uring::prep_recv_multishot(sqe, sv[0], group_id, 0, 7);
+            REQUIRE(ring->submit() == 1);
+
+            /* Each write should show up in its own buffer */
+            const auto data = std::array<uint8_t, 3>{1, 2, 3};
+            auto received = std::vector<uint8_t>{};
+            auto selected = true;
+            for (auto x : data) {
+                REQUIRE(write(sv[1], &x, 1) == 1);
+                REQUIRE(ring->submit_and_wait(1, std::chrono::seconds(1))
+                        == 0);
+                ring->for_each_cqe([&](const io_uring_cqe& cqe) {
+                    REQUIRE(cqe.user_data == 7);
+                    if (cqe.res == -ENOBUFS) {
+                        selected = false;
+                        return;
+                    }
+                    REQUIRE(cqe.res == 1);
+                    REQUIRE(cqe.flags & IORING_CQE_F_MORE);
+                    auto id = io_uring::buffer_ring::buffer_id(cqe);
+                    REQUIRE(id);
+                    received.push_back(*bufs->buffer(*id));
+                    bufs->recycle(*id);
+                });
+                bufs->commit();
+
+                /* Some kernels register buffer rings but can't use them */
+                if (!selected) {
+                    WARN("io_uring buffer ring selection unavailable");
+                    close(sv[0]);
+                    close(sv[1]);
+                    return;
+                }
+            }
+            REQUIRE(std::equal(
+                data.begin(), data.end(), received.begin(), received.end()));
+
+            /* Closing the peer terminates the request */
+            close(sv[1]);
+            REQUIRE(ring->submit_and_wait(1, std::chrono::seconds(1)) == 0);
+            auto count = ring->for_each_cqe([](const io_uring_cqe& cqe) {
+                REQUIRE(cqe.res == 0);
+                REQUIRE(!(cqe.flags & IORING_CQE_F_MORE));
+            });
+            REQUIRE(count == 1);
+
+            close(sv[0]);
+        }
+    }
+
+    close(fd);
+}
@@ -1,9 +1,12 @@
+#include <algorithm>
+#include <cinttypes>
 #include <memory>
 
 #include "zmq.h"
 #include "catch.hpp"
 
 #include "core/op_core.h"
+#include "core/op_log_record.h"
 
 struct zmq_context_deleter
 {
@@ -15,6 +18,30 @@ struct zmq_context_deleter
     }
 };
 
+static int encode(uint8_t buffer[], size_t length, const char* format, ...)
+{
+    va_list argp;
+    va_start(argp, format);
+    int error = op_log_record_encode(buffer, length, format, argp);
+    va_end(argp);
+    return (error);
+}
+
+/* Encode and decode a message; compare against snprintf */
+template <typename... Args>
+static void check_round_trip(const char* format, Args... args)
+{
+    uint8_t buffer[OP_LOG_RECORD_MAX_ARGS_LENGTH];
+    int length = encode(buffer, sizeof(buffer), format, args...);
+    REQUIRE(length >= 0);
+
+    char expected[128], actual[128];
+    snprintf(expected, sizeof(expected), format, args...);
+    REQUIRE(op_log_record_decode(actual, sizeof(actual), format, buffer, length)
+            == static_cast<int>(strlen(expected)));
+    REQUIRE(strcmp(expected, actual) == 0);
+}
+
 TEST_CASE("check log level setter/getter", "[logging]")
 {
     for (int level = OP_LOG_NONE; level <= OP_LOG_MAX; level++) {
@@ -55,6 +82,21 @@ TEST_CASE("exercise logging thread functionality", "[logging]")
                        "This is a trace message\n")
                 == 0);
     }
+
+    SECTION("verify binary log message submission")
+    {
+        op_log_binary_set(true);
+
+        /* Only precision characters of the string may be read */
+        const char unterminated[] = {'a', 'b', 'c', 'd'};
+        OP_LOG(OP_LOG_ERROR,
+               "Unterminated %.*s and %.4s\n",
+               static_cast<int>(sizeof(unterminated)),
+               unterminated,
+               unterminated);
+
+        op_log_binary_set(false);
+    }
 }
 
 TEST_CASE("check logging command line parsing function", "[logging]")
@@ -147,3 +189,111 @@ TEST_CASE("check logging function signature --> string function", "[logging]")
         REQUIRE(strcmp(output, pair.second) == 0);
     }
 }
+
+TEST_CASE("check binary log record encoding", "[logging]")
+{
+    SECTION("round trip supported conversions")
+    {
+        check_round_trip("no arguments\n");
+        check_round_trip("100%% literal");
+        check_round_trip("%d %i %u %x %X %o", -1, 2, 3U, 0xabU, 0xcdU, 8U);
+        check_round_trip("%hhd %hd %c", 1, 2, 'c');
+        check_round_trip("%ld %lu %lld %llu", -1L, 2UL, -3LL, 4ULL);
+        check_round_trip("%zu %jd %td", sizeof(int), INTMAX_MAX, ptrdiff_t{-5});
+        check_round_trip("%" PRIu64 " %" PRIx32, UINT64_MAX, 0xdeadbeef);
+        check_round_trip("%f %.3e %g %Lf", 1.5, 2.25, 0.1, 3.0L);
+        check_round_trip("%s and %-8s|%.3s", "this", "that", "truncated");
+        check_round_trip("%*d|%-*.*s|", 6, 42, 10, 4, "width/precision");
+        int value = 0;
+        check_round_trip("%p", static_cast<void*>(&value));
+        check_round_trip("%#08x trailing text", 0x1234U);
+    }
+
+    SECTION("strings are only read up to their precision")
+    {
+        /* Anything past the first four characters is off limits */
+        struct
+        {
+            char data[4] = {'a', 'b', 'c', 'd'};
+            char guard[64];
+        } value;
+        std::fill_n(value.guard, sizeof(value.guard) - 1, 'x');
+        value.guard[sizeof(value.guard) - 1] = '\0';
+
+        /* The star value, the string length, and "abcd" + terminator */
+        uint8_t buffer[OP_LOG_RECORD_MAX_ARGS_LENGTH];
+        int length = encode(buffer, sizeof(buffer), "%.*s", 4, value.data);
+        REQUIRE(length == 24);
+
+        char message[32];
+        REQUIRE(op_log_record_decode(
+                    message, sizeof(message), "%.*s", buffer, length)
+                == 4);
+        REQUIRE(strcmp(message, "abcd") == 0);
+
+        length = encode(buffer, sizeof(buffer), "%.4s|%.s|", value.data, "x");
+        REQUIRE(length == 32);
+        REQUIRE(op_log_record_decode(
+                    message, sizeof(message), "%.4s|%.s|", buffer, length)
+                == 6);
+        REQUIRE(strcmp(message, "abcd||") == 0);
+    }
+
+    SECTION("null strings are copied")
+    {
+        uint8_t buffer[OP_LOG_RECORD_MAX_ARGS_LENGTH];
+        int length =
+            encode(buffer, sizeof(buffer), "%s", static_cast<char*>(nullptr));
+        REQUIRE(length > 0);
+
+        char message[32];
+        REQUIRE(op_log_record_decode(
+                    message, sizeof(message), "%s", buffer, length)
+                > 0);
+        REQUIRE(strcmp(message, "(null)") == 0);
+    }
+
+    SECTION("messages are truncated to fit")
+    {
+        uint8_t buffer[OP_LOG_RECORD_MAX_ARGS_LENGTH];
+        int length = encode(buffer, sizeof(buffer), "%s:%d", "abcdefgh", 12);
+        REQUIRE(length > 0);
+
+        char message[8];
+        REQUIRE(op_log_record_decode(
+                    message, sizeof(message), "%s:%d", buffer, length)
+                == 7);
+        REQUIRE(strcmp(message, "abcdefg") == 0);
+    }
+
+    SECTION("unsupported conversions are rejected")
+    {
+        uint8_t buffer[OP_LOG_RECORD_MAX_ARGS_LENGTH];
+        int count = 0;
+        REQUIRE(encode(buffer, sizeof(buffer), "%n", &count) == -1);
+        REQUIRE(encode(buffer, sizeof(buffer), "%ls", L"wide") == -1);
+        REQUIRE(encode(buffer, sizeof(buffer), "%m") == -1);
+        REQUIRE(encode(buffer, sizeof(buffer), "trailing %") == -1);
+    }
+
+    SECTION("arguments that don't fit are rejected")
+    {
+        uint8_t buffer[16];
+        REQUIRE(encode(buffer, sizeof(buffer), "%d %d", 1, 2) == 16);
+        REQUIRE(encode(buffer, sizeof(buffer), "%d %d %d", 1, 2, 3) == -1);
+        REQUIRE(encode(buffer, sizeof(buffer), "%s", "too long to fit")
+                == -1);
+    }
+
+    SECTION("mismatched arguments are rejected")
+    {
+        uint8_t buffer[OP_LOG_RECORD_MAX_ARGS_LENGTH];
+        int length = encode(buffer, sizeof(buffer), "%d", 1);
+        REQUIRE(length > 0);
+
+        char message[32];
+        REQUIRE(op_log_record_decode(
+                    message, sizeof(message), "%d %d", buffer, length)
+                == -1);
+    }
+}
@@ -4,7 +4,8 @@
 
 TEST_DEPENDS += cpu_test
 TEST_SOURCES += \
-	modules/cpu/test_ispc_target.cpp
+	modules/cpu/test_ispc_target.cpp \
+	modules/cpu/test_load_functions.cpp
 
 ifeq ($(ARCH),x86_64)
 	TEST_SOURCES += \
@@ -0,0 +1,131 @@
+#include <numeric>
+#include <vector>
+
+#include "catch.hpp"
+#include "cpu/generator/config.hpp"
+#include "cpu/generator/instruction_set.hpp"
+#include "cpu/generator/load_functions.hpp"
+#include "cpu/generator/load_traits.hpp"
+
+using isa_type = openperf::cpu::instruction_set::type;
+using namespace openperf::cpu;
+
+TEST_CASE("CPU load functions", "[cpu]")
+{
+    SECTION("crc, ")
+    {
+        /* Test vectors from RFC 3720, appendix B.4 */
+        auto zeros = std::vector<int64_t>(4, 0);
+        auto ones = std::vector<int64_t>(4, -1);
+
+        REQUIRE(~scalar::crc32c_int64(zeros.data(), zeros.size(), ~0U)
+                == 0x8a9136aa);
+        REQUIRE(~scalar::crc32c_int64(ones.data(), ones.size(), ~0U)
+                == 0x62a8ab43);
+        REQUIRE(~scalar::crc32c_int32(
+                    reinterpret_cast<const int32_t*>(ones.data()), 8, ~0U)
+                == 0x62a8ab43);
+
+#if defined(__x86_64__)
+        if (instruction_set::available(isa_type::SSE4)) {
+            auto data = std::vector<int64_t>(1024);
+            std::iota(std::begin(data), std::end(data), 0x0123456789abcdef);
+
+            REQUIRE(sse4::crc32c_int64(data.data(), data.size(), 0)
+                    == scalar::crc32c_int64(data.data(), data.size(), 0));
+            REQUIRE(sse4::crc32c_int32(
+                        reinterpret_cast<const int32_t*>(data.data()),
+                        data.size() * 2,
+                        0)
+                    == scalar::crc32c_int64(data.data(), data.size(), 0));
+        }
+#endif
+    }
+
+    SECTION("branch, ")
+    {
+        /* Same seed, same result */
+        auto state1 = uint64_t{1}, state2 = uint64_t{1};
+        REQUIRE(scalar::branch_int64(&state1, 1000)
+                == scalar::branch_int64(&state2, 1000));
+        REQUIRE(state1 == state2);
+        REQUIRE(state1 != 1);
+    }
+
+    SECTION("pointer chase, ")
+    {
+        auto chain = std::vector<int64_t>{2, 0, 3, 1};
+        REQUIRE(scalar::pointer_chase_int64(chain.data(), 0, 1) == 2);
+        REQUIRE(scalar::pointer_chase_int64(chain.data(), 0, 4) == 0);
+        REQUIRE(scalar::pointer_chase_int64(chain.data(), 0, 6) == 3);
+    }
+
+    SECTION("fma, ")
+    {
+        /* Every chain converges to b / (1 - a) */
+        REQUIRE(scalar::fma_double(0.5, 0.5, 100) == Approx(8.0));
+        REQUIRE(scalar::fma_float(0.5, 0.5, 100) == Approx(8.0));
+
+#if defined(__x86_64__)
+        if (instruction_set::available(isa_type::AVX2)) {
+            REQUIRE(avx2::fma_double(0.5, 0.5, 100) == Approx(8.0 * 4));
+            REQUIRE(avx2::fma_float(0.5, 0.5, 100) == Approx(8.0 * 8));
+        }
+        if (instruction_set::available(isa_type::AVX512SKX)) {
+            REQUIRE(avx512::fma_double(0.5, 0.5, 100) == Approx(8.0 * 8));
+            REQUIRE(avx512::fma_float(0.5, 0.5, 100) == Approx(8.0 * 16));
+        }
+#endif
+    }
+}
+
+TEST_CASE("CPU load types", "[cpu]")
+{
+    using namespace openperf::cpu::generator;
+
+    SECTION("names, ")
+    {
+        auto names = load_names{.operation = api::operation_type::fma,
+                                .instruction_set = api::instruction_type::avx2,
+                                .data = api::data_type::float64};
+
+        auto config = make_load<target_op_config>(names, 3);
+        REQUIRE(config);
+        REQUIRE(to_load_names(*config) == names);
+        REQUIRE(std::visit([](const auto& c) { return (c.weight); }, *config)
+                == 3);
+    }
+
+    SECTION("unsupported combinations, ")
+    {
+        REQUIRE(!to_load_index<target_op_config>(
+            {.operation = api::operation_type::pointer_chase,
+             .instruction_set = api::instruction_type::avx512,
+             .data = api::data_type::float32}));
+        REQUIRE(!make_load<target_op_config>(
+            load_names{.operation = api::operation_type::crc,
+                       .instruction_set = api::instruction_type::avx2,
+                       .data = api::data_type::int32},
+            1));
+    }
+
+    SECTION("matrix, ")
+    {
+        /* Every instruction set and data type combination is supported */
+        for (auto instr : {api::instruction_type::scalar,
+                           api::instruction_type::sse2,
+                           api::instruction_type::sse4,
+                           api::instruction_type::avx,
+                           api::instruction_type::avx2,
+                           api::instruction_type::avx512,
+                           api::instruction_type::neon}) {
+            for (auto data : {api::data_type::int32,
+                              api::data_type::int64,
+                              api::data_type::float32,
+                              api::data_type::float64}) {
+                REQUIRE(to_load_index<target_stats>(
+                    {api::operation_type::matrix, instr, data}));
+            }
+        }
+    }
+}
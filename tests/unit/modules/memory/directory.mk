@@ -5,4 +5,6 @@
 TEST_DEPENDS += memory_test
 TEST_SOURCES += \
 	modules/memory/test_buffer.cpp \
+	modules/memory/test_index_generator.cpp \
+	modules/memory/test_kernels.cpp \
 	modules/memory/test_statistics.cpp
@@ -1,9 +1,11 @@
+#include <algorithm>
 #include <array>
 
 #include "catch.hpp"
 
 #include "memory/generator/buffer.hpp"
 
+using namespace openperf::memory;
 using namespace openperf::memory::generator;
 
 TEST_CASE("memory buffer", "[memory]")
@@ -18,6 +20,15 @@ TEST_CASE("memory buffer", "[memory]")
         REQUIRE(b.length() == buffer_size);
     }
 
+    SECTION("numa bound, ")
+    {
+        /* Binding failures are not fatal, so this should always work */
+        auto b = buffer(buffer_size, api::page_size_type::standard, 0);
+        REQUIRE(b.data() != nullptr);
+        REQUIRE(b.length() == buffer_size);
+        std::fill_n(b.data(), buffer_size, std::byte{0xa5});
+    }
+
     SECTION("readable, ")
     {
         auto b = buffer(buffer_size);
@@ -0,0 +1,69 @@
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+#include "catch.hpp"
+
+#include "memory/generator/index_generator.hpp"
+
+using namespace openperf::memory;
+using namespace openperf::memory::generator;
+
+static std::vector<size_t> to_indexes(const index_generator& indexes)
+{
+    auto v = std::vector<size_t>{};
+    for (auto i = 0UL; i < indexes.size(); i++) { v.push_back(indexes[i]); }
+    return (v);
+}
+
+static std::vector<size_t> iota(size_t min, size_t max)
+{
+    auto v = std::vector<size_t>(max - min);
+    std::iota(std::begin(v), std::end(v), min);
+    return (v);
+}
+
+TEST_CASE("memory index generator", "[memory]")
+{
+    SECTION("sequential, ")
+    {
+        auto indexes = index_generator(api::pattern_type::sequential, 10, 20);
+        REQUIRE(indexes.size() == 10);
+        REQUIRE(to_indexes(indexes) == iota(10, 20));
+    }
+
+    SECTION("reverse, ")
+    {
+        auto indexes = index_generator(api::pattern_type::reverse, 10, 20);
+        auto expected = iota(10, 20);
+        std::reverse(std::begin(expected), std::end(expected));
+        REQUIRE(to_indexes(indexes) == expected);
+    }
+
+    SECTION("random, ")
+    {
+        for (auto size : {1UL, 2UL, 3UL, 64UL, 1000UL, 4097UL, 100003UL}) {
+            auto indexes =
+                index_generator(api::pattern_type::random, 7, 7 + size, size);
+            REQUIRE(indexes.size() == size);
+
+            auto actual = to_indexes(indexes);
+
+            /* Positions should be scrambled for any non-trivial size */
+            if (size > 64) { REQUIRE(actual != iota(7, 7 + size)); }
+
+            /* ... but every index should still be visited exactly once */
+            std::sort(std::begin(actual), std::end(actual));
+            REQUIRE(actual == iota(7, 7 + size));
+        }
+    }
+
+    SECTION("seeded, ")
+    {
+        auto a = index_generator(api::pattern_type::random, 0, 1000, 1);
+        auto b = index_generator(api::pattern_type::random, 0, 1000, 1);
+        auto c = index_generator(api::pattern_type::random, 0, 1000, 2);
+        REQUIRE(to_indexes(a) == to_indexes(b));
+        REQUIRE(to_indexes(a) != to_indexes(c));
+    }
+}
@@ -0,0 +1,86 @@
+#include <array>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+#include "catch.hpp"
+
+#include "memory/generator/kernels.hpp"
+
+using namespace openperf::memory;
+using namespace openperf::memory::generator;
+
+static uint8_t fold(const std::byte* src, size_t length)
+{
+    return (std::accumulate(src, src + length, uint8_t{0}, [](auto x, auto b) {
+        return (static_cast<uint8_t>(x ^ static_cast<uint8_t>(b)));
+    }));
+}
+
+TEST_CASE("memory access kernels", "[memory]")
+{
+    constexpr auto vector_kernels = std::array{api::access_kernel_type::sse4,
+                                               api::access_kernel_type::avx2,
+                                               api::access_kernel_type::avx512};
+
+    /* Sizes and offsets that exercise unaligned heads and partial tails */
+    constexpr auto lengths = std::array{1UL, 15UL, 64UL, 255UL, 256UL, 4099UL};
+    constexpr auto offsets = std::array{0UL, 1UL, 17UL, 63UL};
+
+    auto src = std::vector<std::byte>(8192);
+    std::generate(std::begin(src), std::end(src), [x = 0]() mutable {
+        return (std::byte(x++ * 7 + 3));
+    });
+
+    SECTION("resolve, ")
+    {
+        auto type = kernel::resolve(api::access_kernel_type::automatic);
+        REQUIRE(type != api::access_kernel_type::automatic);
+        REQUIRE(kernel::available(type));
+    }
+
+    SECTION("write, ")
+    {
+        for (auto type : {api::access_kernel_type::scalar,
+                          api::access_kernel_type::sse4,
+                          api::access_kernel_type::avx2,
+                          api::access_kernel_type::avx512,
+                          api::access_kernel_type::rep_movsb}) {
+            if (!kernel::available(type)) { continue; }
+
+            for (auto non_temporal : {false, true}) {
+                auto fns = kernel::get_functions(type, non_temporal);
+                for (auto length : lengths) {
+                    for (auto offset : offsets) {
+                        auto dst = std::vector<std::byte>(8192);
+                        fns.write(dst.data() + offset, length, src.data());
+                        fns.drain();
+                        REQUIRE(std::equal(src.data(),
+                                           src.data() + length,
+                                           dst.data() + offset));
+                        REQUIRE(dst[offset + length] == std::byte{0});
+                    }
+                }
+            }
+        }
+    }
+
+    SECTION("read, ")
+    {
+        for (auto type : vector_kernels) {
+            if (!kernel::available(type)) { continue; }
+
+            for (auto non_temporal : {false, true}) {
+                auto fns = kernel::get_functions(type, non_temporal);
+                for (auto length : lengths) {
+                    for (auto offset : offsets) {
+                        auto sink = std::byte{0};
+                        fns.read(src.data() + offset, length, &sink);
+                        REQUIRE(static_cast<uint8_t>(sink)
+                                == fold(src.data() + offset, length));
+                    }
+                }
+            }
+        }
+    }
+}
@@ -4,4 +4,6 @@ TEST_DEPENDS += packet_analyzer_test
 
 TEST_SOURCES += \
 	modules/packet/analyzer/test_flow_counters.cpp \
-	modules/packet/analyzer/test_flow_headers.cpp
+	modules/packet/analyzer/test_flow_headers.cpp \
+	modules/packet/analyzer/test_flow_map.cpp \
+	modules/packet/analyzer/test_flow_soa_counters.cpp
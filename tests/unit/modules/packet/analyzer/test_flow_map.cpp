@@ -0,0 +1,110 @@
+#include <memory>
+#include <set>
+
+#include "catch.hpp"
+
+#include "packet/analyzer/statistics/flow/map.tcc"
+
+using namespace openperf::packet::analyzer::statistics;
+
+/*
+ * Use a shared pointer for our test value so that we can verify that
+ * every entry gets unique stats from the factory.  The factory stores
+ * each entry's slot in its stats.
+ */
+using test_stats = std::shared_ptr<uint64_t>;
+template class flow::map<test_stats>;
+
+TEST_CASE("flow map", "[packet_analyzer]")
+{
+    auto make_stats = [](uint32_t slot) {
+        return (std::make_shared<uint64_t>(slot));
+    };
+
+    SECTION("empty, ")
+    {
+        auto map = flow::map<test_stats>(16, make_stats);
+        REQUIRE(map.size() == 0);
+        REQUIRE(map.max_size() == 16);
+        REQUIRE(map.overflow() == 0);
+        REQUIRE(map.begin() == map.end());
+        REQUIRE(map.find(1, 1) == nullptr);
+        REQUIRE_THROWS_AS(map.at({1, 1}), std::out_of_range);
+    }
+
+    SECTION("insert and find, ")
+    {
+        constexpr size_t max_flows = 1024;
+        auto map = flow::map<test_stats>(max_flows, make_stats);
+
+        /* Use colliding rss hashes to exercise the bucket probing */
+        /* Flow slots are assigned in insertion order */
+        for (uint32_t i = 0; i < max_flows; i++) {
+            auto* stats = map.insert({i % 3, i});
+            REQUIRE(stats);
+            REQUIRE(**stats == i);
+        }
+
+        REQUIRE(map.size() == max_flows);
+        REQUIRE(std::distance(map.begin(), map.end()) == max_flows);
+
+        auto unique = std::set<uint64_t*>{};
+        for (uint32_t i = 0; i < max_flows; i++) {
+            auto* stats = map.find(i % 3, i);
+            REQUIRE(stats);
+            REQUIRE(**stats == i);
+            unique.insert(stats->get());
+        }
+        REQUIRE(unique.size() == max_flows);
+
+        for (const auto& [key, stats] : map) {
+            REQUIRE(key.second == *stats);
+            REQUIRE(key.first == key.second % 3);
+        }
+
+        REQUIRE(map.find(max_flows % 3, max_flows) == nullptr);
+    }
+
+    SECTION("insert with init, ")
+    {
+        auto map = flow::map<test_stats>(2, make_stats);
+        auto* stats = map.insert({1, 2}, [&](test_stats& value) {
+            /* Not yet visible to readers */
+            REQUIRE(map.size() == 0);
+            REQUIRE(map.find(1, 2) == nullptr);
+            *value = 12;
+        });
+        REQUIRE(stats);
+        REQUIRE(map.find(1, 2) == stats);
+        REQUIRE(**stats == 12);
+    }
+
+    SECTION("overflow, ")
+    {
+        auto map = flow::map<test_stats>(2, make_stats);
+        REQUIRE(map.insert({1, 1}));
+        REQUIRE(map.insert({2, 2}));
+        REQUIRE(map.insert({3, 3}) == nullptr);
+        REQUIRE(map.size() == 2);
+
+        map.add_overflow(10);
+        REQUIRE(map.overflow() == 10);
+
+        /* Existing flows are still available */
+        REQUIRE(map.find(1, 1));
+        REQUIRE(map.find(2, 2));
+        REQUIRE(map.find(3, 3) == nullptr);
+    }
+
+    SECTION("move, ")
+    {
+        auto map = flow::map<test_stats>(4, make_stats);
+        **map.insert({1, 2}) = 12;
+        map.add_overflow();
+
+        auto moved = std::move(map);
+        REQUIRE(moved.size() == 1);
+        REQUIRE(moved.overflow() == 1);
+        REQUIRE(**moved.find(1, 2) == 12);
+    }
+}
@@ -0,0 +1,94 @@
+#include <chrono>
+
+#include "catch.hpp"
+
+#include "packet/analyzer/statistics/flow/soa_counters.hpp"
+
+using namespace openperf::packet::analyzer::statistics;
+
+TEST_CASE("flow soa counters", "[packet_analyzer]")
+{
+    using namespace flow::counter;
+    using timestamp = frame_counter::timestamp;
+
+    auto counters = flow::soa_counters<frame_counter,
+                                       frame_length,
+                                       sequencing,
+                                       prbs>(8);
+
+    SECTION("layout, ")
+    {
+        REQUIRE(counters.size() == 8);
+        REQUIRE(counters.holds<frame_length>());
+        REQUIRE(!counters.holds<latency>());
+        REQUIRE_THROWS_AS(counters.get<latency>(0), std::invalid_argument);
+    }
+
+    SECTION("burst update, ")
+    {
+        /* Three packets for slot 1, one for slot 4, two more for slot 1 */
+        const auto slots = std::array<uint32_t, 6>{1, 1, 1, 4, 1, 1};
+        const auto lengths = std::array<uint16_t, 6>{64, 128, 64, 256, 64, 64};
+
+        auto burst = flow::soa_burst{};
+        burst.count = slots.size();
+        for (uint16_t i = 0; i < burst.count; i++) {
+            burst.slots[i] = slots[i];
+            burst.rx[i] = timestamp(std::chrono::microseconds(i + 1));
+            burst.frame_lengths[i] = lengths[i];
+            burst.packet_flags[i] = flow::soa_burst::has_sequence;
+            burst.sequence_numbers[i] = i;
+            burst.prbs_octets[i] = lengths[i];
+            burst.prbs_bit_errors[i] = 0;
+        }
+        burst.packet_flags[2] |= flow::soa_burst::udp_checksum_error;
+        burst.prbs_bit_errors[5] = 3;
+
+        counters.update(burst);
+
+        /* Compare against the per packet updates */
+        auto frames = frame_counter{};
+        auto length = frame_length{};
+        for (uint16_t i = 0; i < burst.count; i++) {
+            if (slots[i] != 1) { continue; }
+            if (!frames.count) { frames.first_ = burst.rx[i]; }
+            frames.count++;
+            frames.last_ = burst.rx[i];
+            update(length, lengths[i], frames.count);
+        }
+
+        const auto& slot_frames = counters.get<frame_counter>(1);
+        REQUIRE(slot_frames.count == frames.count);
+        REQUIRE(slot_frames.first() == frames.first());
+        REQUIRE(slot_frames.last() == frames.last());
+        REQUIRE(slot_frames.errors.udp_checksum == 1);
+        REQUIRE(slot_frames.errors.ipv4_checksum == 0);
+
+        const auto& slot_length = counters.get<frame_length>(1);
+        REQUIRE(slot_length.min == length.min);
+        REQUIRE(slot_length.max == length.max);
+        REQUIRE(slot_length.total == length.total);
+        REQUIRE(slot_length.m2 == Approx(length.m2));
+
+        /* Slot 1 skipped sequence number 3, which went to slot 4 */
+        const auto& slot_seq = counters.get<sequencing>(1);
+        REQUIRE(slot_seq.in_order == 5);
+        REQUIRE(slot_seq.dropped == 1);
+        REQUIRE(slot_seq.last_seq == 5);
+
+        const auto& slot_prbs = counters.get<prbs>(1);
+        REQUIRE(slot_prbs.octets == 384);
+        REQUIRE(slot_prbs.bit_errors == 3);
+        REQUIRE(slot_prbs.frame_errors == 1);
+
+        REQUIRE(counters.get<frame_counter>(4).count == 1);
+        REQUIRE(counters.get<frame_length>(4).total == 256);
+        REQUIRE(counters.get<frame_counter>(0).count == 0);
+        REQUIRE(!counters.get<frame_counter>(0).first());
+
+        /* Copies of a slot's counters match the stored counters */
+        const auto copy = counters.counters(1);
+        REQUIRE(std::get<frame_counter>(copy).count == frames.count);
+        REQUIRE(std::get<prbs>(copy).octets == 384);
+    }
+}
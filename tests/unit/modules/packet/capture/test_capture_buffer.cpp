@@ -730,6 +730,217 @@ TEST_CASE("capture buffer", "[packet_capture]")
         }
     }
 
+    SECTION("file stream, ")
+    {
+        const char* capture_filename = "unit_test_stream.pcapng";
+        const size_t buffer_size = 16 * 1024 * 1024;
+
+        SECTION("create, ")
+        {
+            SECTION("success, no keep")
+            {
+                {
+                    capture_buffer_file_stream buffer(capture_filename,
+                                                      buffer_size);
+                    REQUIRE(std::filesystem::exists(capture_filename));
+                }
+                REQUIRE(!std::filesystem::exists(capture_filename));
+            }
+
+            SECTION("success, keep")
+            {
+                {
+                    capture_buffer_file_stream buffer(
+                        capture_filename,
+                        buffer_size,
+                        capture_buffer_file_stream::keep_file::enabled);
+                    REQUIRE(std::filesystem::exists(capture_filename));
+                }
+                REQUIRE(std::filesystem::exists(capture_filename));
+                std::remove(capture_filename);
+            }
+
+            SECTION("failure, bad path")
+            {
+                REQUIRE_THROWS_AS(capture_buffer_file_stream(
+                                      "/tmp/bad_path_to_file/file.pcapng",
+                                      buffer_size),
+                                  std::runtime_error);
+            }
+        }
+
+        SECTION("write and read, ")
+        {
+            const size_t packet_count = 100;
+            const size_t payload_size = 64;
+            const size_t packet_size = calc_ipv4_packet_size(64);
+
+            capture_buffer_file_stream buffer(capture_filename, buffer_size);
+            fill_capture_buffer_ipv4(buffer, packet_count, payload_size);
+
+            int counted = 0;
+            for (auto& packet : buffer) {
+                REQUIRE(packet.hdr.packet_len == packet_size);
+                REQUIRE(packet.hdr.captured_len == packet_size);
+                ++counted;
+            }
+            REQUIRE(counted == packet_count);
+
+            /* Data is written in direct I/O sized chunks */
+            REQUIRE(std::filesystem::file_size(capture_filename) % 4096 == 0);
+        }
+
+        SECTION("write and read, rotate by size")
+        {
+            const size_t packet_count = 8192;
+            const size_t payload_size = 1000;
+
+            capture_buffer_file_stream buffer(
+                capture_filename,
+                buffer_size,
+                capture_buffer_file_stream::keep_file::disabled,
+                UINT32_MAX,
+                1024 * 1024);
+            REQUIRE(fill_capture_buffer_ipv4(buffer, packet_count, payload_size)
+                    == packet_count);
+
+            auto reader = buffer.create_reader();
+            auto filenames = buffer.get_filenames();
+            REQUIRE(filenames.size() > 1);
+            REQUIRE(filenames[1] == "unit_test_stream.1.pcapng");
+
+            auto stats = buffer.get_stats();
+            REQUIRE(stats.packets == packet_count);
+            REQUIRE(stats.dropped == 0);
+
+            auto counted =
+                verify_ipv4_incrementing_timestamp_and_packet_id(*reader);
+            REQUIRE(counted == packet_count);
+
+            reader->rewind();
+            counted = verify_ipv4_incrementing_timestamp_and_packet_id(*reader);
+            REQUIRE(counted == packet_count);
+        }
+    }
+
+    SECTION("live, ")
+    {
+        const uint64_t buffer_size = 1 * 1024 * 1024;
+        const size_t payload_size = 64;
+        const size_t buffer_bytes_per_packet =
+            (sizeof(capture_packet_hdr)
+             + pad_capture_data_len(calc_ipv4_packet_size(payload_size)));
+        const size_t max_packets_in_buffer =
+            (buffer_size / buffer_bytes_per_packet);
+        bool done = false;
+
+        capture_buffer_live buffer(
+            buffer_size, UINT32_MAX, [&done]() { return (done); });
+
+        SECTION("write and read, ")
+        {
+            const size_t packet_count = 1000;
+            fill_capture_buffer_ipv4(buffer, packet_count, payload_size);
+
+            auto reader = buffer.create_reader();
+            REQUIRE(!reader->is_done());
+
+            done = true;
+            auto counted =
+                verify_ipv4_incrementing_timestamp_and_packet_id(*reader);
+            REQUIRE(counted == packet_count);
+            REQUIRE(reader->is_done());
+        }
+
+        SECTION("drop when full, ")
+        {
+            REQUIRE(fill_capture_buffer_ipv4(
+                        buffer, 2 * max_packets_in_buffer, payload_size)
+                    == 2 * max_packets_in_buffer);
+
+            auto stats = buffer.get_stats();
+            REQUIRE(stats.packets == max_packets_in_buffer);
+            REQUIRE(stats.dropped == max_packets_in_buffer);
+
+            done = true;
+            auto reader = buffer.create_reader();
+            auto counted =
+                verify_ipv4_incrementing_timestamp_and_packet_id(*reader);
+            REQUIRE(counted == max_packets_in_buffer);
+        }
+
+        SECTION("write and read with wrap, ")
+        {
+            auto reader = buffer.create_reader();
+            std::array<capture_packet*, 16> packets;
+            size_t total_written = 0, counted = 0;
+
+            // Packet sizes don't divide the buffer size, so records wrap
+            for (size_t payload : {64, 200, 1000, 1500, 64}) {
+                INFO("payload size " << payload);
+                const size_t packet_count =
+                    buffer_size
+                    / (sizeof(capture_packet_hdr)
+                       + pad_capture_data_len(calc_ipv4_packet_size(payload)))
+                    / 3;
+                for (int i = 0; i < 4; i++) {
+                    total_written +=
+                        fill_capture_buffer_ipv4(buffer,
+                                                 packet_count,
+                                                 payload,
+                                                 uint16_t(total_written));
+                    while (auto n = reader->read_packets(packets.data(),
+                                                         packets.size())) {
+                        std::for_each(
+                            packets.data(),
+                            packets.data() + n,
+                            [&](auto packet) {
+                                auto ipv4 = reinterpret_cast<const ipv4_hdr*>(
+                                    packet->data + sizeof(eth_hdr));
+                                REQUIRE(ntohs(ipv4->packet_id)
+                                        == uint16_t(counted));
+                                ++counted;
+                            });
+                    }
+                }
+            }
+            REQUIRE(counted == total_written);
+            REQUIRE(buffer.get_stats().dropped == 0);
+            REQUIRE(!reader->is_done());
+        }
+
+        SECTION("multiple readers, ")
+        {
+            const size_t num_buffers = 3;
+            const size_t packet_count = 1000;
+            std::vector<std::unique_ptr<capture_buffer>> buffers;
+            for (size_t i = 0; i < num_buffers; ++i) {
+                buffers.emplace_back(new capture_buffer_live(
+                    buffer_size, UINT32_MAX, [&done]() { return (done); }));
+            }
+            fill_capture_buffers_ipv4(buffers, packet_count, 4);
+
+            std::vector<std::unique_ptr<capture_buffer_reader>> readers;
+            std::transform(buffers.begin(),
+                           buffers.end(),
+                           std::back_inserter(readers),
+                           [&](auto& b) { return b->create_reader(); });
+            multi_capture_buffer_live_reader reader(std::move(readers));
+
+            std::array<capture_packet*, 16> packets;
+            size_t counted = 0;
+            while (auto n =
+                       reader.read_packets(packets.data(), packets.size())) {
+                counted += n;
+            }
+            REQUIRE(counted == packet_count);
+            REQUIRE(!reader.is_done());
+
+            done = true;
+            REQUIRE(reader.is_done());
+        }
+    }
+
     SECTION("multi buffer reader ")
     {
         SECTION("write and read, ")
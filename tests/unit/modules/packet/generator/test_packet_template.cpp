@@ -242,5 +242,36 @@ TEST_CASE("traffic generator packet template,"
             check_contents(
                 pt, exp_cartesian_cartesian, hdr_lens.layer2 + hdr_lens.layer3);
         }
+
+        SECTION("lazy headers match expanded headers,")
+        {
+            auto udp_config = header::udp_config{};
+            set_udp_defaults(udp_config.header);
+            header_configs.push_back(udp_config);
+
+            for (auto pkt_mux :
+                 {header::modifier_mux::zip, header::modifier_mux::cartesian}) {
+                for (auto ip_mux : {header::modifier_mux::zip,
+                                    header::modifier_mux::cartesian}) {
+                    set_mux(header_configs[1], ip_mux);
+                    auto expanded = packet_template(header_configs, pkt_mux);
+                    auto lazy = packet_template(header_configs, pkt_mux, 0);
+                    REQUIRE(!expanded.lazy());
+                    REQUIRE(lazy.lazy());
+                    REQUIRE(lazy.size() == expanded.size());
+
+                    /* Pseudoheader checksums must match, too */
+                    auto hdr_lens = lazy.header_lengths();
+                    auto hdr_len =
+                        hdr_lens.layer2 + hdr_lens.layer3 + hdr_lens.layer4;
+                    for (auto i = 0U; i < lazy.size(); i++) {
+                        REQUIRE(std::memcmp(lazy[i], expanded[i], hdr_len)
+                                == 0);
+                    }
+
+                    check_contents(lazy, lazy.size(), hdr_len);
+                }
+            }
+        }
     }
 }
@@ -1,3 +1,6 @@
+#include <algorithm>
+#include <array>
+
 #include "catch.hpp"
 
 #include "packet/generator/traffic/sequence.hpp"
@@ -84,6 +87,25 @@ void check_length_sum(const sequence& seq, size_t n)
     REQUIRE(seq.sum_packet_lengths(n) == len_sum);
 }
 
+void check_flow_sums(const sequence& seq)
+{
+    for (auto flow_idx = 0U; flow_idx < seq.flow_count(); flow_idx++) {
+        auto packets = 0UL;
+        auto len_sum = 0UL;
+        std::for_each(std::begin(seq), std::end(seq), [&](const auto& tuple) {
+            if (std::get<sequence::flow_index>(tuple) == flow_idx) {
+                packets++;
+                len_sum += std::get<sequence::packet_length>(tuple);
+            }
+        });
+
+        REQUIRE(seq.flow_packets(flow_idx) == packets);
+        REQUIRE(seq.sum_flow_packet_lengths(flow_idx) == len_sum);
+        REQUIRE(seq.sum_flow_packet_lengths(flow_idx, 3 * seq.size())
+                == 3 * len_sum);
+    }
+}
+
 bool is_ipv4_header(const uint8_t* ptr)
 {
     auto eth = reinterpret_cast<const libpacket::protocol::ethernet*>(ptr);
@@ -100,6 +122,73 @@ void check_ipv4_count(const sequence& seq, size_t exp_ipv4_headers)
     REQUIRE(nb_ipv4_headers == exp_ipv4_headers);
 }
 
+constexpr uint16_t burst_size = 32;
+template <typename T>
+using burst_pair = std::array<std::array<T, burst_size>, 2>;
+
+/*
+ * Each sequence owns its own copy of the headers, so compare header contents
+ * instead of pointers.
+ */
+bool same_header(const uint8_t* lhs_hdr,
+                 openperf::packetio::packet::header_lengths lhs_lens,
+                 const uint8_t* rhs_hdr,
+                 openperf::packetio::packet::header_lengths rhs_lens)
+{
+    if (lhs_lens.value != rhs_lens.value) { return (false); }
+
+    auto length = lhs_lens.layer2 + lhs_lens.layer3 + lhs_lens.layer4;
+    return (std::equal(lhs_hdr, lhs_hdr + length, rhs_hdr));
+}
+
+void check_computed_indexes(const sequence& tables, const sequence& computed)
+{
+    REQUIRE(computed.size() == tables.size());
+    REQUIRE(computed.sum_packet_lengths() == tables.sum_packet_lengths());
+
+    /* Unpack the same bursts from both and make sure we wrap a few times */
+    auto flows = burst_pair<unsigned>{};
+    auto headers = burst_pair<const uint8_t*>{};
+    auto hdr_lens = burst_pair<openperf::packetio::packet::header_lengths>{};
+    auto flags = burst_pair<openperf::packetio::packet::packet_type::flags>{};
+    auto sigs = burst_pair<std::optional<signature_config>>{};
+    auto lengths = burst_pair<uint16_t>{};
+
+    for (size_t idx = 0; idx < 3 * tables.size(); idx += burst_size) {
+        for (auto i : {0, 1}) {
+            const auto& seq = (i == 0 ? tables : computed);
+            REQUIRE(seq.unpack(idx,
+                               burst_size,
+                               flows[i].data(),
+                               headers[i].data(),
+                               hdr_lens[i].data(),
+                               flags[i].data(),
+                               sigs[i].data(),
+                               lengths[i].data())
+                    == burst_size);
+        }
+
+        REQUIRE(flows[0] == flows[1]);
+        REQUIRE(lengths[0] == lengths[1]);
+
+        for (auto i = 0U; i < burst_size; i++) {
+            REQUIRE(same_header(
+                headers[0][i], hdr_lens[0][i], headers[1][i], hdr_lens[1][i]));
+
+            auto view = computed[idx + i];
+            REQUIRE(std::get<sequence::flow_index>(view) == flows[1][i]);
+            REQUIRE(same_header(std::get<sequence::pointer_to_header>(view),
+                                std::get<sequence::header_length>(view),
+                                headers[1][i],
+                                hdr_lens[1][i]));
+            REQUIRE(std::get<sequence::packet_length>(view) == lengths[1][i]);
+        }
+
+        REQUIRE(computed.sum_packet_lengths(idx)
+                == tables.sum_packet_lengths(idx));
+    }
+}
+
 auto range(size_t n)
 {
     auto r = std::vector<size_t>(n);
@@ -166,8 +255,10 @@ TEST_CASE("packet generator sequences", "[packet_generator]")
                                 return (lhs + std::get<uint16_t>(rhs));
                             });
         REQUIRE(seq.sum_packet_lengths() == pkt_len_sum);
+        REQUIRE(seq.sum_packet_lengths(3 * seq.size()) == 3 * pkt_len_sum);
 
         for (auto n : range(seq.size())) { check_length_sum(seq, n); }
+        check_flow_sums(seq);
 
         check_ipv4_count(seq, flow_lcm * ipv4_weight);
     }
@@ -189,9 +280,71 @@ TEST_CASE("packet generator sequences", "[packet_generator]")
                                 return (lhs + std::get<uint16_t>(rhs));
                             });
         REQUIRE(seq.sum_packet_lengths() == pkt_len_sum);
+        REQUIRE(seq.sum_packet_lengths(3 * seq.size()) == 3 * pkt_len_sum);
 
         for (auto n : range(seq.size())) { check_length_sum(seq, n); }
+        check_flow_sums(seq);
 
         check_ipv4_count(seq, ipv4_mod_count * ipv4_weight);
     }
+
+    SECTION("length sums,")
+    {
+        /* Use more lengths than flows, so lengths and flows don't line up */
+        auto defs = definition_container{};
+        defs.emplace_back(
+            packet_template(get_ipv4_packet_config(ipv4_mod_count),
+                            header::modifier_mux::zip),
+            length_template(length_container{64, 128, 256, 512, 1024, 1500}),
+            ipv4_weight,
+            std::nullopt);
+        defs.emplace_back(packet_template(get_ipv6_packet_config(3),
+                                          header::modifier_mux::zip),
+                          length_template(length_container(ipv6_pkt_lengths)),
+                          ipv6_weight,
+                          std::nullopt);
+
+        for (auto computed : {false, true}) {
+            auto max_table_size =
+                computed ? 0 : sequence::max_index_table_size;
+            for (auto round_robin : {false, true}) {
+                auto tmp = defs;
+                auto seq = (round_robin ? sequence::round_robin_sequence(
+                                std::move(tmp), max_table_size)
+                                        : sequence::sequential_sequence(
+                                            std::move(tmp), max_table_size));
+
+                auto pkt_len_sum = std::accumulate(
+                    std::begin(seq),
+                    std::end(seq),
+                    0UL,
+                    [](size_t lhs, const auto& rhs) {
+                        return (lhs + std::get<uint16_t>(rhs));
+                    });
+                REQUIRE(seq.sum_packet_lengths() == pkt_len_sum);
+
+                for (auto n : range(seq.size())) { check_length_sum(seq, n); }
+                check_flow_sums(seq);
+            }
+        }
+    }
+
+    SECTION("computed indexes,")
+    {
+        SECTION("round-robin,")
+        {
+            auto defs1 = definitions, defs2 = definitions;
+            auto tables = sequence::round_robin_sequence(std::move(defs1));
+            auto computed = sequence::round_robin_sequence(std::move(defs2), 0);
+            check_computed_indexes(tables, computed);
+        }
+
+        SECTION("sequential,")
+        {
+            auto defs1 = definitions, defs2 = definitions;
+            auto tables = sequence::sequential_sequence(std::move(defs1));
+            auto computed = sequence::sequential_sequence(std::move(defs2), 0);
+            check_computed_indexes(tables, computed);
+        }
+    }
 }
@@ -0,0 +1,4 @@
+OP_INC_DIRS += $(OP_ROOT)/src/modules
+
+TEST_SOURCES += \
+	modules/packet/stack/test_pbuf_chain.cpp
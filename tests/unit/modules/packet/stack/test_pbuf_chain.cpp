@@ -0,0 +1,196 @@
+#include <cstdint>
+#include <memory>
+#include <numeric>
+#include <vector>
+
+#include "catch.hpp"
+
+#include "packet/stack/dpdk/pbuf_chain.hpp"
+
+using namespace openperf::packet::stack::dpdk::gso;
+
+/* Just the pbuf fields the split touches */
+struct test_pbuf
+{
+    test_pbuf* next;
+    void* payload;
+    uint16_t tot_len;
+    uint16_t len;
+    uint8_t flags;
+};
+
+/* A chain of pbufs that reference consecutive chunks of one buffer */
+struct test_chain
+{
+    std::vector<uint8_t> data;
+    std::vector<std::unique_ptr<test_pbuf>> pbufs;
+
+    test_chain(const std::vector<uint16_t>& lengths)
+        : data(std::accumulate(lengths.begin(), lengths.end(), size_t{0}))
+    {
+        std::iota(data.begin(), data.end(), 0);
+
+        auto offset = size_t{0};
+        for (auto len : lengths) {
+            auto flags = static_cast<uint8_t>(pbufs.size());
+            pbufs.emplace_back(
+                new test_pbuf{nullptr, data.data() + offset, 0, len, flags});
+            offset += len;
+        }
+
+        for (size_t i = 0; i + 1 < pbufs.size(); i++) {
+            pbufs[i]->next = pbufs[i + 1].get();
+        }
+
+        auto tot_len = uint16_t{0};
+        for (auto it = pbufs.rbegin(); it != pbufs.rend(); ++it) {
+            tot_len += (*it)->len;
+            (*it)->tot_len = tot_len;
+        }
+    }
+
+    test_pbuf* head() const { return (pbufs.front().get()); }
+    test_pbuf* at(size_t idx) const { return (pbufs[idx].get()); }
+};
+
+/* A new, empty, pbuf, i.e. the header pbuf for the new chain */
+static std::unique_ptr<test_pbuf> make_head()
+{
+    return (std::make_unique<test_pbuf>(test_pbuf{}));
+}
+
+/* A new pbuf referencing the data after offset in p */
+static std::unique_ptr<test_pbuf> make_tail(const test_pbuf* p,
+                                            uint16_t offset)
+{
+    auto len = static_cast<uint16_t>(p->len - offset);
+    auto payload = reinterpret_cast<uint8_t*>(p->payload) + offset;
+    return (std::make_unique<test_pbuf>(
+        test_pbuf{nullptr, payload, len, len, 0}));
+}
+
+/* Check chain lengths and return the pbufs in it */
+static std::vector<test_pbuf*> chain_pbufs(test_pbuf* head)
+{
+    auto pbufs = std::vector<test_pbuf*>{};
+    for (auto p = head; p != nullptr; p = p->next) {
+        REQUIRE(p->tot_len == p->len + (p->next ? p->next->tot_len : 0));
+        pbufs.push_back(p);
+    }
+    return (pbufs);
+}
+
+/* Concatenate the data referenced by the chain */
+static std::vector<uint8_t> chain_data(test_pbuf* head)
+{
+    auto data = std::vector<uint8_t>{};
+    for (auto p = head; p != nullptr; p = p->next) {
+        auto ptr = reinterpret_cast<uint8_t*>(p->payload);
+        data.insert(data.end(), ptr, ptr + p->len);
+    }
+    return (data);
+}
+
+TEST_CASE("pbuf reference chain split", "[pbuf chain]")
+{
+    auto chain = test_chain({100, 200, 300});
+    auto head = make_head();
+
+    SECTION("split on a pbuf boundary, ")
+    {
+        split_reference_chain<test_pbuf>(
+            chain.head(), chain.at(0), chain.at(1), 0, head.get(), nullptr);
+
+        /* The new chain takes over the original pbufs; nothing is shared */
+        auto first = chain_pbufs(chain.head());
+        auto second = chain_pbufs(head.get());
+        REQUIRE(first == std::vector<test_pbuf*>{chain.at(0)});
+        REQUIRE(
+            second
+            == std::vector<test_pbuf*>{head.get(), chain.at(1), chain.at(2)});
+
+        REQUIRE(chain.head()->tot_len == 100);
+        REQUIRE(head->tot_len == 500);
+        REQUIRE(head->len == 0);
+
+        REQUIRE(chain_data(chain.head())
+                == std::vector<uint8_t>(chain.data.begin(),
+                                        chain.data.begin() + 100));
+        REQUIRE(chain_data(head.get())
+                == std::vector<uint8_t>(chain.data.begin() + 100,
+                                        chain.data.end()));
+    }
+
+    SECTION("split inside a pbuf, ")
+    {
+        auto tail = make_tail(chain.at(1), 50);
+        split_reference_chain<test_pbuf>(
+            chain.head(), chain.at(0), chain.at(1), 50, head.get(), tail.get());
+
+        /* Only the tail references the split pbuf's data after the split */
+        auto first = chain_pbufs(chain.head());
+        auto second = chain_pbufs(head.get());
+        REQUIRE(first == std::vector<test_pbuf*>{chain.at(0), chain.at(1)});
+        REQUIRE(
+            second
+            == std::vector<test_pbuf*>{head.get(), tail.get(), chain.at(2)});
+
+        REQUIRE(chain.at(1)->len == 50);
+        REQUIRE(chain.at(1)->next == nullptr);
+        REQUIRE(chain.head()->tot_len == 150);
+
+        REQUIRE(tail->payload == chain.data.data() + 150);
+        REQUIRE(tail->len == 150);
+        REQUIRE(tail->flags == chain.at(1)->flags);
+        REQUIRE(head->tot_len == 450);
+
+        REQUIRE(chain_data(chain.head())
+                == std::vector<uint8_t>(chain.data.begin(),
+                                        chain.data.begin() + 150));
+        REQUIRE(chain_data(head.get())
+                == std::vector<uint8_t>(chain.data.begin() + 150,
+                                        chain.data.end()));
+    }
+
+    SECTION("split inside the last pbuf, ")
+    {
+        auto tail = make_tail(chain.at(2), 1);
+        split_reference_chain<test_pbuf>(
+            chain.head(), chain.at(1), chain.at(2), 1, head.get(), tail.get());
+
+        auto first = chain_pbufs(chain.head());
+        auto second = chain_pbufs(head.get());
+        REQUIRE(first.size() == 3);
+        REQUIRE(second == std::vector<test_pbuf*>{head.get(), tail.get()});
+
+        REQUIRE(chain.head()->tot_len == 301);
+        REQUIRE(head->tot_len == 299);
+        REQUIRE(tail->next == nullptr);
+    }
+
+    SECTION("split inside the first pbuf, ")
+    {
+        auto tail = make_tail(chain.at(0), 10);
+        split_reference_chain<test_pbuf>(
+            chain.head(), nullptr, chain.at(0), 10, head.get(), tail.get());
+
+        auto first = chain_pbufs(chain.head());
+        auto second = chain_pbufs(head.get());
+        REQUIRE(first == std::vector<test_pbuf*>{chain.at(0)});
+        REQUIRE(second.size() == 4);
+
+        REQUIRE(chain.head()->tot_len == 10);
+        REQUIRE(head->tot_len == 590);
+    }
+
+    SECTION("header room in the new head counts toward its length, ")
+    {
+        head->len = 54;
+        split_reference_chain<test_pbuf>(
+            chain.head(), chain.at(1), chain.at(2), 0, head.get(), nullptr);
+
+        chain_pbufs(head.get());
+        REQUIRE(head->tot_len == 354);
+        REQUIRE(chain.head()->tot_len == 300);
+    }
+}
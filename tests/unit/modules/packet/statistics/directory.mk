@@ -1,4 +1,5 @@
 OP_INC_DIRS += $(OP_ROOT)/src/modules
 
 TEST_SOURCES += \
+	modules/packet/statistics/test_flow_update_tracker.cpp \
 	modules/packet/statistics/test_protocol_counters.cpp
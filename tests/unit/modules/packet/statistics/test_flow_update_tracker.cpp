@@ -0,0 +1,58 @@
+#include <vector>
+
+#include "catch.hpp"
+
+#include "packet/statistics/flow_update_tracker.hpp"
+
+using namespace openperf::packet::statistics;
+
+static std::vector<size_t> get_updates(flow_update_tracker& tracker,
+                                       const std::vector<uint64_t>& counts)
+{
+    auto updates = std::vector<size_t>{};
+
+    tracker.resize(counts.size());
+    for (size_t idx = 0; idx < counts.size(); idx++) {
+        if (tracker.update(idx, counts[idx])) { updates.push_back(idx); }
+    }
+
+    return (updates);
+}
+
+TEST_CASE("flow update tracker", "[packet_statistics]")
+{
+    auto tracker = flow_update_tracker{};
+    REQUIRE(tracker.size() == 0);
+
+    SECTION("first update, ")
+    {
+        /* Every flow is new, even ones without any packets */
+        auto updates = get_updates(tracker, {0, 1, 2});
+        REQUIRE(updates == std::vector<size_t>{0, 1, 2});
+        REQUIRE(tracker.size() == 3);
+    }
+
+    SECTION("unchanged flows, ")
+    {
+        get_updates(tracker, {0, 1, 2});
+        REQUIRE(get_updates(tracker, {0, 1, 2}).empty());
+    }
+
+    SECTION("changed flows, ")
+    {
+        get_updates(tracker, {0, 1, 2});
+        REQUIRE(get_updates(tracker, {0, 5, 2}) == std::vector<size_t>{1});
+        REQUIRE(get_updates(tracker, {3, 5, 9}) == std::vector<size_t>{0, 2});
+
+        /* Counters can be reset, too */
+        REQUIRE(get_updates(tracker, {3, 0, 9}) == std::vector<size_t>{1});
+    }
+
+    SECTION("new flows, ")
+    {
+        get_updates(tracker, {1, 1});
+        REQUIRE(get_updates(tracker, {1, 1, 0, 4})
+                == std::vector<size_t>{2, 3});
+        REQUIRE(tracker.size() == 4);
+    }
+}
@@ -7,4 +7,6 @@ TEST_DEPENDS += packetio_test
 TEST_SOURCES += \
 	modules/packetio/mock_packet_buffer.cpp \
 	modules/packetio/test_forwarding_table.cpp \
+	modules/packetio/test_queue_balancer.cpp \
+	modules/packetio/test_timing_wheel.cpp \
 	modules/packetio/test_transmit_table.cpp
@@ -1,5 +1,8 @@
+#include <algorithm>
 #include <map>
+#include <string>
 #include <utility>
+#include <vector>
 
 #include "catch.hpp"
 
@@ -82,6 +85,33 @@ TEST_CASE("forwarding table functionality", "[forwarding table]")
             REQUIRE(table.has_interface_rx_sinks(port1));
             REQUIRE(!table.has_interface_rx_sinks(port1 + 1));
 
+            SECTION("multicast sinks, ")
+            {
+                /* Nothing is published until the writer asks */
+                REQUIRE(table.get_multicast_rx_sinks(port1).empty());
+
+                delete table.update_multicast_rx_sinks(port1);
+                REQUIRE(table.get_multicast_rx_sinks(port1).size() == 1);
+                REQUIRE(table.get_multicast_rx_sinks(port1)[0].id
+                        == sink1.id);
+                REQUIRE(table.get_multicast_rx_sinks(port1 + 1).empty());
+
+                auto ifp2 = test_interface{"interface_2"};
+                auto mac2 = mac_address{0x00, 0x01, 0x02, 0x03, 0x04, 0x06};
+                auto sink2 = test_sink{"sink_2"};
+                delete table.insert_interface(port1, mac2, ifp2);
+                delete table.insert_interface_sink(
+                    port1, mac2, forwarding_table::direction::RX, sink2);
+                delete table.update_multicast_rx_sinks(port1);
+                REQUIRE(table.get_multicast_rx_sinks(port1).size() == 2);
+
+                delete table.remove_interface(port1, mac1);
+                delete table.update_multicast_rx_sinks(port1);
+                REQUIRE(table.get_multicast_rx_sinks(port1).size() == 1);
+                REQUIRE(table.get_multicast_rx_sinks(port1)[0].id
+                        == sink2.id);
+            }
+
             SECTION("find sink, ")
             {
                 auto found = table.find_interface_and_sinks(port1, mac1);
@@ -398,3 +428,100 @@ TEST_CASE("forwarding table functionality", "[forwarding table]")
         }
     }
 }
+
+TEST_CASE("forwarding table mac lookup", "[forwarding table]")
+{
+    auto table = forwarding_table();
+    auto port = static_cast<uint16_t>(1);
+
+    /* Enough interfaces to outgrow the initial lookup table a few times */
+    static constexpr unsigned nb_interfaces = 1000;
+
+    auto to_mac = [](unsigned idx) {
+        return (mac_address{0x02,
+                            0x00,
+                            0x00,
+                            static_cast<uint8_t>(idx >> 16),
+                            static_cast<uint8_t>(idx >> 8),
+                            static_cast<uint8_t>(idx)});
+    };
+
+    for (unsigned i = 0; i < nb_interfaces; i++) {
+        delete table.insert_interface(
+            port, to_mac(i), test_interface{std::to_string(i)});
+    }
+
+    SECTION("find, ")
+    {
+        for (unsigned i = 0; i < nb_interfaces; i++) {
+            auto ptr = table.find_interface(port, to_mac(i));
+            REQUIRE(ptr);
+            REQUIRE(ptr->id == std::to_string(i));
+        }
+        REQUIRE(!table.find_interface(port, to_mac(nb_interfaces)));
+        REQUIRE(!table.find_interface(port + 1, to_mac(0)));
+    }
+
+    SECTION("find burst, ")
+    {
+        auto macs = std::vector<mac_address>{};
+        for (unsigned i = 0; i < nb_interfaces + 10; i++) {
+            macs.push_back(to_mac(i));
+        }
+
+        auto octets = std::vector<const uint8_t*>{};
+        std::transform(std::begin(macs),
+                       std::end(macs),
+                       std::back_inserter(octets),
+                       [](const auto& mac) { return (mac.octets.data()); });
+
+        auto entries = std::vector<const forwarding_table::interface_sinks*>(
+            octets.size());
+        table.find_interface_and_sinks(
+            port, octets.data(), entries.data(), octets.size());
+
+        for (unsigned i = 0; i < entries.size(); i++) {
+            if (i < nb_interfaces) {
+                REQUIRE(entries[i]);
+                REQUIRE(entries[i]->ifp.id == std::to_string(i));
+            } else {
+                REQUIRE(!entries[i]);
+            }
+        }
+    }
+
+    SECTION("remove and reinsert, ")
+    {
+        /* Churn leaves tombstones behind; the table must keep working */
+        for (unsigned loop = 0; loop < 3; loop++) {
+            for (unsigned i = 0; i < nb_interfaces; i += 2) {
+                delete table.remove_interface(port, to_mac(i));
+            }
+            for (unsigned i = 0; i < nb_interfaces; i++) {
+                REQUIRE(!table.find_interface(port, to_mac(i)) == !(i % 2));
+            }
+            for (unsigned i = 0; i < nb_interfaces; i += 2) {
+                delete table.insert_interface(
+                    port, to_mac(i), test_interface{std::to_string(i)});
+            }
+        }
+
+        for (unsigned i = 0; i < nb_interfaces; i++) {
+            auto ptr = table.find_interface(port, to_mac(i));
+            REQUIRE(ptr);
+            REQUIRE(ptr->id == std::to_string(i));
+        }
+    }
+
+    SECTION("update sinks, ")
+    {
+        auto sink = test_sink{"sink"};
+        delete table.insert_interface_sink(
+            port, to_mac(7), forwarding_table::direction::RX, sink);
+
+        auto found = table.find_interface_rx_sinks(port, to_mac(7));
+        REQUIRE(found);
+        REQUIRE(found->size() == 1);
+        REQUIRE(found->front().id == sink.id);
+    }
+}
@@ -0,0 +1,62 @@
+#include "catch.hpp"
+
+#include "packetio/workers/dpdk/queue_balancer.hpp"
+
+using namespace openperf::packetio::dpdk;
+
+TEST_CASE("queue balancer", "[packetio]")
+{
+    const auto workers = std::vector<unsigned>{1, 2};
+
+    SECTION("balanced load, ")
+    {
+        auto queues = std::vector<queue_load>{
+            {0, 0, 1, 1000}, {0, 1, 2, 900}, {0, 2, 1, 100}, {0, 3, 2, 200}};
+        REQUIRE(!find_queue_move(queues, workers, 100));
+    }
+
+    SECTION("single worker, ")
+    {
+        auto queues = std::vector<queue_load>{{0, 0, 1, 1000}, {0, 1, 1, 0}};
+        REQUIRE(!find_queue_move(queues, {1}, 100));
+    }
+
+    SECTION("idle, ")
+    {
+        auto queues = std::vector<queue_load>{{0, 0, 1, 50}, {0, 1, 1, 40}};
+        REQUIRE(!find_queue_move(queues, workers, 100));
+    }
+
+    SECTION("moves queue to idle worker, ")
+    {
+        auto queues = std::vector<queue_load>{
+            {0, 0, 1, 800}, {0, 1, 1, 1000}, {0, 2, 1, 200}};
+        auto move = find_queue_move(queues, workers, 100);
+        REQUIRE(move);
+        REQUIRE(move->port_id == 0);
+        REQUIRE(move->queue_id == 1);
+        REQUIRE(move->from == 1);
+        REQUIRE(move->to == 2);
+    }
+
+    SECTION("picks queue closest to half the imbalance, ")
+    {
+        /* Worker loads: 1 -> 1000, 2 -> 200; ideal move is 400 */
+        auto queues = std::vector<queue_load>{{0, 0, 1, 100},
+                                              {0, 1, 1, 350},
+                                              {1, 0, 1, 550},
+                                              {1, 1, 2, 200}};
+        auto move = find_queue_move(queues, workers, 100);
+        REQUIRE(move);
+        REQUIRE(move->port_id == 0);
+        REQUIRE(move->queue_id == 1);
+        REQUIRE(move->to == 2);
+    }
+
+    SECTION("ignores moves that don't help, ")
+    {
+        /* A single hot queue can't be balanced by moving it */
+        auto queues = std::vector<queue_load>{{0, 0, 1, 1000}};
+        REQUIRE(!find_queue_move(queues, workers, 100));
+    }
+}
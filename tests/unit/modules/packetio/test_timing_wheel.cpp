@@ -0,0 +1,136 @@
+#include <map>
+
+#include "catch.hpp"
+
+#include "packetio/workers/dpdk/timing_wheel.hpp"
+
+using namespace openperf::packetio::dpdk::schedule;
+
+TEST_CASE("timing wheel", "[packetio]")
+{
+    /* 16 ticks per slot, 64 slots; one revolution is 1024 ticks */
+    using wheel_type = timing_wheel<unsigned, 4, 6>;
+
+    SECTION("empty, ")
+    {
+        auto wheel = wheel_type{};
+        REQUIRE(wheel.empty());
+        REQUIRE(wheel.expire(1000000, [](uint64_t, unsigned) {
+            FAIL("nothing should expire");
+            return (true);
+        }) == 0);
+    }
+
+    SECTION("expire in order, ")
+    {
+        auto wheel = wheel_type{100};
+        wheel.insert(500, 3);
+        wheel.insert(150, 1);
+        wheel.insert(300, 2);
+        wheel.insert(5000, 4); /* multiple revolutions away */
+        REQUIRE(wheel.size() == 4);
+
+        auto expired = std::vector<unsigned>{};
+        auto collect = [&](uint64_t deadline, unsigned value) {
+            REQUIRE(deadline <= 600);
+            expired.push_back(value);
+            return (true);
+        };
+
+        REQUIRE(wheel.expire(149, collect) == 0);
+        REQUIRE(wheel.expire(600, collect) == 3);
+        REQUIRE(expired == std::vector<unsigned>{1, 2, 3});
+        REQUIRE(wheel.size() == 1);
+
+        /* Go around a few times; the far entry should wait its turn */
+        for (uint64_t now = 1000; now < 5000; now += 100) {
+            REQUIRE(wheel.expire(now, collect) == 0);
+        }
+        REQUIRE(wheel.expire(5000, [](uint64_t deadline, unsigned value) {
+            REQUIRE(deadline == 5000);
+            REQUIRE(value == 4);
+            return (true);
+        }) == 1);
+        REQUIRE(wheel.empty());
+    }
+
+    SECTION("periodic entries, ")
+    {
+        /* Schedule a bunch of periodic events and verify their counts */
+        auto wheel = wheel_type{};
+        auto periods = std::map<unsigned, uint64_t>{};
+        auto counts = std::map<unsigned, uint64_t>{};
+        for (unsigned i = 1; i <= 100; i++) {
+            periods[i] = i * 7;
+            wheel.insert(periods[i], i);
+        }
+
+        constexpr uint64_t duration = 100000;
+        for (uint64_t now = 0; now <= duration; now += 13) {
+            wheel.expire(now, [&](uint64_t deadline, unsigned value) {
+                REQUIRE(deadline <= now);
+                counts[value]++;
+                wheel.insert(deadline + periods[value], value);
+                return (true);
+            });
+        }
+
+        REQUIRE(wheel.size() == 100);
+        for (unsigned i = 1; i <= 100; i++) {
+            REQUIRE(counts[i] == duration / periods[i]);
+        }
+    }
+
+    SECTION("stop expiring, ")
+    {
+        auto wheel = wheel_type{};
+        for (unsigned i = 0; i < 10; i++) { wheel.insert(i * 10, i); }
+
+        auto expired = std::vector<unsigned>{};
+        auto stop_at_five = [&](uint64_t, unsigned value) {
+            expired.push_back(value);
+            return (value != 5);
+        };
+        REQUIRE(wheel.expire(1000, stop_at_five) == 6);
+        REQUIRE(wheel.size() == 4);
+
+        /* Remaining entries should still expire in order */
+        REQUIRE(wheel.expire(1000, stop_at_five) == 4);
+        REQUIRE(expired
+                == std::vector<unsigned>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
+    }
+
+    SECTION("past deadlines, ")
+    {
+        auto wheel = wheel_type{10000};
+        wheel.insert(10, 1);
+        REQUIRE(wheel.expire(10000, [](uint64_t deadline, unsigned value) {
+            REQUIRE(deadline == 10);
+            REQUIRE(value == 1);
+            return (true);
+        }) == 1);
+    }
+
+    SECTION("long gaps, ")
+    {
+        auto wheel = wheel_type{};
+        wheel.insert(10, 1);
+        wheel.insert(20000, 2);
+        REQUIRE(wheel.expire(10000, [](uint64_t, unsigned value) {
+            REQUIRE(value == 1);
+            return (true);
+        }) == 1);
+        REQUIRE(wheel.size() == 1);
+
+        auto count = 0U;
+        wheel.for_each([&](uint64_t deadline, unsigned value) {
+            REQUIRE(deadline == 20000);
+            REQUIRE(value == 2);
+            count++;
+        });
+        REQUIRE(count == 1);
+
+        wheel.reset(0);
+        REQUIRE(wheel.empty());
+    }
+}
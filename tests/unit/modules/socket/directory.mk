@@ -6,4 +6,6 @@ TEST_DEPENDS += socket_test
 
 TEST_SOURCES += \
 	modules/socket/test_circular_buffer.cpp \
-	modules/socket/test_event_queue.cpp
+	modules/socket/test_dgram_channel.cpp \
+	modules/socket/test_event_queue.cpp \
+	modules/socket/test_tcp_send_queue.cpp
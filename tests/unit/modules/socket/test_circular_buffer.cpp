@@ -2,6 +2,7 @@
 #include <atomic>
 #include <cstring>
 #include <memory>
+#include <numeric>
 #include <vector>
 
 #include "catch.hpp"
@@ -169,6 +170,46 @@ TEST_CASE("circular buffer functionality", "[circular buffer]")
         }
     }
 
+    SECTION("can fill in a header after its data, ")
+    {
+        /* Move the cursors so that the data wraps */
+        std::array<uint8_t, test_buffer_size - 64> filler;
+        REQUIRE(producer->write(filler.data(), filler.size())
+                == filler.size());
+        REQUIRE(consumer->read(filler.data(), filler.size())
+                == filler.size());
+
+        int fds[2];
+        REQUIRE(pipe(fds) == 0);
+        std::array<uint8_t, 128> data;
+        std::iota(data.begin(), data.end(), 0);
+        REQUIRE(::write(fds[1], data.data(), data.size())
+                == static_cast<ssize_t>(data.size()));
+
+        const uint64_t header = 0xfeedface;
+        REQUIRE(producer->pwrite(fds[0], data.size(), nullptr, sizeof(header))
+                == static_cast<ssize_t>(data.size()));
+        REQUIRE(consumer->readable() == 0);
+        REQUIRE(producer->pwrite(&header, sizeof(header), 0)
+                == sizeof(header));
+        REQUIRE(consumer->readable() == 0);
+
+        producer->commit(sizeof(header) + data.size());
+        REQUIRE(consumer->readable() == sizeof(header) + data.size());
+
+        auto read_header = uint64_t{0};
+        REQUIRE(consumer->read(&read_header, sizeof(read_header))
+                == sizeof(read_header));
+        REQUIRE(read_header == header);
+
+        std::array<uint8_t, 128> buffer;
+        REQUIRE(consumer->read(buffer.data(), buffer.size()) == buffer.size());
+        REQUIRE(buffer == data);
+
+        close(fds[0]);
+        close(fds[1]);
+    }
+
     SECTION("0 byte write/read is idempotent, ")
     {
         std::array<uint8_t, 128> buffer;
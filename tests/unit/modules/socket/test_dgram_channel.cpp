@@ -0,0 +1,264 @@
+#include <cstring>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+#include "catch.hpp"
+
+#include "socket/circular_buffer_consumer.tcc"
+#include "socket/event_queue_producer.tcc"
+#include "socket/client/dgram_channel.hpp"
+
+using namespace openperf::socket;
+
+/*
+ * A bare bones server side view of a datagram channel. Just like the real
+ * server channel, it shares its layout with the client channel, but it only
+ * pulls datagrams off of the transmit buffer and unblocks the client.
+ */
+class test_dgram_server
+    : public circular_buffer_consumer<test_dgram_server>
+    , public event_queue_producer<test_dgram_server>
+{
+    DGRAM_CHANNEL_MEMBERS
+
+    friend class circular_buffer_consumer<test_dgram_server>;
+    friend class event_queue_producer<test_dgram_server>;
+
+    std::unique_ptr<uint8_t[]> tx_storage;
+    std::unique_ptr<uint8_t[]> rx_storage;
+
+protected:
+    uint8_t* consumer_base() const { return (tx_buffer.ptr.get()); }
+    size_t consumer_len() const { return (tx_buffer.len); }
+    std::atomic_size_t& consumer_read_idx() { return (tx_q_read_idx); }
+    const std::atomic_size_t& consumer_read_idx() const
+    {
+        return (tx_q_read_idx);
+    }
+    std::atomic_size_t& consumer_write_idx() { return (tx_q_write_idx); }
+    const std::atomic_size_t& consumer_write_idx() const
+    {
+        return (tx_q_write_idx);
+    }
+
+    int producer_fd() const { return (server_fds.client_fd); }
+    std::atomic_uint64_t& notify_read_idx() { return (rx_fd_read_idx); }
+    const std::atomic_uint64_t& notify_read_idx() const
+    {
+        return (rx_fd_read_idx);
+    }
+    std::atomic_uint64_t& notify_write_idx() { return (rx_fd_write_idx); }
+    const std::atomic_uint64_t& notify_write_idx() const
+    {
+        return (rx_fd_write_idx);
+    }
+
+public:
+    test_dgram_server(size_t capacity, int flags)
+        : tx_buffer(new uint8_t[capacity], capacity)
+        , tx_q_write_idx(0)
+        , rx_q_read_idx(0)
+        , tx_fd_write_idx(0)
+        , rx_fd_read_idx(0)
+        , socket_flags(flags)
+        , rx_buffer(new uint8_t[capacity], capacity)
+        , tx_q_read_idx(0)
+        , rx_q_write_idx(0)
+        , tx_fd_read_idx(0)
+        , rx_fd_write_idx(0)
+        , allocator(nullptr)
+        , tx_storage(tx_buffer.ptr.get())
+        , rx_storage(rx_buffer.ptr.get())
+    {
+        server_fds.client_fd = eventfd(0, flags & EFD_NONBLOCK);
+        server_fds.server_fd = eventfd(0, 0);
+        if (server_fds.client_fd == -1 || server_fds.server_fd == -1) {
+            throw std::runtime_error("Could not create eventfd: "
+                                     + std::string(strerror(errno)));
+        }
+
+        /* Everything is in the same process, so both sides share fds */
+        client_fds = server_fds;
+    }
+
+    ~test_dgram_server()
+    {
+        close(server_fds.client_fd);
+        close(server_fds.server_fd);
+    }
+
+    client::dgram_channel& client()
+    {
+        return (*reinterpret_cast<client::dgram_channel*>(this));
+    }
+
+    /* Returns the number of transmit notifications from the client */
+    uint64_t notifications()
+    {
+        auto counter = eventfd_t{0};
+        eventfd_read(server_fds.server_fd, &counter);
+        return (counter);
+    }
+
+    /* Pull the next datagram payload off of the transmit buffer, if any */
+    std::optional<std::vector<uint8_t>> recv()
+    {
+        auto desc = dgram_channel_descriptor{};
+        if (readable() < sizeof(desc)) { return (std::nullopt); }
+
+        pread(std::addressof(desc), sizeof(desc), 0);
+        if (desc.tag != descriptor_tag
+            || readable() < sizeof(desc) + desc.length) {
+            return (std::nullopt);
+        }
+
+        auto payload = std::vector<uint8_t>(desc.length);
+        pread(payload.data(), payload.size(), sizeof(desc));
+        drop(sizeof(desc) + desc.length);
+
+        return (payload);
+    }
+};
+
+template class openperf::socket::circular_buffer_consumer<test_dgram_server>;
+template class openperf::socket::event_queue_producer<test_dgram_server>;
+
+/* A batch of datagrams, each filled with its index */
+struct test_batch
+{
+    std::vector<std::vector<uint8_t>> payloads;
+    std::vector<iovec> iovecs;
+    std::vector<mmsghdr> msgs;
+
+    test_batch(const std::vector<size_t>& lengths)
+        : payloads(lengths.size())
+        , iovecs(lengths.size())
+        , msgs(lengths.size())
+    {
+        for (size_t i = 0; i < lengths.size(); i++) {
+            payloads[i].assign(lengths[i], static_cast<uint8_t>(i));
+            iovecs[i] = iovec{payloads[i].data(), payloads[i].size()};
+            msgs[i] = mmsghdr{};
+            msgs[i].msg_hdr.msg_iov = &iovecs[i];
+            msgs[i].msg_hdr.msg_iovlen = 1;
+        }
+    }
+
+    tl::expected<unsigned, int>
+    send(client::dgram_channel& channel, size_t offset, size_t count)
+    {
+        return (channel.send(msgs.data() + offset, count, 0));
+    }
+};
+
+TEST_CASE("datagram channel batches", "[datagram channel]")
+{
+    /*
+     * Size our datagrams so that each one takes up an aligned 128 byte
+     * chunk of the buffer; the channel holds exactly 4 of them.
+     */
+    static constexpr size_t test_buffer_size = 512;
+    static constexpr size_t test_datagram_size =
+        128 - sizeof(dgram_channel_descriptor);
+    static constexpr size_t test_channel_datagrams = 4;
+
+    auto check_received = [](test_dgram_server& server,
+                             const test_batch& batch,
+                             size_t offset,
+                             size_t count) {
+        for (size_t i = offset; i < offset + count; i++) {
+            auto payload = server.recv();
+            REQUIRE(payload);
+            REQUIRE(*payload == batch.payloads[i]);
+        }
+    };
+
+    SECTION("nonblocking testcases, ")
+    {
+        auto server =
+            std::make_unique<test_dgram_server>(test_buffer_size, EFD_NONBLOCK);
+        auto& client = server->client();
+
+        SECTION("sends a full batch with one notification, ")
+        {
+            auto batch = test_batch(std::vector<size_t>(
+                test_channel_datagrams, test_datagram_size));
+            auto sent = batch.send(client, 0, test_channel_datagrams);
+            REQUIRE(sent);
+            REQUIRE(*sent == test_channel_datagrams);
+            for (const auto& msg : batch.msgs) {
+                REQUIRE(msg.msg_len == test_datagram_size);
+            }
+
+            REQUIRE(server->notifications() == 1);
+            check_received(*server, batch, 0, test_channel_datagrams);
+            REQUIRE(!server->recv());
+        }
+
+        SECTION("single datagrams can fill the channel, ")
+        {
+            auto batch = test_batch(std::vector<size_t>(
+                test_channel_datagrams, test_datagram_size));
+            for (const auto& msg : batch.msgs) {
+                auto sent = client.send(
+                    msg.msg_hdr.msg_iov, msg.msg_hdr.msg_iovlen, 0, nullptr);
+                REQUIRE(sent);
+                REQUIRE(*sent == test_datagram_size);
+            }
+
+            check_received(*server, batch, 0, test_channel_datagrams);
+            REQUIRE(!server->recv());
+        }
+
+        SECTION("partial batch when the channel fills midway, ")
+        {
+            auto batch = test_batch(std::vector<size_t>(
+                test_channel_datagrams + 2, test_datagram_size));
+            auto sent = batch.send(client, 0, batch.msgs.size());
+            REQUIRE(sent);
+            REQUIRE(*sent == test_channel_datagrams);
+            REQUIRE(batch.msgs[test_channel_datagrams].msg_len == 0);
+            REQUIRE(batch.msgs[test_channel_datagrams + 1].msg_len == 0);
+
+            SECTION("EAGAIN if nothing else fits, ")
+            {
+                auto again = batch.send(client, test_channel_datagrams, 2);
+                REQUIRE(!again);
+                REQUIRE(again.error() == EAGAIN);
+            }
+
+            SECTION("sends the rest once the server catches up, ")
+            {
+                check_received(*server, batch, 0, 2);
+                REQUIRE(server->unblock() == 0);
+
+                auto rest = batch.send(client, test_channel_datagrams, 2);
+                REQUIRE(rest);
+                REQUIRE(*rest == 2);
+
+                check_received(*server, batch, 2, test_channel_datagrams);
+                REQUIRE(!server->recv());
+            }
+        }
+
+        SECTION("partial batch when a datagram is too big midway, ")
+        {
+            auto batch = test_batch(
+                {test_datagram_size, test_buffer_size, test_datagram_size});
+            auto sent = batch.send(client, 0, batch.msgs.size());
+            REQUIRE(sent);
+            REQUIRE(*sent == 1);
+
+            auto too_big = batch.send(client, 1, 2);
+            REQUIRE(!too_big);
+            REQUIRE(too_big.error() == EMSGSIZE);
+
+            check_received(*server, batch, 0, 1);
+            REQUIRE(!server->recv());
+        }
+    }
+}
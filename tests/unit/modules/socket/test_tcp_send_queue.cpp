@@ -0,0 +1,143 @@
+#include <cstdint>
+#include <vector>
+
+#include "catch.hpp"
+
+#include "socket/server/tcp_send_queue.hpp"
+
+using namespace openperf::socket::server;
+
+/* Just enough of the server stream channel for the send queue */
+struct test_channel
+{
+    std::vector<uint8_t> data;
+    size_t read_idx = 0;
+
+    void write(size_t length)
+    {
+        for (size_t i = 0; i < length; i++) {
+            data.push_back(static_cast<uint8_t>(data.size()));
+        }
+    }
+
+    size_t readable() const { return (data.size() - read_idx); }
+
+    iovec recv_peek(size_t offset) const
+    {
+        if (read_idx + offset >= data.size()) { return (iovec{}); }
+        return (iovec{
+            .iov_base = const_cast<uint8_t*>(data.data()) + read_idx + offset,
+            .iov_len = readable() - offset});
+    }
+
+    size_t recv_drop(size_t length)
+    {
+        read_idx += length;
+        return (length);
+    }
+
+    const uint8_t* at(size_t idx) const { return (data.data() + idx); }
+};
+
+TEST_CASE("tcp send queue", "[tcp send queue]")
+{
+    auto channel = test_channel{};
+    channel.write(1000);
+
+    SECTION("zero copy, ")
+    {
+        auto sendq = tcp_send_queue(true);
+        REQUIRE(sendq.zero_copy());
+        REQUIRE(sendq.unsent(channel) == 1000);
+
+        sendq.sent(channel, 600);
+
+        SECTION("sent data stays in the channel, ")
+        {
+            REQUIRE(sendq.length() == 600);
+            REQUIRE(sendq.unsent(channel) == 400);
+            REQUIRE(channel.readable() == 1000);
+
+            auto iov = sendq.peek(channel);
+            REQUIRE(iov.iov_base == channel.at(600));
+            REQUIRE(iov.iov_len == 400);
+        }
+
+        SECTION("partial acks release data in order, ")
+        {
+            REQUIRE(sendq.acked(channel, 100) == 100);
+            REQUIRE(sendq.length() == 500);
+            REQUIRE(channel.readable() == 900);
+            REQUIRE(channel.recv_peek(0).iov_base == channel.at(100));
+
+            /* Unsent data doesn't move */
+            REQUIRE(sendq.unsent(channel) == 400);
+            REQUIRE(sendq.peek(channel).iov_base == channel.at(600));
+
+            REQUIRE(sendq.acked(channel, 500) == 500);
+            REQUIRE(sendq.length() == 0);
+            REQUIRE(channel.readable() == 400);
+            REQUIRE(sendq.peek(channel).iov_base == channel.at(600));
+        }
+
+        SECTION("acks past the queued data only drop queued data, ")
+        {
+            /* e.g. the ack for our FIN */
+            REQUIRE(sendq.acked(channel, 601) == 600);
+            REQUIRE(sendq.length() == 0);
+            REQUIRE(channel.readable() == 400);
+
+            REQUIRE(sendq.acked(channel, 1) == 0);
+            REQUIRE(channel.readable() == 400);
+        }
+
+        SECTION("sends and acks can interleave, ")
+        {
+            sendq.sent(channel, 400);
+            REQUIRE(sendq.length() == 1000);
+            REQUIRE(sendq.unsent(channel) == 0);
+            REQUIRE(sendq.peek(channel).iov_len == 0);
+
+            REQUIRE(sendq.acked(channel, 700) == 700);
+            channel.write(200);
+            REQUIRE(sendq.length() == 300);
+            REQUIRE(sendq.unsent(channel) == 200);
+            REQUIRE(sendq.peek(channel).iov_base == channel.at(1000));
+
+            sendq.sent(channel, 200);
+            REQUIRE(sendq.acked(channel, 500) == 500);
+            REQUIRE(sendq.length() == 0);
+            REQUIRE(channel.readable() == 0);
+        }
+
+        SECTION("moving hands off queued data, ")
+        {
+            auto other = std::move(sendq);
+            REQUIRE(other.zero_copy());
+            REQUIRE(other.length() == 600);
+            REQUIRE(sendq.length() == 0);
+
+            /* Only the new owner can release the data */
+            REQUIRE(sendq.acked(channel, 600) == 0);
+            REQUIRE(channel.readable() == 1000);
+            REQUIRE(other.acked(channel, 600) == 600);
+            REQUIRE(channel.readable() == 400);
+        }
+    }
+
+    SECTION("copy, ")
+    {
+        auto sendq = tcp_send_queue(false);
+        REQUIRE(!sendq.zero_copy());
+
+        sendq.sent(channel, 600);
+        REQUIRE(sendq.length() == 0);
+        REQUIRE(channel.readable() == 400);
+        REQUIRE(sendq.unsent(channel) == 400);
+        REQUIRE(sendq.peek(channel).iov_base == channel.at(600));
+
+        /* The stack has its own copy, so acks don't touch the channel */
+        REQUIRE(sendq.acked(channel, 600) == 0);
+        REQUIRE(channel.readable() == 400);
+    }
+}